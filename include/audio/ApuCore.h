@@ -7,6 +7,7 @@
 #include "AudioTypes.h"
 #include "AudioCommandQueue.h"
 #include "AudioMusicTypes.h"
+#include "platforms/EngineConfig.h"
 
 #include <atomic>
 #include <cstdint>
@@ -32,7 +33,15 @@ namespace pixelroot32::audio {
       *                DC-blocker to remove offset + transient clicks.
       *
       * On cores without an FPU (ESP32-C3) the integer-optimised path uses
-      * `audio_mixer_lut` which is pre-fitted to the same curve.
+      * `audio_mixer_lut`, pre-fitted to the same curve and linearly
+      * interpolated between entries.
+      *
+      * With AUDIO_BLOCK_RENDER (default) each voice renders a whole
+      * MIX_BLOCK_SAMPLES chunk into a mix accumulator before the
+      * compressor/HPF pass runs over the chunk. Envelope, LFO and sweep are
+      * evaluated every AUDIO_CONTROL_RATE samples and gain / pitch are
+      * interpolated linearly in between; the per-sample renderer remains as
+      * the reference.
       */
      class ApuCore {
     public:
@@ -66,6 +75,12 @@ namespace pixelroot32::audio {
         /** @brief Compressor nonlinearity constant. */
         static constexpr float MIXER_K     = 0.5f;
 
+        /** @brief Samples per mix-accumulator chunk in the block renderer. */
+        static constexpr int MIX_BLOCK_SAMPLES = 128;
+
+        /** @brief Commands drained from the queue per batch at the start of a buffer. */
+        static constexpr size_t COMMAND_DRAIN_BATCH = 16;
+
         /** @brief Default constructor. Initializes state but does not set sample rate. */
         ApuCore();
 
@@ -94,6 +109,26 @@ namespace pixelroot32::audio {
          */
         void generateSamples(int16_t* stream, int length);
 
+        // -- Offline voice rendering (SfxCache) ---------------------------
+        /**
+         * @brief Starts @p ch for @p event at @p sampleRate, as PLAY_EVENT does for a pooled voice.
+         *
+         * Touches no ApuCore state, so it is safe to call from the game thread
+         * while the audio thread runs.
+         */
+        static void startVoice(Voice& ch, const AudioEvent& event, int sampleRate);
+
+        /**
+         * @brief Renders a lone voice at unit mix gain (full-scale int16, no compressor / HPF).
+         * @param ch Voice started with startVoice(); advanced in place.
+         * @param sampleRate Rate the voice was started at.
+         * @param out Output buffer.
+         * @param length Maximum samples to render.
+         * @return Samples written: @p length, or fewer once the voice has ended
+         *         (the last MIX_BLOCK_SAMPLES chunk may end in silence).
+         */
+        static int renderVoice(Voice& ch, int sampleRate, int16_t* out, int length);
+
         /** @brief Returns the total number of commands dropped since construction. @return Monotonic count. */
         uint32_t getDroppedCommands() const {
             return droppedCommands.load(std::memory_order_relaxed);
@@ -161,18 +196,33 @@ namespace pixelroot32::audio {
         size_t countEnabledVoicesForTesting() const;
         /** Main music track note index after sequencer run (native_test regression). */
         size_t getSequencerMainNoteIndexForTesting() const;
+        /** Switch between the block renderer and the per-sample reference renderer. */
+        void setBlockRenderForTesting(bool enabled) { blockRender_ = enabled; }
 #endif
 
     private:
         void processCommands();
+        void executeCommand(const AudioCommand& cmd);
         void updateMusicSequencer();
         void executePlayEvent(const AudioEvent& event);
         Voice* findVoiceForEvent(WaveType type);
         float generateSampleForVoice(Voice& voice);
+        void renderPerSample(int16_t* stream, int length);
+        void renderBlock(int16_t* stream, int length);
+        /** Mix accumulator for one chunk: float on FPU/native, Q15 on the no-FPU path. */
+        union MixBlock {
+            float f[MIX_BLOCK_SAMPLES];
+            int32_t q15[MIX_BLOCK_SAMPLES];
+        };
+        static void renderVoiceBlock(Voice& voice, int length, int sampleRate, MixBlock& block);
+        int16_t outputSampleFloat(float acc);
+        int16_t outputSampleQ15(int32_t sum);
 
         // -- Channels and I/O ---------------------------------------------
         Voice voices[MAX_VOICES];
         AudioCommandQueue commandQueue;
+        /** Scratch for AudioCommandQueue::drainBatch (kept off the audio task stack). */
+        AudioCommand commandBatch_[COMMAND_DRAIN_BATCH];
         std::atomic<uint32_t> droppedCommands{0};
 
         int sampleRate = 44100;
@@ -192,6 +242,10 @@ namespace pixelroot32::audio {
         int32_t hpfPrevInQ15 = 0;
         int32_t hpfPrevOutQ15 = 0;
 
+        // -- Block renderer -------------------------------------------------
+        bool blockRender_ = platforms::config::AudioBlockRender;
+        MixBlock mixBlock_;
+
         // -- Profiling ring buffer (thread-safe offload) --------------------
         ProfileEntry profileRing[PROFILE_RING_SIZE];
         uint8_t profileHead = 0;
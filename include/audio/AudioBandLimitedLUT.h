@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace pixelroot32::audio {
+
+/**
+ * @file AudioBandLimitedLUT.h
+ * @brief Mip-mapped band-limited saw and triangle wavetables for the no-FPU mixer.
+ *
+ * Used by band-limited voices (InstrumentPreset::bandLimited) on cores that mix
+ * in Q15. Level L holds one period summed from the first 64 >> L harmonics,
+ * Lanczos-windowed to tame Gibbs ripple with the fundamental kept at full
+ * amplitude, so level 0 is the full 64-harmonic shape and level 6 is a bare
+ * sine. The mixer picks the level whose top harmonic stays below Nyquist for
+ * the voice's phase increment; PULSE is built as the difference of two
+ * phase-shifted saws.
+ *
+ * Values are Q15 int16 in the same orientation as the naive generators:
+ * the saw rises from -1 to +1 over the period, the triangle is -1 at phase 0
+ * and +1 at phase 0.5. Both tables take ~7 KB of flash.
+ */
+
+/** @brief Number of mip levels per table (64, 32, ... 1 harmonics). */
+inline constexpr int BL_WAVETABLE_LEVELS = 7;
+
+/** @brief Band-limited rising saw (-1 -> +1), one period per level, Q15. */
+inline constexpr int16_t BL_SAW_Q15[BL_WAVETABLE_LEVELS][256] = {
+    { // level 0: 64 harmonics
+             0, -18007, -29309, -32706, -32019, -31191, -31183, -31152, -30746, -30373, -30219, -30031, -29702, -29402, -29201, -28974,
+        -28675, -28398, -28178, -27936, -27650, -27384, -27153, -26904, -26627, -26366, -26128, -25875, -25603, -25345, -25103, -24848,
+        -24579, -24323, -24078, -23822, -23556, -23300, -23053, -22796, -22532, -22277, -22028, -21770, -21508, -21253, -21003, -20745,
+        -20484, -20230, -19979, -19720, -19460, -19206, -18954, -18696, -18436, -18182, -17929, -17671, -17412, -17158, -16905, -16646,
+        -16387, -16134, -15880, -15622, -15363, -15110, -14855, -14597, -14339, -14085, -13831, -13572, -13315, -13061, -12806, -12548,
+        -12291, -12037, -11782, -11523, -11267, -11013, -10757, -10499, -10242,  -9988,  -9733,  -9474,  -9218,  -8964,  -8708,  -8450,
+         -8194,  -7940,  -7684,  -7426,  -7170,  -6916,  -6659,  -6401,  -6145,  -5891,  -5635,  -5377,  -5121,  -4867,  -4610,  -4352,
+         -4097,  -3843,  -3586,  -3328,  -3073,  -2818,  -2561,  -2304,  -2048,  -1794,  -1537,  -1279,  -1024,   -770,   -512,   -255,
+             0,    255,    512,    770,   1024,   1279,   1537,   1794,   2048,   2304,   2561,   2818,   3073,   3328,   3586,   3843,
+          4097,   4352,   4610,   4867,   5121,   5377,   5635,   5891,   6145,   6401,   6659,   6916,   7170,   7426,   7684,   7940,
+          8194,   8450,   8708,   8964,   9218,   9474,   9733,   9988,  10242,  10499,  10757,  11013,  11267,  11523,  11782,  12037,
+         12291,  12548,  12806,  13061,  13315,  13572,  13831,  14085,  14339,  14597,  14855,  15110,  15363,  15622,  15880,  16134,
+         16387,  16646,  16905,  17158,  17412,  17671,  17929,  18182,  18436,  18696,  18954,  19206,  19460,  19720,  19979,  20230,
+         20484,  20745,  21003,  21253,  21508,  21770,  22028,  22277,  22532,  22796,  23053,  23300,  23556,  23822,  24078,  24323,
+         24579,  24848,  25103,  25345,  25603,  25875,  26128,  26366,  26627,  26904,  27153,  27384,  27650,  27936,  28178,  28398,
+         28675,  28974,  29201,  29402,  29702,  30031,  30219,  30373,  30746,  31152,  31183,  31191,  32019,  32706,  29309,  18007,
+    },
+    { // level 1: 32 harmonics
+             0,  -9532, -18010, -24638, -29049, -31348, -32007, -31675, -30972, -30330, -29939, -29778, -29715, -29611, -29392, -29068,
+        -28703, -28369, -28103, -27897, -27709, -27497, -27240, -26946, -26642, -26358, -26107, -25881, -25659, -25420, -25156, -24875,
+        -24593, -24325, -24077, -23842, -23605, -23355, -23090, -22817, -22545, -22285, -22037, -21795, -21551, -21296, -21032, -20762,
+        -20497, -20240, -19992, -19746, -19497, -19240, -18976, -18710, -18448, -18193, -17944, -17696, -17444, -17186, -16922, -16658,
+        -16399, -16145, -15895, -15646, -15391, -15132, -14869, -14607, -14349, -14096, -13846, -13595, -13339, -13079, -12817, -12556,
+        -12300, -12047, -11796, -11543, -11287, -11026, -10765, -10506, -10250,  -9998,  -9746,  -9492,  -9234,  -8974,  -8713,  -8455,
+         -8200,  -7948,  -7695,  -7440,  -7182,  -6922,  -6662,  -6404,  -6150,  -5898,  -5645,  -5389,  -5130,  -4870,  -4610,  -4354,
+         -4100,  -3848,  -3594,  -3337,  -3078,  -2818,  -2559,  -2303,  -2050,  -1797,  -1543,  -1286,  -1026,   -766,   -508,   -253,
+             0,    253,    508,    766,   1026,   1286,   1543,   1797,   2050,   2303,   2559,   2818,   3078,   3337,   3594,   3848,
+          4100,   4354,   4610,   4870,   5130,   5389,   5645,   5898,   6150,   6404,   6662,   6922,   7182,   7440,   7695,   7948,
+          8200,   8455,   8713,   8974,   9234,   9492,   9746,   9998,  10250,  10506,  10765,  11026,  11287,  11543,  11796,  12047,
+         12300,  12556,  12817,  13079,  13339,  13595,  13846,  14096,  14349,  14607,  14869,  15132,  15391,  15646,  15895,  16145,
+         16399,  16658,  16922,  17186,  17444,  17696,  17944,  18193,  18448,  18710,  18976,  19240,  19497,  19746,  19992,  20240,
+         20497,  20762,  21032,  21296,  21551,  21795,  22037,  22285,  22545,  22817,  23090,  23355,  23605,  23842,  24077,  24325,
+         24593,  24875,  25156,  25420,  25659,  25881,  26107,  26358,  26642,  26946,  27240,  27497,  27709,  27897,  28103,  28369,
+         28703,  29068,  29392,  29611,  29715,  29778,  29939,  30330,  30972,  31675,  32007,  31348,  29049,  24638,  18010,   9532,
+    },
+    { // level 2: 16 harmonics
+             0,  -4875,  -9598, -14028, -18044, -21551, -24486, -26820, -28560, -29741, -30426, -30696, -30641, -30355, -29925, -29430,
+        -28929, -28468, -28072, -27750, -27496, -27297, -27132, -26979, -26819, -26636, -26422, -26174, -25895, -25593, -25279, -24963,
+        -24656, -24365, -24093, -23841, -23606, -23382, -23163, -22942, -22712, -22471, -22216, -21948, -21670, -21386, -21101, -20820,
+        -20547, -20283, -20029, -19784, -19544, -19308, -19070, -18828, -18579, -18323, -18059, -17789, -17516, -17242, -16970, -16703,
+        -16441, -16186, -15936, -15691, -15447, -15203, -14956, -14704, -14448, -14186, -13920, -13651, -13382, -13114, -12849, -12589,
+        -12333, -12081, -11833, -11586, -11338, -11089, -10836, -10579, -10318, -10054,  -9788,  -9521,  -9255,  -8992,  -8732,  -8476,
+         -8223,  -7973,  -7724,  -7475,  -7224,  -6971,  -6714,  -6454,  -6190,  -5925,  -5660,  -5395,  -5132,  -4873,  -4616,  -4363,
+         -4112,  -3862,  -3612,  -3361,  -3107,  -2850,  -2590,  -2328,  -2063,  -1798,  -1534,  -1272,  -1012,   -755,   -501,   -250,
+             0,    250,    501,    755,   1012,   1272,   1534,   1798,   2063,   2328,   2590,   2850,   3107,   3361,   3612,   3862,
+          4112,   4363,   4616,   4873,   5132,   5395,   5660,   5925,   6190,   6454,   6714,   6971,   7224,   7475,   7724,   7973,
+          8223,   8476,   8732,   8992,   9255,   9521,   9788,  10054,  10318,  10579,  10836,  11089,  11338,  11586,  11833,  12081,
+         12333,  12589,  12849,  13114,  13382,  13651,  13920,  14186,  14448,  14704,  14956,  15203,  15447,  15691,  15936,  16186,
+         16441,  16703,  16970,  17242,  17516,  17789,  18059,  18323,  18579,  18828,  19070,  19308,  19544,  19784,  20029,  20283,
+         20547,  20820,  21101,  21386,  21670,  21948,  22216,  22471,  22712,  22942,  23163,  23382,  23606,  23841,  24093,  24365,
+         24656,  24963,  25279,  25593,  25895,  26174,  26422,  26636,  26819,  26979,  27132,  27297,  27496,  27750,  28072,  28468,
+         28929,  29430,  29925,  30355,  30641,  30696,  30426,  29741,  28560,  26820,  24486,  21551,  18044,  14028,   9598,   4875,
+    },
+    { // level 3: 8 harmonics
+             0,  -2502,  -4982,  -7416,  -9783, -12062, -14236, -16286, -18199, -19962, -21566, -23004, -24272, -25368, -26294, -27053,
+        -27653, -28100, -28406, -28581, -28639, -28593, -28457, -28245, -27971, -27649, -27291, -26909, -26515, -26116, -25722, -25338,
+        -24969, -24620, -24292, -23985, -23701, -23437, -23191, -22960, -22743, -22534, -22331, -22130, -21928, -21722, -21510, -21290,
+        -21060, -20820, -20569, -20308, -20037, -19757, -19471, -19179, -18884, -18587, -18290, -17995, -17704, -17417, -17136, -16862,
+        -16594, -16332, -16077, -15828, -15584, -15343, -15105, -14869, -14632, -14395, -14155, -13913, -13666, -13415, -13159, -12898,
+        -12632, -12362, -12088, -11812, -11532, -11252, -10971, -10691, -10413, -10136,  -9863,  -9593,  -9327,  -9065,  -8807,  -8553,
+         -8302,  -8053,  -7807,  -7562,  -7317,  -7072,  -6825,  -6577,  -6327,  -6073,  -5816,  -5556,  -5293,  -5026,  -4756,  -4483,
+         -4209,  -3933,  -3657,  -3381,  -3106,  -2832,  -2561,  -2292,  -2026,  -1763,  -1504,  -1248,   -994,   -743,   -494,   -247,
+             0,    247,    494,    743,    994,   1248,   1504,   1763,   2026,   2292,   2561,   2832,   3106,   3381,   3657,   3933,
+          4209,   4483,   4756,   5026,   5293,   5556,   5816,   6073,   6327,   6577,   6825,   7072,   7317,   7562,   7807,   8053,
+          8302,   8553,   8807,   9065,   9327,   9593,   9863,  10136,  10413,  10691,  10971,  11252,  11532,  11812,  12088,  12362,
+         12632,  12898,  13159,  13415,  13666,  13913,  14155,  14395,  14632,  14869,  15105,  15343,  15584,  15828,  16077,  16332,
+         16594,  16862,  17136,  17417,  17704,  17995,  18290,  18587,  18884,  19179,  19471,  19757,  20037,  20308,  20569,  20820,
+         21060,  21290,  21510,  21722,  21928,  22130,  22331,  22534,  22743,  22960,  23191,  23437,  23701,  23985,  24292,  24620,
+         24969,  25338,  25722,  26116,  26515,  26909,  27291,  27649,  27971,  28245,  28457,  28593,  28639,  28581,  28406,  28100,
+         27653,  27053,  26294,  25368,  24272,  23004,  21566,  19962,  18199,  16286,  14236,  12062,   9783,   7416,   4982,   2502,
+    },
+    { // level 4: 4 harmonics
+             0,  -1330,  -2655,  -3973,  -5278,  -6568,  -7838,  -9085, -10304, -11493, -12649, -13768, -14847, -15884, -16876, -17821,
+        -18718, -19564, -20358, -21099, -21786, -22418, -22996, -23518, -23985, -24398, -24756, -25062, -25316, -25519, -25673, -25779,
+        -25840, -25858, -25833, -25770, -25670, -25535, -25369, -25173, -24950, -24703, -24434, -24146, -23841, -23522, -23190, -22849,
+        -22500, -22145, -21787, -21427, -21066, -20707, -20350, -19997, -19648, -19306, -18969, -18640, -18318, -18004, -17698, -17400,
+        -17110, -16827, -16553, -16285, -16024, -15769, -15519, -15274, -15034, -14797, -14563, -14330, -14099, -13869, -13638, -13407,
+        -13174, -12939, -12702, -12462, -12218, -11970, -11719, -11463, -11202, -10937, -10668, -10394, -10116,  -9834,  -9547,  -9257,
+         -8964,  -8668,  -8369,  -8068,  -7766,  -7463,  -7158,  -6854,  -6550,  -6246,  -5944,  -5644,  -5345,  -5049,  -4755,  -4465,
+         -4177,  -3893,  -3612,  -3335,  -3062,  -2792,  -2525,  -2262,  -2002,  -1745,  -1490,  -1238,   -988,   -740,   -492,   -246,
+             0,    246,    492,    740,    988,   1238,   1490,   1745,   2002,   2262,   2525,   2792,   3062,   3335,   3612,   3893,
+          4177,   4465,   4755,   5049,   5345,   5644,   5944,   6246,   6550,   6854,   7158,   7463,   7766,   8068,   8369,   8668,
+          8964,   9257,   9547,   9834,  10116,  10394,  10668,  10937,  11202,  11463,  11719,  11970,  12218,  12462,  12702,  12939,
+         13174,  13407,  13638,  13869,  14099,  14330,  14563,  14797,  15034,  15274,  15519,  15769,  16024,  16285,  16553,  16827,
+         17110,  17400,  17698,  18004,  18318,  18640,  18969,  19306,  19648,  19997,  20350,  20707,  21066,  21427,  21787,  22145,
+         22500,  22849,  23190,  23522,  23841,  24146,  24434,  24703,  24950,  25173,  25369,  25535,  25670,  25770,  25833,  25858,
+         25840,  25779,  25673,  25519,  25316,  25062,  24756,  24398,  23985,  23518,  22996,  22418,  21786,  21099,  20358,  19564,
+         18718,  17821,  16876,  15884,  14847,  13768,  12649,  11493,  10304,   9085,   7838,   6568,   5278,   3973,   2655,   1330,
+    },
+    { // level 5: 2 harmonics
+             0,   -768,  -1535,  -2300,  -3062,  -3821,  -4575,  -5323,  -6065,  -6800,  -7527,  -8245,  -8953,  -9650, -10336, -11010,
+        -11670, -12317, -12950, -13568, -14170, -14755, -15323, -15874, -16407, -16922, -17417, -17893, -18348, -18784, -19199, -19593,
+        -19965, -20317, -20646, -20954, -21240, -21504, -21745, -21965, -22163, -22338, -22492, -22623, -22733, -22822, -22889, -22935,
+        -22960, -22965, -22949, -22914, -22859, -22786, -22693, -22583, -22455, -22310, -22148, -21970, -21777, -21569, -21346, -21110,
+        -20860, -20598, -20324, -20038, -19742, -19436, -19120, -18796, -18464, -18124, -17777, -17423, -17065, -16701, -16332, -15960,
+        -15585, -15206, -14826, -14444, -14061, -13677, -13293, -12909, -12526, -12145, -11765, -11386, -11010, -10637, -10266,  -9899,
+         -9535,  -9175,  -8819,  -8467,  -8119,  -7775,  -7436,  -7101,  -6771,  -6446,  -6125,  -5809,  -5497,  -5190,  -4888,  -4589,
+         -4295,  -4005,  -3719,  -3437,  -3158,  -2883,  -2610,  -2341,  -2074,  -1809,  -1547,  -1286,  -1027,   -769,   -512,   -256,
+             0,    256,    512,    769,   1027,   1286,   1547,   1809,   2074,   2341,   2610,   2883,   3158,   3437,   3719,   4005,
+          4295,   4589,   4888,   5190,   5497,   5809,   6125,   6446,   6771,   7101,   7436,   7775,   8119,   8467,   8819,   9175,
+          9535,   9899,  10266,  10637,  11010,  11386,  11765,  12145,  12526,  12909,  13293,  13677,  14061,  14444,  14826,  15206,
+         15585,  15960,  16332,  16701,  17065,  17423,  17777,  18124,  18464,  18796,  19120,  19436,  19742,  20038,  20324,  20598,
+         20860,  21110,  21346,  21569,  21777,  21970,  22148,  22310,  22455,  22583,  22693,  22786,  22859,  22914,  22949,  22965,
+         22960,  22935,  22889,  22822,  22733,  22623,  22492,  22338,  22163,  21965,  21745,  21504,  21240,  20954,  20646,  20317,
+         19965,  19593,  19199,  18784,  18348,  17893,  17417,  16922,  16407,  15874,  15323,  14755,  14170,  13568,  12950,  12317,
+         11670,  11010,  10336,   9650,   8953,   8245,   7527,   6800,   6065,   5323,   4575,   3821,   3062,   2300,   1535,    768,
+    },
+    { // level 6: 1 harmonic
+             0,   -512,  -1024,  -1535,  -2045,  -2554,  -3061,  -3566,  -4070,  -4570,  -5069,  -5564,  -6055,  -6543,  -7028,  -7507,
+         -7983,  -8453,  -8919,  -9379,  -9833, -10282, -10724, -11160, -11589, -12011, -12426, -12834, -13234, -13625, -14009, -14384,
+        -14750, -15108, -15456, -15795, -16125, -16445, -16755, -17055, -17345, -17624, -17892, -18150, -18397, -18633, -18857, -19071,
+        -19272, -19462, -19641, -19807, -19962, -20104, -20235, -20353, -20459, -20553, -20634, -20703, -20760, -20804, -20835, -20854,
+        -20860, -20854, -20835, -20804, -20760, -20703, -20634, -20553, -20459, -20353, -20235, -20104, -19962, -19807, -19641, -19462,
+        -19272, -19071, -18857, -18633, -18397, -18150, -17892, -17624, -17345, -17055, -16755, -16445, -16125, -15795, -15456, -15108,
+        -14750, -14384, -14009, -13625, -13234, -12834, -12426, -12011, -11589, -11160, -10724, -10282,  -9833,  -9379,  -8919,  -8453,
+         -7983,  -7507,  -7028,  -6543,  -6055,  -5564,  -5069,  -4570,  -4070,  -3566,  -3061,  -2554,  -2045,  -1535,  -1024,   -512,
+             0,    512,   1024,   1535,   2045,   2554,   3061,   3566,   4070,   4570,   5069,   5564,   6055,   6543,   7028,   7507,
+          7983,   8453,   8919,   9379,   9833,  10282,  10724,  11160,  11589,  12011,  12426,  12834,  13234,  13625,  14009,  14384,
+         14750,  15108,  15456,  15795,  16125,  16445,  16755,  17055,  17345,  17624,  17892,  18150,  18397,  18633,  18857,  19071,
+         19272,  19462,  19641,  19807,  19962,  20104,  20235,  20353,  20459,  20553,  20634,  20703,  20760,  20804,  20835,  20854,
+         20860,  20854,  20835,  20804,  20760,  20703,  20634,  20553,  20459,  20353,  20235,  20104,  19962,  19807,  19641,  19462,
+         19272,  19071,  18857,  18633,  18397,  18150,  17892,  17624,  17345,  17055,  16755,  16445,  16125,  15795,  15456,  15108,
+         14750,  14384,  14009,  13625,  13234,  12834,  12426,  12011,  11589,  11160,  10724,  10282,   9833,   9379,   8919,   8453,
+          7983,   7507,   7028,   6543,   6055,   5564,   5069,   4570,   4070,   3566,   3061,   2554,   2045,   1535,   1024,    512,
+    },
+};
+
+/** @brief Band-limited triangle (-1 at phase 0, +1 at phase 0.5), odd harmonics only, Q15. */
+inline constexpr int16_t BL_TRIANGLE_Q15[BL_WAVETABLE_LEVELS][256] = {
+    { // level 0: 64 harmonics
+        -32287, -32139, -31753, -31250, -30728, -30217, -29709, -29195, -28681, -28170, -27659, -27146, -26633, -26121, -25610, -25097,
+        -24584, -24073, -23561, -23048, -22536, -22024, -21512, -20999, -20487, -19975, -19463, -18951, -18439, -17926, -17414, -16902,
+        -16390, -15878, -15366, -14853, -14341, -13829, -13317, -12805, -12292, -11780, -11268, -10756, -10244,  -9732,  -9219,  -8707,
+         -8195,  -7683,  -7171,  -6658,  -6146,  -5634,  -5122,  -4610,  -4097,  -3585,  -3073,  -2561,  -2049,  -1537,  -1024,   -512,
+             0,    512,   1024,   1537,   2049,   2561,   3073,   3585,   4097,   4610,   5122,   5634,   6146,   6658,   7171,   7683,
+          8195,   8707,   9219,   9732,  10244,  10756,  11268,  11780,  12292,  12805,  13317,  13829,  14341,  14853,  15366,  15878,
+         16390,  16902,  17414,  17926,  18439,  18951,  19463,  19975,  20487,  20999,  21512,  22024,  22536,  23048,  23561,  24073,
+         24584,  25097,  25610,  26121,  26633,  27146,  27659,  28170,  28681,  29195,  29709,  30217,  30728,  31250,  31753,  32139,
+         32287,  32139,  31753,  31250,  30728,  30217,  29709,  29195,  28681,  28170,  27659,  27146,  26633,  26121,  25610,  25097,
+         24584,  24073,  23561,  23048,  22536,  22024,  21512,  20999,  20487,  19975,  19463,  18951,  18439,  17926,  17414,  16902,
+         16390,  15878,  15366,  14853,  14341,  13829,  13317,  12805,  12292,  11780,  11268,  10756,  10244,   9732,   9219,   8707,
+          8195,   7683,   7171,   6658,   6146,   5634,   5122,   4610,   4097,   3585,   3073,   2561,   2049,   1537,   1024,    512,
+             0,   -512,  -1024,  -1537,  -2049,  -2561,  -3073,  -3585,  -4097,  -4610,  -5122,  -5634,  -6146,  -6658,  -7171,  -7683,
+         -8195,  -8707,  -9219,  -9732, -10244, -10756, -11268, -11780, -12292, -12805, -13317, -13829, -14341, -14853, -15366, -15878,
+        -16390, -16902, -17414, -17926, -18439, -18951, -19463, -19975, -20487, -20999, -21512, -22024, -22536, -23048, -23561, -24073,
+        -24584, -25097, -25610, -26121, -26633, -27146, -27659, -28170, -28681, -29195, -29709, -30217, -30728, -31250, -31753, -32139,
+    },
+    { // level 1: 32 harmonics
+        -31846, -31768, -31545, -31199, -30763, -30271, -29752, -29227, -28708, -28195, -27687, -27178, -26667, -26154, -25638, -25123,
+        -24610, -24098, -23587, -23076, -22563, -22049, -21536, -21022, -20509, -19997, -19485, -18973, -18460, -17947, -17433, -16920,
+        -16408, -15895, -15383, -14871, -14358, -13844, -13331, -12818, -12306, -11794, -11281, -10768, -10255,  -9742,  -9229,  -8716,
+         -8204,  -7692,  -7179,  -6666,  -6153,  -5640,  -5127,  -4614,  -4102,  -3590,  -3077,  -2564,  -2051,  -1538,  -1025,   -512,
+             0,    512,   1025,   1538,   2051,   2564,   3077,   3590,   4102,   4614,   5127,   5640,   6153,   6666,   7179,   7692,
+          8204,   8716,   9229,   9742,  10255,  10768,  11281,  11794,  12306,  12818,  13331,  13844,  14358,  14871,  15383,  15895,
+         16408,  16920,  17433,  17947,  18460,  18973,  19485,  19997,  20509,  21022,  21536,  22049,  22563,  23076,  23587,  24098,
+         24610,  25123,  25638,  26154,  26667,  27178,  27687,  28195,  28708,  29227,  29752,  30271,  30763,  31199,  31545,  31768,
+         31846,  31768,  31545,  31199,  30763,  30271,  29752,  29227,  28708,  28195,  27687,  27178,  26667,  26154,  25638,  25123,
+         24610,  24098,  23587,  23076,  22563,  22049,  21536,  21022,  20509,  19997,  19485,  18973,  18460,  17947,  17433,  16920,
+         16408,  15895,  15383,  14871,  14358,  13844,  13331,  12818,  12306,  11794,  11281,  10768,  10255,   9742,   9229,   8716,
+          8204,   7692,   7179,   6666,   6153,   5640,   5127,   4614,   4102,   3590,   3077,   2564,   2051,   1538,   1025,    512,
+             0,   -512,  -1025,  -1538,  -2051,  -2564,  -3077,  -3590,  -4102,  -4614,  -5127,  -5640,  -6153,  -6666,  -7179,  -7692,
+         -8204,  -8716,  -9229,  -9742, -10255, -10768, -11281, -11794, -12306, -12818, -13331, -13844, -14358, -14871, -15383, -15895,
+        -16408, -16920, -17433, -17947, -18460, -18973, -19485, -19997, -20509, -21022, -21536, -22049, -22563, -23076, -23587, -24098,
+        -24610, -25123, -25638, -26154, -26667, -27178, -27687, -28195, -28708, -29227, -29752, -30271, -30763, -31199, -31545, -31768,
+    },
+    { // level 2: 16 harmonics
+        -31061, -31021, -30901, -30707, -30442, -30114, -29731, -29304, -28840, -28350, -27841, -27320, -26794, -26267, -25741, -25219,
+        -24701, -24186, -23674, -23164, -22655, -22144, -21633, -21120, -20605, -20088, -19571, -19053, -18535, -18018, -17502, -16987,
+        -16472, -15959, -15446, -14933, -14420, -13906, -13392, -12876, -12361, -11844, -11328, -10812, -10296,  -9780,  -9265,  -8751,
+         -8237,  -7723,  -7210,  -6696,  -6182,  -5667,  -5152,  -4636,  -4120,  -3604,  -3088,  -2572,  -2057,  -1542,  -1028,   -514,
+             0,    514,   1028,   1542,   2057,   2572,   3088,   3604,   4120,   4636,   5152,   5667,   6182,   6696,   7210,   7723,
+          8237,   8751,   9265,   9780,  10296,  10812,  11328,  11844,  12361,  12876,  13392,  13906,  14420,  14933,  15446,  15959,
+         16472,  16987,  17502,  18018,  18535,  19053,  19571,  20088,  20605,  21120,  21633,  22144,  22655,  23164,  23674,  24186,
+         24701,  25219,  25741,  26267,  26794,  27320,  27841,  28350,  28840,  29304,  29731,  30114,  30442,  30707,  30901,  31021,
+         31061,  31021,  30901,  30707,  30442,  30114,  29731,  29304,  28840,  28350,  27841,  27320,  26794,  26267,  25741,  25219,
+         24701,  24186,  23674,  23164,  22655,  22144,  21633,  21120,  20605,  20088,  19571,  19053,  18535,  18018,  17502,  16987,
+         16472,  15959,  15446,  14933,  14420,  13906,  13392,  12876,  12361,  11844,  11328,  10812,  10296,   9780,   9265,   8751,
+          8237,   7723,   7210,   6696,   6182,   5667,   5152,   4636,   4120,   3604,   3088,   2572,   2057,   1542,   1028,    514,
+             0,   -514,  -1028,  -1542,  -2057,  -2572,  -3088,  -3604,  -4120,  -4636,  -5152,  -5667,  -6182,  -6696,  -7210,  -7723,
+         -8237,  -8751,  -9265,  -9780, -10296, -10812, -11328, -11844, -12361, -12876, -13392, -13906, -14420, -14933, -15446, -15959,
+        -16472, -16987, -17502, -18018, -18535, -19053, -19571, -20088, -20605, -21120, -21633, -22144, -22655, -23164, -23674, -24186,
+        -24701, -25219, -25741, -26267, -26794, -27320, -27841, -28350, -28840, -29304, -29731, -30114, -30442, -30707, -30901, -31021,
+    },
+    { // level 3: 8 harmonics
+        -29808, -29787, -29722, -29616, -29468, -29279, -29052, -28788, -28489, -28157, -27794, -27404, -26988, -26549, -26090, -25614,
+        -25123, -24619, -24105, -23584, -23056, -22524, -21989, -21453, -20917, -20382, -19848, -19316, -18786, -18258, -17733, -17210,
+        -16690, -16171, -15653, -15136, -14620, -14104, -13588, -13071, -12553, -12035, -11515, -10994, -10472,  -9948,  -9424,  -8899,
+         -8372,  -7846,  -7319,  -6792,  -6265,  -5739,  -5213,  -4688,  -4164,  -3641,  -3118,  -2597,  -2076,  -1557,  -1037,   -519,
+             0,    519,   1037,   1557,   2076,   2597,   3118,   3641,   4164,   4688,   5213,   5739,   6265,   6792,   7319,   7846,
+          8372,   8899,   9424,   9948,  10472,  10994,  11515,  12035,  12553,  13071,  13588,  14104,  14620,  15136,  15653,  16171,
+         16690,  17210,  17733,  18258,  18786,  19316,  19848,  20382,  20917,  21453,  21989,  22524,  23056,  23584,  24105,  24619,
+         25123,  25614,  26090,  26549,  26988,  27404,  27794,  28157,  28489,  28788,  29052,  29279,  29468,  29616,  29722,  29787,
+         29808,  29787,  29722,  29616,  29468,  29279,  29052,  28788,  28489,  28157,  27794,  27404,  26988,  26549,  26090,  25614,
+         25123,  24619,  24105,  23584,  23056,  22524,  21989,  21453,  20917,  20382,  19848,  19316,  18786,  18258,  17733,  17210,
+         16690,  16171,  15653,  15136,  14620,  14104,  13588,  13071,  12553,  12035,  11515,  10994,  10472,   9948,   9424,   8899,
+          8372,   7846,   7319,   6792,   6265,   5739,   5213,   4688,   4164,   3641,   3118,   2597,   2076,   1557,   1037,    519,
+             0,   -519,  -1037,  -1557,  -2076,  -2597,  -3118,  -3641,  -4164,  -4688,  -5213,  -5739,  -6265,  -6792,  -7319,  -7846,
+         -8372,  -8899,  -9424,  -9948, -10472, -10994, -11515, -12035, -12553, -13071, -13588, -14104, -14620, -15136, -15653, -16171,
+        -16690, -17210, -17733, -18258, -18786, -19316, -19848, -20382, -20917, -21453, -21989, -22524, -23056, -23584, -24105, -24619,
+        -25123, -25614, -26090, -26549, -26988, -27404, -27794, -28157, -28489, -28788, -29052, -29279, -29468, -29616, -29722, -29787,
+    },
+    { // level 4: 4 harmonics
+        -28152, -28139, -28102, -28041, -27955, -27845, -27711, -27554, -27373, -27169, -26943, -26695, -26426, -26136, -25826, -25496,
+        -25147, -24781, -24397, -23996, -23580, -23149, -22703, -22244, -21773, -21290, -20797, -20293, -19781, -19260, -18731, -18196,
+        -17655, -17109, -16558, -16004, -15446, -14885, -14323, -13759, -13195, -12630, -12065, -11500, -10936, -10373,  -9812,  -9252,
+         -8694,  -8137,  -7583,  -7030,  -6480,  -5931,  -5385,  -4840,  -4297,  -3756,  -3217,  -2678,  -2141,  -1605,  -1070,   -535,
+             0,    535,   1070,   1605,   2141,   2678,   3217,   3756,   4297,   4840,   5385,   5931,   6480,   7030,   7583,   8137,
+          8694,   9252,   9812,  10373,  10936,  11500,  12065,  12630,  13195,  13759,  14323,  14885,  15446,  16004,  16558,  17109,
+         17655,  18196,  18731,  19260,  19781,  20293,  20797,  21290,  21773,  22244,  22703,  23149,  23580,  23996,  24397,  24781,
+         25147,  25496,  25826,  26136,  26426,  26695,  26943,  27169,  27373,  27554,  27711,  27845,  27955,  28041,  28102,  28139,
+         28152,  28139,  28102,  28041,  27955,  27845,  27711,  27554,  27373,  27169,  26943,  26695,  26426,  26136,  25826,  25496,
+         25147,  24781,  24397,  23996,  23580,  23149,  22703,  22244,  21773,  21290,  20797,  20293,  19781,  19260,  18731,  18196,
+         17655,  17109,  16558,  16004,  15446,  14885,  14323,  13759,  13195,  12630,  12065,  11500,  10936,  10373,   9812,   9252,
+          8694,   8137,   7583,   7030,   6480,   5931,   5385,   4840,   4297,   3756,   3217,   2678,   2141,   1605,   1070,    535,
+             0,   -535,  -1070,  -1605,  -2141,  -2678,  -3217,  -3756,  -4297,  -4840,  -5385,  -5931,  -6480,  -7030,  -7583,  -8137,
+         -8694,  -9252,  -9812, -10373, -10936, -11500, -12065, -12630, -13195, -13759, -14323, -14885, -15446, -16004, -16558, -17109,
+        -17655, -18196, -18731, -19260, -19781, -20293, -20797, -21290, -21773, -22244, -22703, -23149, -23580, -23996, -24397, -24781,
+        -25147, -25496, -25826, -26136, -26426, -26695, -26943, -27169, -27373, -27554, -27711, -27845, -27955, -28041, -28102, -28139,
+    },
+    { // level 5: 2 harmonics
+        -26560, -26552, -26528, -26488, -26432, -26360, -26272, -26169, -26050, -25915, -25764, -25598, -25416, -25219, -25007, -24780,
+        -24538, -24281, -24010, -23724, -23424, -23109, -22781, -22439, -22084, -21715, -21333, -20938, -20531, -20111, -19680, -19236,
+        -18781, -18314, -17837, -17348, -16849, -16341, -15822, -15293, -14756, -14209, -13655, -13091, -12520, -11942, -11356, -10763,
+        -10164,  -9559,  -8948,  -8331,  -7710,  -7084,  -6454,  -5819,  -5182,  -4541,  -3897,  -3251,  -2603,  -1954,  -1303,   -652,
+             0,    652,   1303,   1954,   2603,   3251,   3897,   4541,   5182,   5819,   6454,   7084,   7710,   8331,   8948,   9559,
+         10164,  10763,  11356,  11942,  12520,  13091,  13655,  14209,  14756,  15293,  15822,  16341,  16849,  17348,  17837,  18314,
+         18781,  19236,  19680,  20111,  20531,  20938,  21333,  21715,  22084,  22439,  22781,  23109,  23424,  23724,  24010,  24281,
+         24538,  24780,  25007,  25219,  25416,  25598,  25764,  25915,  26050,  26169,  26272,  26360,  26432,  26488,  26528,  26552,
+         26560,  26552,  26528,  26488,  26432,  26360,  26272,  26169,  26050,  25915,  25764,  25598,  25416,  25219,  25007,  24780,
+         24538,  24281,  24010,  23724,  23424,  23109,  22781,  22439,  22084,  21715,  21333,  20938,  20531,  20111,  19680,  19236,
+         18781,  18314,  17837,  17348,  16849,  16341,  15822,  15293,  14756,  14209,  13655,  13091,  12520,  11942,  11356,  10763,
+         10164,   9559,   8948,   8331,   7710,   7084,   6454,   5819,   5182,   4541,   3897,   3251,   2603,   1954,   1303,    652,
+             0,   -652,  -1303,  -1954,  -2603,  -3251,  -3897,  -4541,  -5182,  -5819,  -6454,  -7084,  -7710,  -8331,  -8948,  -9559,
+        -10164, -10763, -11356, -11942, -12520, -13091, -13655, -14209, -14756, -15293, -15822, -16341, -16849, -17348, -17837, -18314,
+        -18781, -19236, -19680, -20111, -20531, -20938, -21333, -21715, -22084, -22439, -22781, -23109, -23424, -23724, -24010, -24281,
+        -24538, -24780, -25007, -25219, -25416, -25598, -25764, -25915, -26050, -26169, -26272, -26360, -26432, -26488, -26528, -26552,
+    },
+    { // level 6: 1 harmonic
+        -26560, -26552, -26528, -26488, -26432, -26360, -26272, -26169, -26050, -25915, -25764, -25598, -25416, -25219, -25007, -24780,
+        -24538, -24281, -24010, -23724, -23424, -23109, -22781, -22439, -22084, -21715, -21333, -20938, -20531, -20111, -19680, -19236,
+        -18781, -18314, -17837, -17348, -16849, -16341, -15822, -15293, -14756, -14209, -13655, -13091, -12520, -11942, -11356, -10763,
+        -10164,  -9559,  -8948,  -8331,  -7710,  -7084,  -6454,  -5819,  -5182,  -4541,  -3897,  -3251,  -2603,  -1954,  -1303,   -652,
+             0,    652,   1303,   1954,   2603,   3251,   3897,   4541,   5182,   5819,   6454,   7084,   7710,   8331,   8948,   9559,
+         10164,  10763,  11356,  11942,  12520,  13091,  13655,  14209,  14756,  15293,  15822,  16341,  16849,  17348,  17837,  18314,
+         18781,  19236,  19680,  20111,  20531,  20938,  21333,  21715,  22084,  22439,  22781,  23109,  23424,  23724,  24010,  24281,
+         24538,  24780,  25007,  25219,  25416,  25598,  25764,  25915,  26050,  26169,  26272,  26360,  26432,  26488,  26528,  26552,
+         26560,  26552,  26528,  26488,  26432,  26360,  26272,  26169,  26050,  25915,  25764,  25598,  25416,  25219,  25007,  24780,
+         24538,  24281,  24010,  23724,  23424,  23109,  22781,  22439,  22084,  21715,  21333,  20938,  20531,  20111,  19680,  19236,
+         18781,  18314,  17837,  17348,  16849,  16341,  15822,  15293,  14756,  14209,  13655,  13091,  12520,  11942,  11356,  10763,
+         10164,   9559,   8948,   8331,   7710,   7084,   6454,   5819,   5182,   4541,   3897,   3251,   2603,   1954,   1303,    652,
+             0,   -652,  -1303,  -1954,  -2603,  -3251,  -3897,  -4541,  -5182,  -5819,  -6454,  -7084,  -7710,  -8331,  -8948,  -9559,
+        -10164, -10763, -11356, -11942, -12520, -13091, -13655, -14209, -14756, -15293, -15822, -16341, -16849, -17348, -17837, -18314,
+        -18781, -19236, -19680, -20111, -20531, -20938, -21333, -21715, -22084, -22439, -22781, -23109, -23424, -23724, -24010, -24281,
+        -24538, -24780, -25007, -25219, -25416, -25598, -25764, -25915, -26050, -26169, -26272, -26360, -26432, -26488, -26528, -26552,
+    },
+};
+
+} // namespace pixelroot32::audio
@@ -14,17 +14,21 @@ namespace pixelroot32::audio {
     /**
      * @class AudioCommandQueue
      * @brief Multi-Producer Single-Consumer (MPSC) lock-free ring buffer for AudioCommands.
-     * 
+     *
      * Fixed-size, zero-allocation queue designed for real-time audio thread communication.
      * Supports multiple concurrent producer threads (e.g., game logic, music sequencer)
      * and a single consumer thread (the audio thread).
-     * 
+     *
      * Drop policy: When the queue is full, the newest command is silently dropped and
      * the droppedCommands counter is incremented. Callers can monitor this via
-     * getDroppedCommands() for diagnostics.
-     * 
-     * Thread-safety: Uses compare-and-swap (CAS) for atomic ring index advancement.
-     * The producer path is wait-free; the consumer path is lock-free.
+     * getDroppedCommands() for diagnostics. One slot is kept free, so at most
+     * CAPACITY - 1 commands are pending.
+     *
+     * Thread-safety: Vyukov-style ring. Each slot carries a sequence number that says
+     * whose turn it is: producers claim a position with a CAS on tail, write the slot,
+     * then publish it by bumping its sequence; the consumer only reads slots whose
+     * sequence shows a finished write, so it never sees a claimed but unwritten slot.
+     * The consumer path is wait-free; producers retry only when they race each other.
      */
     class AudioCommandQueue {
     public:
@@ -36,12 +40,18 @@ namespace pixelroot32::audio {
         #else
         static_assert(AUDIO_COMMAND_QUEUE_CAPACITY >= 128 && AUDIO_COMMAND_QUEUE_CAPACITY <= 1024,
             "AUDIO_COMMAND_QUEUE_CAPACITY must be between 128 and 1024");
+        static_assert((AUDIO_COMMAND_QUEUE_CAPACITY & (AUDIO_COMMAND_QUEUE_CAPACITY - 1)) == 0,
+            "AUDIO_COMMAND_QUEUE_CAPACITY must be a power of two");
         /** @brief User-configured queue capacity in commands. */
         static constexpr size_t CAPACITY = AUDIO_COMMAND_QUEUE_CAPACITY;
         #endif
 
-        /** @brief Default constructor. Initializes head, tail, and dropped counters to zero. */
-        AudioCommandQueue() : head(0), tail(0), droppedCommands(0) {}
+        /** @brief Default constructor. Marks every slot free for its first lap. */
+        AudioCommandQueue() : head(0), tail(0), droppedCommands(0) {
+            for (size_t i = 0; i < CAPACITY; ++i) {
+                slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
 
         /**
          * @brief Enqueues a command. Thread-safe for multiple producers.
@@ -49,51 +59,99 @@ namespace pixelroot32::audio {
          * @return true if successful, false if the queue is full (dropped).
          */
         bool enqueue(const AudioCommand& cmd) {
-            size_t currentTail = tail.load(std::memory_order_relaxed);
-            
-            do {
-                size_t nextTail = (currentTail + 1) % CAPACITY;
-                
-                if (nextTail == head.load(std::memory_order_acquire)) {
-                    // Queue full - drop newest command and increment dropped counter
+            size_t pos = tail.load(std::memory_order_relaxed);
+
+            for (;;) {
+                Slot& slot = slots[pos & MASK];
+                const intptr_t dif = (intptr_t)slot.sequence.load(std::memory_order_acquire) - (intptr_t)pos;
+
+                if (dif == 0) {
+                    // Slot is free for this lap; keep one slot spare like the original ring.
+                    if ((intptr_t)(pos - head.load(std::memory_order_acquire)) >= (intptr_t)CAPACITY - 1) {
+                        droppedCommands.fetch_add(1, std::memory_order_relaxed);
+                        return false;
+                    }
+                    if (tail.compare_exchange_weak(pos, pos + 1,
+                        std::memory_order_relaxed, std::memory_order_relaxed)) {
+                        slot.command = cmd;
+                        // Publish: the consumer waits for sequence == pos + 1.
+                        slot.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                    // CAS failed: pos now holds the current tail, retry there.
+                } else if (dif < 0) {
+                    // Slot still holds last lap's command - queue full.
                     droppedCommands.fetch_add(1, std::memory_order_relaxed);
                     return false;
+                } else {
+                    // Another producer took this position; catch up with tail.
+                    pos = tail.load(std::memory_order_relaxed);
                 }
-                
-                // Try to advance tail atomically using CAS
-                if (tail.compare_exchange_weak(currentTail, nextTail,
-                    std::memory_order_release, std::memory_order_relaxed)) {
-                    // Successfully advanced tail, now write the command
-                    buffer[currentTail] = cmd;
-                    return true;
-                }
-                // CAS failed, tail was modified by another producer, retry
-            } while (true);
+            }
         }
 
         /**
          * @brief Dequeues a command. Called from the consumer (Audio Thread).
          * @param outCmd Reference to store the dequeued command.
-         * @return true if a command was dequeued, false if the queue is empty.
+         * @return true if a command was dequeued, false if the queue is empty
+         *         (or the oldest command is still being written).
          */
         bool dequeue(AudioCommand& outCmd) {
-            size_t currentHead = head.load(std::memory_order_relaxed);
+            const size_t pos = head.load(std::memory_order_relaxed);
+            Slot& slot = slots[pos & MASK];
 
-            if (currentHead == tail.load(std::memory_order_acquire)) {
-                // Queue empty
+            if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
                 return false;
             }
 
-            outCmd = buffer[currentHead];
-            head.store((currentHead + 1) % CAPACITY, std::memory_order_release);
+            outCmd = slot.command;
+            // Hand the slot to the producer that will claim it next lap.
+            slot.sequence.store(pos + CAPACITY, std::memory_order_release);
+            head.store(pos + 1, std::memory_order_release);
             return true;
         }
 
+        /**
+         * @brief Dequeues up to maxCount commands in FIFO order, coalescing redundant ones.
+         *
+         * Repeated SET_MASTER_VOLUME, SET_MASTER_BITCRUSH, MUSIC_SET_TEMPO and
+         * MUSIC_SET_BPM commands within one drain collapse into the first one's
+         * position carrying the last one's value. Only the final value of those
+         * settings is observable, so bursts of updates cost one slot in @p out.
+         * A MUSIC_PLAY in between keeps BPM changes apart, since it anchors the
+         * sequencer with the BPM current at that point.
+         *
+         * Called from the consumer (Audio Thread).
+         * @param out Destination array of at least maxCount commands.
+         * @param maxCount Maximum commands written to @p out.
+         * @return Number of commands written to @p out (0 when the queue is empty).
+         */
+        size_t drainBatch(AudioCommand* out, size_t maxCount) {
+            size_t latest[COALESCED_KINDS] = {NONE, NONE, NONE, NONE};
+            size_t n = 0;
+
+            while (n < maxCount && dequeue(out[n])) {
+                const int kind = coalescedKind(out[n].type);
+                if (kind >= 0) {
+                    if (latest[kind] != NONE) {
+                        out[latest[kind]] = out[n];
+                        continue;
+                    }
+                    latest[kind] = n;
+                } else if (out[n].type == AudioCommandType::MUSIC_PLAY) {
+                    latest[KIND_BPM] = NONE;
+                }
+                ++n;
+            }
+            return n;
+        }
+
         /**
          * @brief Checks if the queue is empty.
          */
         bool isEmpty() const {
-            return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+            const size_t pos = head.load(std::memory_order_acquire);
+            return slots[pos & MASK].sequence.load(std::memory_order_acquire) != pos + 1;
         }
 
         /**
@@ -105,7 +163,30 @@ namespace pixelroot32::audio {
         }
 
     private:
-        AudioCommand buffer[CAPACITY];
+        static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+        static constexpr size_t MASK = CAPACITY - 1;
+
+        static constexpr size_t NONE = ~(size_t)0;
+        static constexpr int COALESCED_KINDS = 4;
+        static constexpr int KIND_BPM = 3;
+
+        /** Last-value-wins commands; -1 for commands that must all run. */
+        static int coalescedKind(AudioCommandType type) {
+            switch (type) {
+                case AudioCommandType::SET_MASTER_VOLUME:   return 0;
+                case AudioCommandType::SET_MASTER_BITCRUSH: return 1;
+                case AudioCommandType::MUSIC_SET_TEMPO:     return 2;
+                case AudioCommandType::MUSIC_SET_BPM:       return KIND_BPM;
+                default:                                    return -1;
+            }
+        }
+
+        struct Slot {
+            std::atomic<size_t> sequence;
+            AudioCommand command;
+        };
+
+        Slot slots[CAPACITY];
         std::atomic<size_t> head;
         std::atomic<size_t> tail;
         std::atomic<size_t> droppedCommands;
@@ -12,7 +12,8 @@ namespace pixelroot32::audio {
      * @brief Precalculated Look-Up Table for non-linear audio mixing.
      * Maps a sum of channels (int32_t) to a compressed result (int16_t).
      * Range: -131072 to 131071 (approx. 4 channels of 16-bit audio).
-     * Resolution: 1025 entries, index = (suma + 131072) >> 8
+     * Resolution: 1025 entries, index = (suma + 131072) >> 8; ApuCore
+     * interpolates linearly on the low 8 bits.
      *
      * Curve: LUT[i] ≈ 32767 * x / (1 + |x|*0.5) where x = sum * 1.6 / 131072.
      * This matches the FPU mixing path when each channel is pre-scaled by 0.4
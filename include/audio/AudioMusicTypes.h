@@ -149,6 +149,7 @@ struct InstrumentPreset {
     // Waveform Refinements
     bool noiseShortMode = false;   // For NOISE: true = metallic timbre (93-step LFSR)
     float dutySweep = 0.0f;        // For PULSE: duty cycle change per second
+    bool bandLimited = false;      // PULSE/TRIANGLE/SAW: band-limited oscillator (no aliasing on high notes)
 };
 
 constexpr InstrumentPreset INSTR_PULSE_LEAD{
@@ -19,7 +19,9 @@ namespace pixelroot32::audio {
         /** Band-limited sine via LUT. */
         SINE,
         /** Polyphonic saw from linear phase ramp. */
-        SAW
+        SAW,
+        /** Pre-rendered sample played back from an SfxCache (see AudioEvent::sample). */
+        PCM
     };
 
     // Voice abstraction for SNES-like dynamic pool (internal APU use).
@@ -28,7 +30,8 @@ namespace pixelroot32::audio {
         TRIANGLE,
         NOISE,
         SINE,
-        SAW
+        SAW,
+        PCM
     };
 
     constexpr VoiceType toVoiceType(WaveType waveType) {
@@ -38,6 +41,7 @@ namespace pixelroot32::audio {
             case WaveType::NOISE: return VoiceType::NOISE;
             case WaveType::SINE: return VoiceType::SINE;
             case WaveType::SAW: return VoiceType::SAW;
+            case WaveType::PCM: return VoiceType::PCM;
             default: return VoiceType::PULSE;
         }
     }
@@ -49,6 +53,7 @@ namespace pixelroot32::audio {
             case VoiceType::NOISE: return WaveType::NOISE;
             case VoiceType::SINE: return WaveType::SINE;
             case VoiceType::SAW: return WaveType::SAW;
+            case VoiceType::PCM: return WaveType::PCM;
             default: return WaveType::PULSE;
         }
     }
@@ -193,6 +198,13 @@ namespace pixelroot32::audio {
         int32_t dutySweepQ32 = 0;    // Fixed-point duty sweep
         uint16_t lfsrState = 0x4000; // NES-style 15-bit LFSR for deterministic noise
         bool noiseShortMode = false; // true = 93-step sequence (metallic), false = 32767-step
+        bool bandLimited = false;    // PULSE/TRIANGLE/SAW: PolyBLEP (float) or mip-mapped wavetables (Q15)
+
+        // PCM playback (WaveType::PCM): walks the cached sample one frame per output sample.
+        const struct SfxSample* pcmSample = nullptr;
+        uint32_t pcmPos = 0;          ///< Next frame to play.
+        int32_t adpcmPredictor = 0;   ///< IMA ADPCM decoder state.
+        int32_t adpcmIndex = 0;
 
         /** Samples until next LFSR step on NOISE; `frequency` sets noise clock rate (not pitch). */
         uint32_t noisePeriodSamples = 1;
@@ -228,6 +240,11 @@ namespace pixelroot32::audio {
             remainingSamples = 0;
             lfsrState = 0x4000; // Initialize LFSR to non-zero state
             noiseShortMode = false;
+            bandLimited = false;
+            pcmSample = nullptr;
+            pcmPos = 0;
+            adpcmPredictor = 0;
+            adpcmIndex = 0;
             noisePeriodSamples = 1;
             noiseCountdown = 0;
             sweepSamplesTotal = 0;
@@ -271,6 +288,12 @@ namespace pixelroot32::audio {
          */
         float sweepEndHz = 0.0f;
         float sweepDurationSec = 0.0f;
+
+        /**
+         * Cached sample for WaveType::PCM (see SfxCache). Must outlive playback.
+         * `volume` is the playback gain; frequency, duration and preset are ignored.
+         */
+        const struct SfxSample* sample = nullptr;
     };
 
     // --- Command Types ---
@@ -286,6 +309,7 @@ namespace pixelroot32::audio {
         MUSIC_RESUME,
         MUSIC_SET_TEMPO,
         MUSIC_SET_BPM,
+        STOP_SAMPLES,
     };
 
     // Forward declaration for MusicTrack
@@ -304,6 +328,11 @@ namespace pixelroot32::audio {
             const MusicTrack* track;
             float tempoFactor;
             float bpm;
+            /** STOP_SAMPLES: voices playing any of these table entries stop (see SfxCache::stopCommand()). */
+            struct {
+                const struct SfxSample* first;
+                uint8_t count;
+            } sampleRange;
         };
 
         // Multi-track support
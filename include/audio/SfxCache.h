@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#pragma once
+
+#include "AudioTypes.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace pixelroot32::audio {
+
+    /**
+     * @brief Storage format of a pre-rendered SFX sample.
+     *
+     * IMA ADPCM suits smooth timbres (triangle, saw, soft envelopes); the hard
+     * edges of pulse and noise smear under its 4-bit steps, so keep those PCM8.
+     */
+    enum class SfxFormat : uint8_t {
+        PCM8,      ///< Signed 8-bit, one byte per frame.
+        IMA_ADPCM  ///< 4-bit IMA ADPCM, low nibble first, decoder starts at predictor 0 / index 0.
+    };
+
+    /**
+     * @struct SfxSample
+     * @brief A pre-rendered mono sound effect played by a WaveType::PCM voice.
+     *
+     * Usually filled by SfxCache; can also describe a const array kept in flash
+     * (e.g. rendered once with SfxCache::render() and pasted into the game).
+     * Frames play back one per output sample, so `sampleRate` must match the
+     * engine's rate.
+     */
+    struct SfxSample {
+        const uint8_t* data = nullptr;
+        uint32_t length = 0;        ///< Frames (not bytes).
+        uint32_t sampleRate = 0;    ///< Rate the sample was rendered at.
+        SfxFormat format = SfxFormat::PCM8;
+    };
+
+    /** @brief IMA ADPCM quantizer step sizes. */
+    inline constexpr int16_t IMA_ADPCM_STEPS[89] = {
+        7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,    25,    28,
+        31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+        130,   143,   157,   173,   190,   209,   230,   253,   279,   307,   337,   371,   408,   449,   494,
+        544,   598,   658,   724,   796,   876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+        2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484,  7132,  7845,  8630,
+        9493,  10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+    };
+
+    /** @brief IMA ADPCM step index adjustment per nibble. */
+    inline constexpr int8_t IMA_ADPCM_INDEX_STEP[16] = {
+        -1, -1, -1, -1, 2, 4, 6, 8,
+        -1, -1, -1, -1, 2, 4, 6, 8
+    };
+
+    /**
+     * @brief Decodes one IMA ADPCM nibble.
+     * @param nibble 4-bit code.
+     * @param predictor Decoder predictor (int16 range), updated.
+     * @param index Step index (0-88), updated.
+     * @return The decoded sample (Q15).
+     */
+    inline int32_t ima_adpcm_decode(uint8_t nibble, int32_t& predictor, int32_t& index) {
+        const int32_t step = IMA_ADPCM_STEPS[index];
+        int32_t diff = step >> 3;
+        if (nibble & 4) diff += step;
+        if (nibble & 2) diff += step >> 1;
+        if (nibble & 1) diff += step >> 2;
+        predictor += (nibble & 8) ? -diff : diff;
+        if (predictor > 32767) predictor = 32767;
+        if (predictor < -32768) predictor = -32768;
+        index += IMA_ADPCM_INDEX_STEP[nibble & 15];
+        if (index < 0) index = 0;
+        if (index > 88) index = 88;
+        return predictor;
+    }
+
+    /**
+     * @class SfxCache
+     * @brief Renders frequently fired sound effects to compact PCM once, for cheap playback.
+     *
+     * Call add() during scene load for each AudioEvent (with its InstrumentPreset)
+     * that fires often, then play the returned sample with makeEvent(). Rendering runs
+     * the same oscillator / envelope / LFO code as a live voice, but only once; the
+     * PCM voice that plays it back is a pointer walk with a gain, so busy frames with
+     * many coins / jumps / hits cost a fraction of live synthesis.
+     *
+     * Memory comes from a caller-provided arena (no heap); PCM8 takes one byte per
+     * frame and IMA ADPCM half a byte. Samples stay valid until clear() or the arena
+     * is released; stop their voices with stopCommand() first.
+     *
+     * Not thread-safe: fill it from the game thread (e.g. in Scene::init).
+     */
+    class SfxCache {
+    public:
+        /** @brief Maximum cached samples per cache. */
+        static constexpr size_t MAX_SAMPLES = 16;
+
+        /**
+         * @brief Creates an empty cache over @p arena.
+         * @param arena Caller-owned storage for rendered data.
+         * @param arenaBytes Size of @p arena in bytes.
+         * @param sampleRate Engine output rate the samples are rendered at.
+         */
+        SfxCache(uint8_t* arena, size_t arenaBytes, int sampleRate);
+
+        /**
+         * @brief Renders @p event into the arena.
+         *
+         * The event is rendered at full scale (its volume is ignored; pass the
+         * playback gain to makeEvent()). Trailing silence after the release is trimmed.
+         * @return The cached sample, or nullptr when the arena or the sample table is
+         *         full, or the event cannot be cached (PCM, zero duration).
+         */
+        const SfxSample* add(const AudioEvent& event, SfxFormat format = SfxFormat::PCM8);
+
+        /**
+         * @brief Drops all samples and rewinds the arena.
+         *
+         * Does not stop playback: PCM voices still playing a cached sample keep
+         * reading the arena, and the next add() overwrites it. The caller must stop
+         * them first by submitting stopCommand() to the engine, which takes it at the
+         * start of its next buffer. The same applies before the arena is released.
+         */
+        void clear();
+
+        /**
+         * @brief Builds the command that stops every voice playing a sample of this cache.
+         *
+         * Submit it through AudioEngine::submitCommand() (or ApuCore) before clear()
+         * or before releasing the arena.
+         */
+        AudioCommand stopCommand() const;
+
+        /** @brief Number of cached samples. */
+        size_t size() const { return count; }
+        /** @brief Arena bytes in use. */
+        size_t bytesUsed() const { return used; }
+        /** @brief Total arena bytes. */
+        size_t capacityBytes() const { return arenaBytes; }
+
+        /**
+         * @brief Renders @p event to PCM into @p out without a cache.
+         *
+         * Useful for producing flash-resident samples offline.
+         * @param sample Filled with the result on success; `data` points at @p out.
+         * @return Bytes written, or 0 if the event does not fit in @p outBytes or cannot be rendered.
+         */
+        static size_t render(const AudioEvent& event, SfxFormat format, int sampleRate,
+                             uint8_t* out, size_t outBytes, SfxSample& sample);
+
+        /**
+         * @brief Builds the AudioEvent that plays @p sample.
+         * @param sample Cached sample (must outlive playback).
+         * @param volume Playback gain [0.0 - 1.0].
+         */
+        static AudioEvent makeEvent(const SfxSample* sample, float volume);
+
+    private:
+        uint8_t* arena;
+        size_t arenaBytes;
+        size_t used = 0;
+        int sampleRate;
+        SfxSample samples[MAX_SAMPLES];
+        size_t count = 0;
+    };
+
+} // namespace pixelroot32::audio
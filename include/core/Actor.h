@@ -8,7 +8,7 @@
 #include "math/Scalar.h"
 #include <cstdint>
 
-namespace pixelroot32::physics { class CollisionSystem; }
+namespace pixelroot32::physics { class CollisionSystem; class PhysicsBodyStore; }
 
 namespace pixelroot32::core {
 
@@ -47,6 +47,7 @@ public:
 
     uint16_t entityId = 0;   ///< Unique id per CollisionSystem registration; used for pair deduplication.
     int queryId = 0;                         ///< Used for optimized grid queries.
+    int16_t broadphaseProxy = -1;            ///< Index of the actor's cached cell range in its grid (-1: none).
 
     pixelroot32::physics::CollisionLayer layer = pixelroot32::physics::DefaultLayers::kNone; ///< The collision layer this actor belongs to.
     pixelroot32::physics::CollisionLayer mask  = pixelroot32::physics::DefaultLayers::kNone; ///< The collision layers this actor interacts with.
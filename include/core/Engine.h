@@ -13,6 +13,7 @@
 #include "audio/AudioEngine.h"
 #include "audio/MusicPlayer.h"
 #include "platforms/PlatformCapabilities.h"
+#include "physics/PhysicsWorker.h"
 
 #if PIXELROOT32_ENABLE_TOUCH
 #include "input/TouchEventDispatcher.h"
@@ -91,9 +92,40 @@ public:
      *
      * Infinite loop: update() each iteration; draw() and present() only when the active
      * scene's Scene::shouldRedrawFramebuffer() is true (always when PIXELROOT32_ENABLE_DEBUG_OVERLAY).
+     * With the pipelined present on, the present of frame N overlaps update() / draw() of N+1.
      */
     void run();
 
+    /**
+     * @brief Switches between sequential and pipelined present (graphics::PresentPipeline).
+     *
+     * Pipelined mode needs a driver that implements DrawSurface::presentBuffer() and exposes its
+     * sprite buffer; it allocates a second logical framebuffer. Enabled by init() when
+     * PIXELROOT32_ENABLE_PIPELINED_PRESENT is 1.
+     *
+     * @return true when pipelined present is active after the call.
+     */
+    bool setPipelinedPresent(bool enabled);
+
+    bool isPipelinedPresent() const { return presentPipeline.isRunning(); }
+
+#if PIXELROOT32_ENABLE_PHYSICS
+    /**
+     * @brief Switches the parallel physics step on or off (physics::PhysicsWorker).
+     *
+     * The worker thread is shared by every scene set afterwards through setScene(). Results are
+     * bit-identical either way. Enabled by init() when PHYSICS_PARALLEL is 1.
+     *
+     * @return true when the parallel step is active after the call (false on single-core chips).
+     */
+    bool setParallelPhysics(bool enabled);
+
+    bool isParallelPhysics() const { return physicsWorker.isRunning(); }
+#endif
+
+    /** @brief Counters of the pipelined present (zero in sequential mode). */
+    const pixelroot32::graphics::PresentPipelineStats& getPresentPipelineStats() const { return presentPipeline.getStats(); }
+
     /**
      * @brief Gets the time elapsed since the last frame.
      * @return The delta time in milliseconds.
@@ -122,7 +154,10 @@ public:
      * @brief Replaces the current renderer instance.
      * @param newRenderer R-value reference to the new Renderer to use.
      */
-    void setRenderer(pixelroot32::graphics::Renderer&& newRenderer) { renderer = std::move(newRenderer); }
+    void setRenderer(pixelroot32::graphics::Renderer&& newRenderer) {
+        setPipelinedPresent(false);
+        renderer = std::move(newRenderer);
+    }
 
     /**
      * @brief Provides access to the Renderer subsystem.
@@ -222,6 +257,10 @@ protected:
     pixelroot32::graphics::Renderer renderer;         ///< Handles all graphics rendering operations.
     pixelroot32::input::InputManager inputManager; ///< Manages user input.
     PlatformCapabilities capabilities;             ///< Hardware capabilities of the current platform.
+    pixelroot32::graphics::PresentPipeline presentPipeline; ///< Present worker of the pipelined mode (idle when sequential).
+#if PIXELROOT32_ENABLE_PHYSICS
+    pixelroot32::physics::PhysicsWorker physicsWorker;      ///< Second thread of the parallel physics step (stopped when serial).
+#endif
     
     // Touch subsystem
     #if PIXELROOT32_ENABLE_TOUCH
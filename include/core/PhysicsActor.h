@@ -115,9 +115,18 @@ protected:
      */
     void* userData = nullptr;
 
-    /** Packed physics flags: bit0=sensor, bit1=oneWay, bit2=bounce (default: bounce=true) */
+    /** Packed physics flags: bit0=sensor, bit1=oneWay, bit2=bounce (default: bounce=true), bit3=renderInterpolation */
     uint8_t physicsFlags = 0x04;
 
+    // Sleeping state, managed by CollisionSystem.
+    bool sleeping = false;
+    uint16_t restSteps = 0;    ///< Consecutive steps below CollisionSystem::MIN_VELOCITY.
+    uint16_t sleepIsland = 0;  ///< Island the body fell asleep with (0: none); woken together.
+    int16_t solverIndex = -1;  ///< Scratch index: PhysicsBodyStore slot, then island building.
+
+    friend class pixelroot32::physics::CollisionSystem;
+    friend class pixelroot32::physics::PhysicsBodyStore;
+
 public:
     /**
      * @brief Constructs a new PhysicsActor.
@@ -255,8 +264,7 @@ public:
      */
     template <typename T = float, typename std::enable_if<!std::is_same<T, pixelroot32::math::Scalar>::value, int>::type = 0>
     void setVelocity(T x, T y) {
-        velocity.x = pixelroot32::math::toScalar(x);
-        velocity.y = pixelroot32::math::toScalar(y);
+        setVelocity(pixelroot32::math::Vector2(pixelroot32::math::toScalar(x), pixelroot32::math::toScalar(y)));
     }
 
     /**
@@ -265,16 +273,16 @@ public:
      * @param y Vertical velocity.
      */
     void setVelocity(pixelroot32::math::Scalar x, pixelroot32::math::Scalar y) {
-        velocity.x = x;
-        velocity.y = y;
+        setVelocity(pixelroot32::math::Vector2(x, y));
     }
 
     /**
-     * @brief Sets the linear velocity of the actor using a Vector2.
+     * @brief Sets the linear velocity of the actor using a Vector2. A non-zero velocity wakes the body.
      * @param v Velocity vector.
      */
     void setVelocity(const pixelroot32::math::Vector2& v) {
         velocity = v;
+        if (sleeping && !v.is_zero_approx()) wakeUp();
     }
 
     /**
@@ -397,6 +405,33 @@ public:
      */
     bool isBounce() const { return (physicsFlags & 0x04) != 0; }
 
+    /**
+     * @brief Sets whether Scene::draw() draws this body between its last two physics states.
+     *
+     * Smooths motion when frames and fixed physics steps do not line up (or physics runs at a
+     * lower PHYSICS_STEP_HZ than the display), at the cost of one step of display latency.
+     * Meant for bodies moved by the physics step; bodies moved in update() should leave it off.
+     * @param enabled true = draw at getRenderPosition(); false = draw at position (default).
+     */
+    void setRenderInterpolation(bool enabled) {
+        if (enabled) physicsFlags |= 0x08;
+        else physicsFlags &= ~0x08;
+    }
+
+    /**
+     * @brief Returns true if this body is drawn at its interpolated position.
+     */
+    bool hasRenderInterpolation() const { return (physicsFlags & 0x08) != 0; }
+
+    /**
+     * @brief Position blended between the previous and the current physics step.
+     * @param alpha Blend factor in [0, 1] (physics::PhysicsScheduler::getAlpha()); 1 = position.
+     */
+    pixelroot32::math::Vector2 getRenderPosition(pixelroot32::math::Scalar alpha) const {
+        if (alpha >= pixelroot32::math::toScalar(1.0f)) return position;
+        return previousPosition + (position - previousPosition) * alpha;
+    }
+
     /**
      * @brief Updates the previous position to the current position.
      * 
@@ -421,6 +456,24 @@ public:
     void setPosition(pixelroot32::math::Vector2 pos) {
         position = pos;
         previousPosition = pos;
+        wakeUp();
+    }
+
+    /**
+     * @brief True while the body is asleep: it is not integrated and its contacts with static
+     * or sleeping bodies are skipped (no onCollision callbacks).
+     */
+    bool isSleeping() const { return sleeping; }
+
+    /**
+     * @brief Wakes the body; the rest of its island wakes at the next physics step.
+     *
+     * Non-zero setVelocity(), setPosition(), RigidActor::applyImpulse()/applyForce() and contacts
+     * with awake or kinematic bodies call this. Call it after writing `position` directly.
+     */
+    void wakeUp() {
+        sleeping = false;
+        restSteps = 0;
     }
 
     /**
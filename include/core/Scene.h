@@ -143,6 +143,21 @@ public:
      */
     virtual bool shouldRedrawFramebuffer() const { return true; }
 
+#if PIXELROOT32_ENABLE_PHYSICS
+    /**
+     * @brief Splits this scene's physics step over @p worker (nullptr: serial).
+     * Called by Engine::setScene() while the parallel physics step is on.
+     */
+    void setPhysicsWorker(pixelroot32::physics::PhysicsWorker* worker) { collisionSystem.setWorker(worker); }
+
+    /**
+     * @brief Render interpolation factor of this frame (physics::PhysicsScheduler::getAlpha()).
+     * draw() applies it to bodies with PhysicsActor::setRenderInterpolation(); custom draw code
+     * can pass it to PhysicsActor::getRenderPosition().
+     */
+    pixelroot32::math::Scalar getPhysicsAlpha() const { return physicsScheduler.getAlpha(); }
+#endif
+
     /**
      * @brief Adds an entity to the scene.
      * @param entity Pointer to the Entity to add.
@@ -16,8 +16,20 @@
 #ifndef PIXELROOT32_TFT_ESPI_LINES_PER_BLOCK_FALLBACK
 #define PIXELROOT32_TFT_ESPI_LINES_PER_BLOCK_FALLBACK 30
 #endif
+#ifndef PIXELROOT32_TFT_ESPI_PARTIAL_PRESENT
+#define PIXELROOT32_TFT_ESPI_PARTIAL_PRESENT 1
+#endif
+#ifndef PIXELROOT32_TFT_ESPI_PARTIAL_MAX_RECTS
+#define PIXELROOT32_TFT_ESPI_PARTIAL_MAX_RECTS 24
+#endif
+#ifndef PIXELROOT32_TFT_ESPI_PARTIAL_MAX_COVERAGE_PCT
+#define PIXELROOT32_TFT_ESPI_PARTIAL_MAX_COVERAGE_PCT 60
+#endif
 
 #include "graphics/BaseDrawSurface.h"
+#include "graphics/DirtyGrid.h"
+#include "graphics/FramebufferFormat.h"
+#include "graphics/PresentKernels.h"
 // TFT_eSPI-specific includes
 #include <TFT_eSPI.h>
 #include <stdint.h>
@@ -87,10 +99,32 @@ public:
     /**
      * @brief Get pointer to sprite buffer for direct manipulation.
      * 
-     * @return Pointer to 8bpp sprite buffer, or nullptr if sprite not created
+     * @return Pointer to the sprite buffer (RGB332 bytes, or panel-order RGB565 words when
+     *         @c PIXELROOT32_FRAMEBUFFER_BPP is 16), or nullptr if sprite not created
      */
     uint8_t* getSpriteBuffer() override;
 
+    /**
+     * @brief Receives the Renderer's dirty cells for the next sendBuffer().
+     *
+     * With @c PIXELROOT32_TFT_ESPI_PARTIAL_PRESENT, only the changed windows are converted
+     * and pushed; nullptr (or too many / too large windows) pushes the full frame.
+     */
+    void setPresentDirtyGrid(const pixelroot32::graphics::DirtyGrid* grid) override;
+
+    /** @brief Converts and pushes an external framebuffer (graphics::PresentPipeline's present copy). */
+    bool supportsBufferPresent() const override { return true; }
+
+    /**
+     * @brief Pushes @p framebuffer (same layout as the sprite buffer) through the same
+     * partial / full DMA path as sendBuffer(). Safe to call from another core while the
+     * sprite buffer is being drawn: indexed colours come from @p paletteLUT, never the palette banks.
+     */
+    void presentBuffer(const uint8_t* framebuffer,
+                       const pixelroot32::graphics::DirtyRect* rects,
+                       uint16_t rectCount,
+                       const uint16_t* paletteLUT) override;
+
     /**
      * @brief Processes system events. Always true for embedded.
      */
@@ -106,7 +140,11 @@ private:
     uint8_t currentBuffer = 0;                    ///< Current buffer index (0 or 1)
     uint16_t* xLUT = nullptr;        ///< Lookup table for X scaling (physical -> logical)
     uint16_t* yLUT = nullptr;        ///< Lookup table for Y scaling (physical -> logical)
-    uint16_t* paletteLUT = nullptr;  ///< Pre-calculated 8bpp to 16bpp palette LUT
+    uint16_t* paletteLUT = nullptr;  ///< Pre-calculated 8bpp to 16bpp palette LUT (palette-slot indices when indexed)
+    uint32_t paletteLUTGeneration = 0; ///< Palette generation paletteLUT was built from (indexed framebuffer)
+
+    const pixelroot32::graphics::DirtyGrid* presentDirtyGrid = nullptr; ///< Set by Renderer::endFrame() for one present
+    pixelroot32::graphics::DirtyRect presentRects[PIXELROOT32_TFT_ESPI_PARTIAL_MAX_RECTS]; ///< Logical windows to push
     
     /**
      * @brief Checks if scaling is needed.
@@ -120,6 +158,18 @@ private:
      * @brief Builds the X and Y scaling lookup tables.
      */
     void buildScaleLUTs();
+
+    /**
+     * @brief Indexed framebuffer: rebuilds paletteLUT from the palette slot banks when they changed.
+     * Game thread only (sendBuffer / init); presentBuffer() uses loadIndexedPaletteLUT().
+     * @param force Rebuild even if the palette generation is unchanged.
+     */
+    void refreshIndexedPaletteLUT(bool force);
+
+    /**
+     * @brief Indexed framebuffer: converts an RGB565 table (buildIndexedPaletteLUT() layout) into paletteLUT.
+     */
+    void loadIndexedPaletteLUT(const uint16_t* rgb565);
     
     /**
      * @brief Frees scaling-related memory.
@@ -127,14 +177,24 @@ private:
     void freeScalingBuffers();
 
     /**
-     * @brief Sends the buffer using hardware DMA and software scaling.
+     * @brief Sends @p spritePtr using hardware DMA and software scaling.
+     * @param partial   presentRects holds @p rectCount windows describing every change since
+     *                  the last present; false pushes the full frame.
+     */
+    void sendBufferScaled(const uint8_t* spritePtr, bool partial, uint16_t rectCount);
+
+    /**
+     * @brief Pushes only the windows in presentRects (partial present).
+     * @param rectCount Number of valid entries in presentRects.
      */
-    void sendBufferScaled();
+    void sendDirtyRectsScaled(const uint8_t* spritePtr, uint16_t rectCount);
 
     /**
-     * @brief Scales a single line from 8bpp logical to 16bpp physical.
+     * @brief Converts physical rows [physY0, physY1) of a window starting at physX0 (width physW)
+     * into @p dst via the graphics::present row kernels (1:1 / 2x / LUT). Shared by the
+     * full-frame and partial present paths.
      */
-    void scaleLine(const uint8_t* spriteBase, int srcY, uint16_t* dst);
+    void scaleWindowBlock(const uint8_t* spriteBase, int physX0, int physW, int physY0, int physY1, uint16_t* dst);
 };
 
 } // namespace pixelroot32::drivers::esp32
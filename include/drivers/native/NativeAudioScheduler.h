@@ -10,6 +10,8 @@
 #include "audio/ApuCore.h"
 
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -25,9 +27,21 @@ namespace pixelroot32::audio {
      * a lock-free ring, mirroring the dual-core ESP32 behaviour. All
      * synthesis / sequencer logic lives in ApuCore; this class owns only
      * threading and the ring buffer.
+     *
+     * The ring is single-producer (audio thread) / single-consumer (SDL
+     * callback), power-of-two sized, and hands out contiguous spans so ApuCore
+     * renders straight into it. The producer sleeps on a condition variable
+     * until the consumer drains the ring below the target latency.
+     *
+     * The target latency adapts: every underrun (callback finds fewer samples
+     * than it needs) raises it by one block, and a long enough run without
+     * underruns lowers it by MIX_BLOCK_SAMPLES, down to one block.
      */
     class NativeAudioScheduler : public AudioScheduler {
     public:
+        /**
+         * @param ringBufferSize Ring capacity in samples, rounded up to a power of two.
+         */
         explicit NativeAudioScheduler(size_t ringBufferSize = 4096);
         ~NativeAudioScheduler() override;
 
@@ -45,24 +59,57 @@ namespace pixelroot32::audio {
         const ApuCore& core() const { return apu; }
         ApuCore& core() { return apu; }
 
+        /** @brief Ring capacity in samples (power of two). */
+        size_t getRingCapacity() const { return rbCapacity; }
+
+        /** @brief Samples the producer currently keeps buffered ahead of the callback. */
+        size_t getTargetLatencySamples() const { return targetLatency.load(std::memory_order_relaxed); }
+
+        /** @brief Samples rendered and not yet consumed. */
+        size_t getBufferedSamples() const { return rbAvailableToRead(); }
+
+        /**
+         * @brief Number of callbacks that found the ring short and padded with silence.
+         *
+         * Start-up, before the ring first reaches the target, is not counted.
+         */
+        size_t getUnderrunCount() const { return underruns.load(std::memory_order_relaxed); }
+
     private:
+        /** Underrun-free audio (in seconds) before the target latency steps down. */
+        static constexpr int LATENCY_DECAY_SECONDS = 2;
+
         ApuCore apu;
 
         std::thread audioThread;
         std::atomic<bool> running{false};
+        std::mutex wakeMutex;
+        std::condition_variable wakeCv;
 
         std::vector<int16_t> ringBuffer;
+        size_t rbCapacity;
+        size_t rbMask;
+        // Monotonic positions; the slot is pos & rbMask, fill is write - read.
         std::atomic<size_t> rbReadPos{0};
         std::atomic<size_t> rbWritePos{0};
-        size_t rbCapacity;
         int blockSize = 256;
+        int sampleRate = 22050;
+
+        std::atomic<size_t> targetLatency{0};
+        std::atomic<size_t> underruns{0};
+        std::atomic<bool> primed{false};   // ring reached the target once since start()
+        size_t cleanSamples = 0;           // consumer only: samples since the last underrun
 
         void threadLoop();
+        void adaptLatency(bool shortRead, size_t consumed);
 
         size_t rbAvailableToRead() const;
-        size_t rbAvailableToWrite() const;
-        void rbWrite(const int16_t* data, size_t count);
-        void rbRead(int16_t* data, size_t count);
+        /** Contiguous writable span at the write position; @p count receives its length. */
+        int16_t* rbWriteSpan(size_t& count);
+        void rbCommitWrite(size_t count);
+        /** Contiguous readable span at the read position; @p count receives its length. */
+        const int16_t* rbReadSpan(size_t& count) const;
+        void rbCommitRead(size_t count);
     };
 
 } // namespace pixelroot32::audio
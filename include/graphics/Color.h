@@ -276,4 +276,46 @@ uint16_t resolveColor(Color color);
  */
 uint16_t resolveColor(Color color, PaletteContext context);
 
+// -----------------------------------------------------------------------------
+// Indexed framebuffer (PIXELROOT32_FRAMEBUFFER_INDEXED)
+// -----------------------------------------------------------------------------
+//
+// The framebuffer stores one byte per pixel that names a palette slot entry
+// instead of a colour: bit 7 = sprite bank, bits 4-6 = slot, bits 0-3 = Color
+// index. The driver resolves it through a 256-entry LUT that is rebuilt only
+// when getPaletteGeneration() changes, so palette swaps (fades, flashes) cost
+// 256 writes instead of a redraw. Slot 0 resolves through the slot bank; in
+// single palette mode use setPalette()/setCustomPalette(), which keep it in sync.
+
+/**
+ * @brief Framebuffer index for @p color in palette @p slot of the given bank.
+ * Out-of-range colours (e.g. Color::Transparent) map to index 0; slots >= 8 fall back to slot 0.
+ */
+constexpr uint8_t paletteSlotIndex(PaletteContext context, uint8_t slot, Color color) {
+    const uint8_t idx = static_cast<uint8_t>(color);
+    if (idx >= PALETTE_SIZE) {
+        return 0;
+    }
+    return static_cast<uint8_t>((context == PaletteContext::Sprite ? 0x80u : 0u) |
+                                ((slot < 8 ? slot : 0u) << 4) | idx);
+}
+
+/**
+ * @brief Monotonic counter bumped by every palette, slot or palette-mode change.
+ */
+uint32_t getPaletteGeneration();
+
+/**
+ * @brief Bumps the palette generation after editing a custom palette in place
+ * (the engine does not copy custom palettes, so it cannot see such writes).
+ */
+void markPalettesChanged();
+
+/**
+ * @brief Fills @p out[256] with the RGB565 colour of every paletteSlotIndex().
+ * @param out Destination table of 256 entries.
+ */
+void buildIndexedPaletteLUT(uint16_t* out);
+
 }
+
@@ -9,6 +9,17 @@
 
 namespace pixelroot32::graphics {
 
+/**
+ * @struct DirtyRect
+ * @brief Axis-aligned rectangle in logical pixels produced by DirtyGrid::collectPresentRects().
+ */
+struct DirtyRect {
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+};
+
 /**
  * @class DirtyGrid
  * @brief Two-buffer dirty cell grid (8×8 px cells) for selective framebuffer clears.
@@ -54,6 +65,18 @@ public:
      */
     void markRect(int x, int y, int w, int h);
 
+    /**
+     * @brief Bytes of a cell mask in the layout markCells() takes: one row of
+     *        (cols + 7) / 8 bytes per cell row, bit (cx & 7) of byte (cx >> 3).
+     */
+    size_t cellMaskBytes() const { return byteCount; }
+
+    /**
+     * @brief ORs a cell mask (cellMaskBytes() bytes, see there) into the current frame.
+     * @param mask Cells to mark; bits past the last column are ignored.
+     */
+    void markCells(const uint8_t* mask);
+
     /**
      * @brief Checks if a cell was marked dirty in the previous frame.
      * @param cx Cell X coordinate.
@@ -123,17 +146,64 @@ public:
     bool isCurrMarked(uint8_t cx, uint8_t cy) const;
 
     /**
-     * Zeros 8×8 regions in an 8bpp linear framebuffer for each cell set in `prev`.
+     * @brief Marks a cell as fully repainted by opaque content this frame.
+     *
+     * Covered cells are skipped by clearFramebuffer8FromPrev() / clearFramebuffer16FromPrev():
+     * whatever they held is overwritten anyway. Cleared by swapAndClear().
+     */
+    void markCovered(uint8_t cx, uint8_t cy);
+
+    /** @brief True when markCovered() was called for this cell since the last swapAndClear() / clearCovered(). */
+    bool isCovered(uint8_t cx, uint8_t cy) const;
+
+    /** @brief Drops all covered marks. */
+    void clearCovered();
+
+    /** @brief Cells set in `prev` that are also covered (their clear is skipped). */
+    uint32_t countPrevCoveredCells() const;
+
+    /**
+     * Zeros 8×8 regions in an 8bpp linear framebuffer for each cell set in `prev` and not covered.
      * Merges contiguous dirty cells per scanline into single horizontal memsets.
      * @param framebufferWidth Row stride in bytes (typically logical width).
      */
     void clearFramebuffer8FromPrev(uint8_t* fb, int framebufferWidth, int framebufferHeight, uint8_t fillByte) const;
 
+    /**
+     * Same as clearFramebuffer8FromPrev() for a 16bpp (RGB565) framebuffer.
+     * @param framebufferWidth Row stride in pixels.
+     */
+    void clearFramebuffer16FromPrev(uint16_t* fb, int framebufferWidth, int framebufferHeight, uint16_t fillWord) const;
+
+    /**
+     * @brief Builds the set of rectangles that changed on screen this frame (`prev` ∪ `curr`).
+     *
+     * Cells cleared at beginFrame (`prev`) and cells drawn this frame (`curr`) are merged into
+     * horizontal runs per cell row; runs separated by at most @p mergeGapCells clean cells are
+     * joined, and runs with identical column span on consecutive rows are merged into one rect.
+     *
+     * @param out           Destination array for rects in logical pixels.
+     * @param maxRects      Capacity of @p out.
+     * @param outCount      Number of rects written (0 when nothing changed).
+     * @param screenW       Logical framebuffer width.
+     * @param screenH       Logical framebuffer height.
+     * @param mergeGapCells Maximum clean-cell gap bridged inside one row.
+     * @return false when the result cannot describe the frame (capacity exceeded, full-dirty
+     *         state, or a screen size that is not a multiple of the cell size) — present the full frame.
+     */
+    bool collectPresentRects(DirtyRect* out,
+                             uint16_t maxRects,
+                             uint16_t& outCount,
+                             int screenW,
+                             int screenH,
+                             uint8_t mergeGapCells = 1) const;
+
 private:
     uint8_t  cols = 0;
     uint8_t  rows = 0;
     uint8_t* prev = nullptr;
     uint8_t* curr = nullptr;
+    uint8_t* covered = nullptr;  ///< Cells fully repainted by opaque content this frame.
     bool     fullDirty = false;
     size_t   byteCount = 0;
     uint32_t currMarkedCount_ = 0;  ///< Running count of bits set in curr.
@@ -144,6 +214,8 @@ private:
     void            setBit(uint8_t* buf, uint8_t cx, uint8_t cy);
     bool            getBit(const uint8_t* buf, uint8_t cx, uint8_t cy) const;
     static uint32_t popcountBuffer(const uint8_t* buf, size_t nbytes);
+    template <typename T>
+    void clearFramebufferFromPrevImpl(T* fb, int framebufferWidth, int framebufferHeight, T fill) const;
 };
 
 }  // namespace pixelroot32::graphics
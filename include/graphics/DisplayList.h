@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "Color.h"
+#include "Font.h"
+
+namespace pixelroot32::graphics {
+
+/**
+ * @enum DrawCommandType
+ * @brief Kind of a recorded Renderer draw call.
+ */
+enum class DrawCommandType : uint8_t {
+    Sprite1bpp,
+    Sprite2bpp,
+    Sprite4bpp,
+    FilledRect,
+    Text,
+    TileRun1bpp,
+    TileRun2bpp,
+    TileRun4bpp
+};
+
+/**
+ * @struct DrawCommand
+ * @brief Compact recorded draw call, in screen space (display offsets already applied).
+ *
+ * Sprite descriptors and text are copied; pixel data, palettes, fonts and tilemaps are
+ * referenced and must stay valid until the list is executed (Renderer::endFrame()).
+ */
+struct DrawCommand {
+    static constexpr uint8_t kFlagFlipX      = 0x01;
+    static constexpr uint8_t kFlagStatic     = 0x02; ///< Tile run of a LayerType::Static map.
+    static constexpr uint8_t kFlagBackground = 0x04; ///< Recorded under PaletteContext::Background.
+
+    DrawCommandType type;
+    uint8_t         layer;       ///< Sort key set by Renderer::setDrawLayer().
+    uint8_t         flags;
+    uint8_t         paletteSlot; ///< Resolved sprite palette slot (2bpp/4bpp sprites).
+    int32_t         x;           ///< Draw position (tile runs: view origin of the map).
+    int32_t         y;
+    int16_t         w;           ///< Rect / text size; sprite size for sprites.
+    int16_t         h;
+
+    union {
+        struct {
+            const uint16_t* data;
+            Color           color;
+        } sprite1;
+        struct {
+            const uint8_t* data;
+            const Color*   palette;
+            uint8_t        paletteSize;
+        } spriteN;
+        struct {
+            uint16_t surfaceColor; ///< Already resolved for the DrawSurface.
+        } rect;
+        struct {
+            const Font* font;
+            uint16_t    textOffset; ///< Into the list's text arena.
+            uint8_t     length;
+            uint8_t     size;
+            Color       color;
+        } text;
+        struct {
+            const void* map;        ///< TileMap / TileMap2bpp / TileMap4bpp, per type.
+            uint8_t     rowBegin;   ///< Tile rows [rowBegin, rowEnd) to draw.
+            uint8_t     rowEnd;
+            uint8_t     tileWidth;
+            uint8_t     tileHeight;
+            uint8_t     colBegin;   ///< Visible tile columns, for bounds only.
+            uint8_t     colEnd;
+            Color       color;      ///< 1bpp maps only.
+        } tiles;
+    };
+
+    /** Screen-space bounds [x0, x1) x [y0, y1) of the pixels this command may touch. */
+    void bounds(int& x0, int& y0, int& x1, int& y1) const;
+};
+
+/**
+ * @struct DisplayListStats
+ * @brief Per-frame counters of the recorded rendering mode (reset by Renderer::beginFrame()).
+ */
+struct DisplayListStats {
+    uint32_t recorded = 0;        ///< Commands appended.
+    uint32_t culled = 0;          ///< Commands dropped (off-viewport, or static tile runs over clean cells).
+    uint32_t merged = 0;          ///< Commands folded into a neighbour (adjacent rects, tile runs).
+    uint32_t executed = 0;        ///< Commands replayed.
+    uint32_t overflowFlushes = 0; ///< Early flushes because the arena was full.
+    uint32_t occluded = 0;        ///< Commands dropped because later opaque rects / tile runs hide them.
+    uint32_t bytesSaved = 0;      ///< Framebuffer bytes not written: skipped clears of covered cells plus occluded commands.
+    uint32_t discarded = 0;       ///< Commands of the previous frame dropped here because it never reached endFrame().
+};
+
+/**
+ * @class DisplayList
+ * @brief Fixed-capacity command arena for Renderer's recorded mode.
+ *
+ * Commands and copied text live in two buffers allocated once (allocate()); recording never
+ * touches the heap. Before execution the list is ordered (sortByLayerAndPalette()) and
+ * compacted (mergeAdjacent()).
+ */
+class DisplayList {
+public:
+    DisplayList() = default;
+    ~DisplayList();
+
+    DisplayList(DisplayList&& other) noexcept;
+    DisplayList& operator=(DisplayList&& other) noexcept;
+
+    DisplayList(const DisplayList&) = delete;
+    DisplayList& operator=(const DisplayList&) = delete;
+
+    /**
+     * @brief Allocates room for @p commandCapacity commands and @p textCapacity text bytes.
+     * @return false on invalid capacity or allocation failure (the list is then empty).
+     */
+    [[nodiscard]] bool allocate(std::size_t commandCapacity, std::size_t textCapacity);
+
+    /** Frees both buffers. */
+    void release();
+
+    bool isAllocated() const { return commands != nullptr; }
+
+    /** Drops all recorded commands and text. */
+    void clear() {
+        count = 0;
+        textUsed = 0;
+    }
+
+    /** @return Slot for a new command, or nullptr when the arena is full. */
+    DrawCommand* append() {
+        return count < commandCapacity ? &commands[count++] : nullptr;
+    }
+
+    /**
+     * @brief Copies @p text (at most 255 bytes) into the text arena.
+     * @return Offset of the copy, or -1 when it does not fit.
+     */
+    int appendText(std::string_view text);
+
+    std::string_view text(const DrawCommand& cmd) const {
+        return std::string_view(textBytes + cmd.text.textOffset, cmd.text.length);
+    }
+
+    std::size_t size() const { return count; }
+    std::size_t capacity() const { return commandCapacity; }
+
+    DrawCommand& operator[](std::size_t i) { return commands[i]; }
+    const DrawCommand& operator[](std::size_t i) const { return commands[i]; }
+
+    /**
+     * @brief Stable sort by layer, then moves 2bpp/4bpp sprites next to an earlier sprite with
+     * the same palette and slot when no command in between overlaps them (so the paint order of
+     * overlapping pixels never changes). Runs of same-palette sprites share one palette LUT.
+     */
+    void sortByLayerAndPalette();
+
+    /**
+     * @brief Folds consecutive same-colour filled rects whose union is a rectangle, and
+     * consecutive runs of the same tilemap whose rows touch or overlap.
+     * @return Number of commands removed.
+     */
+    std::size_t mergeAdjacent();
+
+    /** Removes command @p i, keeping the order of the rest. */
+    void erase(std::size_t i);
+
+private:
+    DrawCommand* commands = nullptr;
+    char*        textBytes = nullptr;
+    std::size_t  commandCapacity = 0;
+    std::size_t  textCapacity = 0;
+    std::size_t  count = 0;
+    std::size_t  textUsed = 0;
+};
+
+} // namespace pixelroot32::graphics
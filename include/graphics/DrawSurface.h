@@ -8,6 +8,9 @@
 
 namespace pixelroot32::graphics {
 
+class DirtyGrid;
+struct DirtyRect;
+
 /**
  * @class DrawSurface
  * @brief Abstract interface for platform-specific drawing operations.
@@ -132,12 +135,51 @@ public:
      * Default implementation returns nullptr.
      * Override in drivers that support direct buffer access.
      * 
-     * @return Pointer to 8bpp sprite buffer, or nullptr if not supported
+     * @return Pointer to the sprite buffer (layout per graphics::FramebufferPixel), or nullptr if not supported
      */
     virtual uint8_t* getSpriteBuffer() {
         return nullptr;
     }
 
+    /**
+     * @brief Hands the renderer's dirty-cell state to the driver right before sendBuffer().
+     * 
+     * Drivers that can push partial windows (e.g., TFT_eSPI) may present only the cells
+     * changed this frame (previous ∪ current marks). nullptr means the whole frame must be sent.
+     * Default implementation ignores it.
+     * 
+     * @param grid Dirty grid valid until sendBuffer() returns, or nullptr
+     */
+    virtual void setPresentDirtyGrid(const DirtyGrid* grid) {
+        (void)grid;
+    }
+
+    /**
+     * @brief Whether presentBuffer() is implemented (required by graphics::PresentPipeline).
+     */
+    virtual bool supportsBufferPresent() const {
+        return false;
+    }
+
+    /**
+     * @brief Presents a framebuffer other than the sprite buffer.
+     * 
+     * Called by graphics::PresentPipeline from its worker thread / core while the next frame
+     * is drawn into the sprite buffer, so implementations must only touch @p framebuffer and
+     * the display bus. Default implementation ignores it.
+     * 
+     * @param framebuffer Pixels in the sprite buffer layout (graphics::FramebufferPixel)
+     * @param rects       Logical windows that changed since the previous present, or nullptr for the full frame
+     * @param rectCount   Number of entries in @p rects
+     * @param paletteLUT  Indexed framebuffer: RGB565 per framebuffer index (buildIndexedPaletteLUT() layout),
+     *                    snapshotted by the producer, when the palette changed since the previous present;
+     *                    nullptr keeps the current colours. Implementations must not read the palette banks.
+     */
+    virtual void presentBuffer(const uint8_t* framebuffer, const DirtyRect* rects, uint16_t rectCount,
+                               const uint16_t* paletteLUT) {
+        (void)framebuffer; (void)rects; (void)rectCount; (void)paletteLUT;
+    }
+
     /**
      * @brief Sets the display contrast/brightness.
      * @param level Contrast level (0-255).
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "platforms/EngineConfig.h"
+
+namespace pixelroot32::graphics {
+
+/**
+ * @brief Element type of the logical framebuffer exposed by DrawSurface::getSpriteBuffer().
+ *
+ * - 8bpp (default): TFT_eSprite RGB332 bytes.
+ * - 16bpp (`PIXELROOT32_FRAMEBUFFER_BPP=16`): RGB565 words stored byte-swapped
+ *   (panel order), exactly as TFT_eSprite keeps them at color depth 16.
+ */
+using FramebufferPixel = std::conditional_t<pixelroot32::platforms::config::Framebuffer16Bpp, uint16_t, uint8_t>;
+
+/**
+ * @brief Emulates TFT_eSPI 8bpp sprite packing (RGB332).
+ */
+inline uint8_t packRgb565ToTftSprite8(uint16_t rgb565) {
+    return static_cast<uint8_t>(
+        ((rgb565 & 0xE000) >> 8) |
+        ((rgb565 & 0x0700) >> 6) |
+        ((rgb565 & 0x0018) >> 3));
+}
+
+/**
+ * @brief RGB565 value that packRgb565ToTftSprite8() maps back to exactly @p value.
+ *
+ * Lets an indexed framebuffer byte travel through the RGB565 DrawSurface primitives unchanged.
+ */
+constexpr uint16_t rgb565CarrierForTftSprite8(uint8_t value) {
+    return static_cast<uint16_t>(((value & 0xE0u) << 8) | ((value & 0x1Cu) << 6) | ((value & 0x03u) << 3));
+}
+
+/**
+ * @brief RGB565 as stored by a 16bpp TFT_eSprite (bytes swapped for the SPI bus).
+ */
+inline uint16_t packRgb565ToTftSprite16(uint16_t rgb565) {
+    return static_cast<uint16_t>((rgb565 >> 8) | (rgb565 << 8));
+}
+
+/**
+ * @brief Packs a resolved RGB565 colour into the active framebuffer format.
+ */
+inline FramebufferPixel packRgb565ToFramebuffer(uint16_t rgb565) {
+    if constexpr (pixelroot32::platforms::config::Framebuffer16Bpp) {
+        return packRgb565ToTftSprite16(rgb565);
+    } else {
+        return packRgb565ToTftSprite8(rgb565);
+    }
+}
+
+/**
+ * @brief Fills @p count framebuffer pixels starting at @p dst.
+ */
+inline void fillFramebufferSpan(FramebufferPixel* dst, FramebufferPixel value, int count) {
+    if constexpr (sizeof(FramebufferPixel) == 1) {
+        std::memset(dst, value, static_cast<size_t>(count));
+    } else {
+        for (int i = 0; i < count; ++i) {
+            dst[i] = value;
+        }
+    }
+}
+
+/**
+ * @namespace pixelroot32::graphics::present
+ * @brief Row kernels turning logical framebuffer rows into panel-order RGB565 for DMA.
+ *
+ * Overloaded on the source pixel type so both framebuffer formats can be exercised
+ * (and benchmarked) natively regardless of the configured one. @p lut is the 256-entry
+ * RGB332 → panel RGB565 table; it is ignored for 16bpp sources. The 8bpp overloads are the
+ * scalar reference for the pluggable kernel sets in PresentKernels.h.
+ */
+namespace present {
+
+/// 1:1 row. @p dst must be 4-byte aligned.
+inline void convertRow(const uint8_t* src, uint16_t* dst, int n, const uint16_t* lut) {
+    const uint16_t* __restrict pLUT = lut;
+    uint32_t* dst32 = reinterpret_cast<uint32_t*>(dst);
+    int x = 0;
+    for (; x <= n - 8; x += 8) {
+        dst32[x/2]     = (static_cast<uint32_t>(pLUT[src[x+1]]) << 16) | pLUT[src[x]];
+        dst32[x/2 + 1] = (static_cast<uint32_t>(pLUT[src[x+3]]) << 16) | pLUT[src[x+2]];
+        dst32[x/2 + 2] = (static_cast<uint32_t>(pLUT[src[x+5]]) << 16) | pLUT[src[x+4]];
+        dst32[x/2 + 3] = (static_cast<uint32_t>(pLUT[src[x+7]]) << 16) | pLUT[src[x+6]];
+    }
+    for (; x < n; ++x) {
+        dst[x] = pLUT[src[x]];
+    }
+}
+
+/// 1:1 row from a 16bpp framebuffer: already panel order, plain copy.
+inline void convertRow(const uint16_t* src, uint16_t* dst, int n, const uint16_t* lut) {
+    (void)lut;
+    std::memcpy(dst, src, static_cast<size_t>(n) * sizeof(uint16_t));
+}
+
+/// 2x horizontal duplicate of @p srcN pixels into 2 * srcN. @p dst must be 4-byte aligned.
+inline void convertRow2x(const uint8_t* src, uint16_t* dst, int srcN, const uint16_t* lut) {
+    const uint16_t* __restrict pLUT = lut;
+    uint32_t* dst32 = reinterpret_cast<uint32_t*>(dst);
+    for (int lx = 0; lx < srcN; ++lx) {
+        const uint32_t color = pLUT[src[lx]];
+        dst32[lx] = (color << 16) | color;
+    }
+}
+
+/// 2x horizontal duplicate from a 16bpp framebuffer. @p dst must be 4-byte aligned.
+inline void convertRow2x(const uint16_t* src, uint16_t* dst, int srcN, const uint16_t* lut) {
+    (void)lut;
+    uint32_t* dst32 = reinterpret_cast<uint32_t*>(dst);
+    for (int lx = 0; lx < srcN; ++lx) {
+        const uint32_t color = src[lx];
+        dst32[lx] = (color << 16) | color;
+    }
+}
+
+/// Arbitrary horizontal scale: dst[i] = src[xLUT[i]].
+inline void convertRowScaled(const uint8_t* src, uint16_t* dst, int n, const uint16_t* xLUT, const uint16_t* lut) {
+    const uint16_t* __restrict pLUT = lut;
+    const uint16_t* __restrict xL = xLUT;
+    int x = 0;
+    for (; x <= n - 4; x += 4) {
+        dst[x]     = pLUT[src[xL[x]]];
+        dst[x + 1] = pLUT[src[xL[x + 1]]];
+        dst[x + 2] = pLUT[src[xL[x + 2]]];
+        dst[x + 3] = pLUT[src[xL[x + 3]]];
+    }
+    for (; x < n; ++x) {
+        dst[x] = pLUT[src[xL[x]]];
+    }
+}
+
+/// Arbitrary horizontal scale from a 16bpp framebuffer.
+inline void convertRowScaled(const uint16_t* src, uint16_t* dst, int n, const uint16_t* xLUT, const uint16_t* lut) {
+    (void)lut;
+    const uint16_t* __restrict xL = xLUT;
+    int x = 0;
+    for (; x <= n - 4; x += 4) {
+        dst[x]     = src[xL[x]];
+        dst[x + 1] = src[xL[x + 1]];
+        dst[x + 2] = src[xL[x + 2]];
+        dst[x + 3] = src[xL[x + 3]];
+    }
+    for (; x < n; ++x) {
+        dst[x] = src[xL[x]];
+    }
+}
+
+} // namespace present
+
+} // namespace pixelroot32::graphics
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "FramebufferFormat.h"
+
+namespace pixelroot32::graphics::present {
+
+/**
+ * @struct RowKernels
+ * @brief One implementation of the 8bpp → panel RGB565 row conversions used at present.
+ *
+ * Same contracts as the scalar reference overloads in FramebufferFormat.h (convertRow,
+ * convertRow2x, convertRowScaled for uint8_t sources); every set must produce bit-identical
+ * output. @p dst must be 4-byte aligned; sources may have any alignment.
+ */
+struct RowKernels {
+    const char* name;
+    void (*row)(const uint8_t* src, uint16_t* dst, int n, const uint16_t* lut);
+    void (*row2x)(const uint8_t* src, uint16_t* dst, int srcN, const uint16_t* lut);
+    void (*rowScaled)(const uint8_t* src, uint16_t* dst, int n, const uint16_t* xLUT, const uint16_t* lut);
+};
+
+/** @brief The inline reference kernels of FramebufferFormat.h. */
+const RowKernels& scalarKernels();
+
+/**
+ * @brief Word-wide variant aimed at Xtensa (ESP32 / ESP32-S3): one 32-bit load per four
+ * source pixels (or two xLUT entries) instead of byte / halfword loads, packed 32-bit stores.
+ * Portable C++, so it is also built and verified natively. Opt-in through setActiveKernels():
+ * it is slower than scalar on the host and has not been measured on the target yet.
+ */
+const RowKernels& wordKernels();
+
+/** @brief Set used by default: the scalar reference on every platform. */
+const RowKernels& defaultKernels();
+
+/** @brief Set used by drivers at present time (defaultKernels() unless overridden). */
+const RowKernels& activeKernels();
+
+/**
+ * @brief Overrides activeKernels() (benchmarks, A/B profiling). Call before presents start:
+ * a PresentPipeline worker reads it without synchronisation.
+ */
+void setActiveKernels(const RowKernels& kernels);
+
+// Dispatch overloads for code templated on the framebuffer pixel type: 8bpp sources go through
+// @p k, 16bpp sources are already panel RGB565 and keep the copy kernels.
+
+inline void convertRow(const RowKernels& k, const uint8_t* src, uint16_t* dst, int n, const uint16_t* lut) {
+    k.row(src, dst, n, lut);
+}
+
+inline void convertRow(const RowKernels&, const uint16_t* src, uint16_t* dst, int n, const uint16_t* lut) {
+    convertRow(src, dst, n, lut);
+}
+
+inline void convertRow2x(const RowKernels& k, const uint8_t* src, uint16_t* dst, int srcN, const uint16_t* lut) {
+    k.row2x(src, dst, srcN, lut);
+}
+
+inline void convertRow2x(const RowKernels&, const uint16_t* src, uint16_t* dst, int srcN, const uint16_t* lut) {
+    convertRow2x(src, dst, srcN, lut);
+}
+
+inline void convertRowScaled(const RowKernels& k, const uint8_t* src, uint16_t* dst, int n,
+                             const uint16_t* xLUT, const uint16_t* lut) {
+    k.rowScaled(src, dst, n, xLUT, lut);
+}
+
+inline void convertRowScaled(const RowKernels&, const uint16_t* src, uint16_t* dst, int n,
+                             const uint16_t* xLUT, const uint16_t* lut) {
+    convertRowScaled(src, dst, n, xLUT, lut);
+}
+
+} // namespace pixelroot32::graphics::present
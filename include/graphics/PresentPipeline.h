@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "DirtyGrid.h"
+#include "platforms/PlatformCapabilities.h"
+#include "platforms/WorkerThread.h"
+
+namespace pixelroot32::graphics {
+
+class DrawSurface;
+
+/**
+ * @struct PresentPipelineStats
+ * @brief Counters of the pipelined present mode (microseconds from platforms::config::profilerMicros()).
+ */
+struct PresentPipelineStats {
+    uint32_t framesSubmitted = 0; ///< submit() calls.
+    uint32_t framesPresented = 0; ///< presentBuffer() calls completed by the worker.
+    uint32_t fullCopies = 0;      ///< Submits that copied the whole frame (no usable dirty rects).
+    uint32_t lastPresentUs = 0;   ///< Duration of the most recent presentBuffer().
+    uint32_t totalPresentUs = 0;  ///< Worker time spent in presentBuffer().
+    uint32_t totalWaitUs = 0;     ///< Producer time blocked on a present still in flight.
+    uint32_t totalCopyUs = 0;     ///< Producer time spent copying into the present buffer.
+};
+
+/**
+ * @class PresentPipeline
+ * @brief Overlaps drawing frame N+1 with converting / pushing frame N to the display.
+ *
+ * Two logical framebuffers: the DrawSurface sprite buffer, which the Renderer keeps drawing
+ * into (it must stay persistent for DirtyGrid's selective clears), and a present buffer owned
+ * here. submit() copies the cells that changed this frame into the present buffer and hands it
+ * to a worker (platforms::WorkerThread) that calls DrawSurface::presentBuffer(); the producer
+ * only blocks when the previous present is still in flight.
+ *
+ * The present buffer is an exact copy of the sprite buffer after every submit(), so the driver
+ * may still fall back to a full-frame push at any time. With the indexed framebuffer the palette
+ * is snapshotted alongside it (buildIndexedPaletteLUT() on the producer side), so the worker never
+ * reads palette banks the game may be changing for the next frame.
+ */
+class PresentPipeline {
+public:
+    /// Dirty rects handed to the worker per frame; more falls back to a full copy.
+    static constexpr uint16_t kMaxRects = 24;
+
+    PresentPipeline() = default;
+    ~PresentPipeline();
+
+    PresentPipeline(const PresentPipeline&) = delete;
+    PresentPipeline& operator=(const PresentPipeline&) = delete;
+
+    /**
+     * @brief Allocates the present buffer and starts the worker.
+     * @param surface Driver used for presents; must report supportsBufferPresent().
+     * @param width   Logical framebuffer width.
+     * @param height  Logical framebuffer height.
+     * @param caps    Placement: caps.presentWorkerCoreId / caps.presentWorkerPriority.
+     * @return false when the surface cannot present external buffers, allocation fails or the
+     *         platform has no threads (callers keep presenting sequentially).
+     */
+    bool start(DrawSurface& surface, int width, int height,
+               const pixelroot32::platforms::PlatformCapabilities& caps);
+
+    /** @brief Waits for the last present, stops the worker and frees the present buffer. */
+    void stop();
+
+    bool isRunning() const { return worker.isRunning(); }
+
+    /**
+     * @brief Hands the frame in @p framebuffer to the worker.
+     *
+     * Blocks until the previous present finished, then copies the changed region into the
+     * present buffer and returns; the sprite buffer may be drawn into right away.
+     *
+     * @param framebuffer Sprite buffer (graphics::FramebufferPixel layout, width × height).
+     * @param grid        Renderer dirty cells for this frame, or nullptr to copy and present it all.
+     */
+    void submit(const uint8_t* framebuffer, const DirtyGrid* grid);
+
+    /** @brief Blocks until no present is in flight. */
+    void waitIdle();
+
+    /** @brief Counters; worker-side fields are current as of the last waitIdle() / submit(). */
+    const PresentPipelineStats& getStats() const { return stats; }
+    void resetStats() { stats = PresentPipelineStats{}; }
+
+private:
+    DrawSurface* surface = nullptr;
+    uint8_t*     presentBuffer = nullptr;
+    int          width = 0;
+    int          height = 0;
+    bool         primed = false;  ///< presentBuffer holds a complete frame.
+
+    // Written by the producer before dispatch, read by the worker after.
+    DirtyRect rects[kMaxRects];
+    uint16_t  rectCount = 0;
+    bool      fullFrame = true;
+    const uint16_t* presentPalette = nullptr;  ///< paletteSnapshot when it changed since the last present.
+
+    // Indexed framebuffer only: RGB565 per framebuffer index, as of the last submit().
+    uint16_t* paletteSnapshot = nullptr;
+    uint32_t  paletteSnapshotGeneration = 0;
+    bool      paletteSnapshotValid = false;
+    bool      paletteSnapshotPending = false;  ///< Not yet handed to the worker.
+
+    // Written by the worker before its job completes; folded into stats by waitIdle().
+    uint32_t workerFrames = 0;
+    uint32_t workerLastUs = 0;
+    uint32_t workerTotalUs = 0;
+
+    pixelroot32::platforms::WorkerThread worker;
+
+    PresentPipelineStats stats;
+
+    /** Worker side: presents the published frame. */
+    void presentPending();
+    static void presentJob(void* self);
+};
+
+} // namespace pixelroot32::graphics
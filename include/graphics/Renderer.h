@@ -14,7 +14,10 @@
 #include "platforms/PlatformMemory.h"
 
 #include "DirtyGrid.h"
+#include "DisplayList.h"
 #include "DrawSurface.h"
+#include "FramebufferFormat.h"
+#include "PresentPipeline.h"
 #include "DisplayConfig.h"
 #include "Color.h"
 #include "Font.h"
@@ -737,6 +740,8 @@ public:
           currentRenderContext(other.currentRenderContext),
           logicalFrameBuffer8(nullptr),
           dirtyGrid(std::move(other.dirtyGrid)),
+          displayList_(std::move(other.displayList_)),
+          recording_(other.recording_),
           tilemapSpriteDirtyMode_(other.tilemapSpriteDirtyMode_),
           debugDirtyCellOverlay_(other.debugDirtyCellOverlay_),
           suppressFramebufferClearBeforeStaticMemcpy_(other.suppressFramebufferClearBeforeStaticMemcpy_)
@@ -746,6 +751,7 @@ public:
             other.animDynTrackSlots_[i] = {};
         }
         other.logicalFrameBuffer8 = nullptr;
+        other.recording_ = false;
         other.tilemapSpriteDirtyMode_ = TilemapSpriteDirtyMode::Normal;
         other.debugDirtyCellOverlay_ = false;
         other.suppressFramebufferClearBeforeStaticMemcpy_ = false;
@@ -769,6 +775,9 @@ public:
             logicalFrameBuffer8 = nullptr;
             other.logicalFrameBuffer8 = nullptr;
             dirtyGrid = std::move(other.dirtyGrid);
+            displayList_ = std::move(other.displayList_);
+            recording_ = other.recording_;
+            other.recording_ = false;
             tilemapSpriteDirtyMode_ = other.tilemapSpriteDirtyMode_;
             for (uint8_t i = 0; i < kMaxAnimDynTrackSlots; ++i) {
                 animDynTrackSlots_[i] = other.animDynTrackSlots_[i];
@@ -776,6 +785,7 @@ public:
             }
             debugDirtyCellOverlay_ = other.debugDirtyCellOverlay_;
             suppressFramebufferClearBeforeStaticMemcpy_ = other.suppressFramebufferClearBeforeStaticMemcpy_;
+            presentFullFrame_ = true;
             other.tilemapSpriteDirtyMode_ = TilemapSpriteDirtyMode::Normal;
             other.debugDirtyCellOverlay_ = false;
             other.suppressFramebufferClearBeforeStaticMemcpy_ = false;
@@ -799,6 +809,14 @@ public:
      */
     void forceFullRedraw();
 
+    /**
+     * @brief Marks the frame in progress as changed everywhere, so endFrame() presents the full screen.
+     *
+     * Used when the framebuffer is rewritten outside dirty-cell tracking during the frame
+     * (e.g. StaticTilemapLayerCache rebuilding its snapshot). No-op when dirty regions are disabled.
+     */
+    void requestFullPresent();
+
     /**
      * Clears framebuffer clear-suppression planning for this frame (call once before stacked scenes advise).
      * No-op when dirty regions are disabled.
@@ -824,9 +842,69 @@ public:
 
     /**
      * @brief Finalizes the frame and sends the buffer to the display.
+     *
+     * In recorded mode the display list is executed first. With a PresentPipeline attached
+     * the frame is handed to its worker instead of DrawSurface::sendBuffer().
      */
     void endFrame();
 
+    /**
+     * @brief Routes endFrame() presents through @p pipeline (nullptr: present on this thread).
+     *
+     * The pipeline must be running on this renderer's DrawSurface. Waits for any present of the
+     * previous pipeline first.
+     */
+    void setPresentPipeline(PresentPipeline* pipeline);
+
+    PresentPipeline* getPresentPipeline() const { return presentPipeline_; }
+
+    /**
+     * @brief Switches to recorded (display-list) mode.
+     *
+     * Sprite, filled-rect, text and tilemap draws are then appended to a fixed-capacity
+     * command arena instead of executing. At endFrame() the list is sorted by draw layer and
+     * sprite palette (without changing the paint order of overlapping commands), culled
+     * against the viewport and, for static tilemaps, against the cells cleared this frame,
+     * merged (adjacent same-colour rects, touching runs of one tilemap) and executed.
+     *
+     * Other primitives (lines, circles, pixels, bitmaps, scaled sprites) flush the pending
+     * list and draw immediately, so they keep their submission order. Code that writes the
+     * framebuffer directly must call flushDisplayList() first. Pixel data, palettes, fonts and
+     * tilemaps must stay valid until endFrame(); sprite descriptors and text are copied.
+     *
+     * Every frame must end with endFrame() (Engine::run does this): the next beginFrame() drops
+     * whatever is still pending, counts it in DisplayListStats::discarded and, in debug builds,
+     * logs a warning. A present path that calls DrawSurface::sendBuffer() directly shows nothing.
+     *
+     * Allocate during scene / engine init: this is the only allocation of the mode.
+     * A full arena flushes early (counted in DisplayListStats::overflowFlushes).
+     *
+     * @param commandCapacity Commands per flush (28 bytes each on ESP32, 40 on 64-bit hosts).
+     * @param textCapacity    Bytes of copied text per flush.
+     * @return false on allocation failure (recorded mode stays off).
+     */
+    [[nodiscard]] bool enableRecordedMode(std::size_t commandCapacity, std::size_t textCapacity = 256);
+
+    /** @brief Executes anything pending, frees the arena and returns to immediate drawing. */
+    void disableRecordedMode();
+
+    bool isRecordedModeEnabled() const { return recording_; }
+
+    /**
+     * @brief Sort key for subsequently recorded commands (lower layers execute first).
+     *
+     * Scene::draw sets it to each entity's render layer; it resets to 0 in beginFrame().
+     * Ignored in immediate mode.
+     */
+    void setDrawLayer(uint8_t layer) { drawLayer_ = layer; }
+    uint8_t getDrawLayer() const { return drawLayer_; }
+
+    /** @brief Executes the pending display list now (no-op in immediate mode). */
+    void flushDisplayList();
+
+    /** @brief Counters for the frame in progress (recorded mode only). */
+    const DisplayListStats& getDisplayListStats() const { return displayListStats_; }
+
     /**
      * @brief Gets the underlying DrawSurface implementation.
      * @return Reference to the DrawSurface.
@@ -921,6 +999,32 @@ public:
      */
     void drawFilledRectangleW(int x, int y, int width, int height, uint16_t color);
 
+    /// Most colours one drawPointBatch() call can use.
+    static constexpr uint8_t kPointBatchMaxColors = 16;
+
+    /// DirtyGrid mask drawPointBatch() keeps on the stack (covers 480x320 logical pixels).
+    static constexpr size_t kPointBatchCellMaskBytes = 512;
+
+    /**
+     * @brief Draws @p count square points of @p size x @p size pixels (1 or 2) in one call.
+     *
+     * Meant for particles. With a logical framebuffer the points are written straight into it
+     * (no DrawSurface call per point); otherwise each point goes through
+     * DrawSurface::drawFilledRectangle. Points are clipped to the viewport, take the display
+     * offset like other primitives, and only the dirty cells the points touch are marked (not
+     * the box around them). A pending display list is flushed first, as for drawPixel().
+     *
+     * @param xs, ys      Point positions (top-left pixel).
+     * @param colorIndex  Per-point index into @p colors.
+     * @param count       Number of points.
+     * @param colors      RGB565 colours, at most kPointBatchMaxColors. An indexed framebuffer
+     *                    snaps each to the nearest sprite palette colour, once per call.
+     * @param colorCount  Entries in @p colors.
+     * @param size        Point edge in pixels: 1 or 2.
+     */
+    void drawPointBatch(const int16_t* xs, const int16_t* ys, const uint8_t* colorIndex, int count,
+                        const uint16_t* colors, uint8_t colorCount, uint8_t size);
+
     /**
      * @brief Draws a line between two points.
      * @param x1 Start X.
@@ -1054,6 +1158,10 @@ public:
      *
      * This API intentionally hides all bit-level details from game code.
      *
+     * When the DrawSurface exposes its framebuffer, rows are clipped once and
+     * runs of set bits are written as horizontal spans (clz/ctz walk) instead of
+     * one virtual drawPixel() call per pixel.
+     *
      * @param sprite Sprite descriptor (data, width, height).
      * @param x      Top-left X coordinate in logical screen space.
      * @param y      Top-left Y coordinate in logical screen space.
@@ -1155,6 +1263,7 @@ public:
 
     /**
      * @brief Draws a tilemap of 2bpp sprites.
+     * With a logical framebuffer the map is rasterised per scanline instead of per tile.
      */
     void drawTileMap(const TileMap2bpp& map,
                      int originX,
@@ -1163,12 +1272,34 @@ public:
 
     /**
      * @brief Draws a tilemap of 4bpp sprites.
+     * With a logical framebuffer the map is rasterised per scanline instead of per tile.
      */
     void drawTileMap(const TileMap4bpp& map,
                      int originX,
                      int originY,
                      LayerType layerType = LayerType::Dynamic);
 
+    /**
+     * @brief Rasterises a 4bpp tilemap into an arbitrary off-screen pixel buffer.
+     *
+     * Map pixel (0,0) lands at (@p destX, @p destY) in @p target; display offsets, offset
+     * bypass and dirty tracking are ignored. Only pixels inside the clip rectangle
+     * [@p clipX0, @p clipX1) x [@p clipY0, @p clipY1) are written, so callers (e.g. the
+     * scrolling StaticTilemapLayerCache ring) can fill just a newly exposed strip.
+     *
+     * @param target       FramebufferPixel buffer in the logical framebuffer format.
+     * @param targetStride Row pitch of @p target in pixels.
+     */
+    void rasterizeTileMapRegion(const TileMap4bpp& map,
+                                int destX,
+                                int destY,
+                                FramebufferPixel* target,
+                                int targetStride,
+                                int clipX0,
+                                int clipY0,
+                                int clipX1,
+                                int clipY1);
+
     /**
      * @brief Enables or disables ignoring global offsets for subsequent draw calls.
      * 
@@ -1211,11 +1342,32 @@ private:
 
     PaletteContext* currentRenderContext = nullptr;
 
-    /// 8bpp logical framebuffer pointer when the DrawSurface exposes it (e.g. TFT_eSPI sprite); nullptr otherwise.
+    /// Logical framebuffer bytes when the DrawSurface exposes them (e.g. TFT_eSPI sprite); nullptr otherwise.
+    /// Holds FramebufferPixel elements: 8bpp by default, 16bpp with PIXELROOT32_FRAMEBUFFER_BPP=16.
     uint8_t* logicalFrameBuffer8 = nullptr;
 
     DirtyGrid dirtyGrid;
 
+    /// Set by setPresentPipeline(): endFrame() submits to it instead of calling sendBuffer().
+    PresentPipeline* presentPipeline_ = nullptr;
+
+    DisplayList displayList_;
+    DisplayListStats displayListStats_;
+    /// Recorded mode on (arena allocated).
+    bool recording_ = false;
+    /// Executing the display list: draws go straight to the surface.
+    bool replaying_ = false;
+    /// Something reached the framebuffer outside the end-of-frame flush (disables dirty-cell culling).
+    bool displayListBarrier_ = false;
+    /// beginFrame() cleared only the previously dirty cells (the rest still holds last frame's pixels).
+    bool frameClearedDirtyCellsOnly_ = false;
+    /// That dirty-cell clear is deferred to the first flush, which knows which cells get fully repainted.
+    bool frameClearPending_ = false;
+    uint8_t drawLayer_ = 0;
+    /// Tile rows [begin, end) a replayed tile run is limited to; end < 0 when inactive.
+    int tileRowClipBegin_ = 0;
+    int tileRowClipEnd_ = -1;
+
     TilemapSpriteDirtyMode tilemapSpriteDirtyMode_ = TilemapSpriteDirtyMode::Normal;
 
     /// Per-map tracking entry for dynamic animated tilemap dirty heuristics across frames.
@@ -1236,13 +1388,100 @@ private:
     /** When dirty regions enabled: omit selective/full framebuffer clear — StaticTilemapLayerCache overwrites FB. */
     bool suppressFramebufferClearBeforeStaticMemcpy_ = false;
 
+    /** Frame changed outside dirty-cell tracking; endFrame() asks the driver for a full present. */
+    bool presentFullFrame_ = true;
+    /// Hash of (map, view origin, visible content) for Static tilemap layers drawn this frame / last frame.
+    uint32_t staticLayerSignature_ = 0;
+    uint32_t prevStaticLayerSignature_ = 0;
+    /// Palette generation the last presented frame was drawn / resolved with.
+    uint32_t presentPaletteGeneration_ = 0;
+
+    void noteStaticLayerDraw(const void* mapKey, int viewOriginX, int viewOriginY, uint32_t contentSignature);
+
+    /// Hash of what a Static layer shows on screen: visible tile indices, their runtime mask bits
+    /// and the current animation frames. Any edit to those pixels changes it.
+    template<typename TMap>
+    uint32_t staticLayerContentSignature(const TMap& map, int viewOriginX, int viewOriginY) const {
+        if constexpr (!pixelroot32::platforms::config::EnableDirtyRegions) {
+            (void)map;
+            (void)viewOriginX;
+            (void)viewOriginY;
+            return 0;
+        } else {
+            uint32_t h = map.animManager ? map.animManager->getVisualSignature() : 2166136261u;
+            if (map.indices == nullptr || map.tileWidth == 0 || map.tileHeight == 0) {
+                return h;
+            }
+            const int colBegin = std::max(0, viewOriginX < 0 ? -viewOriginX / map.tileWidth : 0);
+            const int colEnd = std::min(static_cast<int>(map.width),
+                                        (logicalWidth - viewOriginX + map.tileWidth - 1) / map.tileWidth);
+            const int rowBegin = std::max(0, viewOriginY < 0 ? -viewOriginY / map.tileHeight : 0);
+            const int rowEnd = std::min(static_cast<int>(map.height),
+                                        (logicalHeight - viewOriginY + map.tileHeight - 1) / map.tileHeight);
+            for (int row = rowBegin; row < rowEnd; ++row) {
+                for (int col = colBegin; col < colEnd; ++col) {
+                    const int index = row * map.width + col;
+                    uint32_t v = map.indices[index];
+                    if (map.runtimeMask != nullptr && (map.runtimeMask[index >> 3] & (1 << (index & 7))) == 0) {
+                        v |= 0x100u;
+                    }
+                    h = (h ^ v) * 16777619u;
+                }
+            }
+            return h;
+        }
+    }
+
     // Sprite palette slot context for multi-palette sprites
     static constexpr uint8_t kSpritePaletteSlotContextInactive = 0xFF;
     uint8_t currentSpritePaletteSlot = kSpritePaletteSlotContextInactive;
 
+    /// Typed view of logicalFrameBuffer8 (RGB332 bytes or RGB565 words, see FramebufferFormat.h).
+    FramebufferPixel* framebufferPixels() const {
+        return reinterpret_cast<FramebufferPixel*>(logicalFrameBuffer8);
+    }
+
+    /// 1bpp span blit into the logical framebuffer (requires width <= 16). @p startX / @p startY already include offsets.
+    void drawSprite1bppSpans(const Sprite& sprite, int startX, int startY, FramebufferPixel packedColor, bool flipX);
+
+    /// Colour handed to DrawSurface primitives: resolved RGB565, or an index carrier when the framebuffer is indexed.
+    uint16_t surfaceColor(Color color, PaletteContext context) const;
+
+    /// surfaceColor() for an arbitrary RGB565: indexed framebuffers snap it to the nearest sprite slot 0 colour.
+    uint16_t surfaceColorRgb565(uint16_t rgb565) const;
+
+    /// Fills @p out with surfaceColor-equivalents of @p palette in bank @p context, slot @p slot.
+    void buildSlotLUT(const Color* palette, uint8_t count, PaletteContext context, uint8_t slot, uint16_t* out) const;
+
     void drawSpriteInternal(const Sprite2bpp& sprite, int x, int y, const uint16_t* paletteLUT, bool flipX);
     void drawSpriteInternal(const Sprite4bpp& sprite, int x, int y, const uint16_t* paletteLUT, bool flipX);
 
+    bool isRecording() const { return recording_ && !replaying_; }
+    /// Appends a command slot, flushing once when the arena is full.
+    DrawCommand* appendDrawCommand();
+    /// @return false when [x, x+w) x [y, y+h) misses the viewport (counted as culled).
+    bool recordableBounds(int x, int y, int w, int h);
+    void recordSprite(const Sprite& sprite, int x, int y, Color color, bool flipX);
+    void recordSprite(DrawCommandType type, const uint8_t* data, const Color* palette, uint8_t width, uint8_t height,
+                      uint8_t paletteSize, uint8_t slot, int x, int y, bool flipX);
+    void recordFilledRect(int x, int y, int width, int height, uint16_t surfaceColor);
+    /// @return false when the text cannot be recorded (too long for the arena): draw it immediately.
+    bool recordText(std::string_view text, int x, int y, Color color, uint8_t size, const Font* font);
+    template<typename TMap>
+    void recordTileRun(DrawCommandType type, const TMap& map, int originX, int originY, LayerType layerType, Color color);
+    void flushDisplayList(bool endOfFrame);
+    /// Drops static tile rows that only cover cells still holding last frame's (identical) pixels.
+    void cullStaticTileRunsAgainstDirtyGrid();
+    /// Drops commands hidden under later opaque rects / tile runs and marks covered cells in the DirtyGrid.
+    void cullOccludedDrawCommands();
+    /// Marks the cells @p cmd fully repaints with opaque pixels; @return true if any.
+    bool markOpaqueCoverage(const DrawCommand& cmd);
+    template<typename TMap>
+    bool markTileRunCoverage(const DrawCommand& cmd);
+    /// Runs the deferred dirty-cell clear, skipping covered cells.
+    void resolveFrameClear();
+    void executeDrawCommand(const DrawCommand& cmd, const uint16_t*& lut, uint16_t* lutStorage, const DrawCommand*& lutKey);
+
     void ensureDirtyGridSized();
     void markDirtyLogicalRect(int x, int y, int w, int h);
     void drawDebugDirtyCellOverlay();
@@ -1293,6 +1532,34 @@ TileAnimationManager* animMgr,
         PaletteContext* oldContext = nullptr;
     };
 
+    /// Destination of rasterizeTileMap(): pixel buffer, row pitch and clip rectangle (exclusive max).
+    struct TileRasterTarget {
+        FramebufferPixel* pixels = nullptr;
+        int stride = 0;
+        int clipX0 = 0;
+        int clipY0 = 0;
+        int clipX1 = 0;
+        int clipY1 = 0;
+    };
+
+    /**
+     * Scanline rasteriser for 2bpp/4bpp tilemaps into the logical framebuffer (or any
+     * @p target). Cells (frame, mask, palette LUT, dirty marks) are resolved once per tile row;
+     * each scanline then walks the row's tiles, and only tiles straddling the clip edge are clipped.
+     * @param markDirty false for off-screen targets (no dirty-grid marks at all).
+     */
+    template<typename TMap>
+    void rasterizeTileMap(const TMap& map,
+                          LayerType layerType,
+                          const TilemapDirtyTrackingHelper& h,
+                          const TileRasterTarget& target,
+                          bool markDirty);
+
+    /// Framebuffer-wide target for the on-screen tilemap paths.
+    TileRasterTarget screenRasterTarget() const {
+        return TileRasterTarget{framebufferPixels(), logicalWidth, 0, 0, logicalWidth, logicalHeight};
+    }
+
     /// Compute common dirty-tracking state for any tilemap type.
     /// @tparam T Map type (TileMap, TileMap2bpp, TileMap4bpp)
     /// @param map The tilemap
@@ -1314,6 +1581,12 @@ TileAnimationManager* animMgr,
         h.viewOriginX = offsetBypass ? originX : xOffset + originX;
         h.viewOriginY = offsetBypass ? originY : yOffset + originY;
 
+        // Replayed display-list runs were noted when recorded.
+        if (layerType == LayerType::Static && !replaying_) {
+            noteStaticLayerDraw(static_cast<const void*>(map.indices), h.viewOriginX, h.viewOriginY,
+                                staticLayerContentSignature(map, h.viewOriginX, h.viewOriginY));
+        }
+
         const bool selectiveAnimMarks =
             (layerType == LayerType::Dynamic && map.animManager != nullptr);
 
@@ -1348,6 +1621,11 @@ TileAnimationManager* animMgr,
         if (h.startRow < 0) h.startRow = 0;
         if (h.endRow > map.height) h.endRow = map.height;
 
+        if (tileRowClipEnd_ >= 0) {
+            if (h.startRow < tileRowClipBegin_) h.startRow = tileRowClipBegin_;
+            if (h.endRow > tileRowClipEnd_) h.endRow = tileRowClipEnd_;
+        }
+
         return h;
     }
 
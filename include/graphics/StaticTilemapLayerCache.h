@@ -31,10 +31,17 @@ struct TileMap4bppDrawSpec {
 /**
  * @brief Centralized framebuffer snapshot for static 4bpp tilemap layers.
  *
- * On drivers that expose a direct logical 8bpp sprite buffer (e.g. TFT_eSPI),
+ * On drivers that expose a direct logical sprite buffer (8bpp or 16bpp, e.g. TFT_eSPI),
  * this avoids redrawing “static” layers every frame when the sampled camera
  * position is unchanged and the cache has not been invalidated.
  *
+ * Scrolling (default): the buffer is used as a wrap-around ring in world space, like a
+ * console's hardware-scrolled tilemap plane. When the display offset moves by less than a
+ * screen, only the newly exposed columns / rows are rasterised into the ring, and the visible
+ * window is copied to the framebuffer with at most two memcpys per scanline. Layer origins must
+ * stay fixed in world space for this; a changed layer set or origin triggers a full rebuild.
+ * With setScrollingEnabled(false) any camera move rebuilds the whole snapshot instead.
+ *
  * Override points:
  * - Compile-time: set @c PIXELROOT32_ENABLE_STATIC_TILEMAP_FB_CACHE to 0 in build flags.
  * - Run-time: setFramebufferCacheEnabled(false) per scene or platform init.
@@ -51,7 +58,8 @@ public:
     void clear();
 
     /**
-     * @brief Pre-allocate the snapshot for a logical framebuffer of width * height bytes.
+     * @brief Pre-allocate the snapshot for a logical framebuffer of width * height pixels
+     * (sizeof(FramebufferPixel) bytes each).
      * @return false if dimensions are invalid or allocation failed.
      */
     [[nodiscard]] bool allocateForLogicalSize(int width, int height);
@@ -90,8 +98,38 @@ public:
     void setFramebufferCacheEnabled(bool enabled);
     [[nodiscard]] bool isFramebufferCacheEnabled() const;
 
+    /**
+     * Toggle incremental ring-buffer scrolling (on by default). When enabled, rebuilds are keyed
+     * on the renderer display offset and static layer specs; the camera samples passed to draw()
+     * are ignored. Scrolling needs at most kMaxScrollingStaticLayers static layers.
+     */
+    void setScrollingEnabled(bool enabled);
+    [[nodiscard]] bool isScrollingEnabled() const;
+
+    /** Static-layer pixels rasterised by the last draw() (0 when the cache was restored as-is). */
+    [[nodiscard]] std::size_t getLastRasterizedPixelCount() const;
+
+    static constexpr std::size_t kMaxScrollingStaticLayers = 4;
+
 private:
 #if PIXELROOT32_ENABLE_STATIC_TILEMAP_FB_CACHE
+    [[nodiscard]] bool canScroll(std::size_t staticLayerCount) const;
+
+    /** Bring the ring up to date for the current display offset and copy it to @p fb. */
+    void drawScrollingStaticLayers(Renderer& renderer,
+                                   FramebufferPixel* fb,
+                                   const TileMap4bppDrawSpec* staticLayers,
+                                   std::size_t staticLayerCount);
+
+    /** Clear and rasterise world rect [x0,x1) x [y0,y1) into the ring, splitting at its wrap edges. */
+    void rasterizeRingRegion(Renderer& renderer,
+                             const TileMap4bppDrawSpec* staticLayers,
+                             std::size_t staticLayerCount,
+                             int x0,
+                             int y0,
+                             int x1,
+                             int y1);
+
     [[nodiscard]] bool wouldRestoreFramebufferViaCacheMemcpy(Renderer& renderer,
                                                              int cameraSampleX,
                                                              int cameraSampleY,
@@ -108,9 +146,19 @@ private:
     std::size_t cacheByteCount = 0;
     int lastCameraX = 0;
     int lastCameraY = 0;
+    int ringWidth = 0;
+    int ringHeight = 0;
+    int ringViewX = 0;
+    int ringViewY = 0;
+    TileMap4bppDrawSpec ringLayers[kMaxScrollingStaticLayers] = {};
+    std::size_t ringLayerCount = 0;
+    std::size_t lastRasterizedPixels = 0;
     bool cacheValid = false;
+    /** Buffer layout: world-space ring (scrolling) vs screen-space snapshot. */
+    bool cacheHoldsRing = false;
     bool userInvalidated = true;
     bool framebufferCacheEnabled = true;
+    bool scrollingEnabled = true;
 #endif
 };
 
@@ -8,30 +8,30 @@
 #if PIXELROOT32_ENABLE_PARTICLES
 
 #include <cstdint>
-#include "graphics/Color.h"
 #include "math/Scalar.h"
-#include "math/Vector2.h"
 
 namespace pixelroot32::graphics::particles {
 
 /**
- * @struct Particle
- * @brief Represents a single particle in the particle system.
+ * @struct ParticleBlock
+ * @brief Structure-of-arrays storage for up to 32 particles of one emitter.
  *
- * Designed to be lightweight to fit many instances in memory (RAM optimization).
+ * Blocks come from the shared ParticlePool and are chained per emitter through @ref next.
+ * Live particles are kept packed in [0, count): a dying particle is replaced by the last one,
+ * so the update and draw loops run over dense arrays with no activity checks.
  */
-struct Particle {
-    pixelroot32::math::Vector2 position; ///< Current position.
-    pixelroot32::math::Vector2 velocity; ///< Velocity vector.
-
-    uint16_t color;      ///< Current color (RGB565).
-    Color startColor; ///< Initial color for interpolation.
-    Color endColor;   ///< Final color for interpolation.
-
-    uint8_t life;    ///< Current remaining life (frames or ticks).
-    uint8_t maxLife; ///< Total life duration.
-
-    bool active = false; ///< Whether the particle is currently in use.
+struct ParticleBlock {
+    static constexpr int kCapacity = 32;
+
+    pixelroot32::math::Scalar posX[kCapacity]; ///< World position.
+    pixelroot32::math::Scalar posY[kCapacity];
+    pixelroot32::math::Scalar velX[kCapacity]; ///< Velocity in pixels per reference frame (1/60 s).
+    pixelroot32::math::Scalar velY[kCapacity];
+    pixelroot32::math::Scalar age[kCapacity];  ///< Life elapsed, 0 at spawn and 1 at death.
+    pixelroot32::math::Scalar ageRate[kCapacity]; ///< Age gained per reference frame (1 / lifetime).
+
+    uint8_t count = 0;  ///< Live particles.
+    int16_t next = -1;  ///< Next block of the same emitter (or of the free list); -1 ends the chain.
 };
 
 } // namespace pixelroot32::graphics::particles
@@ -12,18 +12,21 @@
 #include "ParticleConfig.h"
 #include "math/Scalar.h"
 
+/// Deprecated: emitters now share ParticlePool (PARTICLE_POOL_SIZE) and have no fixed cap.
 #define MAX_PARTICLES_PER_EMITTER 50
 
 namespace pixelroot32::graphics::particles {
 
 /**
  * @class ParticleEmitter
- * @brief Manages a pool of particles to create visual effects.
+ * @brief Spawns, moves and draws particles to create visual effects.
  *
  * Inherits from Entity.
  *
- * Participates in the scene update/draw loop.
- * Uses a fixed-size array for particles to avoid dynamic allocation during runtime.
+ * Participates in the scene update/draw loop. Particles live in blocks taken from the shared
+ * ParticlePool (structure of arrays, no allocation at runtime) and are returned when they die
+ * or the emitter is destroyed. Speeds, gravity and lifetimes in ParticleConfig are expressed per
+ * reference frame (1/60 s) and scaled by deltaTime, so effects look the same at any frame rate.
  */
 class ParticleEmitter: public pixelroot32::core::Entity {
 public:
@@ -34,55 +37,45 @@ public:
      * @param cfg Configuration for the emitted particles.
      */
     ParticleEmitter(pixelroot32::math::Vector2 position, const ParticleConfig& cfg);
+
+    /** @brief Returns the emitter's blocks to the pool. */
+    ~ParticleEmitter() override;
+
+    ParticleEmitter(const ParticleEmitter&) = delete;
+    ParticleEmitter& operator=(const ParticleEmitter&) = delete;
     
     /**
      * @brief Updates all active particles.
-     * Applies physics (gravity, friction) and updates lifetime.
-     * @param deltaTime Time elapsed since last frame.
+     * Integrates velocity, gravity and friction over @p deltaTime, ages particles and kills
+     * those that expire or leave the camera view (world space, using the renderer offset).
+     * @param deltaTime Time elapsed since last frame in milliseconds.
      */
     void update(unsigned long deltaTime) override;
 
     /**
-     * @brief Renders all active particles.
+     * @brief Renders all active particles as 2x2 points with one Renderer::drawPointBatch() call.
      * @param renderer The renderer instance.
      */
     void draw(pixelroot32::graphics::Renderer& renderer) override;
 
     /**
      * @brief Emits a burst of particles from a specific location.
+     * Spawns fewer than @p count when the shared pool runs out.
      * @param position Emission origin.
      * @param count Number of particles to spawn.
      */
     void burst(pixelroot32::math::Vector2 position, int count);
 
-private:
-    ParticleConfig config;  
-    Particle particles[MAX_PARTICLES_PER_EMITTER];
-    int maxParticles = MAX_PARTICLES_PER_EMITTER;
+    /** @brief Kills all particles and returns their blocks to the pool. */
+    void clear();
 
+    /** @brief Number of live particles. */
+    int getActiveCount() const { return activeCount; }
 
-    /**
-     * @brief Linear interpolation between two 16-bit RGB565 colors.
-     * @param c1 Start color.
-     * @param c2 End color.
-     * @param t Interpolation factor (0.0 - 1.0).
-     * @return Interpolated RGB565 color.
-     */
-    inline uint16_t lerpColor(uint16_t c1, uint16_t c2, pixelroot32::math::Scalar t) {
-        uint8_t r1 = (c1 >> 11) & 0x1F;
-        uint8_t g1 = (c1 >> 5)  & 0x3F;
-        uint8_t b1 = c1 & 0x1F;
-
-        uint8_t r2 = (c2 >> 11) & 0x1F;
-        uint8_t g2 = (c2 >> 5)  & 0x3F;
-        uint8_t b2 = c2 & 0x1F;
-
-        uint8_t r = static_cast<uint8_t>(static_cast<int>(pixelroot32::math::toScalar(r1) + pixelroot32::math::toScalar(r2 - r1) * t));
-        uint8_t g = static_cast<uint8_t>(static_cast<int>(pixelroot32::math::toScalar(g1) + pixelroot32::math::toScalar(g2 - g1) * t));
-        uint8_t b = static_cast<uint8_t>(static_cast<int>(pixelroot32::math::toScalar(b1) + pixelroot32::math::toScalar(b2 - b1) * t));
-
-        return (r << 11) | (g << 5) | b;
-    }
+private:
+    ParticleConfig config;
+    int16_t firstBlock = -1; ///< Head of this emitter's block chain in ParticlePool::shared().
+    int activeCount = 0;
 };
 
 } // namespace pixelroot32::graphics::particles
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#pragma once
+
+#include "core/EngineModules.h"
+#if PIXELROOT32_ENABLE_PARTICLES
+
+#include <cstdint>
+#include "Particle.h"
+#include "platforms/EngineConfig.h"
+
+namespace pixelroot32::graphics::particles {
+
+/**
+ * @class ParticlePool
+ * @brief Fixed pool of particle blocks shared by every ParticleEmitter.
+ *
+ * Sized at compile time by PARTICLE_POOL_SIZE, so an emitter only holds the blocks it is
+ * using: one explosion can take most of the pool while idle emitters cost nothing. Blocks
+ * are handed out and returned through an intrusive free list; there is no allocation after
+ * start-up. Not thread-safe (emitters update and draw on the game loop).
+ */
+class ParticlePool {
+public:
+    static constexpr int kBlockCount = pixelroot32::platforms::config::ParticlePoolSize / ParticleBlock::kCapacity;
+    static constexpr int kCapacity = kBlockCount * ParticleBlock::kCapacity;
+
+    ParticlePool();
+
+    ParticlePool(const ParticlePool&) = delete;
+    ParticlePool& operator=(const ParticlePool&) = delete;
+
+    /** @brief The pool all emitters draw from. */
+    static ParticlePool& shared();
+
+    /**
+     * @brief Takes an empty block off the free list.
+     * @return Block index, or -1 when the pool is exhausted.
+     */
+    int16_t acquire();
+
+    /** @brief Returns block @p index to the free list. */
+    void release(int16_t index);
+
+    ParticleBlock& block(int16_t index) { return blocks[index]; }
+    const ParticleBlock& block(int16_t index) const { return blocks[index]; }
+
+    /** @brief Blocks currently on the free list. */
+    int getFreeBlockCount() const { return freeCount; }
+
+private:
+    ParticleBlock blocks[kBlockCount];
+    int16_t freeHead = -1;
+    int freeCount = 0;
+};
+
+} // namespace pixelroot32::graphics::particles
+
+#endif // PIXELROOT32_ENABLE_PARTICLES
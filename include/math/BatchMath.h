@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ *
+ * @file BatchMath.h
+ * @brief Vector2 / Scalar kernels over contiguous structure-of-arrays data.
+ */
+#pragma once
+#include <cstdint>
+#include "math/Fixed16.h"
+
+namespace pixelroot32::math::batch {
+
+/*
+ * Each kernel applies one Vector2 / Scalar operation to @p n consecutive elements and gives
+ * bit-identical results to the per-element code it replaces (same operations, same order,
+ * no fused multiply-add). Output arrays must not overlap the input arrays unless they are
+ * the same array (in-place).
+ *
+ * Both overload sets are always built, so the one matching Scalar is picked by overload
+ * resolution: the float set is written for auto-vectorisation and has SSE2 / NEON paths on
+ * native hosts; the Fixed16 set works on the raw 32-bit values with one 64-bit product per
+ * element (there is no packed 32x32 -> 64 multiply on the targets that use Fixed16).
+ */
+
+/** @brief y[i] = y[i] + x[i] * a. */
+void axpy(float* y, const float* x, float a, int n);
+void axpy(Fixed16* y, const Fixed16* x, Fixed16 a, int n);
+
+/** @brief x[i] = x[i] * s. */
+void scale(float* x, float s, int n);
+void scale(Fixed16* x, Fixed16 s, int n);
+
+/** @brief (x[i], y[i]) = Vector2(x[i], y[i]).limit_length(maxLen). */
+void clampLength(float* x, float* y, float maxLen, int n);
+void clampLength(Fixed16* x, Fixed16* y, Fixed16 maxLen, int n);
+
+/** @brief px[i] = px[i] + vx[i] * dt, py[i] = py[i] + vy[i] * dt (explicit Euler step). */
+void integratePositions(float* px, float* py, const float* vx, const float* vy, float dt, int n);
+void integratePositions(Fixed16* px, Fixed16* py, const Fixed16* vx, const Fixed16* vy, Fixed16 dt, int n);
+
+/**
+ * @brief mask[i] = 1 when box i overlaps the query box, else 0.
+ *
+ * Edges are inclusive, as in Rect::intersects(): boxes that only touch overlap. Passing the
+ * same arrays for min and max tests points against the box.
+ * @return Number of overlapping boxes.
+ */
+int aabbOverlapMask(const float* minX, const float* minY, const float* maxX, const float* maxY, int n,
+                    float qMinX, float qMinY, float qMaxX, float qMaxY, uint8_t* mask);
+int aabbOverlapMask(const Fixed16* minX, const Fixed16* minY, const Fixed16* maxX, const Fixed16* maxY, int n,
+                    Fixed16 qMinX, Fixed16 qMinY, Fixed16 qMaxX, Fixed16 qMaxY, uint8_t* mask);
+
+} // namespace pixelroot32::math::batch
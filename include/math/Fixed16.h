@@ -7,6 +7,7 @@
  */
 #pragma once
 #include <cstdint>
+#include "math/Fixed16Tables.h"
 
 namespace pixelroot32::math {
 
@@ -290,6 +291,107 @@ struct Fixed16 {
         }
         return Fixed16(static_cast<int32_t>(res), true);
     }
+
+    /**
+     * @brief Sine of @p x radians, integer only.
+     *
+     * The angle becomes a 32-bit phase (one turn = 2^32, so any input wraps for free) and is
+     * read from a linearly interpolated quarter-wave table. Error within 2 LSB (3 LSB for
+     * |x| in the thousands of radians).
+     */
+    static Fixed16 sin(Fixed16 x) {
+        return Fixed16(sinPhase(radiansToPhase(x)), true);
+    }
+
+    /** @brief Cosine of @p x radians, integer only (sin() a quarter turn ahead). */
+    static Fixed16 cos(Fixed16 x) {
+        return Fixed16(sinPhase(radiansToPhase(x) + (1u << 30)), true);
+    }
+
+    /**
+     * @brief Angle of (@p x, @p y) in (-pi, pi], integer only.
+     *
+     * Folds the vector into the first octant, interpolates atan(z) from a table for
+     * z = min / max in [0, 1] (long division in 32-bit steps), then unfolds. Error within 2.5 LSB;
+     * returns 0 for (0, 0).
+     */
+    static Fixed16 atan2(Fixed16 y, Fixed16 x) {
+        constexpr int32_t kHalfPiRaw = 102944;  // pi / 2 in 16.16
+        constexpr int32_t kPiRaw = 205887;
+        uint32_t ax = x.raw < 0 ? 0u - static_cast<uint32_t>(x.raw) : static_cast<uint32_t>(x.raw);
+        uint32_t ay = y.raw < 0 ? 0u - static_cast<uint32_t>(y.raw) : static_cast<uint32_t>(y.raw);
+        if (ax == 0 && ay == 0) return Fixed16(0);
+
+        const bool steep = ay > ax;
+        uint32_t num = steep ? ax : ay;
+        uint32_t den = steep ? ay : ax;
+        // Keep den within 24 bits so that each 8-bit step of the division fits 32 bits (num <= den).
+        if (den > 0xFFFFFFu) {
+            const int shift = 8 - __builtin_clz(den);
+            num >>= shift;
+            den >>= shift;
+        }
+        // z = min / max in Q24, [0, 1], eight bits at a time.
+        uint32_t z = 0;
+        uint32_t rem = num;
+        for (int i = 0; i < 3; ++i) {
+            rem <<= 8;
+            z = (z << 8) | (rem / den);
+            rem %= den;
+        }
+        const uint32_t idx = z >> 16;
+        int32_t a = detail::FIXED16_ATAN[idx];
+        if (idx < 256) {
+            a += ((detail::FIXED16_ATAN[idx + 1] - a) * static_cast<int32_t>(z & 0xFFFFu)) >> 16;
+        }
+        if (steep) a = kHalfPiRaw - a;
+        if (x.raw < 0) a = kPiRaw - a;
+        if (y.raw < 0) a = -a;
+        return Fixed16(a, true);
+    }
+
+    /**
+     * @brief Reciprocal square root, integer only. Returns 0 for @p x <= 0.
+     *
+     * Normalises x to m * 4^k with m in [1, 4), seeds 1/sqrt(m) from a small table and runs
+     * three Newton steps y = y * (3 - m * y^2) / 2 in Q30, then rescales by 2^-k.
+     */
+    static Fixed16 rsqrt(Fixed16 x) {
+        if (x.raw <= 0) return Fixed16(0);
+        const uint32_t r = static_cast<uint32_t>(x.raw);
+        const int msb = 31 - __builtin_clz(r);
+        const int shift = (msb - 28) & ~1;  // even, so that sqrt(4^k) = 2^k is exact
+        const int64_t m = shift >= 0 ? (r >> shift) : (static_cast<int64_t>(r) << -shift);  // Q28, [1, 4)
+        int64_t y = detail::FIXED16_RSQRT_SEED[(m >> 26) - 4];  // Q30
+        for (int i = 0; i < 3; ++i) {
+            const int64_t y2 = (y * y) >> 30;
+            const int64_t my2 = (m * y2) >> 28;
+            y = (y * ((int64_t{3} << 30) - my2)) >> 31;
+        }
+        // x = m * 2^(12 + shift): 1/sqrt(x) = y * 2^-(6 + shift / 2); Q30 -> 16.16.
+        const int down = 20 + shift / 2;
+        return Fixed16(static_cast<int32_t>((y + (int64_t{1} << (down - 1))) >> down), true);
+    }
+
+private:
+    /** @brief Radians to a 32-bit phase (2^32 per turn): raw * 2^16 / (2 * pi). */
+    static constexpr uint32_t radiansToPhase(Fixed16 x) {
+        return static_cast<uint32_t>((static_cast<int64_t>(x.raw) * 683565276) >> 16);
+    }
+
+    /** @brief sin of a 32-bit phase in 16.16, from the quarter-wave table. */
+    static int32_t sinPhase(uint32_t phase) {
+        const uint32_t quadrant = phase >> 30;
+        uint32_t p = phase & 0x3FFFFFFFu;
+        if (quadrant & 1u) p = (1u << 30) - p;  // mirror: [0, 2^30]
+        const uint32_t idx = p >> 22;
+        int32_t v = detail::FIXED16_SIN_QUARTER[idx];
+        if (idx < 256) {
+            const int32_t frac = static_cast<int32_t>((p >> 6) & 0xFFFFu);
+            v += ((detail::FIXED16_SIN_QUARTER[idx + 1] - v) * frac) >> 16;
+        }
+        return (quadrant & 2u) ? -v : v;
+    }
 };
 
 /**
@@ -47,15 +47,16 @@ namespace detail {
         }
     }
 
+    // The Fixed16 paths below never leave integer registers (no soft-float libm on FPU-less chips).
+
     template <typename T>
     inline T rsqrt_impl(T x) {
         // Reciprocal square root: 1/sqrt(x)
-        // Uses sqrt-based implementation for accuracy
         if constexpr (std::is_same_v<T, float>) {
             return static_cast<T>(1.0f) / std::sqrt(x);
         } else {
-            // Fixed16: compute sqrt then invert
-            return static_cast<T>(toScalar(1.0f)) / static_cast<T>(Fixed16::sqrt(x.toFloat()));
+            // Fixed16: Newton iteration from a table seed
+            return Fixed16::rsqrt(x);
         }
     }
 
@@ -64,7 +65,7 @@ namespace detail {
         if constexpr (std::is_same_v<T, float>) {
             return std::sin(x);
         } else {
-            return static_cast<T>(std::sin(x.toFloat()));
+            return Fixed16::sin(x);
         }
     }
 
@@ -73,7 +74,7 @@ namespace detail {
         if constexpr (std::is_same_v<T, float>) {
             return std::cos(x);
         } else {
-            return static_cast<T>(std::cos(x.toFloat()));
+            return Fixed16::cos(x);
         }
     }
 
@@ -82,7 +83,7 @@ namespace detail {
         if constexpr (std::is_same_v<T, float>) {
             return std::atan2(y, x);
         } else {
-            return static_cast<T>(std::atan2(y.toFloat(), x.toFloat()));
+            return Fixed16::atan2(y, x);
         }
     }
 
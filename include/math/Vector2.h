@@ -127,9 +127,17 @@ struct Vector2 {
 
     /** @brief Normalizes the vector in place. */
     inline void normalize() {
-        Scalar len = length();
-        if (len > toScalar(0)) {
-            *this /= len;
+        if constexpr (std::is_same_v<Scalar, float>) {
+            Scalar len = length();
+            if (len > toScalar(0)) {
+                *this /= len;
+            }
+        } else {
+            // Fixed16: one integer rsqrt and two multiplies instead of sqrt and two divisions.
+            Scalar lenSq = lengthSquared();
+            if (lenSq > toScalar(0)) {
+                *this *= rsqrt(lenSq);
+            }
         }
     }
 
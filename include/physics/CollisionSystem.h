@@ -8,8 +8,10 @@
 #pragma once
 #include <algorithm>
 #include <cstdint>
+#include <memory>
 #include "physics/CollisionTypes.h"
 #include "physics/SpatialGrid.h"
+#include "physics/PhysicsBodyStore.h"
 #include "math/Vector2.h"
 #include "math/Scalar.h"
 #include "core/Entity.h"
@@ -19,6 +21,8 @@ namespace pixelroot32::core { class Actor; class PhysicsActor; }
 
 namespace pixelroot32::physics {
 
+class PhysicsWorker;
+
 /**
  * @struct KinematicCollision
  * @brief Contains information about a collision involving a KinematicActor.
@@ -43,6 +47,34 @@ struct Contact {
     pixelroot32::math::Scalar penetration = pixelroot32::math::toScalar(0); ///< Penetration depth.
     pixelroot32::math::Scalar restitution = pixelroot32::math::toScalar(0); ///< Combined restitution coefficient.
     bool isSensorContact = false;  ///< True if either body is a sensor; no physics response applied.
+    pixelroot32::math::Scalar normalImpulse = pixelroot32::math::toScalar(0); ///< Accumulated normal impulse (warm-started from the pair cache).
+    pixelroot32::math::Scalar targetVelocity = pixelroot32::math::toScalar(0); ///< Normal velocity the solver drives towards (restitution).
+    int16_t pairIndex = -1;        ///< Broadphase pair caching this contact's impulse (-1: none).
+    int16_t slotA = -1;            ///< PhysicsBodyStore slot of bodyA (SoA mode).
+    int16_t slotB = -1;            ///< PhysicsBodyStore slot of bodyB (SoA mode).
+    bool wakeA = false;            ///< bodyA sleeps and was touched by an active body: wake it after the narrowphase.
+    bool wakeB = false;            ///< Same for bodyB.
+};
+
+/**
+ * @struct BroadphaseStats
+ * @brief Counters of the persistent broadphase pair list (see CollisionSystem::getBroadphaseStats()).
+ */
+struct BroadphaseStats {
+    uint16_t pairs = 0;         ///< Candidate pairs kept between steps.
+    uint16_t movedBodies = 0;   ///< Bodies whose cell range changed in the last detectCollisions().
+    uint16_t pairsGenerated = 0;  ///< Pairs produced by grid queries in the last detectCollisions() (0 when nothing moved).
+    bool pairOverflow = false;  ///< Pair list exceeded PHYSICS_MAX_PAIRS; pairs are enumerated every step.
+};
+
+/**
+ * @struct SolverStats
+ * @brief Contact cache and sleeping counters (see CollisionSystem::getSolverStats()).
+ */
+struct SolverStats {
+    uint16_t contacts = 0;        ///< Contacts generated in the last step.
+    uint16_t cachedContacts = 0;  ///< Contacts warm-started with a cached impulse in the last step.
+    uint16_t sleepingBodies = 0;  ///< RIGID bodies asleep after the last step.
 };
 
 /**
@@ -51,7 +83,8 @@ struct Contact {
  */
 class CollisionSystem {
 public:
-    static constexpr pixelroot32::math::Scalar FIXED_DT = pixelroot32::math::toScalar(1.0f / 60.0f);
+    static constexpr pixelroot32::math::Scalar FIXED_DT =
+        pixelroot32::math::toScalar(1.0f / static_cast<float>(pixelroot32::platforms::config::PhysicsStepHz));
     static constexpr pixelroot32::math::Scalar SLOP = pixelroot32::math::toScalar(0.02f);
     static constexpr pixelroot32::math::Scalar BIAS = pixelroot32::math::toScalar(0.2f);
     static constexpr pixelroot32::math::Scalar VELOCITY_THRESHOLD = pixelroot32::math::toScalar(0.5f);
@@ -91,6 +124,10 @@ public:
 
     /**
      * @brief Detects collisions between all registered bodies.
+     *
+     * The broadphase is incremental: bodies change grid cells only when their cell range
+     * changes, and candidate pairs persist between steps; only pairs of bodies that changed
+     * cells are regenerated. Idle bodies cost a cell-range check each.
      */
     void detectCollisions();
 
@@ -120,13 +157,73 @@ public:
      */
     size_t getEntityCount() const { return entityCount; }
 
+    /**
+     * @brief Sets the world rectangle the broadphase grid covers (the logical screen by default).
+     *
+     * Call with the level size in scrolling games; bodies beyond the bounds share border
+     * cells. Large worlds are stored sparsely (see SPATIAL_GRID_MAX_CELLS).
+     */
+    void setWorldBounds(int x, int y, int width, int height) { grid.setWorldBounds(x, y, width, height); }
+
+    /** @brief Broadphase occupancy and overflow counters. */
+    SpatialGridStats getGridStats() const { return grid.getStats(); }
+
+    /** @brief Contact cache and sleeping counters. */
+    SolverStats getSolverStats() const { return solverStats; }
+
+    /**
+     * @brief Enables warm-starting: contacts start from the impulse their pair accumulated in the
+     * previous step, so resting stacks converge in fewer iterations. Default: PHYSICS_WARM_STARTING.
+     */
+    void setWarmStarting(bool enabled) { warmStarting = enabled; }
+
+    /**
+     * @brief Runs update()'s integrate and solve loops over a structure-of-arrays copy of the
+     * bodies (PhysicsBodyStore) instead of the actors. Same results, fewer cache misses on
+     * large scenes; RigidActor::integrate() overrides are bypassed. Default: PHYSICS_SOA_BODIES.
+     */
+    void setSoaBodies(bool enabled) { soaBodies = enabled; }
+
+    /**
+     * @brief Splits the step over @p worker's thread (nullptr: serial).
+     *
+     * The narrowphase runs the two halves of the pair list concurrently into separate contact
+     * buffers, concatenated in pair order; contact islands (bodies joined by contacts) are
+     * dealt to the two threads and solved concurrently, each island's contacts in their serial
+     * order. Results are bit-identical to the serial step. Small steps (fewer than
+     * kParallelMinWork pairs or contacts) and a stopped worker run serially. The worker must
+     * outlive its use here; Engine owns one when PHYSICS_PARALLEL is set.
+     */
+    void setWorker(PhysicsWorker* worker);
+
+    /**
+     * @brief Enables island sleeping: RIGID bodies touching each other sleep together once all of
+     * them stayed below MIN_VELOCITY for PHYSICS_SLEEP_STEPS steps. Sleeping islands are not
+     * integrated, and their contacts with static or sleeping bodies are skipped. Disabling wakes
+     * every body. Default: on unless PHYSICS_SLEEP_STEPS is 0.
+     */
+    void setSleepingEnabled(bool enabled);
+
+    /** @brief Persistent pair list counters. */
+    BroadphaseStats getBroadphaseStats() const {
+        BroadphaseStats stats;
+        stats.pairs = static_cast<uint16_t>(pairsValid ? pairCount : 0);
+        stats.movedBodies = movedBodies;
+        stats.pairsGenerated = pairsGenerated;
+        stats.pairOverflow = pairOverflow;
+        return stats;
+    }
+
     /**
      * @brief Clears the collision system state.
      */
-    void clear() { entityCount = 0; contactCount = 0; grid.clear(); }
+    void clear() { entityCount = 0; contactCount = 0; grid.clear(); moversDirty = true; }
 
     /**
      * @brief Checks for collisions with a specific actor.
+     *
+     * Candidates come from queryAABB() over the actor's hit box, then the shape-specific
+     * overlap test and layer/mask rule apply.
      * @param actor The actor to check.
      * @param outArray Array to store colliding actors.
      * @param count Reference to store the number of collisions found.
@@ -137,6 +234,60 @@ public:
                        pixelroot32::core::Actor** outArray, 
                        int& count, int maxCount);
 
+    // Spatial queries visit only the grid cells the shape touches. STATIC bodies live in the
+    // static layer; everything else (RIGID, KINEMATIC, plain actors) in the dynamic layer,
+    // refilled every detectCollisions() and kept between steps. Candidates are tested at their
+    // current hit boxes (inclusive edges; circle shapes by their bounding box), but a body
+    // moved by writing `position` is only found in the cells it occupied at the last physics
+    // step unless updateBody() is called; moveAndCollide() does this itself.
+
+    /**
+     * @brief Collects registered actors whose hit box overlaps @p box.
+     * @param box Query rectangle.
+     * @param filter Layer filter (QueryFilter::forActor() for an actor's own queries).
+     * @param out Reusable result buffer (cleared first).
+     */
+    void queryAABB(const pixelroot32::core::Rect& box, const QueryFilter& filter, SpatialQueryResults& out);
+
+    /**
+     * @brief Collects registered actors whose hit box contains @p point.
+     * @param point Query point.
+     * @param filter Layer filter.
+     * @param out Reusable result buffer (cleared first).
+     */
+    void queryPoint(pixelroot32::math::Vector2 point, const QueryFilter& filter, SpatialQueryResults& out);
+
+    /**
+     * @brief Collects registered actors that @p box touches while moving by @p motion.
+     * @param box Rectangle at the start of the motion.
+     * @param motion Displacement of the rectangle.
+     * @param filter Layer filter.
+     * @param out Reusable result buffer (cleared first).
+     */
+    void querySwept(const pixelroot32::core::Rect& box, pixelroot32::math::Vector2 motion,
+                    const QueryFilter& filter, SpatialQueryResults& out);
+
+    /**
+     * @brief Finds the nearest registered actor along a ray.
+     * @param origin Ray origin.
+     * @param direction Ray direction (need not be normalized).
+     * @param maxDistance Ray length.
+     * @param filter Layer filter.
+     * @param outHit Nearest hit, written only when the function returns true.
+     * @return True if something was hit within @p maxDistance.
+     */
+    bool raycast(pixelroot32::math::Vector2 origin, pixelroot32::math::Vector2 direction,
+                 pixelroot32::math::Scalar maxDistance, const QueryFilter& filter, RaycastHit& outHit);
+
+    /**
+     * @brief Re-registers a body in the grid after it moved outside the physics step.
+     *
+     * Adds the cells it now covers to the dynamic layer (stale cells are harmless: every
+     * candidate is tested exactly). For a STATIC body the static layer is rebuilt instead.
+     * @param actor A registered actor.
+     */
+    void updateBody(pixelroot32::core::Actor* actor);
+
     /**
      * @brief Checks if a body requires continuous collision detection (CCD).
      * @param body The physics actor to check.
@@ -176,9 +327,13 @@ private:
     static constexpr int kVelocityIterations = pixelroot32::platforms::config::VelocityIterations;
     static constexpr uint16_t kMaxEntities = pixelroot32::platforms::config::PhysicsMaxEntities;
 
+    static constexpr int kSleepSteps = pixelroot32::platforms::config::PhysicsSleepSteps;
+    static constexpr int kParallelMinWork = 32;  ///< Pairs / contacts below which a dispatch costs more than it saves.
+
     struct CollisionPair {
-        pixelroot32::core::Actor* a;
-        pixelroot32::core::Actor* b;
+        pixelroot32::core::PhysicsActor* a;  ///< Lower entityId.
+        pixelroot32::core::PhysicsActor* b;
+        pixelroot32::math::Vector2 impulse;  ///< Impulse applied to @ref a in the last step (the contact cache).
     };
 
     // Fixed-size array instead of std::vector (zero heap allocation)
@@ -188,9 +343,142 @@ private:
     int contactCount = 0;
     SpatialGrid grid;
     uint16_t nextEntityId = 1;  ///< Next id to assign on addEntity; 0 is reserved for "unregistered".
+
+    // Everything that is not a STATIC body: the dynamic layer's contents.
+    pixelroot32::core::Actor* movers[kMaxEntities];
+    uint16_t moverCount = 0;
+    bool moversDirty = true;
+    SpatialQueryResults queryScratch;  ///< Candidate buffer for checkCollision().
+
+    // Persistent broadphase pairs; invalid after static/mover list changes or an overflow.
+    CollisionPair pairs[kMaxPairs];
+    int pairCount = 0;
+    bool pairsValid = false;
+    bool pairOverflow = false;
+    uint16_t movedBodies = 0;
+    uint16_t pairsGenerated = 0;
+    static constexpr int kMaxCandidates = 64;
+    pixelroot32::core::Actor* candidateScratch[kMaxCandidates];  ///< getPotentialColliders() output.
+    CollisionPair pairScratch[kMaxPairs];  ///< Old or removed pairs whose impulses are carried over.
+
+    bool warmStarting = pixelroot32::platforms::config::PhysicsWarmStarting;
+    bool sleepingEnabled = kSleepSteps > 0;
+    uint16_t nextSleepIsland = 1;
+    // Island sleeping scratch (wakeIslands / updateSleeping).
+    uint16_t wokenIslands[kMaxEntities];
+    pixelroot32::core::PhysicsActor* sleepBodies[kMaxEntities];
+    uint16_t sleepParent[kMaxEntities];   ///< Union-find over the awake RIGID bodies.
+    uint16_t islandRest[kMaxEntities];    ///< Fewest rest steps in each island (by root).
+    uint16_t islandId[kMaxEntities];      ///< Sleep island id given to each root (0: none yet).
+    SolverStats solverStats;
+
+    bool soaBodies = pixelroot32::platforms::config::PhysicsSoaBodies;
+    PhysicsBodyStore bodyStore;
+    bool bodiesInStore = false;  ///< Between integration and writeBack(): the step's body state is in bodyStore.
+
+    /// Narrowphase output: the contacts array, or a worker's own buffer.
+    struct ContactBuffer {
+        Contact* data;
+        int count;
+    };
+
+    /// Buffers of the parallel step, allocated by the first setWorker().
+    struct ParallelScratch {
+        Contact contacts[kMaxContacts];     ///< Contacts of the second half of the pair list.
+        uint16_t order[2][kMaxContacts];    ///< Contact indices each thread solves, in contact order.
+        int orderCount[2];
+        uint16_t parent[kMaxEntities];      ///< Island union-find over solverIndex.
+        uint16_t islandLoad[kMaxEntities];  ///< Contacts per island root.
+        int8_t islandHalf[kMaxEntities];    ///< Thread an island root was dealt to (-1: none yet).
+    };
+
+    PhysicsWorker* worker = nullptr;
+    std::unique_ptr<ParallelScratch> parallel;
+
+    /** True if a running worker and the parallel buffers are available. */
+    bool parallelReady() const;
+
+    /** Brings the static layer, the mover list and the dynamic layer up to date before a query. */
+    void prepareQueries();
+
+    /** Re-buckets every mover at its current position. */
+    void refreshDynamic();
+
+    /** Calls @p fn(a, b) once per candidate pair from full grid queries (a has the lower entityId). */
+    template <typename Fn>
+    void forEachCandidatePair(Fn&& fn);
+
+    /** Rebuilds the pair list from scratch; sets pairOverflow if it does not fit. */
+    void rebuildPairs();
+
+    /** Replaces the pairs of @p actor after its cell range changed. */
+    void refreshPairs(pixelroot32::core::Actor* actor);
+
+    /** Keeps @p a / @p b as a pair with cached @p impulse; @return false if the list is full. */
+    bool addPair(pixelroot32::core::PhysicsActor* a, pixelroot32::core::PhysicsActor* b,
+                 pixelroot32::math::Vector2 impulse);
+
+    /** Impulse cached for @p a / @p b in @p list, or zero. */
+    static pixelroot32::math::Vector2 cachedImpulse(const CollisionPair* list, int count,
+                                                    const pixelroot32::core::PhysicsActor* a,
+                                                    const pixelroot32::core::PhysicsActor* b);
+
+    /**
+     * Narrowphase for one candidate pair (@p pairIndex -1 when uncached): sleep filter, contact
+     * cache and wake-up flags. Writes only @p out and its own pair, so halves can run concurrently.
+     */
+    void collidePair(pixelroot32::core::PhysicsActor* pA, pixelroot32::core::PhysicsActor* pB, int pairIndex,
+                     ContactBuffer& out);
+
+    /** Contact generation for one pair: filters, CCD or discrete contact generation. */
+    void collidePairContacts(pixelroot32::core::PhysicsActor* pA, pixelroot32::core::PhysicsActor* pB,
+                             ContactBuffer& out);
+
+    /** Narrowphase over the pair list split in two halves; the second half's contacts are appended. */
+    void collidePairsParallel();
+
+    /** Applies the contacts' wake-up flags and counts warm-started contacts. */
+    void finishContacts();
+
+    /**
+     * Solves velocities and penetration island by island on two threads, then caches impulses.
+     * @return false (nothing done) when the step is too small or forms a single island.
+     */
+    bool solveIslandsParallel();
+
+    /** Deals contact islands to the two threads; @return false if one thread would get nothing. */
+    bool partitionIslands();
+
+    /** Velocity solver over @p order (indices into contacts; nullptr: the first @p count). */
+    void solveVelocityContacts(const uint16_t* order, int count);
+
+    /** Penetration solver over @p order (indices into contacts; nullptr: the first @p count). */
+    void solvePenetrationContacts(const uint16_t* order, int count);
+
+    /** Stores the contacts' accumulated impulses in their pairs for the next step. */
+    void cacheContactImpulses();
+
+    /** Wakes every island one of whose bodies was woken since the last step. */
+    void wakeIslands();
+
+    /** Counts rest steps and puts islands that stayed slow long enough to sleep. */
+    void updateSleeping();
+
+    /** Wakes all bodies (support removed, sleeping disabled). */
+    void wakeAll();
+
+    /** Position, velocity and hit box of a body as the step sees them (bodyStore's copy while it holds them). */
+    pixelroot32::math::Vector2 bodyPosition(const pixelroot32::core::PhysicsActor* body) const;
+    pixelroot32::math::Vector2 bodyVelocity(const pixelroot32::core::PhysicsActor* body) const;
+    pixelroot32::core::Rect bodyHitBox(pixelroot32::core::PhysicsActor* body) const;
+    pixelroot32::core::Rect bodyHitBox(pixelroot32::core::Actor* actor) const;
+
+    /** Shape-specific overlap test used by checkCollision(). */
+    bool overlaps(pixelroot32::core::Actor* a, pixelroot32::core::Actor* b) const;
     
     bool generateContact(pixelroot32::core::PhysicsActor* a, 
-                         pixelroot32::core::PhysicsActor* b);
+                         pixelroot32::core::PhysicsActor* b,
+                         ContactBuffer& out);
     bool generateCircleVsCircleContact(Contact& contact);
     bool generateAABBVsAABBContact(Contact& contact);
     bool generateCircleVsAABBContact(Contact& contact, 
@@ -5,6 +5,7 @@
 #pragma once
 #include <cstdint>
 #include "math/Scalar.h"
+#include "math/Vector2.h"
 
 namespace pixelroot32 {
 namespace core {
@@ -86,4 +87,37 @@ bool sweepCircleVsRect(const Circle& start,
                        const pixelroot32::core::Rect& rect,
                        pixelroot32::math::Scalar& tHit);
 
+/**
+ * @brief Sweeps a rectangle against a fixed rectangle to find the time of first contact.
+ *
+ * Analytic slab test with the same inclusive edges as Rect::intersects (touching counts).
+ * If the rectangles already touch or overlap at the start, the hit is at t = 0 and the
+ * normal is the axis of least penetration; otherwise it is the face entered first (ties
+ * resolve to the vertical axis). A zero-size @p moving rectangle makes this a segment cast.
+ * @param moving Rectangle at the start of the motion.
+ * @param motion Displacement over the sweep (t = 0 .. 1).
+ * @param target The fixed rectangle.
+ * @param tHit Reference to store the time of first contact in [0, 1].
+ * @param normal Reference to store the contact normal (unit axis, pointing towards @p moving).
+ * @return True if the rectangles touch at some t in [0, 1].
+ */
+bool sweepRectVsRect(const pixelroot32::core::Rect& moving,
+                     const pixelroot32::math::Vector2& motion,
+                     const pixelroot32::core::Rect& target,
+                     pixelroot32::math::Scalar& tHit,
+                     pixelroot32::math::Vector2& normal);
+
+/**
+ * @brief Sweeps a circle against a fixed circle to find the time of first contact.
+ * @param moving Circle at the start of the motion.
+ * @param motion Displacement over the sweep (t = 0 .. 1).
+ * @param target The fixed circle.
+ * @param tHit Reference to store the time of first contact in [0, 1] (0 if already overlapping).
+ * @return True if the circles touch at some t in [0, 1].
+ */
+bool sweepCircleVsCircle(const Circle& moving,
+                         const pixelroot32::math::Vector2& motion,
+                         const Circle& target,
+                         pixelroot32::math::Scalar& tHit);
+
 }
@@ -39,10 +39,14 @@ public:
 
     /**
      * @brief Moves the body along a vector and stops at the first collision.
+     *
+     * One swept query (CollisionSystem::querySwept) collects what the hit box can reach,
+     * then an analytic time of impact per candidate picks the first blocker. Bodies already
+     * touching only block motion that pushes into them.
      * @param motion The relative movement vector.
      * @param outCollision Pointer to store collision data if a hit occurs.
      * @param testOnly If true, checks for collision without moving.
-     * @param safeMargin Extra margin for collision recovery.
+     * @param safeMargin Distance kept from the collider along the contact normal.
      * @param recoveryAsCollision If true, depenetration is reported as collision.
      * @return true if a collision occurred.
      */
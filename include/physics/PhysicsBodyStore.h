@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#pragma once
+#include <cstdint>
+#include "math/Scalar.h"
+#include "math/Vector2.h"
+#include "core/Entity.h"
+#include "platforms/EngineConfig.h"
+
+namespace pixelroot32::core { class PhysicsActor; }
+
+namespace pixelroot32::physics {
+
+struct Contact;
+
+/**
+ * @class PhysicsBodyStore
+ * @brief Structure-of-arrays copy of the physics bodies for the integrate and solve loops.
+ *
+ * gather() walks the entity list once per step (the only virtual calls and pointer chases),
+ * copies every physics body into contiguous arrays and tags it with its slot
+ * (PhysicsActor::solverIndex). Awake RIGID bodies take the first slots, so integration is a
+ * straight loop with no type checks. The integrate and solve loops then run over the arrays,
+ * and the narrowphase reads the integrated state from them (position(), velocity(), hitBox()),
+ * so the actors are written once per step, by writeBack(). Hit boxes keep the offset and size
+ * getHitBox() gave at gather(): no user code runs between gather() and writeBack().
+ *
+ * The arithmetic mirrors RigidActor::integrate() and the CollisionSystem solver step for step,
+ * so both layouts produce bit-identical results. Used by CollisionSystem::update() when
+ * PHYSICS_SOA_BODIES is set (see CollisionSystem::setSoaBodies()).
+ */
+class PhysicsBodyStore {
+public:
+    static constexpr int kCapacity = pixelroot32::platforms::config::PhysicsMaxEntities;
+
+    /**
+     * @brief Copies the physics bodies of @p entities into the arrays and assigns their slots.
+     * Also stores each body's previous position (the pass CollisionSystem::update() makes anyway).
+     */
+    void gather(pixelroot32::core::Entity* const* entities, uint16_t entityCount);
+
+    /**
+     * @brief Integrates forces, gravity and friction into velocities, then velocities into
+     * positions, for awake RIGID bodies. Only the arrays change; see writeBack().
+     */
+    void integrate(pixelroot32::math::Scalar dt);
+
+    /** @brief Gives a body woken during the narrowphase its inverse mass back. */
+    void wake(int slot);
+
+    /**
+     * @brief Velocity solver over @p contacts (prestep, warm start, accumulated impulses).
+     * @param order Indices of the @p contactCount contacts to solve, or nullptr for the first ones.
+     */
+    void solveVelocity(Contact* contacts, int contactCount, const uint16_t* order = nullptr);
+
+    /** @brief Penetration solver over @p contacts (@p order as in solveVelocity()). */
+    void solvePenetration(const Contact* contacts, int contactCount, const uint16_t* order = nullptr);
+
+    /**
+     * @brief Writes positions and velocities of bodies the step moved back to the actors, and
+     * clears the forces of the integrated ones.
+     */
+    void writeBack();
+
+    /** @brief Position of the body in @p slot, as integrated and solved so far this step. */
+    pixelroot32::math::Vector2 position(int slot) const { return pixelroot32::math::Vector2(posX[slot], posY[slot]); }
+
+    /** @brief Velocity of the body in @p slot, as integrated and solved so far this step. */
+    pixelroot32::math::Vector2 velocity(int slot) const { return pixelroot32::math::Vector2(velX[slot], velY[slot]); }
+
+    /** @brief Hit box of the body in @p slot at its current position(). */
+    pixelroot32::core::Rect hitBox(int slot) const {
+        return {pixelroot32::math::Vector2(posX[slot] + boxX[slot], posY[slot] + boxY[slot]), boxW[slot], boxH[slot]};
+    }
+
+    /** @brief Number of bodies gathered in the last step. */
+    int size() const { return count; }
+
+private:
+    pixelroot32::core::PhysicsActor* actors[kCapacity];
+    pixelroot32::math::Scalar posX[kCapacity];
+    pixelroot32::math::Scalar posY[kCapacity];
+    pixelroot32::math::Scalar velX[kCapacity];
+    pixelroot32::math::Scalar velY[kCapacity];
+    pixelroot32::math::Scalar forceX[kCapacity];
+    pixelroot32::math::Scalar forceY[kCapacity];
+    pixelroot32::math::Scalar mass[kCapacity];
+    pixelroot32::math::Scalar invMass[kCapacity];  ///< 0 for STATIC, KINEMATIC and sleeping bodies.
+    pixelroot32::math::Scalar gravityScale[kCapacity];
+    pixelroot32::math::Scalar friction[kCapacity];
+    pixelroot32::math::Scalar boxX[kCapacity];  ///< Hit box offset from the position (0 for the default box).
+    pixelroot32::math::Scalar boxY[kCapacity];
+    int16_t boxW[kCapacity];
+    int16_t boxH[kCapacity];
+    int count = 0;
+    int rigidCount = 0;  ///< Awake RIGID bodies, in slots [0, rigidCount).
+};
+
+} // namespace pixelroot32::physics
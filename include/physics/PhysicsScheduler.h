@@ -16,8 +16,9 @@ namespace pixelroot32::physics {
 
 class PhysicsScheduler {
 public:
-    /// Fixed timestep in microseconds (60 Hz)
-    static constexpr uint32_t FIXED_DT_MICROS = 16667;
+    /// Fixed timestep in microseconds (PHYSICS_STEP_HZ, 16667 at the default 60 Hz)
+    static constexpr uint32_t FIXED_DT_MICROS =
+        (1000000u + pixelroot32::platforms::config::PhysicsStepHz / 2) / pixelroot32::platforms::config::PhysicsStepHz;
     
     /// Maximum physics steps per frame under normal conditions
     static constexpr uint8_t MAX_STEPS_NORMAL = 1;
@@ -74,6 +75,15 @@ public:
     /// @return Accumulated microseconds pending
     uint32_t getAccumulator() const { return accumulatorMicros; }
 
+    /// Render interpolation factor: the fraction of a step left in the accumulator
+    /// Drawing bodies at lerp(previous, current, alpha) shows the simulation one step behind
+    /// real time, without judder (see PhysicsActor::getRenderPosition()).
+    /// @return Alpha in [0, 1]; 1 while catching up with a backlog
+    pixelroot32::math::Scalar getAlpha() const {
+        if (accumulatorMicros >= FIXED_DT_MICROS) return pixelroot32::math::toScalar(1.0f);
+        return pixelroot32::math::toScalar(static_cast<float>(accumulatorMicros) / static_cast<float>(FIXED_DT_MICROS));
+    }
+
 private:
     /// Accumulated time in microseconds (no clamping - preserves real time)
     uint32_t accumulatorMicros = 0;
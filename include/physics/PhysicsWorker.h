@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#pragma once
+
+#include "platforms/PlatformCapabilities.h"
+#include "platforms/WorkerThread.h"
+
+namespace pixelroot32::physics {
+
+/**
+ * @class PhysicsWorker
+ * @brief Second thread for the parallel physics step (see CollisionSystem::setWorker()).
+ *
+ * run() splits a job in two halves: half 1 goes to the worker (platforms::WorkerThread, the
+ * same handoff graphics::PresentPipeline uses) while the calling thread runs half 0, then
+ * waits for the worker. When the worker is not running, run() executes both halves on the
+ * caller, so results never depend on whether it started.
+ */
+class PhysicsWorker {
+public:
+    PhysicsWorker() = default;
+    ~PhysicsWorker();
+
+    PhysicsWorker(const PhysicsWorker&) = delete;
+    PhysicsWorker& operator=(const PhysicsWorker&) = delete;
+
+    /**
+     * @brief Starts the worker.
+     * @param caps Placement: caps.physicsWorkerCoreId / caps.physicsWorkerPriority.
+     * @return false when the platform has no threads or the task cannot be created.
+     */
+    bool start(const pixelroot32::platforms::PlatformCapabilities& caps);
+
+    /** @brief Stops the worker; later run() calls execute serially. */
+    void stop();
+
+    bool isRunning() const { return worker.isRunning(); }
+
+    /**
+     * @brief Runs @p job(1) on the worker and @p job(0) on the caller; returns when both finished.
+     * @param job Callable taking the half index. Halves must not write shared state.
+     */
+    template <typename Job>
+    void run(Job& job) {
+        if (!isRunning()) {
+            job(0);
+            job(1);
+            return;
+        }
+        worker.dispatch(&invoke<Job>, &job);
+        job(0);
+        worker.wait();
+    }
+
+private:
+    template <typename Job>
+    static void invoke(void* job) { (*static_cast<Job*>(job))(1); }
+
+    pixelroot32::platforms::WorkerThread worker;
+};
+
+} // namespace pixelroot32::physics
@@ -20,7 +20,12 @@ class RigidActor : public pixelroot32::core::PhysicsActor {
 protected:
     pixelroot32::math::Vector2 force; ///< Accumulated force for the current frame.
 
+    friend class PhysicsBodyStore;
+
 public:
+    /** @brief World gravity in px/s², scaled per body by its gravity scale. */
+    static constexpr pixelroot32::math::Scalar kGravity = pixelroot32::math::toScalar(200.0f);
+
     /**
      * @brief Constructs a new RigidActor.
      * @param x X position.
@@ -39,13 +44,13 @@ public:
     RigidActor(pixelroot32::math::Vector2 position, int w, int h);
 
     /**
-     * @brief Applies a force to the center of mass.
+     * @brief Applies a force to the center of mass. A non-zero force wakes the body.
      * @param f Force vector.
      */
     void applyForce(const pixelroot32::math::Vector2& f);
 
     /**
-     * @brief Applies an instantaneous impulse (velocity change).
+     * @brief Applies an instantaneous impulse (velocity change). A non-zero impulse wakes the body.
      * @param j Impulse vector.
      */
     void applyImpulse(const pixelroot32::math::Vector2& j);
@@ -5,28 +5,121 @@
 #pragma once
 #include <cstdint>
 #include "math/Scalar.h"
+#include "math/Vector2.h"
+#include "physics/CollisionTypes.h"
 #include "platforms/EngineConfig.h"
 
-namespace pixelroot32::core { class Actor; class Entity; }
+namespace pixelroot32::core { class Actor; class Entity; struct Rect; }
 
 namespace pixelroot32::physics {
 
+/**
+ * @struct QueryFilter
+ * @brief Layer filtering and self-exclusion for spatial queries.
+ *
+ * A candidate passes when `(mask & candidate.layer) != 0` or `(layer & candidate.mask) != 0`,
+ * the same symmetric rule actor pairs use. The default accepts every layer.
+ */
+struct QueryFilter {
+    CollisionLayer layer = DefaultLayers::kNone;        ///< Layers the querier is on (matched against candidate masks).
+    CollisionLayer mask = DefaultLayers::kAll;          ///< Layers the querier looks for (matched against candidate layers).
+    const pixelroot32::core::Actor* exclude = nullptr;  ///< Actor never reported (usually the querier).
+
+    /** @brief Filter an actor's own collision queries use: its layer and mask, excluding itself. */
+    static QueryFilter forActor(const pixelroot32::core::Actor* actor);
+
+    /** @brief True if @p other passes the layer test and is not excluded. */
+    bool accepts(const pixelroot32::core::Actor* other) const;
+};
+
+/**
+ * @struct SpatialQueryResults
+ * @brief Fixed-capacity result buffer for spatial queries; keep one around and reuse it.
+ *
+ * Queries clear it first. Hits beyond kCapacity are dropped and flagged in @ref overflow.
+ */
+struct SpatialQueryResults {
+    static constexpr int kCapacity = pixelroot32::platforms::config::SpatialGridMaxQueryResults;
+
+    pixelroot32::core::Actor* actors[kCapacity];
+    int count = 0;
+    bool overflow = false;
+
+    void clear() { count = 0; overflow = false; }
+
+    void add(pixelroot32::core::Actor* actor) {
+        if (count < kCapacity) actors[count++] = actor;
+        else overflow = true;
+    }
+
+    pixelroot32::core::Actor* const* begin() const { return actors; }
+    pixelroot32::core::Actor* const* end() const { return actors + count; }
+};
+
+/**
+ * @struct RaycastHit
+ * @brief Nearest hit reported by a raycast.
+ */
+struct RaycastHit {
+    pixelroot32::core::Actor* actor = nullptr;                         ///< Actor hit.
+    pixelroot32::math::Vector2 point;                                  ///< Point where the ray enters the hit box.
+    pixelroot32::math::Vector2 normal;                                 ///< Face normal at @ref point.
+    pixelroot32::math::Scalar distance = pixelroot32::math::toScalar(0); ///< Distance from the ray origin.
+};
+
+/**
+ * @struct SpatialGridStats
+ * @brief Occupancy counters of a SpatialGrid (see SpatialGrid::getStats()).
+ *
+ * Overflowed bodies are not lost: they are scanned by every query, which costs O(n) per query
+ * instead of O(1). Non-zero values mean the world bounds, cell size or per-cell capacities
+ * need tuning.
+ */
+struct SpatialGridStats {
+    uint16_t staticOverflow = 0;   ///< STATIC bodies that did not fit a full cell.
+    uint16_t dynamicOverflow = 0;  ///< Moving bodies that did not fit a full cell.
+    uint16_t outsideWorld = 0;     ///< Bodies extending beyond the world bounds (folded into border cells).
+    uint16_t maxCellLoad = 0;      ///< Fullest cell slot (static + dynamic entries).
+    bool hashed = false;           ///< True if the world has more cells than slots (sparse hash storage).
+};
+
 /**
  * @class SpatialGrid
  * @brief Optimized spatial partitioning with separate static/dynamic layers.
  *
  * Static layer: built once per level (or when entities change), not cleared each frame.
- * Dynamic layer: cleared and refilled every frame (RIGID, KINEMATIC).
+ * Dynamic layer: RIGID, KINEMATIC and plain actors, kept up to date incrementally:
+ * syncDynamic() moves a body between cells only when its cell range changes.
  * Reduces per-frame cost when many static tiles are present.
+ *
+ * The grid covers world bounds (the logical screen by default, see setWorldBounds());
+ * border cells also hold everything beyond them. When the world has more cells than
+ * kMaxCells, cells are mapped onto the slots by a hash: cells sharing a slot only add
+ * candidates, which the exact tests reject. Storage belongs to the instance.
  */
 class SpatialGrid {
 public:
     static constexpr int kCellSize = pixelroot32::platforms::config::SpatialGridCellSize;
-    static constexpr int kMaxCells = (pixelroot32::platforms::config::LogicalWidth / kCellSize + 1) *
-                                     (pixelroot32::platforms::config::LogicalHeight / kCellSize + 1);
+    static constexpr int kMaxCells = pixelroot32::platforms::config::SpatialGridMaxCells;
     static constexpr int kMaxStaticPerCell = pixelroot32::platforms::config::SpatialGridMaxStaticPerCell;
     static constexpr int kMaxDynamicPerCell = pixelroot32::platforms::config::SpatialGridMaxDynamicPerCell;
 
+    SpatialGrid();
+
+    /**
+     * @brief Sets the world rectangle the grid covers and empties both layers.
+     *
+     * Use the level size for scrolling worlds so off-screen bodies keep their own cells.
+     * @param x Left edge in world pixels.
+     * @param y Top edge in world pixels.
+     * @param width World width in pixels (at least one cell).
+     * @param height World height in pixels (at least one cell).
+     */
+    void setWorldBounds(int x, int y, int width, int height);
+
+    /** @brief Occupancy counters of the current layers. */
+    SpatialGridStats getStats() const;
+
     /**
      * @brief Clears all dynamic entities from the grid.
      */
@@ -46,14 +139,31 @@ public:
      * @brief Rebuilds the static layer if marked dirty.
      * @param entities Pointer to array of entities.
      * @param entityCount Total number of entities.
+     * @return True if the static layer was rebuilt.
      */
-    void rebuildStaticIfNeeded(pixelroot32::core::Entity* const* entities, uint16_t entityCount);
+    bool rebuildStaticIfNeeded(pixelroot32::core::Entity* const* entities, uint16_t entityCount);
 
     /**
-     * @brief Inserts a dynamic actor into the grid.
+     * @brief Inserts a dynamic actor into the grid (same as syncDynamic()).
      * @param actor The actor to insert.
      */
-    void insertDynamic(pixelroot32::core::Actor* actor);
+    void insertDynamic(pixelroot32::core::Actor* actor) { syncDynamic(actor); }
+
+    /**
+     * @brief Brings a dynamic actor's cells up to date with its hit box.
+     *
+     * The grid caches each actor's cell range; only the cells it leaves or enters are touched,
+     * and nothing at all when the range is unchanged.
+     * @param actor The actor to insert or update.
+     * @return True if the actor's cell range changed (or it was not in the grid yet).
+     */
+    bool syncDynamic(pixelroot32::core::Actor* actor);
+
+    /** @brief syncDynamic() with the actor's hit box given (e.g. not yet written back to it). */
+    bool syncDynamic(pixelroot32::core::Actor* actor, const pixelroot32::core::Rect& box);
+
+    /** @brief True if the dynamic layer was filled since the last clear() or setWorldBounds(). */
+    bool hasDynamicLayer() const { return dynamicValid; }
 
     /**
      * @brief Gets potential colliders for a given actor from the grid.
@@ -64,16 +174,117 @@ public:
      */
     void getPotentialColliders(pixelroot32::core::Actor* actor, pixelroot32::core::Actor** outArray, int& count, int maxCount);
 
+    /** @brief getPotentialColliders() with the actor's hit box given. */
+    void getPotentialColliders(pixelroot32::core::Actor* actor, const pixelroot32::core::Rect& box,
+                               pixelroot32::core::Actor** outArray, int& count, int maxCount);
+
+    // Queries visit only the cells the shape touches, in both layers, and test each candidate's
+    // hit box exactly (inclusive edges, like Rect::intersects). Candidates are deduplicated.
+
+    /**
+     * @brief Collects actors whose hit box overlaps @p box.
+     * @param box Query rectangle.
+     * @param filter Layer filter.
+     * @param out Result buffer (cleared first).
+     */
+    void queryAABB(const pixelroot32::core::Rect& box, const QueryFilter& filter, SpatialQueryResults& out);
+
+    /**
+     * @brief Collects actors whose hit box contains @p point.
+     * @param point Query point.
+     * @param filter Layer filter.
+     * @param out Result buffer (cleared first).
+     */
+    void queryPoint(pixelroot32::math::Vector2 point, const QueryFilter& filter, SpatialQueryResults& out);
+
+    /**
+     * @brief Collects actors that @p box touches while moving by @p motion.
+     *
+     * Candidates come from the cells under the swept bounds; each is kept only if the
+     * analytic sweep (sweepRectVsRect) hits it within the motion.
+     * @param box Rectangle at the start of the motion.
+     * @param motion Displacement of the rectangle.
+     * @param filter Layer filter.
+     * @param out Result buffer (cleared first).
+     */
+    void querySwept(const pixelroot32::core::Rect& box, pixelroot32::math::Vector2 motion,
+                    const QueryFilter& filter, SpatialQueryResults& out);
+
+    /**
+     * @brief Finds the nearest hit box along a ray, walking cells front to back (DDA).
+     *
+     * Stops at the first cell whose far edge lies beyond the nearest hit found so far.
+     * @param origin Ray origin.
+     * @param direction Ray direction (need not be normalized).
+     * @param maxDistance Ray length.
+     * @param filter Layer filter.
+     * @param outHit Nearest hit, written only when the function returns true.
+     * @return True if something was hit within @p maxDistance.
+     */
+    bool raycast(pixelroot32::math::Vector2 origin, pixelroot32::math::Vector2 direction,
+                 pixelroot32::math::Scalar maxDistance, const QueryFilter& filter, RaycastHit& outHit);
+
 private:
-    static pixelroot32::core::Actor* staticCells[kMaxCells][kMaxStaticPerCell];
-    static int staticCellCounts[kMaxCells];
-    static pixelroot32::core::Actor* dynamicCells[kMaxCells][kMaxDynamicPerCell];
-    static int dynamicCellCounts[kMaxCells];
+    pixelroot32::core::Actor* staticCells[kMaxCells][kMaxStaticPerCell];
+    int staticCellCounts[kMaxCells];
+    pixelroot32::core::Actor* dynamicCells[kMaxCells][kMaxDynamicPerCell];
+    int dynamicCellCounts[kMaxCells];
+
+    // Bodies dropped from at least one full cell; every query scans them so nothing is missed.
+    static constexpr int kMaxOverflow = pixelroot32::platforms::config::PhysicsMaxEntities;
+    pixelroot32::core::Actor* staticOverflow[kMaxOverflow];
+    int staticOverflowCount = 0;
+    pixelroot32::core::Actor* dynamicOverflow[kMaxOverflow];
+    int dynamicOverflowCount = 0;
+
+    // Cached cell range of each dynamic actor (indexed by Actor::broadphaseProxy).
+    struct DynamicProxy {
+        pixelroot32::core::Actor* actor;
+        int16_t minCol, minRow, maxCol, maxRow;
+        bool overflowed;  ///< Missing from a full cell, so listed in dynamicOverflow.
+        bool outside;     ///< Extends beyond the world bounds.
+    };
+    DynamicProxy proxies[kMaxOverflow];
+    int proxyCount = 0;
+
+    uint16_t staticOutside = 0;   ///< STATIC bodies beyond the world bounds at the last rebuild.
+    uint16_t dynamicOutside = 0;  ///< Moving bodies beyond the world bounds.
 
     bool staticDirty = true;
+    bool dynamicValid = false;
     int queryId = 0;
 
-    int getCellIndex(pixelroot32::math::Scalar x, pixelroot32::math::Scalar y) const;
+    int worldX = 0;
+    int worldY = 0;
+    int cols = pixelroot32::platforms::config::LogicalWidth / kCellSize + 1;
+    int rows = pixelroot32::platforms::config::LogicalHeight / kCellSize + 1;
+    bool hashed = false;
+
+    /** Cell range covered by @p rect, clamped to the world; @return false if it extends beyond it. */
+    bool getCellRange(const pixelroot32::core::Rect& rect, int& minCol, int& minRow, int& maxCol, int& maxRow) const;
+
+    /** Slot holding cell (@p col, @p row). */
+    int slotOf(int col, int row) const;
+
+    /** Calls @p fn(col, row, slot) per cell of the range (hashed grids may repeat a slot). */
+    template <typename Fn>
+    void forEachCell(int minCol, int minRow, int maxCol, int maxRow, Fn&& fn) const;
+
+    /** Adds @p actor to the cells under its hit box; @return false if a full cell dropped it. */
+    bool insertStatic(pixelroot32::core::Actor* actor);
+
+    /** Removes @p actor from the dynamic cells of @p proxy's range, except those inside the given range. */
+    void removeDynamicCells(const DynamicProxy& proxy, int keepMinCol, int keepMinRow, int keepMaxCol, int keepMaxRow);
+
+    /** Starts a deduplicated query; returns the id to stamp on visited actors. */
+    int beginQuery();
+
+    /** Calls @p visit once per actor (stamped with @p id) in the cell range and the overflow lists. */
+    template <typename Visitor>
+    void visitCells(int minCol, int minRow, int maxCol, int maxRow, int id, Visitor&& visit);
+
+    /** Bounds of @p box over the whole motion, padded by a pixel for truncation. */
+    static pixelroot32::core::Rect sweptBounds(const pixelroot32::core::Rect& box, pixelroot32::math::Vector2 motion);
 };
 
 } // namespace pixelroot32::physics
@@ -145,6 +145,41 @@
 #define PIXELROOT32_ENABLE_DIRTY_REGIONS 0
 #endif
 
+/** @brief Compile-time default for the pipelined present (`graphics::PresentPipeline`).
+ *  `1`: `Engine::init` starts a present worker (second core on dual-core ESP32, `std::thread` on native) that
+ *  converts and pushes frame N while frame N+1 is updated and drawn. Costs one extra logical framebuffer.
+ *  Drivers without `DrawSurface::presentBuffer` (e.g. SDL2) keep presenting sequentially.
+ *  `0` (default): sequential present; `Engine::setPipelinedPresent` can still enable it at runtime.
+ */
+#ifndef PIXELROOT32_ENABLE_PIPELINED_PRESENT
+#define PIXELROOT32_ENABLE_PIPELINED_PRESENT 0
+#endif
+
+/** @brief Logical framebuffer depth for drivers that expose a sprite buffer (`DrawSurface::getSpriteBuffer`).
+ *  `8` (default): RGB332 bytes, half the RAM, colours quantised at draw time.
+ *  `16`: RGB565 words (byte-swapped panel order); exact palette colours and a copy-only present,
+ *  at twice the RAM (153,600 B at 320x240 — intended for boards with PSRAM).
+ */
+#ifndef PIXELROOT32_FRAMEBUFFER_BPP
+#define PIXELROOT32_FRAMEBUFFER_BPP 8
+#endif
+
+#if PIXELROOT32_FRAMEBUFFER_BPP != 8 && PIXELROOT32_FRAMEBUFFER_BPP != 16
+#error "PIXELROOT32_FRAMEBUFFER_BPP must be 8 or 16"
+#endif
+
+/** @brief When `1`, the 8bpp framebuffer stores palette-slot indices (see `paletteSlotIndex`) and colours
+ *  are resolved once per pixel at present time through a 256-entry LUT. Palette changes then recolour
+ *  the whole frame without redrawing it. Raw RGB565 draws snap to the nearest sprite slot 0 colour.
+ */
+#ifndef PIXELROOT32_FRAMEBUFFER_INDEXED
+#define PIXELROOT32_FRAMEBUFFER_INDEXED 0
+#endif
+
+#if PIXELROOT32_FRAMEBUFFER_INDEXED && PIXELROOT32_FRAMEBUFFER_BPP != 8
+#error "PIXELROOT32_FRAMEBUFFER_INDEXED requires PIXELROOT32_FRAMEBUFFER_BPP=8"
+#endif
+
 /** @brief When `1` and `PIXELROOT32_DEBUG_MODE` is defined, `Renderer::beginFrame` may log dirty-region stats (serial cost). */
 #ifndef PIXELROOT32_ENABLE_DIRTY_REGION_PROFILING
 #define PIXELROOT32_ENABLE_DIRTY_REGION_PROFILING 0
@@ -157,6 +192,16 @@
     #define MAX_TILESET_SIZE 256
 #endif
 
+// =============================================================================
+// Particle Limits
+// =============================================================================
+
+/** Particles shared by all emitters (graphics::particles::ParticlePool), allocated in blocks of 32.
+ *  Each particle costs 24 bytes (float Scalar); raise it for explosions of several hundred particles. */
+#ifndef PARTICLE_POOL_SIZE
+    #define PARTICLE_POOL_SIZE 256
+#endif
+
 // =============================================================================
 // Palette Limits
 // =============================================================================
@@ -191,6 +236,17 @@
     #define SPATIAL_GRID_MAX_DYNAMIC_PER_CELL 12
 #endif
 
+#ifndef SPATIAL_GRID_MAX_QUERY_RESULTS
+    #define SPATIAL_GRID_MAX_QUERY_RESULTS 32
+#endif
+
+/** Cell slots per SpatialGrid instance. Worlds that need more cells than this are stored as a
+ *  sparse hash over the slots. Default: enough for the logical screen. */
+#ifndef SPATIAL_GRID_MAX_CELLS
+    #define SPATIAL_GRID_MAX_CELLS \
+        ((LOGICAL_WIDTH / SPATIAL_GRID_CELL_SIZE + 1) * (LOGICAL_HEIGHT / SPATIAL_GRID_CELL_SIZE + 1))
+#endif
+
 #ifndef PHYSICS_MAX_ENTITIES
     #define PHYSICS_MAX_ENTITIES 64
 #endif
@@ -210,6 +266,53 @@
 // Deprecated alias for backward compatibility
 #define PHYSICS_RELAXATION_ITERATIONS PIXELROOT32_VELOCITY_ITERATIONS
 
+/** Start each contact from the impulse its pair accumulated in the previous step (1) or from zero (0). */
+#ifndef PHYSICS_WARM_STARTING
+    #define PHYSICS_WARM_STARTING 1
+#endif
+
+/** Consecutive steps an island of RIGID bodies must stay below MIN_VELOCITY before it sleeps.
+ *  0 disables sleeping. */
+#ifndef PHYSICS_SLEEP_STEPS
+    #define PHYSICS_SLEEP_STEPS 60
+#endif
+
+/** Run CollisionSystem::update()'s integrate and solve loops over a structure-of-arrays body
+ *  store (1) instead of the actors (0). RigidActor::integrate() overrides are not called in SoA mode. */
+#ifndef PHYSICS_SOA_BODIES
+    #define PHYSICS_SOA_BODIES 0
+#endif
+
+/** Split the physics step over a second thread (1): Engine::init starts a physics::PhysicsWorker
+ *  (std::thread on native, a task on the second ESP32 core) that runs half of the narrowphase and of
+ *  the contact islands. Results are bit-identical to the serial step (0). */
+#ifndef PHYSICS_PARALLEL
+    #define PHYSICS_PARALLEL 0
+#endif
+
+/** Fixed physics steps per second (CollisionSystem::FIXED_DT, PhysicsScheduler::FIXED_DT_MICROS).
+ *  30 halves the physics cost; bodies with PhysicsActor::setRenderInterpolation() still move
+ *  smoothly at higher frame rates. */
+#ifndef PHYSICS_STEP_HZ
+    #define PHYSICS_STEP_HZ 60
+#endif
+
+// =============================================================================
+// Audio Synthesis
+// =============================================================================
+
+/** Render ApuCore voices a block at a time (1): one voice over the whole buffer into a mix
+ *  accumulator, envelope and LFO at control rate. 0 keeps the per-sample reference renderer. */
+#ifndef AUDIO_BLOCK_RENDER
+    #define AUDIO_BLOCK_RENDER 1
+#endif
+
+/** Samples between envelope / LFO evaluations in the block renderer (gain and pitch are
+ *  interpolated linearly in between). */
+#ifndef AUDIO_CONTROL_RATE
+    #define AUDIO_CONTROL_RATE 16
+#endif
+
 // =============================================================================
 // Hardware Capabilities
 // =============================================================================
@@ -281,6 +384,12 @@ namespace pixelroot32::platforms::config {
     /** @brief Type-safe access to MaxTilesetSize configuration. */
     inline constexpr uint16_t MaxTilesetSize = MAX_TILESET_SIZE;
 
+    // Particles
+
+    /** @brief Type-safe access to ParticlePoolSize configuration. */
+    inline constexpr int ParticlePoolSize = PARTICLE_POOL_SIZE;
+    static_assert(ParticlePoolSize >= 32, "PARTICLE_POOL_SIZE must hold at least one block of 32 particles");
+
     // Scene Limits
 
     /** @brief Type-safe access to MaxScenes configuration. */
@@ -312,6 +421,12 @@ namespace pixelroot32::platforms::config {
     /** @brief Type-safe access to SpatialGridMaxDynamicPerCell configuration. */
     inline constexpr int SpatialGridMaxDynamicPerCell = SPATIAL_GRID_MAX_DYNAMIC_PER_CELL;
 
+    /** @brief Type-safe access to SpatialGridMaxQueryResults configuration (capacity of a SpatialQueryResults buffer). */
+    inline constexpr int SpatialGridMaxQueryResults = SPATIAL_GRID_MAX_QUERY_RESULTS;
+
+    /** @brief Type-safe access to SpatialGridMaxCells configuration (cell slots per grid). */
+    inline constexpr int SpatialGridMaxCells = SPATIAL_GRID_MAX_CELLS;
+
     // Physics
 
     /** @brief Type-safe access to PhysicsMaxEntities configuration. */
@@ -325,6 +440,29 @@ namespace pixelroot32::platforms::config {
 
     /** @brief Type-safe access to VelocityIterations configuration. */
     inline constexpr int VelocityIterations = PIXELROOT32_VELOCITY_ITERATIONS;
+
+    /** @brief Type-safe access to PhysicsWarmStarting configuration. */
+    inline constexpr bool PhysicsWarmStarting = PHYSICS_WARM_STARTING != 0;
+
+    /** @brief Type-safe access to PhysicsSleepSteps configuration. */
+    inline constexpr int PhysicsSleepSteps = PHYSICS_SLEEP_STEPS;
+
+    /** @brief Type-safe access to PhysicsSoaBodies configuration. */
+    inline constexpr bool PhysicsSoaBodies = PHYSICS_SOA_BODIES != 0;
+
+    /** @brief Type-safe access to PhysicsParallel configuration. */
+    inline constexpr bool PhysicsParallel = PHYSICS_PARALLEL != 0;
+
+    /** @brief Type-safe access to PhysicsStepHz configuration. */
+    inline constexpr int PhysicsStepHz = PHYSICS_STEP_HZ;
+    static_assert(PhysicsStepHz > 0, "PHYSICS_STEP_HZ must be positive");
+
+    /** @brief Type-safe access to AudioBlockRender configuration. */
+    inline constexpr bool AudioBlockRender = AUDIO_BLOCK_RENDER != 0;
+
+    /** @brief Type-safe access to AudioControlRate configuration. */
+    inline constexpr int AudioControlRate = AUDIO_CONTROL_RATE;
+    static_assert(AudioControlRate >= 1 && AudioControlRate <= 128, "AUDIO_CONTROL_RATE must be between 1 and 128");
     
     // Deprecated for backward compatibility
 
@@ -423,6 +561,17 @@ namespace pixelroot32::platforms::config {
     inline constexpr bool EnableStaticTilemapFbCache = false;
     #endif
 
+    // Framebuffer format
+
+    /** @brief True when the logical framebuffer stores RGB565 words (`PIXELROOT32_FRAMEBUFFER_BPP == 16`). */
+    inline constexpr bool Framebuffer16Bpp = (PIXELROOT32_FRAMEBUFFER_BPP == 16);
+
+    /** @brief Bytes per pixel of the logical framebuffer. */
+    inline constexpr int FramebufferBytesPerPixel = PIXELROOT32_FRAMEBUFFER_BPP / 8;
+
+    /** @brief True when the logical framebuffer stores palette-slot indices (`PIXELROOT32_FRAMEBUFFER_INDEXED`). */
+    inline constexpr bool FramebufferIndexed = (PIXELROOT32_FRAMEBUFFER_INDEXED != 0);
+
     #if PIXELROOT32_ENABLE_DIRTY_REGIONS
 
     /** @brief Type-safe access to EnableDirtyRegions configuration. */
@@ -433,6 +582,16 @@ namespace pixelroot32::platforms::config {
     inline constexpr bool EnableDirtyRegions = false;
     #endif
 
+    #if PIXELROOT32_ENABLE_PIPELINED_PRESENT
+
+    /** @brief Type-safe access to EnablePipelinedPresent configuration. */
+    inline constexpr bool EnablePipelinedPresent = true;
+    #else
+
+    /** @brief Type-safe access to EnablePipelinedPresent configuration. */
+    inline constexpr bool EnablePipelinedPresent = false;
+    #endif
+
     inline unsigned long profilerMicros() {
         return micros();
     }
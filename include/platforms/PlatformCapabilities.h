@@ -38,6 +38,19 @@ namespace pixelroot32::platforms {
          */
         int audioPriority = 5; // Re-evaluated dynamically in detect()
 
+        /**
+         * @brief Core and task priority of the pipelined present worker (graphics::PresentPipeline).
+         */
+        int presentWorkerCoreId = 0;
+        int presentWorkerPriority = 1;
+
+        /**
+         * @brief Core and task priority of the parallel physics worker (physics::PhysicsWorker).
+         * Ranked above the present worker: the main loop waits on it mid-step.
+         */
+        int physicsWorkerCoreId = 0;
+        int physicsWorkerPriority = 1;
+
         /**
          * @brief Detects capabilities of the current platform.
          * @return A populated PlatformCapabilities struct.
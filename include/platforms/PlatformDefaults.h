@@ -77,6 +77,26 @@
 #define PR32_DEFAULT_MAIN_CORE 1
 #endif
 
+// Worker tasks (pipelined present, parallel physics step). Both default to the
+// core the main loop does not use. Physics ranks above present: the main loop
+// blocks on its half of the step, while a present has a whole frame of slack.
+// Both stay below the dual-core audio priority (5) so sample deadlines win.
+#ifndef PR32_DEFAULT_PRESENT_WORKER_CORE
+#define PR32_DEFAULT_PRESENT_WORKER_CORE PR32_DEFAULT_AUDIO_CORE
+#endif
+
+#ifndef PR32_DEFAULT_PRESENT_WORKER_PRIORITY
+#define PR32_DEFAULT_PRESENT_WORKER_PRIORITY 3
+#endif
+
+#ifndef PR32_DEFAULT_PHYSICS_WORKER_CORE
+#define PR32_DEFAULT_PHYSICS_WORKER_CORE PR32_DEFAULT_AUDIO_CORE
+#endif
+
+#ifndef PR32_DEFAULT_PHYSICS_WORKER_PRIORITY
+#define PR32_DEFAULT_PHYSICS_WORKER_PRIORITY 4
+#endif
+
 // -----------------------------------------------------------------------------
 // Display Driver Selection
 // -----------------------------------------------------------------------------
@@ -105,6 +125,19 @@
 #if !defined(PIXELROOT32_TFT_ESPI_LINES_PER_BLOCK_FALLBACK)
 #define PIXELROOT32_TFT_ESPI_LINES_PER_BLOCK_FALLBACK 30
 #endif
+// Partial present: when the Renderer hands over its DirtyGrid (dirty regions on,
+// 8bpp sprite buffer), push only the changed windows instead of the full frame.
+// Falls back to a full push above MAX_RECTS windows or MAX_COVERAGE_PCT of the screen,
+// and for one frame after a palette swap or a Static tilemap layer content change.
+#if !defined(PIXELROOT32_TFT_ESPI_PARTIAL_PRESENT)
+#define PIXELROOT32_TFT_ESPI_PARTIAL_PRESENT 1
+#endif
+#if !defined(PIXELROOT32_TFT_ESPI_PARTIAL_MAX_RECTS)
+#define PIXELROOT32_TFT_ESPI_PARTIAL_MAX_RECTS 24
+#endif
+#if !defined(PIXELROOT32_TFT_ESPI_PARTIAL_MAX_COVERAGE_PCT)
+#define PIXELROOT32_TFT_ESPI_PARTIAL_MAX_COVERAGE_PCT 60
+#endif
 #endif
 
 // -----------------------------------------------------------------------------
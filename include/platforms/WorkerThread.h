@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(PLATFORM_NATIVE)
+#include <thread>
+#elif defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+namespace pixelroot32::platforms {
+
+/**
+ * @class WorkerThread
+ * @brief Background worker that runs one job at a time, handed over through a single atomic state word.
+ *
+ * dispatch() stores the job and publishes kReady (release); the worker — a std::thread on native,
+ * a FreeRTOS task pinned to a core on ESP32 — runs it and publishes kIdle (release), which wait()
+ * observes (acquire). Everything written before dispatch() is visible to the job, and everything
+ * the job wrote is visible after wait(). On native both sides spin briefly, then sleep; on ESP32
+ * they block on task notifications.
+ *
+ * Shared by graphics::PresentPipeline and physics::PhysicsWorker; core and priority come from
+ * PlatformCapabilities (PR32_DEFAULT_*_WORKER_* in PlatformDefaults.h).
+ */
+class WorkerThread {
+public:
+    using JobFn = void (*)(void*);
+
+    WorkerThread() = default;
+    ~WorkerThread();
+
+    WorkerThread(const WorkerThread&) = delete;
+    WorkerThread& operator=(const WorkerThread&) = delete;
+
+    /**
+     * @brief Starts the worker.
+     * @param name             Task name (ESP32).
+     * @param core             Core the task is pinned to (ESP32).
+     * @param priority         FreeRTOS priority (ESP32).
+     * @param spinsBeforeSleep Native: yields before an idle worker or a waiting caller starts sleeping.
+     * @return false when the platform has no threads or the task cannot be created.
+     */
+    bool start(const char* name, int core, int priority, int spinsBeforeSleep);
+
+    /** @brief Waits for the job in flight, then stops the worker. */
+    void stop();
+
+    bool isRunning() const { return running.load(std::memory_order_acquire); }
+
+    /** @brief Whether a dispatched job has not finished yet. */
+    bool isBusy() const { return state.load(std::memory_order_acquire) != kIdle; }
+
+    /**
+     * @brief Hands @p fn(@p ctx) to the worker. The previous job must have finished (wait()).
+     */
+    void dispatch(JobFn fn, void* ctx);
+
+    /** @brief Blocks until no job is in flight. Returns at once when the worker is not running. */
+    void wait();
+
+private:
+    enum : uint8_t { kIdle = 0, kReady = 1 };
+
+    void workerLoop();
+
+    // Written by the caller before kReady is published, read by the worker after.
+    JobFn jobFn = nullptr;
+    void* jobCtx = nullptr;
+
+    std::atomic<uint8_t> state{kIdle};
+    std::atomic<bool>    running{false};
+    int spinLimit = 64;
+
+#if defined(PLATFORM_NATIVE)
+    std::thread worker;
+#elif defined(ESP32)
+    TaskHandle_t workerTask = nullptr;
+    TaskHandle_t callerTask = nullptr;
+    std::atomic<bool> workerExited{true};
+    static void workerTrampoline(void* param);
+#endif
+};
+
+} // namespace pixelroot32::platforms
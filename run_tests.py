@@ -199,15 +199,18 @@ def main():
     # Tests to run: (name, test_file, executable, [optional_source_files])
     tests = [
         ("Math", "test/unit/test_math/test_mathutil.cpp", "test_mathutil", None),
+        ("Math-Fixed16", "test/unit/test_fixed16/test_fixed16.cpp", "test_fixed16", None),
+        ("Math-Batch", "test/unit/test_batch_math/test_batch_math.cpp", "test_batch_math", ["src/math/BatchMath.cpp"]),
         ("Core-Rect", "test/unit/test_rect/test_rect.cpp", "test_rect", None),
         ("Core-Entity", "test/unit/test_entity/test_entity.cpp", "test_entity", ["src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
         ("Core-Actor", "test/unit/test_actor/test_actor.cpp", "test_actor", ["src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
-        ("Core-Scene", "test/unit/test_scene/test_scene.cpp", "test_scene", ["src/core/Scene.cpp", "src/physics/CollisionSystem.cpp", "src/physics/SpatialGrid.cpp", "src/core/PhysicsActor.cpp", "src/physics/CollisionPrimitives.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
-        ("Core-SceneManager", "test/unit/test_scene_manager/test_scene_manager.cpp", "test_scene_manager", ["src/core/SceneManager.cpp", "src/core/Scene.cpp", "src/physics/CollisionSystem.cpp", "src/physics/SpatialGrid.cpp", "src/core/PhysicsActor.cpp", "src/physics/CollisionPrimitives.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
-        ("Core-Engine", "test/unit/test_engine/test_engine.cpp", "test_engine", ["src/core/Engine.cpp", "src/core/SceneManager.cpp", "src/core/Scene.cpp", "src/physics/CollisionSystem.cpp", "src/physics/SpatialGrid.cpp", "src/core/PhysicsActor.cpp", "src/physics/CollisionPrimitives.cpp", "src/physics/StaticActor.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp", "src/audio/AudioEngine.cpp", "src/audio/MusicPlayer.cpp", "src/audio/DefaultAudioScheduler.cpp", "src/input/InputManager.cpp", "src/platforms/mock/MockArduino.cpp", "src/platforms/PlatformCapabilities.cpp"]),
+        ("Core-Scene", "test/unit/test_scene/test_scene.cpp", "test_scene", ["src/core/Scene.cpp", "src/physics/CollisionSystem.cpp", "src/physics/PhysicsBodyStore.cpp", "src/math/BatchMath.cpp", "src/physics/PhysicsWorker.cpp", "src/platforms/WorkerThread.cpp", "src/physics/SpatialGrid.cpp", "src/core/PhysicsActor.cpp", "src/physics/RigidActor.cpp", "src/physics/CollisionPrimitives.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
+        ("Core-SceneManager", "test/unit/test_scene_manager/test_scene_manager.cpp", "test_scene_manager", ["src/core/SceneManager.cpp", "src/core/Scene.cpp", "src/physics/CollisionSystem.cpp", "src/physics/PhysicsBodyStore.cpp", "src/math/BatchMath.cpp", "src/physics/PhysicsWorker.cpp", "src/platforms/WorkerThread.cpp", "src/physics/SpatialGrid.cpp", "src/core/PhysicsActor.cpp", "src/physics/CollisionPrimitives.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
+        ("Core-Engine", "test/unit/test_engine/test_engine.cpp", "test_engine", ["src/core/Engine.cpp", "src/core/SceneManager.cpp", "src/core/Scene.cpp", "src/physics/CollisionSystem.cpp", "src/physics/PhysicsBodyStore.cpp", "src/math/BatchMath.cpp", "src/physics/PhysicsWorker.cpp", "src/platforms/WorkerThread.cpp", "src/physics/SpatialGrid.cpp", "src/core/PhysicsActor.cpp", "src/physics/CollisionPrimitives.cpp", "src/physics/StaticActor.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp", "src/audio/AudioEngine.cpp", "src/audio/MusicPlayer.cpp", "src/audio/DefaultAudioScheduler.cpp", "src/input/InputManager.cpp", "src/platforms/mock/MockArduino.cpp", "src/platforms/PlatformCapabilities.cpp"]),
         ("Physics-Types", "test/unit/test_collision_types/test_collision_types.cpp", "test_collision_types", None),
         ("Physics-Primitives", "test/unit/test_collision_primitives/test_collision_primitives.cpp", "test_collision_primitives", ["src/physics/CollisionPrimitives.cpp"]),
-        ("Physics-System", "test/unit/test_collision_system/test_collision_system.cpp", "test_collision_system", ["src/physics/CollisionSystem.cpp", "src/physics/CollisionPrimitives.cpp", "src/core/PhysicsActor.cpp", "src/physics/StaticActor.cpp", "src/physics/RigidActor.cpp", "src/physics/SpatialGrid.cpp"]),
+        ("Physics-System", "test/unit/test_collision_system/test_collision_system.cpp", "test_collision_system", ["src/physics/CollisionSystem.cpp", "src/physics/PhysicsBodyStore.cpp", "src/math/BatchMath.cpp", "src/physics/PhysicsWorker.cpp", "src/platforms/WorkerThread.cpp", "src/physics/CollisionPrimitives.cpp", "src/core/PhysicsActor.cpp", "src/physics/StaticActor.cpp", "src/physics/RigidActor.cpp", "src/physics/SpatialGrid.cpp"]),
+        ("Physics-BodyStore", "test/unit/test_physics_body_store/test_physics_body_store.cpp", "test_physics_body_store", ["src/physics/CollisionSystem.cpp", "src/physics/PhysicsBodyStore.cpp", "src/math/BatchMath.cpp", "src/physics/PhysicsWorker.cpp", "src/platforms/WorkerThread.cpp", "src/physics/CollisionPrimitives.cpp", "src/core/PhysicsActor.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/physics/RigidActor.cpp", "src/physics/SpatialGrid.cpp"]),
         ("Graphics-Color", "test/unit/test_color/test_color.cpp", "test_color", ["src/graphics/Color.cpp"]),
         ("Graphics-Camera2D", "test/unit/test_camera2d/test_camera2d.cpp", "test_camera2d", ["src/graphics/Camera2D.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
         ("Graphics-FontManager", "test/unit/test_font_manager/test_font_manager.cpp", "test_font_manager", ["src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp"]),
@@ -219,16 +222,16 @@ def main():
         ("Audio-Backend", "test/unit/test_audio/test_audiobackend.cpp", "test_audiobackend", ["src/audio/DefaultAudioScheduler.cpp", "src/audio/AudioEngine.cpp", "src/audio/MusicPlayer.cpp", "src/audio/AudioCommandQueue.cpp"]),
         ("Audio-Scheduler", "test/unit/test_audio_scheduler/test_audio_scheduler.cpp", "test_audio_scheduler", ["src/audio/DefaultAudioScheduler.cpp"]),
         ("Audio-Music", "test/unit/test_music_player/test_music_player.cpp", "test_music_player", ["src/audio/MusicPlayer.cpp", "src/audio/AudioEngine.cpp", "src/audio/DefaultAudioScheduler.cpp"]),
-        ("Physics-Actor", "test/unit/test_physics_actor/test_physics_actor.cpp", "test_physics_actor", ["src/core/PhysicsActor.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/physics/RigidActor.cpp", "src/physics/CollisionSystem.cpp", "src/physics/SpatialGrid.cpp", "src/physics/CollisionPrimitives.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
-        ("Physics-Expansion", "test/unit/test_physics_actor/test_physics_actor.cpp", "test_physics_expansion", ["src/core/PhysicsActor.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/physics/RigidActor.cpp", "src/physics/CollisionSystem.cpp", "src/physics/SpatialGrid.cpp", "src/physics/CollisionPrimitives.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
+        ("Physics-Actor", "test/unit/test_physics_actor/test_physics_actor.cpp", "test_physics_actor", ["src/core/PhysicsActor.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/physics/RigidActor.cpp", "src/physics/CollisionSystem.cpp", "src/physics/PhysicsBodyStore.cpp", "src/math/BatchMath.cpp", "src/physics/PhysicsWorker.cpp", "src/platforms/WorkerThread.cpp", "src/physics/SpatialGrid.cpp", "src/physics/CollisionPrimitives.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
+        ("Physics-Expansion", "test/unit/test_physics_actor/test_physics_actor.cpp", "test_physics_expansion", ["src/core/PhysicsActor.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/physics/RigidActor.cpp", "src/physics/CollisionSystem.cpp", "src/physics/PhysicsBodyStore.cpp", "src/math/BatchMath.cpp", "src/physics/PhysicsWorker.cpp", "src/platforms/WorkerThread.cpp", "src/physics/SpatialGrid.cpp", "src/physics/CollisionPrimitives.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
         ("TileAttributes-Property", "test/unit/test_tile_attributes/test_tile_attribute_query_property.cpp", "test_tile_attribute_query_property", None),
         ("TileMask", "test/unit/test_tile_mask/test_tile_mask.cpp", "test_tile_mask", None),
-        ("TileCollection", "test/test_engine_integration/tile_collection/test_tile_collection.cpp", "test_tile_collection", ["src/core/Scene.cpp", "src/physics/CollisionSystem.cpp", "src/physics/SpatialGrid.cpp", "src/core/PhysicsActor.cpp", "src/physics/CollisionPrimitives.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
+        ("TileCollection", "test/test_engine_integration/tile_collection/test_tile_collection.cpp", "test_tile_collection", ["src/core/Scene.cpp", "src/physics/CollisionSystem.cpp", "src/physics/PhysicsBodyStore.cpp", "src/math/BatchMath.cpp", "src/physics/PhysicsWorker.cpp", "src/platforms/WorkerThread.cpp", "src/physics/SpatialGrid.cpp", "src/core/PhysicsActor.cpp", "src/physics/CollisionPrimitives.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
         ("TilePerformance", "test/test_engine_integration/tile_performance/test_tile_performance.cpp", "test_tile_performance", ["src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
-        ("Engine-Integration", "test/test_engine_integration/engine_integration/test_engine_integration.cpp", "test_engine_integration", ["src/core/Engine.cpp", "src/core/SceneManager.cpp", "src/core/Scene.cpp", "src/physics/CollisionSystem.cpp", "src/physics/SpatialGrid.cpp", "src/core/PhysicsActor.cpp", "src/physics/CollisionPrimitives.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp", "src/audio/AudioEngine.cpp", "src/audio/MusicPlayer.cpp", "src/audio/DefaultAudioScheduler.cpp", "src/input/InputManager.cpp", "src/platforms/mock/MockArduino.cpp", "src/platforms/PlatformCapabilities.cpp"]),
-        ("Game-Loop", "test/test_game_loop/test_game_loop.cpp", "test_game_loop", ["src/core/Engine.cpp", "src/core/SceneManager.cpp", "src/core/Scene.cpp", "src/physics/CollisionSystem.cpp", "src/physics/SpatialGrid.cpp", "src/core/PhysicsActor.cpp", "src/physics/CollisionPrimitives.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp", "src/audio/AudioEngine.cpp", "src/audio/MusicPlayer.cpp", "src/audio/DefaultAudioScheduler.cpp", "src/input/InputManager.cpp", "src/platforms/mock/MockArduino.cpp", "src/platforms/PlatformCapabilities.cpp"]),
-        ("UserData-Integration", "test/test_engine_integration/user_data_integration/test_user_data_integration.cpp", "test_user_data_integration", ["src/core/PhysicsActor.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/physics/CollisionSystem.cpp", "src/physics/SpatialGrid.cpp", "src/physics/CollisionPrimitives.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
-        ("UserData-ESP32-Performance", "test/test_engine_integration/user_data_esp32_performance/test_user_data_esp32_performance.cpp", "test_user_data_esp32_performance", ["src/core/PhysicsActor.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/physics/CollisionSystem.cpp", "src/physics/SpatialGrid.cpp", "src/physics/CollisionPrimitives.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
+        ("Engine-Integration", "test/test_engine_integration/engine_integration/test_engine_integration.cpp", "test_engine_integration", ["src/core/Engine.cpp", "src/core/SceneManager.cpp", "src/core/Scene.cpp", "src/physics/CollisionSystem.cpp", "src/physics/PhysicsBodyStore.cpp", "src/math/BatchMath.cpp", "src/physics/PhysicsWorker.cpp", "src/platforms/WorkerThread.cpp", "src/physics/SpatialGrid.cpp", "src/core/PhysicsActor.cpp", "src/physics/CollisionPrimitives.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp", "src/audio/AudioEngine.cpp", "src/audio/MusicPlayer.cpp", "src/audio/DefaultAudioScheduler.cpp", "src/input/InputManager.cpp", "src/platforms/mock/MockArduino.cpp", "src/platforms/PlatformCapabilities.cpp"]),
+        ("Game-Loop", "test/test_game_loop/test_game_loop.cpp", "test_game_loop", ["src/core/Engine.cpp", "src/core/SceneManager.cpp", "src/core/Scene.cpp", "src/physics/CollisionSystem.cpp", "src/physics/PhysicsBodyStore.cpp", "src/math/BatchMath.cpp", "src/physics/PhysicsWorker.cpp", "src/platforms/WorkerThread.cpp", "src/physics/SpatialGrid.cpp", "src/core/PhysicsActor.cpp", "src/physics/CollisionPrimitives.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp", "src/audio/AudioEngine.cpp", "src/audio/MusicPlayer.cpp", "src/audio/DefaultAudioScheduler.cpp", "src/input/InputManager.cpp", "src/platforms/mock/MockArduino.cpp", "src/platforms/PlatformCapabilities.cpp"]),
+        ("UserData-Integration", "test/test_engine_integration/user_data_integration/test_user_data_integration.cpp", "test_user_data_integration", ["src/core/PhysicsActor.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/physics/CollisionSystem.cpp", "src/physics/PhysicsBodyStore.cpp", "src/math/BatchMath.cpp", "src/physics/PhysicsWorker.cpp", "src/platforms/WorkerThread.cpp", "src/physics/SpatialGrid.cpp", "src/physics/CollisionPrimitives.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
+        ("UserData-ESP32-Performance", "test/test_engine_integration/user_data_esp32_performance/test_user_data_esp32_performance.cpp", "test_user_data_esp32_performance", ["src/core/PhysicsActor.cpp", "src/physics/StaticActor.cpp", "src/physics/KinematicActor.cpp", "src/physics/CollisionSystem.cpp", "src/physics/PhysicsBodyStore.cpp", "src/math/BatchMath.cpp", "src/physics/PhysicsWorker.cpp", "src/platforms/WorkerThread.cpp", "src/physics/SpatialGrid.cpp", "src/physics/CollisionPrimitives.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp"]),
         ("UI", "test/unit/test_ui/test_ui_elements.cpp", "test_ui", ["test/unit/test_ui/test_ui_layouts.cpp", "src/graphics/Renderer.cpp", "src/graphics/Color.cpp", "src/graphics/FontManager.cpp", "src/graphics/Font5x7.cpp", "src/graphics/DisplayConfig.cpp", "src/graphics/TileAnimation.cpp", "src/input/InputManager.cpp", "src/platforms/mock/MockArduino.cpp", "src/graphics/ui/UILayout.cpp", "src/graphics/ui/UILabel.cpp", "src/graphics/ui/UIButton.cpp", "src/graphics/ui/UICheckbox.cpp", "src/graphics/ui/UIPanel.cpp", "src/graphics/ui/UIGridLayout.cpp", "src/graphics/ui/UIVerticalLayout.cpp", "src/graphics/ui/UIHorizontalLayout.cpp", "src/graphics/ui/UIAnchorLayout.cpp", "src/graphics/ui/UIPaddingContainer.cpp"]),
     ]
     
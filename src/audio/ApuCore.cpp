@@ -4,8 +4,10 @@
  */
 #include "audio/ApuCore.h"
 #include "audio/AudioMusicTypes.h"
+#include "audio/AudioBandLimitedLUT.h"
 #include "audio/AudioMixerLUT.h"
 #include "audio/AudioOscLUT.h"
+#include "audio/SfxCache.h"
 #include "platforms/EngineConfig.h"
 #include "core/Log.h"
 
@@ -18,21 +20,108 @@
 #include <soc/soc_caps.h>
 #endif
 
+// No-FPU ESP32 cores (ESP32-C3) mix in Q15; everything else mixes in float.
+// PIXELROOT32_APU_FORCE_Q15_MIX selects the Q15 path on any target so the
+// native test build can run it.
+#if (defined(ESP32) && (!defined(SOC_CPU_HAS_FPU) || !SOC_CPU_HAS_FPU)) || defined(PIXELROOT32_APU_FORCE_Q15_MIX)
+#define PR32_APU_Q15_MIX 1
+#endif
+
 namespace pixelroot32::audio {
 
     // ========================================================================================================
     // Wave generator lambdas (moved to file scope for branch-free dispatch)
     // ========================================================================================================
+    static inline int32_t triangle_q15(uint32_t phaseQ32) {
+        const uint32_t p16 = phaseQ32 >> 16;
+        return (p16 < 32768u) ? ((int32_t)(p16 * 2) - 32768) : (32768 - (int32_t)((p16 - 32768u) * 2));
+    }
+    static inline int32_t saw_q15(uint32_t phaseQ32) {
+        const int64_t v = ((int64_t)phaseQ32 << 1) - (1LL << 32);
+        return (int32_t)(v >> 17);
+    }
+
+    // ========================================================================================================
+    // Band-limited oscillators (InstrumentPreset::bandLimited)
+    // ========================================================================================================
+
+    /**
+     * PolyBLEP residual for a rising step of height 2 at phase 0. `t` is the
+     * phase in [0, 1), `dt` the phase increment per sample; zero away from the edge.
+     */
+    static inline float poly_blep(float t, float dt) {
+        if (t < dt) {
+            t /= dt;
+            return t + t - t * t - 1.0f;
+        }
+        if (t > 1.0f - dt) {
+            t = (t - 1.0f) / dt;
+            return t * t + t + t + 1.0f;
+        }
+        return 0.0f;
+    }
+
+    /** PolyBLAMP residual for a slope change of +1 per sample at phase 0 (integral of poly_blep / 2). */
+    static inline float poly_blamp(float t, float dt) {
+        if (t < dt) {
+            const float x = 1.0f - t / dt;
+            return x * x * x * (1.0f / 6.0f);
+        }
+        if (t > 1.0f - dt) {
+            const float x = (t - 1.0f) / dt + 1.0f;
+            return x * x * x * (1.0f / 6.0f);
+        }
+        return 0.0f;
+    }
+
+    static inline float pulse_blep(float phase, float duty, float dt) {
+        float fall = phase - duty;
+        if (fall < 0.0f) fall += 1.0f;
+        return ((phase < duty) ? 1.0f : -1.0f) + poly_blep(phase, dt) - poly_blep(fall, dt);
+    }
+
+    static inline float saw_blep(float phase, float dt) {
+        return 2.0f * phase - 1.0f - poly_blep(phase, dt);
+    }
+
+    static inline float triangle_blamp(float phase, float dt) {
+        // Slope turns by +8 (per unit phase) at phase 0 and by -8 at phase 0.5.
+        float peak = phase + 0.5f;
+        if (peak >= 1.0f) peak -= 1.0f;
+        const float naive = (phase < 0.5f) ? (4.0f * phase - 1.0f) : (3.0f - 4.0f * phase);
+        return naive + 8.0f * dt * (poly_blamp(phase, dt) - poly_blamp(peak, dt));
+    }
+
+    /** Mip level whose highest harmonic (64 >> level) stays below Nyquist at this increment. */
+    static inline int band_limited_level(uint32_t phaseIncQ32) {
+        if (phaseIncQ32 == 0) return 0;
+        const int level = 7 - __builtin_clz(phaseIncQ32);
+        return (level < 0) ? 0 : (level >= BL_WAVETABLE_LEVELS) ? BL_WAVETABLE_LEVELS - 1 : level;
+    }
+
+    /** Linearly interpolated read of one 256-entry wavetable period. */
+    static inline int32_t wavetable_q15(const int16_t* table, uint32_t phaseQ32) {
+        const uint32_t i = phaseQ32 >> 24;
+        const int32_t frac = (int32_t)((phaseQ32 >> 9) & 0x7FFFu);
+        const int32_t a = table[i];
+        const int32_t b = table[(i + 1u) & 255u];
+        return a + (((b - a) * frac) >> 15);
+    }
+
+    /** PULSE as saw(p - duty) - saw(p) plus the duty's DC offset, so both edges are band-limited. */
+    static inline int32_t pulse_wavetable_q15(const int16_t* saw, uint32_t phaseQ32, uint32_t dutyQ32) {
+        return wavetable_q15(saw, phaseQ32 - dutyQ32) - wavetable_q15(saw, phaseQ32)
+             + (int32_t)(dutyQ32 >> 16) - 32768;
+    }
+
     static auto generatePulseSampleQ15 = [](AudioChannel& ch) -> int32_t {
         return (ch.phaseQ32 < ch.dutyCycleQ32) ? 32767 : -32767;
     };
     static auto generateTriangleSampleQ15 = [](AudioChannel& ch) -> int32_t {
-        const uint32_t p16 = ch.phaseQ32 >> 16;
-        return (p16 < 32768u) ? ((int32_t)(p16 * 2) - 32768) : (32768 - (int32_t)((p16 - 32768u) * 2));
+        return triangle_q15(ch.phaseQ32);
     };
     static auto generateSawSampleQ15 = [](AudioChannel& ch) -> int32_t {
-        const int64_t v = ((int64_t)ch.phaseQ32 << 1) - (1LL << 32);
-        return (int32_t)(v >> 17);
+        return saw_q15(ch.phaseQ32);
     };
     static auto generateNoiseSampleQ15 = [](AudioChannel& ch) -> int32_t {
         return (ch.lfsrState & 1u) ? 32767 : -32767;
@@ -45,12 +134,13 @@ namespace pixelroot32::audio {
         generateTriangleSampleQ15, // WaveType::TRIANGLE = 1
         nullptr,                    // WaveType::NOISE = 2 (special case - requires state update)
         nullptr,                    // WaveType::SINE = 3 (uses LUT)
-        generateSawSampleQ15       // WaveType::SAW = 4
+        generateSawSampleQ15,      // WaveType::SAW = 4
+        nullptr                     // WaveType::PCM = 5 (cached sample walk)
     };
 
     static_assert(
-        sizeof(WAVE_GENERATORS_Q15) / sizeof(WAVE_GENERATORS_Q15[0]) == 5,
-        "WAVE_GENERATORS_Q15 must have 5 entries for WaveType enum"
+        sizeof(WAVE_GENERATORS_Q15) / sizeof(WAVE_GENERATORS_Q15[0]) == 6,
+        "WAVE_GENERATORS_Q15 must have 6 entries for WaveType enum"
     );
 
     // ============================================================================
@@ -66,11 +156,11 @@ namespace pixelroot32::audio {
         return (uint32_t)inc;
     }
 
-    /** Linear sweep: updates frequency + phaseIncrement; decrements sweep counter. */
-    static inline void apply_linear_frequency_sweep_float(AudioChannel& ch, int sr) {
-        if (sr <= 0) return;
-        if (ch.sweepSamplesTotal == 0 || ch.type == WaveType::NOISE) return;
-        if (ch.sweepSamplesRemaining == 0) return;
+    /** Linear sweep: updates frequency + phaseIncrement; decrements sweep counter. Returns false when idle. */
+    static inline bool apply_linear_frequency_sweep_float(AudioChannel& ch, int sr) {
+        if (sr <= 0) return false;
+        if (ch.sweepSamplesTotal == 0 || ch.type == WaveType::NOISE) return false;
+        if (ch.sweepSamplesRemaining == 0) return false;
         const float denom = (float)ch.sweepSamplesTotal;
         const float alpha = (float)(ch.sweepSamplesTotal - ch.sweepSamplesRemaining) / denom;
         ch.frequency = ch.sweepStartHz + (ch.sweepEndHz - ch.sweepStartHz) * alpha;
@@ -81,6 +171,122 @@ namespace pixelroot32::audio {
             ch.phaseIncrement = ch.sweepEndHz / (float)sr;
             ch.sweepSamplesTotal = 0;
         }
+        return true;
+    }
+
+    /** Integer counterpart of apply_linear_frequency_sweep_float for the no-FPU path. */
+    static inline void apply_linear_frequency_sweep_q15(AudioChannel& ch) {
+        if (ch.sweepSamplesTotal == 0 || ch.type == WaveType::NOISE || ch.sweepSamplesRemaining == 0) return;
+        const uint32_t numer = ch.sweepSamplesTotal - ch.sweepSamplesRemaining;
+        const int64_t delta = (int64_t)ch.sweepEndIncQ32 - (int64_t)ch.sweepStartIncQ32;
+        int64_t inc = (int64_t)ch.sweepStartIncQ32
+            + (delta * (int64_t)numer) / (int64_t)ch.sweepSamplesTotal;
+        if (inc < 0) inc = 0;
+        if (inc > (int64_t)0xFFFFFFFFLL) inc = 0xFFFFFFFFLL;
+        ch.basePhaseIncQ32 = (uint32_t)inc;
+        ch.sweepSamplesRemaining--;
+        if (ch.sweepSamplesRemaining == 0) {
+            ch.basePhaseIncQ32 = ch.sweepEndIncQ32;
+            ch.sweepSamplesTotal = 0;
+        }
+        // Pitch LFO rebuilds phaseIncQ32 from the base afterwards; without it the
+        // sweep drives the oscillator directly (as on the float path).
+        ch.phaseIncQ32 = ch.basePhaseIncQ32;
+    }
+
+    /**
+     * Advances a sweep by @p k samples in one call. Equivalent to @p k calls of
+     * the per-sample step: the counter is skipped forward and the last step
+     * recomputes the frequency from it.
+     */
+    static inline void advance_linear_frequency_sweep_float(AudioChannel& ch, int sr, uint32_t k) {
+        if (ch.sweepSamplesTotal == 0 || ch.type == WaveType::NOISE || ch.sweepSamplesRemaining == 0) return;
+        const uint32_t steps = std::min(k, ch.sweepSamplesRemaining);
+        ch.sweepSamplesRemaining -= steps - 1u;
+        apply_linear_frequency_sweep_float(ch, sr);
+    }
+
+    static inline void advance_linear_frequency_sweep_q15(AudioChannel& ch, uint32_t k) {
+        if (ch.sweepSamplesTotal == 0 || ch.type == WaveType::NOISE || ch.sweepSamplesRemaining == 0) return;
+        const uint32_t steps = std::min(k, ch.sweepSamplesRemaining);
+        ch.sweepSamplesRemaining -= steps - 1u;
+        apply_linear_frequency_sweep_q15(ch);
+    }
+
+    /** Unified 15-bit NES LFSR shared by all platforms: advances once every noisePeriodSamples. */
+    static inline void clock_noise(AudioChannel& ch) {
+        if (ch.noiseCountdown > 0u) ch.noiseCountdown--;
+        if (ch.noiseCountdown == 0u) {
+            const uint16_t bitToXor = ch.noiseShortMode ? ((ch.lfsrState >> 6) & 1u) : ((ch.lfsrState >> 1) & 1u);
+            const uint16_t fb = (uint16_t)(((ch.lfsrState & 1u) ^ bitToXor) & 1u);
+            ch.lfsrState = (uint16_t)((ch.lfsrState >> 1) | (fb << 14));
+            ch.noiseCountdown = ch.noisePeriodSamples;
+        }
+    }
+
+    /** Duration countdown hit zero: enter RELEASE (extending the voice) or stop it. */
+    static inline void end_note(AudioChannel& ch) {
+        if (ch.envelope.stage != EnvelopeState::Stage::RELEASE
+            && ch.envelope.stage != EnvelopeState::Stage::OFF
+            && ch.envelope.releaseSamples > 0) {
+            ch.envelope.stage = EnvelopeState::Stage::RELEASE;
+            ch.envelope.sampleCounter = 0;
+            ch.remainingSamples = ch.envelope.releaseSamples;
+        } else {
+            ch.enabled = false;
+        }
+    }
+
+    // ------------------------------------------------------------------
+    // PCM voices (SfxCache samples)
+    // ------------------------------------------------------------------
+    static inline void start_pcm_voice(AudioChannel& ch, const AudioEvent& event) {
+        ch.reset();
+        ch.type = WaveType::PCM;
+        const SfxSample* sample = event.sample;
+        if (!sample || !sample->data || sample->length == 0) return;
+        ch.enabled = true;
+        ch.pcmSample = sample;
+        ch.volume = event.volume;
+        ch.remainingSamples = sample->length;
+    }
+
+    /** Next frame of a PCM voice in Q15; disables the voice after the last one. */
+    static inline int32_t pcm_next_q15(AudioChannel& ch) {
+        const SfxSample& sample = *ch.pcmSample;
+        int32_t v;
+        if (sample.format == SfxFormat::PCM8) {
+            v = (int32_t)(int8_t)sample.data[ch.pcmPos] * 256;
+        } else {
+            const uint8_t byte = sample.data[ch.pcmPos >> 1];
+            const uint8_t nibble = (ch.pcmPos & 1u) ? (uint8_t)(byte >> 4) : (uint8_t)(byte & 15u);
+            v = ima_adpcm_decode(nibble, ch.adpcmPredictor, ch.adpcmIndex);
+        }
+        ch.pcmPos++;
+        ch.remainingSamples = sample.length - ch.pcmPos;
+        if (ch.remainingSamples == 0) ch.enabled = false;
+        return v;
+    }
+
+    /** Adds up to @p length frames of a PCM voice to @p out; @p mul applies the voice gain to a Q15 frame. */
+    template <typename Acc, typename Mul>
+    static inline void mix_pcm_block(AudioChannel& ch, Acc* out, int length, Mul mul) {
+        const SfxSample& sample = *ch.pcmSample;
+        const int n = (int)std::min<uint64_t>((uint64_t)length, ch.remainingSamples);
+        if (sample.format == SfxFormat::PCM8) {
+            // Plain pointer walk.
+            const int8_t* p = reinterpret_cast<const int8_t*>(sample.data) + ch.pcmPos;
+            for (int j = 0; j < n; ++j) {
+                out[j] += mul((int32_t)p[j] * 256);
+            }
+            ch.pcmPos += (uint32_t)n;
+            ch.remainingSamples -= (uint64_t)n;
+            if (ch.remainingSamples == 0) ch.enabled = false;
+        } else {
+            for (int j = 0; j < n; ++j) {
+                out[j] += mul(pcm_next_q15(ch));
+            }
+        }
     }
 
     static inline int16_t apply_master_bitcrush(int16_t sample, uint8_t bits) {
@@ -190,99 +396,118 @@ namespace pixelroot32::audio {
     // Command processing
     // ------------------------------------------------------------------
     void ApuCore::processCommands() {
-        AudioCommand cmd;
-        while (commandQueue.dequeue(cmd)) {
-            switch (cmd.type) {
-                case AudioCommandType::PLAY_EVENT:
-                    executePlayEvent(cmd.event);
-                    break;
+        // Batches keep redundant volume / tempo updates from a burst down to one each.
+        size_t n;
+        while ((n = commandQueue.drainBatch(commandBatch_, COMMAND_DRAIN_BATCH)) > 0) {
+            for (size_t i = 0; i < n; ++i) {
+                executeCommand(commandBatch_[i]);
+            }
+        }
+    }
 
-                case AudioCommandType::SET_MASTER_VOLUME: {
-                    float v = cmd.volume;
-                    if (v > 1.0f) v = 1.0f;
-                    if (v < 0.0f) v = 0.0f;
-                    masterVolume = v;
-                    masterVolumeScale = (int32_t)(masterVolume * 65536.0f);
-                    break;
-                }
+    void ApuCore::executeCommand(const AudioCommand& cmd) {
+        switch (cmd.type) {
+            case AudioCommandType::PLAY_EVENT:
+                executePlayEvent(cmd.event);
+                break;
 
-                case AudioCommandType::SET_MASTER_BITCRUSH: {
-                    uint8_t b = cmd.masterBitcrushBits;
-                    if (b > 15u) b = 15u;
-                    masterBitcrushBits_ = b;
-                    break;
+            case AudioCommandType::SET_MASTER_VOLUME: {
+                float v = cmd.volume;
+                if (v > 1.0f) v = 1.0f;
+                if (v < 0.0f) v = 0.0f;
+                masterVolume = v;
+                masterVolumeScale = (int32_t)(masterVolume * 65536.0f);
+                break;
+            }
+
+            case AudioCommandType::SET_MASTER_BITCRUSH: {
+                uint8_t b = cmd.masterBitcrushBits;
+                if (b > 15u) b = 15u;
+                masterBitcrushBits_ = b;
+                break;
+            }
+
+            case AudioCommandType::STOP_CHANNEL:
+                if (cmd.channelIndex < MAX_VOICES) {
+                    voices[cmd.channelIndex].reset();
                 }
+                break;
 
-                case AudioCommandType::STOP_CHANNEL:
-                    if (cmd.channelIndex < MAX_VOICES) {
-                        voices[cmd.channelIndex].reset();
+            case AudioCommandType::STOP_SAMPLES: {
+                const SfxSample* first = cmd.sampleRange.first;
+                const SfxSample* last = first + cmd.sampleRange.count;
+                for (int c = 0; c < MAX_VOICES; ++c) {
+                    const SfxSample* sample = voices[c].pcmSample;
+                    if (voices[c].enabled && voices[c].type == WaveType::PCM && sample >= first && sample < last) {
+                        voices[c].reset();
                     }
-                    break;
+                }
+                break;
+            }
 
-                case AudioCommandType::MUSIC_PLAY: {
-                    activeTrackCount = 1;
-                    tracks[0] = cmd.track;
-                    currentNoteIndices[0] = 0;
-
-                    tickDurationSamples =
-                        (uint64_t)((float)sampleRate * 60.0f / (tempoBPM * (float)TICKS_PER_BEAT));
-
-                    // Anchor sequencer to audio-thread "now" so we do not treat
-                    // elapsed time since boot as a backlog of ticks (would fire
-                    // MAX_NOTES_PER_FRAME notes in one block and voice-steal).
-                    const uint64_t startTick =
-                        (tickDurationSamples > 0) ? (audioTimeSamples / tickDurationSamples) : 0;
-                    globalTickCounter = startTick;
-                    nextNoteTicks[0] = startTick;
-
-                    for (size_t i = 0;
-                         i < cmd.subTrackCount && activeTrackCount < MAX_MUSIC_TRACKS;
-                         ++i) {
-                        if (cmd.subTracks[i]) {
-                            tracks[activeTrackCount] = cmd.subTracks[i];
-                            currentNoteIndices[activeTrackCount] = 0;
-                            nextNoteTicks[activeTrackCount] = startTick;
-                            activeTrackCount++;
-                        }
+            case AudioCommandType::MUSIC_PLAY: {
+                activeTrackCount = 1;
+                tracks[0] = cmd.track;
+                currentNoteIndices[0] = 0;
+
+                tickDurationSamples =
+                    (uint64_t)((float)sampleRate * 60.0f / (tempoBPM * (float)TICKS_PER_BEAT));
+
+                // Anchor sequencer to audio-thread "now" so we do not treat
+                // elapsed time since boot as a backlog of ticks (would fire
+                // MAX_NOTES_PER_FRAME notes in one block and voice-steal).
+                const uint64_t startTick =
+                    (tickDurationSamples > 0) ? (audioTimeSamples / tickDurationSamples) : 0;
+                globalTickCounter = startTick;
+                nextNoteTicks[0] = startTick;
+
+                for (size_t i = 0;
+                     i < cmd.subTrackCount && activeTrackCount < MAX_MUSIC_TRACKS;
+                     ++i) {
+                    if (cmd.subTracks[i]) {
+                        tracks[activeTrackCount] = cmd.subTracks[i];
+                        currentNoteIndices[activeTrackCount] = 0;
+                        nextNoteTicks[activeTrackCount] = startTick;
+                        activeTrackCount++;
                     }
-
-                    firstSequencerCallAfterPlay_ = true;
-                    musicPlayingFlag.store(true, std::memory_order_release);
-                    musicPausedFlag.store(false, std::memory_order_release);
-                    break;
                 }
 
-                case AudioCommandType::MUSIC_STOP:
-                    for (size_t i = 0; i < MAX_MUSIC_TRACKS; ++i) {
-                        tracks[i] = nullptr;
-                        currentNoteIndices[i] = 0;
-                        nextNoteTicks[i] = 0;
-                    }
-                    activeTrackCount = 0;
-                    musicPlayingFlag.store(false, std::memory_order_release);
-                    break;
+                firstSequencerCallAfterPlay_ = true;
+                musicPlayingFlag.store(true, std::memory_order_release);
+                musicPausedFlag.store(false, std::memory_order_release);
+                break;
+            }
 
-                case AudioCommandType::MUSIC_PAUSE:
-                    musicPausedFlag.store(true, std::memory_order_release);
-                    break;
+            case AudioCommandType::MUSIC_STOP:
+                for (size_t i = 0; i < MAX_MUSIC_TRACKS; ++i) {
+                    tracks[i] = nullptr;
+                    currentNoteIndices[i] = 0;
+                    nextNoteTicks[i] = 0;
+                }
+                activeTrackCount = 0;
+                musicPlayingFlag.store(false, std::memory_order_release);
+                break;
 
-                case AudioCommandType::MUSIC_RESUME:
-                    musicPausedFlag.store(false, std::memory_order_release);
-                    break;
+            case AudioCommandType::MUSIC_PAUSE:
+                musicPausedFlag.store(true, std::memory_order_release);
+                break;
 
-                case AudioCommandType::MUSIC_SET_TEMPO:
-                    tempoFactor = std::max(0.1f, cmd.tempoFactor);
-                    break;
+            case AudioCommandType::MUSIC_RESUME:
+                musicPausedFlag.store(false, std::memory_order_release);
+                break;
 
-                case AudioCommandType::MUSIC_SET_BPM:
-                    tempoBPM = std::max(30.0f, std::min(300.0f, cmd.bpm));
-                    tickDurationSamples =
-                        (uint64_t)((float)sampleRate * 60.0f / (tempoBPM * (float)TICKS_PER_BEAT));
-                    break;
+            case AudioCommandType::MUSIC_SET_TEMPO:
+                tempoFactor = std::max(0.1f, cmd.tempoFactor);
+                break;
 
-                default:
-                    break;
-            }
+            case AudioCommandType::MUSIC_SET_BPM:
+                tempoBPM = std::max(30.0f, std::min(300.0f, cmd.bpm));
+                tickDurationSamples =
+                    (uint64_t)((float)sampleRate * 60.0f / (tempoBPM * (float)TICKS_PER_BEAT));
+                break;
+
+            default:
+                break;
         }
     }
 
@@ -423,29 +648,37 @@ namespace pixelroot32::audio {
     void ApuCore::executePlayEvent(const AudioEvent& event) {
         Voice* ch = findVoiceForEvent(event.type);
         if (!ch) return;
+        startVoice(*ch, event, sampleRate);
+    }
+
+    void ApuCore::startVoice(Voice& ch, const AudioEvent& event, int sampleRate) {
+        if (event.type == WaveType::PCM) {
+            start_pcm_voice(ch, event);
+            return;
+        }
 
         const VoiceType voiceType = toVoiceType(event.type);
         // Compatibility fallback required by migration plan.
-        ch->type = toWaveType(voiceType);
-        ch->enabled = true;
-        ch->frequency = event.frequency;
-        ch->phase = 0.0f;
-        ch->phaseIncrement = event.frequency / (float)sampleRate;
+        ch.type = toWaveType(voiceType);
+        ch.enabled = true;
+        ch.frequency = event.frequency;
+        ch.phase = 0.0f;
+        ch.phaseIncrement = event.frequency / (float)sampleRate;
 
         // Fixed-point mirror so the no-FPU mixing path (ESP32-C3) never
         // touches float inside the per-sample inner loop. Computed once
         // per retrigger in float, which is fine since executePlayEvent is
         // rare compared to the 22 050 Hz sample loop.
-        ch->phaseQ32 = 0u;
+        ch.phaseQ32 = 0u;
         if (sampleRate > 0) {
             const double inc = (double)event.frequency * 4294967296.0 / (double)sampleRate;
-            ch->phaseIncQ32 = (inc < 0.0) ? 0u
+            ch.phaseIncQ32 = (inc < 0.0) ? 0u
                             : (inc >= 4294967295.0) ? 0xFFFFFFFFu
                             : (uint32_t)inc;
         } else {
-            ch->phaseIncQ32 = 0u;
+            ch.phaseIncQ32 = 0u;
         }
-        ch->basePhaseIncQ32 = ch->phaseIncQ32;
+        ch.basePhaseIncQ32 = ch.phaseIncQ32;
 
         // ADSR envelope initialization from preset (or legacy defaults).
         // Default values (attack=2ms, decay=0, sustain=1.0, release=5ms)
@@ -461,7 +694,7 @@ namespace pixelroot32::audio {
             releaseTime  = event.preset->releaseTime;
         }
 
-        auto& env = ch->envelope;
+        auto& env = ch.envelope;
         env.attackSamples  = (uint32_t)std::max(1.0f, attackTime  * (float)sampleRate);
         env.decaySamples   = (uint32_t)(decayTime   * (float)sampleRate);
         env.sustainLevel   = sustainLevel;
@@ -472,15 +705,15 @@ namespace pixelroot32::audio {
         env.currentLevel   = 0.0f;
         env.stage          = EnvelopeState::Stage::ATTACK;
 
-        ch->volume = event.volume;  // base volume (preset level)
-        ch->targetVolume = event.volume;
-        ch->volumeDelta = 0.0f;     // no longer used for anti-click
+        ch.volume = event.volume;  // base volume (preset level)
+        ch.targetVolume = event.volume;
+        ch.volumeDelta = 0.0f;     // no longer used for anti-click
 
         env.attackDelta  = 1.0f / (float)env.attackSamples;
         env.decayDelta   = (env.decaySamples > 0) ? (1.0f - sustainLevel) / (float)env.decaySamples : 0.0f;
         env.releaseDelta = (env.releaseSamples > 0) ? sustainLevel / (float)env.releaseSamples : 0.0f;
 
-#if defined(ESP32) && (!defined(SOC_CPU_HAS_FPU) || !SOC_CPU_HAS_FPU)
+#ifdef PR32_APU_Q15_MIX
         // Initialize Q15 envelope fields for RISC-V fast path
         env.currentLevelQ15 = 0;
         env.sustainLevelQ15 = (int32_t)(sustainLevel * 32768.0f);
@@ -490,58 +723,59 @@ namespace pixelroot32::audio {
 #endif
 
         // LFO initialization
-        ch->lfo.enabled = false;
+        ch.lfo.enabled = false;
         if (event.preset && event.preset->lfoTarget != LfoTarget::NONE && event.preset->lfoFrequency > 0.0f) {
-            ch->lfo.enabled = true;
-            ch->lfo.target = event.preset->lfoTarget;
-            ch->lfo.depth = event.preset->lfoDepth;
-            ch->lfo.periodSamples = (uint32_t)((float)sampleRate / event.preset->lfoFrequency);
-            if (ch->lfo.periodSamples < 1u) ch->lfo.periodSamples = 1u;
-            ch->lfo.sampleCounter = 0;
-            ch->lfo.currentValue = 0.0f;
-            ch->lfo.delaySamples = (uint16_t)(event.preset->lfoDelay * (float)sampleRate);
-            ch->lfo.delayCounter = 0;
+            ch.lfo.enabled = true;
+            ch.lfo.target = event.preset->lfoTarget;
+            ch.lfo.depth = event.preset->lfoDepth;
+            ch.lfo.periodSamples = (uint32_t)((float)sampleRate / event.preset->lfoFrequency);
+            if (ch.lfo.periodSamples < 1u) ch.lfo.periodSamples = 1u;
+            ch.lfo.sampleCounter = 0;
+            ch.lfo.currentValue = 0.0f;
+            ch.lfo.delaySamples = (uint16_t)(event.preset->lfoDelay * (float)sampleRate);
+            ch.lfo.delayCounter = 0;
             // Convert float depth to Q15 for no-FPU path
-            ch->lfo.depthQ15 = (int32_t)(ch->lfo.depth * 32768.0f);
-            ch->lfo.currentValueQ15 = 0;
+            ch.lfo.depthQ15 = (int32_t)(ch.lfo.depth * 32768.0f);
+            ch.lfo.currentValueQ15 = 0;
         }
 
-        ch->remainingSamples = (uint64_t)(event.duration * (float)sampleRate);
+        ch.remainingSamples = (uint64_t)(event.duration * (float)sampleRate);
+        ch.bandLimited = event.preset && event.preset->bandLimited;
 
-        ch->sweepSamplesTotal = 0;
-        ch->sweepSamplesRemaining = 0;
+        ch.sweepSamplesTotal = 0;
+        ch.sweepSamplesRemaining = 0;
         if ((event.type == WaveType::PULSE || event.type == WaveType::TRIANGLE
                 || event.type == WaveType::SINE || event.type == WaveType::SAW)
             && event.sweepDurationSec > 0.0f && event.sweepEndHz > 0.0f && sampleRate > 0) {
-            const uint64_t noteLen = ch->remainingSamples;
+            const uint64_t noteLen = ch.remainingSamples;
             if (noteLen > 0) {
                 uint64_t sweepLen = (uint64_t)(event.sweepDurationSec * (float)sampleRate);
                 if (sweepLen == 0) sweepLen = 1;
                 if (sweepLen > noteLen) sweepLen = noteLen;
                 if (sweepLen >= 1) {
-                    ch->sweepSamplesTotal = (uint32_t)sweepLen;
-                    ch->sweepSamplesRemaining = ch->sweepSamplesTotal;
-                    ch->sweepStartHz = event.frequency;
-                    ch->sweepEndHz = event.sweepEndHz;
-                    ch->sweepStartIncQ32 = frequency_hz_to_phase_inc_q32(event.frequency, sampleRate);
-                    ch->sweepEndIncQ32 = frequency_hz_to_phase_inc_q32(event.sweepEndHz, sampleRate);
+                    ch.sweepSamplesTotal = (uint32_t)sweepLen;
+                    ch.sweepSamplesRemaining = ch.sweepSamplesTotal;
+                    ch.sweepStartHz = event.frequency;
+                    ch.sweepEndHz = event.sweepEndHz;
+                    ch.sweepStartIncQ32 = frequency_hz_to_phase_inc_q32(event.frequency, sampleRate);
+                    ch.sweepEndIncQ32 = frequency_hz_to_phase_inc_q32(event.sweepEndHz, sampleRate);
                 }
             }
         }
 
         if (event.type == WaveType::PULSE) {
-            ch->dutyCycle = event.duty;
+            ch.dutyCycle = event.duty;
             double d = (double)event.duty;
             if (d < 0.0) d = 0.0;
             if (d > 1.0) d = 1.0;
-            ch->dutyCycleQ32 = (uint32_t)(d * 4294967296.0);
+            ch.dutyCycleQ32 = (uint32_t)(d * 4294967296.0);
             
             if (event.preset) {
-                ch->dutySweep = event.preset->dutySweep / (float)sampleRate;
-                ch->dutySweepQ32 = (int32_t)((double)event.preset->dutySweep * 4294967296.0 / (double)sampleRate);
+                ch.dutySweep = event.preset->dutySweep / (float)sampleRate;
+                ch.dutySweepQ32 = (int32_t)((double)event.preset->dutySweep * 4294967296.0 / (double)sampleRate);
             } else {
-                ch->dutySweep = 0.0f;
-                ch->dutySweepQ32 = 0;
+                ch.dutySweep = 0.0f;
+                ch.dutySweepQ32 = 0;
             }
         } else if (event.type == WaveType::NOISE) {
             uint32_t period;
@@ -553,16 +787,16 @@ namespace pixelroot32::audio {
                 period = (uint32_t)((float)sampleRate / noiseHz);
                 if (period < 1u) period = 1u;
             }
-            ch->noisePeriodSamples = period;
-            ch->noiseCountdown = 1u;
-            ch->lfsrState = 0x4000;
-            ch->noiseShortMode = (event.preset) ? event.preset->noiseShortMode : false;
-            ch->phase = 0.0f;
-            ch->phaseIncrement = 0.0f;
+            ch.noisePeriodSamples = period;
+            ch.noiseCountdown = 1u;
+            ch.lfsrState = 0x4000;
+            ch.noiseShortMode = (event.preset) ? event.preset->noiseShortMode : false;
+            ch.phase = 0.0f;
+            ch.phaseIncrement = 0.0f;
         } else if (event.type == WaveType::SINE || event.type == WaveType::SAW) {
-            ch->dutyCycle = 0.5f;
-            ch->dutySweep = 0.0f;
-            ch->dutySweepQ32 = 0;
+            ch.dutyCycle = 0.5f;
+            ch.dutySweep = 0.0f;
+            ch.dutySweepQ32 = 0;
         }
     }
 
@@ -645,7 +879,7 @@ namespace pixelroot32::audio {
         }
     }
 
-#if defined(ESP32) && (!defined(SOC_CPU_HAS_FPU) || !SOC_CPU_HAS_FPU)
+#ifdef PR32_APU_Q15_MIX
     // ------------------------------------------------------------------
     // ADSR Envelope state machine (fixed-point Q15 for RISC-V)
     // ------------------------------------------------------------------
@@ -696,6 +930,12 @@ namespace pixelroot32::audio {
     // ------------------------------------------------------------------
     // LFO oscillator tick (triangle wave, per-sample)
     // ------------------------------------------------------------------
+    /** Triangle wave in [-1.0, +1.0] at the LFO's current position. */
+    static inline float lfo_triangle_float(const LfoState& lfo) {
+        const float t = (float)lfo.sampleCounter / (float)lfo.periodSamples;
+        return (t < 0.5f) ? (4.0f * t - 1.0f) : (3.0f - 4.0f * t);
+    }
+
     static inline void tickLfo(AudioChannel& ch) {
         auto& lfo = ch.lfo;
         if (!lfo.enabled || lfo.periodSamples == 0) return;
@@ -708,14 +948,22 @@ namespace pixelroot32::audio {
         lfo.sampleCounter++;
         if (lfo.sampleCounter >= lfo.periodSamples) lfo.sampleCounter = 0;
 
-        // Triangle wave in [-1.0, +1.0]
-        const float t = (float)lfo.sampleCounter / (float)lfo.periodSamples;
-        lfo.currentValue = (t < 0.5f) ? (4.0f * t - 1.0f) : (3.0f - 4.0f * t);
+        lfo.currentValue = lfo_triangle_float(lfo);
     }
 
     // ------------------------------------------------------------------
     // LFO oscillator tick (Q15 integer-only, triangle wave)
     // ------------------------------------------------------------------
+    static inline int32_t lfo_triangle_q15(const LfoState& lfo) {
+        // Integer triangle wave in Q15
+        // tQ15 = (sampleCounter * 32768) / periodSamples (range: 0 to 32768)
+        const int32_t tQ15 = (int32_t)((uint64_t)lfo.sampleCounter * 32768u / lfo.periodSamples);
+
+        // Triangle: if t < 0.5: 4*t - 1, else: 3 - 4*t
+        // In Q15: if tQ15 < 16384: 4*tQ15 - 32768, else: 98304 - 4*tQ15
+        return (tQ15 < 16384) ? ((tQ15 << 2) - 32768) : (98304 - (tQ15 << 2));
+    }
+
     static inline void tickLfoQ15(LfoState& lfo) {
         if (!lfo.enabled || lfo.periodSamples == 0) return;
 
@@ -727,17 +975,7 @@ namespace pixelroot32::audio {
         lfo.sampleCounter++;
         if (lfo.sampleCounter >= lfo.periodSamples) lfo.sampleCounter = 0;
 
-        // Integer triangle wave in Q15
-        // tQ15 = (sampleCounter * 32768) / periodSamples (range: 0 to 32768)
-        int32_t tQ15 = (int32_t)((uint64_t)lfo.sampleCounter * 32768u / lfo.periodSamples);
-
-        // Triangle: if t < 0.5: 4*t - 1, else: 3 - 4*t
-        // In Q15: if tQ15 < 16384: 4*tQ15 - 32768, else: 98304 - 4*tQ15
-        if (tQ15 < 16384) {
-            lfo.currentValueQ15 = (tQ15 << 2) - 32768;  // 4*tQ15 - 32768
-        } else {
-            lfo.currentValueQ15 = 98304 - (tQ15 << 2);  // 98304 - 4*tQ15
-        }
+        lfo.currentValueQ15 = lfo_triangle_q15(lfo);
     }
 
     // ------------------------------------------------------------------
@@ -745,19 +983,32 @@ namespace pixelroot32::audio {
     // ------------------------------------------------------------------
     float ApuCore::generateSampleForVoice(Voice& ch) {
         if (!ch.enabled) return 0.0f;
+        if (ch.type == WaveType::PCM) return (float)pcm_next_q15(ch) * (1.0f / 32768.0f) * ch.volume;
 
-        apply_linear_frequency_sweep_float(ch, sampleRate);
+        if (apply_linear_frequency_sweep_float(ch, sampleRate)
+            && ch.lfo.enabled && ch.lfo.target == LfoTarget::PITCH) {
+            // Keep vibrato on top of the sweep, as the Q15 path does.
+            ch.phaseIncrement *= 1.0f + ch.lfo.currentValue * ch.lfo.depth;
+        }
 
         float sample = 0.0f;
         switch (ch.type) {
             case WaveType::PULSE:
-                sample = (ch.phase < ch.dutyCycle) ? 1.0f : -1.0f;
+                if (ch.bandLimited) {
+                    sample = pulse_blep(ch.phase, ch.dutyCycle, ch.phaseIncrement);
+                } else {
+                    sample = (ch.phase < ch.dutyCycle) ? 1.0f : -1.0f;
+                }
                 break;
             case WaveType::TRIANGLE:
                 // TODO: future NES-accurate 4-bit quantization (deferred)
-                sample = (ch.phase < 0.5f)
-                       ? (4.0f * ch.phase - 1.0f)
-                       : (3.0f - 4.0f * ch.phase);
+                if (ch.bandLimited) {
+                    sample = triangle_blamp(ch.phase, ch.phaseIncrement);
+                } else {
+                    sample = (ch.phase < 0.5f)
+                           ? (4.0f * ch.phase - 1.0f)
+                           : (3.0f - 4.0f * ch.phase);
+                }
                 break;
             case WaveType::SINE: {
                 const unsigned i = (unsigned)(ch.phase * 256.0f) & 255u;
@@ -765,18 +1016,16 @@ namespace pixelroot32::audio {
                 break;
             }
             case WaveType::SAW:
-                sample = 2.0f * ch.phase - 1.0f;
+                if (ch.bandLimited) {
+                    sample = saw_blep(ch.phase, ch.phaseIncrement);
+                } else {
+                    sample = 2.0f * ch.phase - 1.0f;
+                }
                 break;
             case WaveType::NOISE: {
                 // Unified 15-bit NES LFSR shared by all platforms so the
                 // timbre is identical in simulator and hardware.
-                if (ch.noiseCountdown > 0u) ch.noiseCountdown--;
-                if (ch.noiseCountdown == 0u) {
-                    const uint16_t bitToXor = ch.noiseShortMode ? ((ch.lfsrState >> 6) & 1u) : ((ch.lfsrState >> 1) & 1u);
-                    const uint16_t fb = (uint16_t)(((ch.lfsrState & 1u) ^ bitToXor) & 1u);
-                    ch.lfsrState = (uint16_t)((ch.lfsrState >> 1) | (fb << 14));
-                    ch.noiseCountdown = ch.noisePeriodSamples;
-                }
+                clock_noise(ch);
                 sample = (ch.lfsrState & 1u) ? 1.0f : -1.0f;
                 break;
             }
@@ -817,18 +1066,7 @@ namespace pixelroot32::audio {
         // release samples are added to remainingSamples at transition).
         if (ch.remainingSamples > 0) {
             ch.remainingSamples--;
-            if (ch.remainingSamples == 0) {
-                if (ch.envelope.stage != EnvelopeState::Stage::RELEASE
-                    && ch.envelope.stage != EnvelopeState::Stage::OFF
-                    && ch.envelope.releaseSamples > 0) {
-                    // Enter release and extend channel lifetime
-                    ch.envelope.stage = EnvelopeState::Stage::RELEASE;
-                    ch.envelope.sampleCounter = 0;
-                    ch.remainingSamples = ch.envelope.releaseSamples;
-                } else {
-                    ch.enabled = false;
-                }
-            }
+            if (ch.remainingSamples == 0) end_note(ch);
         }
 
         return sample * ch.volume * ch.envelope.currentLevel * lfoVolMod;
@@ -843,12 +1081,118 @@ namespace pixelroot32::audio {
         if (!commandQueue.isEmpty()) processCommands();
         updateMusicSequencer();
 
+        if (blockRender_) {
+            renderBlock(stream, length);
+        } else {
+            renderPerSample(stream, length);
+        }
+
+        if (postMixMono_) {
+            postMixMono_(stream, length, postMixUser_);
+        }
+
+        audioTimeSamples += (uint64_t)length;
+        samplesSinceLog += (uint64_t)length;
+
+        if constexpr (platforms::config::EnableProfiling) {
+            if (samplesSinceLog >= (uint64_t)sampleRate) {
+                uint8_t idx = profileWriteIdx.fetch_add(1, std::memory_order_relaxed);
+                idx %= PROFILE_RING_SIZE;
+                profileRing[idx].audioTimeSamples = audioTimeSamples;
+                profileRing[idx].peak = currentPeak;
+                profileRing[idx].clipped = (currentPeak >= 32767.0f);
+                if (profileCount < PROFILE_RING_SIZE) {
+                    profileCount++;
+                }
+                currentPeak = 0.0f;
+                samplesSinceLog = 0;
+            }
+        } else if (samplesSinceLog >= (uint64_t)sampleRate) {
+            currentPeak = 0.0f;
+            samplesSinceLog = 0;
+        }
+    }
+
+    // ------------------------------------------------------------------
+    // Output stage: compressor / LUT, DC-blocker, master volume, bitcrush
+    // ------------------------------------------------------------------
+    inline int16_t ApuCore::outputSampleFloat(float acc) {
         constexpr float FINAL_SCALE = 32767.0f;
         // HPF coefficient: y[n] = x[n] - x[n-1] + R*y[n-1]
         // R = 0.995 at 22050 Hz -> ~35 Hz -3dB
         constexpr float HPF_R = 0.995f;
 
-#if defined(SOC_CPU_HAS_FPU) && SOC_CPU_HAS_FPU
+        acc *= masterVolume;
+        const float mixed = acc / (1.0f + std::fabs(acc) * MIXER_K);
+
+        // DC-blocker: removes duty-asymmetry DC and softens retrigger pops.
+        const float hpfOut = mixed - hpfPrevIn + HPF_R * hpfPrevOut;
+        hpfPrevIn = mixed;
+        hpfPrevOut = hpfOut;
+
+        float finalSample = hpfOut * FINAL_SCALE;
+        const float absSample = std::fabs(finalSample);
+        if (absSample > currentPeak) currentPeak = absSample;
+        if (finalSample > 32767.0f) finalSample = 32767.0f;
+        if (finalSample < -32768.0f) finalSample = -32768.0f;
+        return apply_master_bitcrush((int16_t)finalSample, masterBitcrushBits_);
+    }
+
+    inline int16_t ApuCore::outputSampleQ15(int32_t sum) {
+        // LUT points are 256 input units apart. Interpolating between them keeps
+        // quiet mixes from collapsing onto a handful of output steps.
+        int32_t offset = sum + 131072;
+        if (offset < 0) offset = 0;
+        if (offset > 1024 * 256) offset = 1024 * 256;
+        const int32_t index = offset >> 8;
+        const int32_t frac = offset & 255;
+
+        // Q15 HPF coefficient: R = 0.995, Q15 = 0.995 * 32768 = 32604
+        // Yields ~35 Hz -3dB cutoff at 22050 Hz sample rate
+        static constexpr int32_t HPF_R_Q15 = 32604;
+
+        // Q15 HPF: y[n] = x[n] - x[n-1] + (R * y[n-1])
+        // Uses Q15 fixed-point to avoid soft-float on RISC-V cores
+        int32_t inputQ15 = audio_mixer_lut[index];
+        if (frac != 0) inputQ15 += ((audio_mixer_lut[index + 1] - inputQ15) * frac) >> 8;
+
+        // Compute R * y[n-1] in Q30, then shift to Q15
+        int64_t feedback = (int64_t)HPF_R_Q15 * (int64_t)hpfPrevOutQ15;
+        int32_t feedbackQ15 = (int32_t)(feedback >> 15);
+
+        // HPF difference equation
+        int32_t hpfOutQ15 = inputQ15 - hpfPrevInQ15 + feedbackQ15;
+
+        // Saturating clamp to prevent overflow artifacts
+        if (hpfOutQ15 > 32767) hpfOutQ15 = 32767;
+        if (hpfOutQ15 < -32768) hpfOutQ15 = -32768;
+
+        // Update state for next sample
+        hpfPrevInQ15 = inputQ15;
+        hpfPrevOutQ15 = hpfOutQ15;
+
+        // Convert to Q14 for master volume (matches FPU path scaling)
+        int32_t finalSample = hpfOutQ15 >> 1;
+
+        // Apply master volume after HPF (matches FPU path order)
+        if (masterVolumeScale != 65536) {
+            finalSample = (finalSample * masterVolumeScale) >> 16;
+            // Clamp to 16-bit range
+            if (finalSample > 32767) finalSample = 32767;
+            if (finalSample < -32768) finalSample = -32768;
+        }
+
+        const int16_t out = apply_master_bitcrush((int16_t)finalSample, masterBitcrushBits_);
+        const int32_t absSample = (out < 0) ? -(int32_t)out : (int32_t)out;
+        if ((float)absSample > currentPeak) currentPeak = (float)absSample;
+        return out;
+    }
+
+    // ------------------------------------------------------------------
+    // Per-sample reference renderer (sample-outer, voice-inner)
+    // ------------------------------------------------------------------
+    void ApuCore::renderPerSample(int16_t* stream, int length) {
+#if !defined(PR32_APU_Q15_MIX) && defined(SOC_CPU_HAS_FPU) && SOC_CPU_HAS_FPU
         // ---- FPU path (ESP32 classic, ESP32-S3, native) -----------------
         for (int i = 0; i < length; ++i) {
             float acc = 0.0f;
@@ -857,22 +1201,9 @@ namespace pixelroot32::audio {
                     acc += generateSampleForVoice(voices[c]) * MIXER_SCALE;
                 }
             }
-            acc *= masterVolume;
-            float mixed = acc / (1.0f + std::fabs(acc) * MIXER_K);
-
-            // DC-blocker: removes duty-asymmetry DC and softens retrigger pops.
-            const float hpfOut = mixed - hpfPrevIn + HPF_R * hpfPrevOut;
-            hpfPrevIn = mixed;
-            hpfPrevOut = hpfOut;
-
-            float finalSample = hpfOut * FINAL_SCALE;
-            const float absSample = std::fabs(finalSample);
-            if (absSample > currentPeak) currentPeak = absSample;
-            if (finalSample > 32767.0f) finalSample = 32767.0f;
-            if (finalSample < -32768.0f) finalSample = -32768.0f;
-            stream[i] = apply_master_bitcrush((int16_t)finalSample, masterBitcrushBits_);
+            stream[i] = outputSampleFloat(acc);
         }
-#elif defined(ESP32)
+#elif defined(PR32_APU_Q15_MIX)
         // ---- Integer / LUT path (ESP32-C3, RISC-V no-FPU) ---------------
         // Uses the Q32 phase mirror + Q15 output per channel so the inner
         // loop contains zero soft-float operations. The LUT is pre-fitted
@@ -914,22 +1245,28 @@ namespace pixelroot32::audio {
                 Voice& ch = voices[c];
                 if (!ch.enabled) continue;
 
+                if (ch.type == WaveType::PCM) {
+                    // Cached sample: envelope and LFO are baked in, only gain and MIXER_SCALE apply.
+                    sum += ((((pcm_next_q15(ch) * volQ15[c]) >> 15) * 13107) >> 15);
+                    continue;
+                }
+
                 int32_t s = 0; // Q15 sample in [-32767, +32767]
 
                 // Branch-free type dispatch using function pointer lookup
                 if (ch.type == WaveType::NOISE) {
                     // NOISE: inline state update (required for LFSR mutation)
-                    if (ch.noiseCountdown > 0u) ch.noiseCountdown--;
-                    if (ch.noiseCountdown == 0u) {
-                        const uint16_t bitToXor = ch.noiseShortMode ? ((ch.lfsrState >> 6) & 1u) : ((ch.lfsrState >> 1) & 1u);
-                        const uint16_t fb = (uint16_t)(((ch.lfsrState & 1u) ^ bitToXor) & 1u);
-                        ch.lfsrState = (uint16_t)((ch.lfsrState >> 1) | (fb << 14));
-                        ch.noiseCountdown = ch.noisePeriodSamples;
-                    }
+                    clock_noise(ch);
                     s = generateNoiseSampleQ15(ch);
                 } else if (ch.type == WaveType::SINE) {
                     // SINE: direct LUT lookup
                     s = (int32_t)SINE_LUT_Q15[(ch.phaseQ32 >> 24) & 255u];
+                } else if (ch.bandLimited) {
+                    // PULSE, TRIANGLE, SAW: mip-mapped wavetable for the current pitch
+                    const int level = band_limited_level(ch.phaseIncQ32);
+                    s = (ch.type == WaveType::TRIANGLE) ? wavetable_q15(BL_TRIANGLE_Q15[level], ch.phaseQ32)
+                      : (ch.type == WaveType::SAW) ? wavetable_q15(BL_SAW_Q15[level], ch.phaseQ32)
+                      : pulse_wavetable_q15(BL_SAW_Q15[level], ch.phaseQ32, ch.dutyCycleQ32);
                 } else if (auto gen = WAVE_GENERATORS_Q15[static_cast<int>(ch.type)]) {
                     // PULSE, TRIANGLE, SAW: function pointer lookup
                     s = gen(ch);
@@ -968,20 +1305,7 @@ namespace pixelroot32::audio {
                 tickEnvelopeQ15(ch);
 
                 // Linear frequency sweep (integer phase inc, no soft-float in lerp).
-                if (ch.sweepSamplesTotal > 0 && ch.type != WaveType::NOISE && ch.sweepSamplesRemaining > 0) {
-                    const uint32_t numer = ch.sweepSamplesTotal - ch.sweepSamplesRemaining;
-                    const int64_t delta = (int64_t)ch.sweepEndIncQ32 - (int64_t)ch.sweepStartIncQ32;
-                    int64_t inc = (int64_t)ch.sweepStartIncQ32
-                        + (delta * (int64_t)numer) / (int64_t)ch.sweepSamplesTotal;
-                    if (inc < 0) inc = 0;
-                    if (inc > (int64_t)0xFFFFFFFFLL) inc = 0xFFFFFFFFLL;
-                    ch.basePhaseIncQ32 = (uint32_t)inc;
-                    ch.sweepSamplesRemaining--;
-                    if (ch.sweepSamplesRemaining == 0) {
-                        ch.basePhaseIncQ32 = ch.sweepEndIncQ32;
-                        ch.sweepSamplesTotal = 0;
-                    }
-                }
+                apply_linear_frequency_sweep_q15(ch);
 
                 // LFO tick + pitch modulation (Q15-only, no float).
                 tickLfoQ15(ch.lfo);
@@ -996,62 +1320,11 @@ namespace pixelroot32::audio {
                 // Duration countdown + release trigger (same as float path).
                 if (ch.remainingSamples > 0) {
                     ch.remainingSamples--;
-                    if (ch.remainingSamples == 0) {
-                        if (ch.envelope.stage != EnvelopeState::Stage::RELEASE
-                            && ch.envelope.stage != EnvelopeState::Stage::OFF
-                            && ch.envelope.releaseSamples > 0) {
-                            ch.envelope.stage = EnvelopeState::Stage::RELEASE;
-                            ch.envelope.sampleCounter = 0;
-                            ch.remainingSamples = ch.envelope.releaseSamples;
-                        } else {
-                            ch.enabled = false;
-                        }
-                    }
+                    if (ch.remainingSamples == 0) end_note(ch);
                 }
             }
 
-            int32_t index = (sum + 131072) >> 8;
-            if (index < 0) index = 0;
-            if (index > 1024) index = 1024;
-
-            // Q15 HPF coefficient: R = 0.995, Q15 = 0.995 * 32768 = 32604
-            // Yields ~35 Hz -3dB cutoff at 22050 Hz sample rate
-            static constexpr int32_t HPF_R_Q15 = 32604;
-
-            // Q15 HPF: y[n] = x[n] - x[n-1] + (R * y[n-1])
-            // Uses Q15 fixed-point to avoid soft-float on RISC-V cores
-            int32_t inputQ15 = audio_mixer_lut[index];
-
-            // Compute R * y[n-1] in Q30, then shift to Q15
-            int64_t feedback = (int64_t)HPF_R_Q15 * (int64_t)hpfPrevOutQ15;
-            int32_t feedbackQ15 = (int32_t)(feedback >> 15);
-
-            // HPF difference equation
-            int32_t hpfOutQ15 = inputQ15 - hpfPrevInQ15 + feedbackQ15;
-
-            // Saturating clamp to prevent overflow artifacts
-            if (hpfOutQ15 > 32767) hpfOutQ15 = 32767;
-            if (hpfOutQ15 < -32768) hpfOutQ15 = -32768;
-
-            // Update state for next sample
-            hpfPrevInQ15 = inputQ15;
-            hpfPrevOutQ15 = hpfOutQ15;
-
-            // Convert to Q14 for master volume (matches FPU path scaling)
-            int32_t finalSample = hpfOutQ15 >> 1;
-
-            // Apply master volume after HPF (matches FPU path order)
-            if (masterVolumeScale != 65536) {
-                finalSample = (finalSample * masterVolumeScale) >> 16;
-                // Clamp to 16-bit range
-                if (finalSample > 32767) finalSample = 32767;
-                if (finalSample < -32768) finalSample = -32768;
-            }
-            
-            stream[i] = apply_master_bitcrush((int16_t)finalSample, masterBitcrushBits_);
-
-            const int32_t absSample = (stream[i] < 0) ? -(int32_t)stream[i] : (int32_t)stream[i];
-            if ((float)absSample > currentPeak) currentPeak = (float)absSample;
+            stream[i] = outputSampleQ15(sum);
         }
 
         // Sync per-channel float volume back from Q15 so the next block
@@ -1068,46 +1341,431 @@ namespace pixelroot32::audio {
                     acc += generateSampleForVoice(voices[c]) * MIXER_SCALE;
                 }
             }
-            acc *= masterVolume;
-            float mixed = acc / (1.0f + std::fabs(acc) * MIXER_K);
-
-            const float hpfOut = mixed - hpfPrevIn + HPF_R * hpfPrevOut;
-            hpfPrevIn = mixed;
-            hpfPrevOut = hpfOut;
-
-            float finalSample = hpfOut * FINAL_SCALE;
-            const float absSample = std::fabs(finalSample);
-            if (absSample > currentPeak) currentPeak = absSample;
-            if (finalSample > 32767.0f) finalSample = 32767.0f;
-            if (finalSample < -32768.0f) finalSample = -32768.0f;
-            stream[i] = apply_master_bitcrush((int16_t)finalSample, masterBitcrushBits_);
+            stream[i] = outputSampleFloat(acc);
         }
 #endif
+    }
 
-        if (postMixMono_) {
-            postMixMono_(stream, length, postMixUser_);
+    // ------------------------------------------------------------------
+    // Block renderer (voice-outer, sample-inner)
+    // ------------------------------------------------------------------
+    // Each voice renders a chunk into the mix accumulator in segments of at
+    // most AUDIO_CONTROL_RATE samples. Envelope, LFO and sweep are advanced
+    // once per segment and gain / phase increment are ramped linearly across
+    // it. Segments also end at the note's end and at envelope corners, so
+    // the piecewise-linear ADSR is reproduced exactly.
+
+    /** Samples left on the envelope's current linear ramp; 0 while it is flat (SUSTAIN/OFF). */
+    static inline uint32_t envelope_ramp_samples(const EnvelopeState& env) {
+        uint32_t end = 0;
+        switch (env.stage) {
+            case EnvelopeState::Stage::ATTACK:  end = env.attackSamples;  break;
+            case EnvelopeState::Stage::DECAY:   end = env.decaySamples;   break;
+            case EnvelopeState::Stage::RELEASE: end = env.releaseSamples; break;
+            default: return 0;
         }
+        return (env.sampleCounter < end) ? (end - env.sampleCounter) : 1u;
+    }
 
-        audioTimeSamples += (uint64_t)length;
-        samplesSinceLog += (uint64_t)length;
+    static inline bool envelope_is_ramping(const EnvelopeState& env) {
+        return env.stage == EnvelopeState::Stage::ATTACK
+            || env.stage == EnvelopeState::Stage::DECAY
+            || env.stage == EnvelopeState::Stage::RELEASE;
+    }
 
-        if constexpr (platforms::config::EnableProfiling) {
-            if (samplesSinceLog >= (uint64_t)sampleRate) {
-                uint8_t idx = profileWriteIdx.fetch_add(1, std::memory_order_relaxed);
-                idx %= PROFILE_RING_SIZE;
-                profileRing[idx].audioTimeSamples = audioTimeSamples;
-                profileRing[idx].peak = currentPeak;
-                profileRing[idx].clipped = (currentPeak >= 32767.0f);
-                if (profileCount < PROFILE_RING_SIZE) {
-                    profileCount++;
+    /** Skips the LFO forward by @p k samples. Returns false while it is still in its delay. */
+    static inline bool advance_lfo_counters(LfoState& lfo, uint32_t k) {
+        if (!lfo.enabled || lfo.periodSamples == 0) return false;
+        if (lfo.delayCounter < lfo.delaySamples) {
+            const uint32_t wait = std::min(k, (uint32_t)(lfo.delaySamples - lfo.delayCounter));
+            lfo.delayCounter = (uint16_t)(lfo.delayCounter + wait);
+            k -= wait;
+            if (k == 0) return false;
+        }
+        lfo.sampleCounter = (uint32_t)(((uint64_t)lfo.sampleCounter + k) % lfo.periodSamples);
+        return true;
+    }
+
+#ifdef PR32_APU_Q15_MIX
+    /** Runs @p k envelope ticks; @p k must not pass the end of the current ramp. */
+    static inline void advance_envelope_q15(AudioChannel& ch, uint32_t k) {
+        auto& env = ch.envelope;
+        const int32_t n = (int32_t)(k - 1u);  // last tick goes through tickEnvelopeQ15 for the stage change
+        if (n > 0 && envelope_is_ramping(env)) {
+            switch (env.stage) {
+                case EnvelopeState::Stage::ATTACK:  env.currentLevelQ15 += env.attackDeltaQ15 * n;  break;
+                case EnvelopeState::Stage::DECAY:   env.currentLevelQ15 -= env.decayDeltaQ15 * n;   break;
+                default:                            env.currentLevelQ15 -= env.releaseDeltaQ15 * n; break;
+            }
+            env.sampleCounter += (uint32_t)n;
+        }
+        tickEnvelopeQ15(ch);
+    }
+
+    /** Per-voice gain in Q15: volume × envelope × tremolo × MIXER_SCALE, as in the per-sample path. */
+    static inline int32_t voice_gain_q15(const AudioChannel& ch, int32_t volQ15) {
+        int32_t g = (volQ15 * std::max<int32_t>(0, ch.envelope.currentLevelQ15)) >> 15;
+        if (ch.lfo.enabled && ch.lfo.target == LfoTarget::VOLUME) {
+            const int32_t volModQ15 = 32768 - ((ch.lfo.depthQ15 * (32768 - ch.lfo.currentValueQ15)) >> 16);
+            g = (g * volModQ15) >> 15;
+        }
+        return (g * 13107) >> 15;
+    }
+#else
+    /** Runs @p k envelope ticks; @p k must not pass the end of the current ramp. */
+    static inline void advance_envelope_float(AudioChannel& ch, uint32_t k) {
+        auto& env = ch.envelope;
+        const uint32_t n = k - 1u;  // last tick goes through tickEnvelope for the stage change
+        if (n > 0 && envelope_is_ramping(env)) {
+            switch (env.stage) {
+                case EnvelopeState::Stage::ATTACK:  env.currentLevel += env.attackDelta * (float)n;  break;
+                case EnvelopeState::Stage::DECAY:   env.currentLevel -= env.decayDelta * (float)n;   break;
+                default:                            env.currentLevel -= env.releaseDelta * (float)n; break;
+            }
+            env.sampleCounter += n;
+        }
+        tickEnvelope(ch);
+    }
+
+    /** Per-voice gain: volume × envelope × tremolo × MIXER_SCALE, as in the per-sample path. */
+    static inline float voice_gain_float(const AudioChannel& ch) {
+        float g = ch.volume * std::max(0.0f, ch.envelope.currentLevel) * ApuCore::MIXER_SCALE;
+        if (ch.lfo.enabled && ch.lfo.target == LfoTarget::VOLUME) {
+            g *= 1.0f - ch.lfo.depth * 0.5f * (1.0f - ch.lfo.currentValue);
+        }
+        return g;
+    }
+#endif
+
+    void ApuCore::renderVoiceBlock(Voice& ch, int length, int sampleRate, MixBlock& block) {
+        const uint32_t controlRate = (uint32_t)platforms::config::AudioControlRate;
+#ifdef PR32_APU_Q15_MIX
+        (void)sampleRate;  // the integer path works on the voice's Q32 increments
+        int32_t* acc = block.q15;
+        const int32_t volQ15 = (int32_t)(ch.volume * 32768.0f);
+        if (ch.type == WaveType::PCM) {
+            const int32_t g = (volQ15 * 13107) >> 15;
+            mix_pcm_block(ch, acc, length, [g](int32_t v) { return (v * g) >> 15; });
+            return;
+        }
+#else
+        float* acc = block.f;
+        if (ch.type == WaveType::PCM) {
+            const float g = ch.volume * MIXER_SCALE * (1.0f / 32768.0f);
+            mix_pcm_block(ch, acc, length, [g](int32_t v) { return (float)v * g; });
+            return;
+        }
+#endif
+
+        int pos = 0;
+        while (pos < length && ch.enabled) {
+            uint32_t k = std::min(controlRate, (uint32_t)(length - pos));
+            if (ch.remainingSamples > 0 && ch.remainingSamples < k) k = (uint32_t)ch.remainingSamples;
+            uint32_t ramp = envelope_ramp_samples(ch.envelope);
+#ifdef PR32_APU_Q15_MIX
+            // RELEASE also ends early once the level reaches zero.
+            if (ch.envelope.stage == EnvelopeState::Stage::RELEASE && ch.envelope.releaseDeltaQ15 > 0) {
+                const int32_t level = std::max<int32_t>(ch.envelope.currentLevelQ15, 1);
+                ramp = std::min(ramp, (uint32_t)((level + ch.envelope.releaseDeltaQ15 - 1) / ch.envelope.releaseDeltaQ15));
+            }
+            // The Q15 deltas are truncated, so the corner tick steps the level onto
+            // its target; it gets a one-sample segment instead of being ramped in.
+            if (ramp > 1) ramp -= 1;
+#else
+            if (ch.envelope.stage == EnvelopeState::Stage::RELEASE && ch.envelope.releaseDelta > 0.0f) {
+                const float toZero = std::ceil(ch.envelope.currentLevel / ch.envelope.releaseDelta);
+                ramp = std::min(ramp, (toZero >= 1.0f) ? (uint32_t)toZero : 1u);
+            }
+#endif
+            if (ramp > 0 && ramp < k) k = ramp;
+            // The LFO jumps from 0 to its first value when the delay ends (a one-sample
+            // segment takes the step); the pitch stops ramping when the sweep does.
+            if (ch.lfo.enabled && ch.lfo.delayCounter < ch.lfo.delaySamples) {
+                k = std::min(k, (uint32_t)(ch.lfo.delaySamples - ch.lfo.delayCounter));
+            } else if (ch.lfo.enabled && ch.lfo.sampleCounter == 0
+#ifdef PR32_APU_Q15_MIX
+                       && ch.lfo.currentValueQ15 == 0) {
+#else
+                       && ch.lfo.currentValue == 0.0f) {
+#endif
+                k = 1;
+            }
+            if (ch.sweepSamplesTotal > 0 && ch.sweepSamplesRemaining > 0) {
+                k = std::min(k, ch.sweepSamplesRemaining);
+            }
+
+#ifdef PR32_APU_Q15_MIX
+            // ---- Control-rate update (integer) ----
+            const int32_t gainStart = voice_gain_q15(ch, volQ15);
+            const uint32_t incStart = ch.phaseIncQ32;
+            advance_linear_frequency_sweep_q15(ch, k);
+            advance_envelope_q15(ch, k);
+            if (advance_lfo_counters(ch.lfo, k)) ch.lfo.currentValueQ15 = lfo_triangle_q15(ch.lfo);
+            if (ch.lfo.enabled && ch.lfo.target == LfoTarget::PITCH) {
+                const int32_t modQ15 = (int32_t)((int64_t)ch.lfo.currentValueQ15 * ch.lfo.depthQ15 >> 15);
+                const int64_t inc = (int64_t)ch.basePhaseIncQ32 + ((int64_t)ch.basePhaseIncQ32 * modQ15 >> 15);
+                ch.phaseIncQ32 = (inc < 0) ? 0u : (uint32_t)inc;
+            }
+            const int32_t gainEnd = voice_gain_q15(ch, volQ15);
+
+            // Gain ramps in Q16.16 (|gain| <= 13107, so the shift stays in range);
+            // sample j uses the gain after j ticks, like the Q15 per-sample path.
+            int32_t g = gainStart * 65536;
+            const int32_t dg = (gainEnd - gainStart) * 65536 / (int32_t)k;
+            uint32_t phase = ch.phaseQ32;
+            uint32_t inc = incStart;
+            const uint32_t dInc = (uint32_t)(int32_t)(((int64_t)ch.phaseIncQ32 - (int64_t)incStart) / (int64_t)k);
+            int32_t* out = acc + pos;
+            // Band-limited voices use the mip level that is safe for the higher end of the ramp.
+            const int level = ch.bandLimited ? band_limited_level(std::max(incStart, ch.phaseIncQ32)) : 0;
+
+            switch (ch.type) {
+                case WaveType::PULSE: {
+                    uint32_t duty = ch.dutyCycleQ32;
+                    const uint32_t dutySweep = (uint32_t)ch.dutySweepQ32;
+                    if (ch.bandLimited) {
+                        const int16_t* saw = BL_SAW_Q15[level];
+                        for (uint32_t j = 0; j < k; ++j) {
+                            out[j] += (pulse_wavetable_q15(saw, phase, duty) * (g >> 16)) >> 15;
+                            g += dg;
+                            phase += inc;
+                            inc += dInc;
+                            duty += dutySweep;
+                        }
+                        ch.dutyCycleQ32 = duty;
+                        break;
+                    }
+                    for (uint32_t j = 0; j < k; ++j) {
+                        out[j] += ((phase < duty) ? (g >> 16) : -(g >> 16)) * 32767 >> 15;
+                        g += dg;
+                        phase += inc;
+                        inc += dInc;
+                        duty += dutySweep;
+                    }
+                    ch.dutyCycleQ32 = duty;
+                    break;
                 }
-                currentPeak = 0.0f;
-                samplesSinceLog = 0;
+                case WaveType::TRIANGLE:
+                    if (ch.bandLimited) {
+                        const int16_t* table = BL_TRIANGLE_Q15[level];
+                        for (uint32_t j = 0; j < k; ++j) {
+                            out[j] += (wavetable_q15(table, phase) * (g >> 16)) >> 15;
+                            g += dg;
+                            phase += inc;
+                            inc += dInc;
+                        }
+                        break;
+                    }
+                    for (uint32_t j = 0; j < k; ++j) {
+                        out[j] += (triangle_q15(phase) * (g >> 16)) >> 15;
+                        g += dg;
+                        phase += inc;
+                        inc += dInc;
+                    }
+                    break;
+                case WaveType::SINE:
+                    for (uint32_t j = 0; j < k; ++j) {
+                        out[j] += ((int32_t)SINE_LUT_Q15[(phase >> 24) & 255u] * (g >> 16)) >> 15;
+                        g += dg;
+                        phase += inc;
+                        inc += dInc;
+                    }
+                    break;
+                case WaveType::SAW:
+                    if (ch.bandLimited) {
+                        const int16_t* table = BL_SAW_Q15[level];
+                        for (uint32_t j = 0; j < k; ++j) {
+                            out[j] += (wavetable_q15(table, phase) * (g >> 16)) >> 15;
+                            g += dg;
+                            phase += inc;
+                            inc += dInc;
+                        }
+                        break;
+                    }
+                    for (uint32_t j = 0; j < k; ++j) {
+                        out[j] += (saw_q15(phase) * (g >> 16)) >> 15;
+                        g += dg;
+                        phase += inc;
+                        inc += dInc;
+                    }
+                    break;
+                case WaveType::NOISE:
+                    for (uint32_t j = 0; j < k; ++j) {
+                        clock_noise(ch);
+                        out[j] += (((ch.lfsrState & 1u) ? 32767 : -32767) * (g >> 16)) >> 15;
+                        g += dg;
+                    }
+                    break;
+                case WaveType::PCM:
+                    break;  // mixed by mix_pcm_block above
             }
-        } else if (samplesSinceLog >= (uint64_t)sampleRate) {
-            currentPeak = 0.0f;
-            samplesSinceLog = 0;
+            ch.phaseQ32 = phase;
+#else
+            // ---- Control-rate update (float) ----
+            const float gainStart = voice_gain_float(ch);
+            const float incStart = ch.phaseIncrement;
+            // The float path steps the sweep before each sample, the LFO after it.
+            const bool sweeping = ch.sweepSamplesTotal > 0 && ch.sweepSamplesRemaining > 0
+                && ch.type != WaveType::NOISE;
+            advance_linear_frequency_sweep_float(ch, sampleRate, k);
+            advance_envelope_float(ch, k);
+            if (advance_lfo_counters(ch.lfo, k)) ch.lfo.currentValue = lfo_triangle_float(ch.lfo);
+            if (ch.lfo.enabled && ch.lfo.target == LfoTarget::PITCH) {
+                ch.phaseIncrement = ch.frequency / (float)sampleRate
+                    * (1.0f + ch.lfo.currentValue * ch.lfo.depth);
+            }
+            const float gainEnd = voice_gain_float(ch);
+
+            // Sample j uses the gain after j + 1 ticks, like the per-sample path.
+            const float invK = 1.0f / (float)k;
+            float g = gainStart;
+            const float dg = (gainEnd - gainStart) * invK;
+            float phase = ch.phase;
+            const float dInc = (ch.phaseIncrement - incStart) * invK;
+            float inc = sweeping ? incStart + dInc : incStart;
+            float* out = acc + pos;
+
+            switch (ch.type) {
+                case WaveType::PULSE: {
+                    float duty = ch.dutyCycle;
+                    const float dutySweep = ch.dutySweep;
+                    const bool bandLimited = ch.bandLimited;
+                    for (uint32_t j = 0; j < k; ++j) {
+                        g += dg;
+                        if (bandLimited) {
+                            out[j] += pulse_blep(phase, duty, inc) * g;
+                        } else {
+                            out[j] += (phase < duty) ? g : -g;
+                        }
+                        phase += inc;
+                        if (phase >= 1.0f) phase -= 1.0f;
+                        inc += dInc;
+                        if (dutySweep != 0.0f) {
+                            duty += dutySweep;
+                            if (duty > 1.0f) duty -= 1.0f;
+                            else if (duty < 0.0f) duty += 1.0f;
+                        }
+                    }
+                    ch.dutyCycle = duty;
+                    break;
+                }
+                case WaveType::TRIANGLE:
+                    if (ch.bandLimited) {
+                        for (uint32_t j = 0; j < k; ++j) {
+                            g += dg;
+                            out[j] += triangle_blamp(phase, inc) * g;
+                            phase += inc;
+                            if (phase >= 1.0f) phase -= 1.0f;
+                            inc += dInc;
+                        }
+                        break;
+                    }
+                    for (uint32_t j = 0; j < k; ++j) {
+                        g += dg;
+                        out[j] += ((phase < 0.5f) ? (4.0f * phase - 1.0f) : (3.0f - 4.0f * phase)) * g;
+                        phase += inc;
+                        if (phase >= 1.0f) phase -= 1.0f;
+                        inc += dInc;
+                    }
+                    break;
+                case WaveType::SINE:
+                    for (uint32_t j = 0; j < k; ++j) {
+                        g += dg;
+                        const unsigned idx = (unsigned)(phase * 256.0f) & 255u;
+                        out[j] += (float)SINE_LUT_Q15[idx] * (1.0f / 32768.0f) * g;
+                        phase += inc;
+                        if (phase >= 1.0f) phase -= 1.0f;
+                        inc += dInc;
+                    }
+                    break;
+                case WaveType::SAW:
+                    if (ch.bandLimited) {
+                        for (uint32_t j = 0; j < k; ++j) {
+                            g += dg;
+                            out[j] += saw_blep(phase, inc) * g;
+                            phase += inc;
+                            if (phase >= 1.0f) phase -= 1.0f;
+                            inc += dInc;
+                        }
+                        break;
+                    }
+                    for (uint32_t j = 0; j < k; ++j) {
+                        g += dg;
+                        out[j] += (2.0f * phase - 1.0f) * g;
+                        phase += inc;
+                        if (phase >= 1.0f) phase -= 1.0f;
+                        inc += dInc;
+                    }
+                    break;
+                case WaveType::NOISE:
+                    for (uint32_t j = 0; j < k; ++j) {
+                        g += dg;
+                        clock_noise(ch);
+                        out[j] += (ch.lfsrState & 1u) ? g : -g;
+                    }
+                    break;
+                case WaveType::PCM:
+                    break;  // mixed by mix_pcm_block above
+            }
+            ch.phase = phase;
+#endif
+
+            if (ch.remainingSamples > 0) {
+                ch.remainingSamples -= k;
+                if (ch.remainingSamples == 0) end_note(ch);
+            }
+            pos += (int)k;
+        }
+    }
+
+    void ApuCore::renderBlock(int16_t* stream, int length) {
+        for (int base = 0; base < length; base += MIX_BLOCK_SAMPLES) {
+            const int n = std::min(MIX_BLOCK_SAMPLES, length - base);
+#ifdef PR32_APU_Q15_MIX
+            std::fill(mixBlock_.q15, mixBlock_.q15 + n, 0);
+#else
+            std::fill(mixBlock_.f, mixBlock_.f + n, 0.0f);
+#endif
+            for (int c = 0; c < MAX_VOICES; ++c) {
+                if (voices[c].enabled) renderVoiceBlock(voices[c], n, sampleRate, mixBlock_);
+            }
+
+            int16_t* out = stream + base;
+            for (int i = 0; i < n; ++i) {
+#ifdef PR32_APU_Q15_MIX
+                out[i] = outputSampleQ15(mixBlock_.q15[i]);
+#else
+                out[i] = outputSampleFloat(mixBlock_.f[i]);
+#endif
+            }
+        }
+    }
+
+    int ApuCore::renderVoice(Voice& ch, int sampleRate, int16_t* out, int length) {
+        MixBlock block;
+        int done = 0;
+        while (done < length && ch.enabled) {
+            const int n = std::min(MIX_BLOCK_SAMPLES, length - done);
+#ifdef PR32_APU_Q15_MIX
+            std::fill(block.q15, block.q15 + n, 0);
+            renderVoiceBlock(ch, n, sampleRate, block);
+            for (int i = 0; i < n; ++i) {
+                // Undo MIXER_SCALE (13107 / 32768) so a unit-volume voice spans int16.
+                int32_t v = (int32_t)(((int64_t)block.q15[i] * 32768) / 13107);
+                out[done + i] = (int16_t)std::max<int32_t>(-32768, std::min<int32_t>(32767, v));
+            }
+#else
+            std::fill(block.f, block.f + n, 0.0f);
+            renderVoiceBlock(ch, n, sampleRate, block);
+            constexpr float SCALE = 32767.0f / MIXER_SCALE;
+            for (int i = 0; i < n; ++i) {
+                const float v = block.f[i] * SCALE;
+                out[done + i] = (int16_t)std::max(-32768.0f, std::min(32767.0f, std::round(v)));
+            }
+#endif
+            done += n;
         }
+        return done;
     }
 
     void ApuCore::setPostMixMono(void (*fn)(int16_t* mono, int length, void* user), void* user) {
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#include "audio/SfxCache.h"
+#include "audio/ApuCore.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace pixelroot32::audio {
+
+    namespace {
+
+        /** Frames quieter than one 8-bit step count as silence when trimming the tail. */
+        constexpr int32_t SILENCE_THRESHOLD = 128;
+
+        inline uint8_t encodePcm8(int16_t s) {
+            const int32_t v = ((int32_t)s + 128) >> 8;
+            return (uint8_t)(int8_t)std::max<int32_t>(-128, std::min<int32_t>(127, v));
+        }
+
+        /** Encodes one frame; keeps the encoder's predictor in lockstep with the decoder. */
+        inline uint8_t encodeImaAdpcm(int16_t s, int32_t& predictor, int32_t& index) {
+            int32_t diff = (int32_t)s - predictor;
+            uint8_t nibble = 0;
+            if (diff < 0) {
+                nibble = 8;
+                diff = -diff;
+            }
+            int32_t step = IMA_ADPCM_STEPS[index];
+            if (diff >= step) {
+                nibble |= 4;
+                diff -= step;
+            }
+            step >>= 1;
+            if (diff >= step) {
+                nibble |= 2;
+                diff -= step;
+            }
+            step >>= 1;
+            if (diff >= step) nibble |= 1;
+            ima_adpcm_decode(nibble, predictor, index);
+            return nibble;
+        }
+
+    } // namespace
+
+    SfxCache::SfxCache(uint8_t* arena, size_t arenaBytes, int sampleRate)
+        : arena(arena), arenaBytes(arena ? arenaBytes : 0), sampleRate(sampleRate) {}
+
+    const SfxSample* SfxCache::add(const AudioEvent& event, SfxFormat format) {
+        if (count >= MAX_SAMPLES) return nullptr;
+
+        SfxSample& sample = samples[count];
+        const size_t bytes = render(event, format, sampleRate, arena + used, arenaBytes - used, sample);
+        if (bytes == 0) return nullptr;
+
+        used += bytes;
+        return &samples[count++];
+    }
+
+    void SfxCache::clear() {
+        // Table entries are left as they are, so a voice that has not taken its stop
+        // command yet reads stale frames rather than a null pointer.
+        count = 0;
+        used = 0;
+    }
+
+    AudioCommand SfxCache::stopCommand() const {
+        AudioCommand cmd;
+        cmd.type = AudioCommandType::STOP_SAMPLES;
+        cmd.sampleRange.first = samples;
+        cmd.sampleRange.count = (uint8_t)MAX_SAMPLES;
+        return cmd;
+    }
+
+    size_t SfxCache::render(const AudioEvent& event, SfxFormat format, int sampleRate,
+                            uint8_t* out, size_t outBytes, SfxSample& sample) {
+        if (!out || sampleRate <= 0 || event.type == WaveType::PCM || event.duration <= 0.0f) return 0;
+
+        // Render at full scale; the playback voice applies the gain.
+        AudioEvent fullScale = event;
+        fullScale.volume = 1.0f;
+        Voice voice;
+        ApuCore::startVoice(voice, fullScale, sampleRate);
+        if (!voice.enabled) return 0;
+
+        const size_t maxFrames = (format == SfxFormat::PCM8) ? outBytes : outBytes * 2;
+        int16_t chunk[ApuCore::MIX_BLOCK_SAMPLES];
+        size_t frames = 0;
+        size_t audible = 0;  // frames up to the last one above the silence threshold
+        int32_t predictor = 0;
+        int32_t index = 0;
+
+        while (voice.enabled) {
+            const int n = ApuCore::renderVoice(voice, sampleRate, chunk, ApuCore::MIX_BLOCK_SAMPLES);
+            for (int i = 0; i < n; ++i) {
+                const bool silent = std::abs((int32_t)chunk[i]) < SILENCE_THRESHOLD;
+                if (frames >= maxFrames) {
+                    if (!silent) return 0;  // does not fit
+                    continue;
+                }
+                if (format == SfxFormat::PCM8) {
+                    out[frames] = encodePcm8(chunk[i]);
+                } else {
+                    const uint8_t nibble = encodeImaAdpcm(chunk[i], predictor, index);
+                    uint8_t& byte = out[frames >> 1];
+                    byte = (frames & 1u) ? (uint8_t)((byte & 0x0Fu) | (nibble << 4)) : nibble;
+                }
+                ++frames;
+                if (!silent) audible = frames;
+            }
+        }
+        if (audible == 0) return 0;
+
+        sample.data = out;
+        sample.length = (uint32_t)audible;
+        sample.sampleRate = (uint32_t)sampleRate;
+        sample.format = format;
+        return (format == SfxFormat::PCM8) ? audible : (audible + 1) / 2;
+    }
+
+    AudioEvent SfxCache::makeEvent(const SfxSample* sample, float volume) {
+        AudioEvent event{};
+        event.type = WaveType::PCM;
+        event.volume = volume;
+        event.duration = (sample && sample->sampleRate > 0)
+                       ? (float)sample->length / (float)sample->sampleRate : 0.0f;
+        event.sample = sample;
+        return event;
+    }
+
+} // namespace pixelroot32::audio
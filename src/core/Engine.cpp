@@ -149,6 +149,54 @@ namespace pixelroot32::core {
         #ifdef PLATFORM_NATIVE
         connectInputToDrawer();
         #endif
+
+        if constexpr (pixelroot32::platforms::config::EnablePipelinedPresent) {
+            setPipelinedPresent(true);
+        }
+
+        #if PIXELROOT32_ENABLE_PHYSICS
+        if constexpr (pixelroot32::platforms::config::PhysicsParallel) {
+            setParallelPhysics(true);
+        }
+        #endif
+    }
+
+    #if PIXELROOT32_ENABLE_PHYSICS
+    bool Engine::setParallelPhysics(bool enabled) {
+        // Scenes keep the worker pointer; a stopped worker makes their step serial again.
+        if (!enabled) {
+            physicsWorker.stop();
+            return false;
+        }
+        if (!physicsWorker.start(capabilities)) {
+            log(LogLevel::Warning, "[Engine] Parallel physics unavailable, stepping serially");
+            return false;
+        }
+        if (auto scene = sceneManager.getCurrentScene()) {
+            scene.value()->setPhysicsWorker(&physicsWorker);
+        }
+        return true;
+    }
+    #endif
+
+    bool Engine::setPipelinedPresent(bool enabled) {
+        if (!enabled) {
+            renderer.setPresentPipeline(nullptr);
+            presentPipeline.stop();
+            return false;
+        }
+        if (presentPipeline.isRunning()) {
+            return true;
+        }
+        // The worker presents a copy of the sprite buffer, so drivers without one stay sequential.
+        DrawSurface& surface = renderer.getDrawSurface();
+        if (surface.getSpriteBuffer() == nullptr ||
+            !presentPipeline.start(surface, renderer.getLogicalWidth(), renderer.getLogicalHeight(), capabilities)) {
+            log(LogLevel::Warning, "[Engine] Pipelined present unavailable, presenting sequentially");
+            return false;
+        }
+        renderer.setPresentPipeline(&presentPipeline);
+        return true;
     }
 
     #ifdef PLATFORM_NATIVE
@@ -197,7 +245,7 @@ namespace pixelroot32::core {
                 }
                 if (redraw) {
                     draw();
-                    drawer->present();
+                    renderer.endFrame();
                 }
 
                 SDL_Delay(1);
@@ -210,6 +258,7 @@ namespace pixelroot32::core {
             static uint32_t totalDrawTime = 0;
             static uint32_t totalPresentTime = 0;
             static uint32_t totalEventsTime = 0;
+            static uint32_t totalFrameTime = 0;
             uint32_t t0 = 0;
             if constexpr (pixelroot32::platforms::config::EnableProfiling) {
                 t0 = pixelroot32::platforms::config::profilerMicros();
@@ -229,8 +278,10 @@ namespace pixelroot32::core {
                         }
                         unsigned long physicsIntegrateCount = gProfilerPhysicsIntegrateCount;
 
-                        log(LogLevel::Profiling, "FPS: %d | Update: %dus | Events: %dus | Draw: %dus | Present: %dus | Collision: %luus | PhysicsInt: %luus (%lu)\n",
+                        log(LogLevel::Profiling, "FPS: %d | Frame: %dus (%s) | Update: %dus | Events: %dus | Draw: %dus | Present: %dus | Collision: %luus | PhysicsInt: %luus (%lu)\n",
                             frameCount,
+                            totalFrameTime / frameCount,
+                            presentPipeline.isRunning() ? "pipelined" : "sequential",
                             totalUpdateTime / frameCount,
                             totalEventsTime / frameCount,
                             totalDrawTime / frameCount,
@@ -239,11 +290,25 @@ namespace pixelroot32::core {
                             avgPhysicsIntegrate,
                             physicsIntegrateCount
                         );
+                        if (presentPipeline.isRunning()) {
+                            // Main-loop "Present" above is handoff only (wait + copy); the push runs on the worker core.
+                            const auto& ps = presentPipeline.getStats();
+                            const uint32_t submitted = ps.framesSubmitted > 0 ? ps.framesSubmitted : 1;
+                            const uint32_t presented = ps.framesPresented > 0 ? ps.framesPresented : 1;
+                            log(LogLevel::Profiling, "[Present] worker: %uus/frame (%u frames) | wait: %uus | copy: %uus | full copies: %u",
+                                static_cast<unsigned>(ps.totalPresentUs / presented),
+                                static_cast<unsigned>(ps.framesPresented),
+                                static_cast<unsigned>(ps.totalWaitUs / submitted),
+                                static_cast<unsigned>(ps.totalCopyUs / submitted),
+                                static_cast<unsigned>(ps.fullCopies));
+                            presentPipeline.resetStats();
+                        }
                         frameCount = 0;
                         totalUpdateTime = 0;
                         totalDrawTime = 0;
                         totalPresentTime = 0;
                         totalEventsTime = 0;
+                        totalFrameTime = 0;
                         gProfilerCollisionTime = 0;
                         gProfilerPhysicsIntegrateTime = 0;
                         gProfilerPhysicsIntegrateCount = 0;
@@ -292,8 +357,8 @@ namespace pixelroot32::core {
                     t3 = pixelroot32::platforms::config::profilerMicros();
                 }
 
-                // Present frame (TFT_eSPI)
-                drawer->present();
+                // Present frame (TFT_eSPI): sequential push, or handoff to the present worker
+                renderer.endFrame();
             }
 
             if constexpr (pixelroot32::platforms::config::EnableProfiling) {
@@ -302,6 +367,7 @@ namespace pixelroot32::core {
                 totalEventsTime += (t2 - t1);
                 totalDrawTime += redraw ? (t3 - t2) : 0u;
                 totalPresentTime += redraw ? (t4 - t3) : 0u;
+                totalFrameTime += (t4 - t0);
                 frameCount++;
             }
 
@@ -313,6 +379,11 @@ namespace pixelroot32::core {
     void Engine::setScene(Scene* newScene) {
         assert(newScene != nullptr && "Cannot set null scene in engine");
         sceneManager.setCurrentScene(newScene);
+        #if PIXELROOT32_ENABLE_PHYSICS
+        if (physicsWorker.isRunning()) {
+            newScene->setPhysicsWorker(&physicsWorker);
+        }
+        #endif
     }
 
     Renderer& Engine::getRenderer() {
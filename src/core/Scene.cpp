@@ -12,6 +12,7 @@
 #include "core/EngineModules.h"
 #include "core/Scene.h"
 #include "core/Actor.h"
+#include "core/PhysicsActor.h"
 #include "graphics/Color.h"
 #include <cassert>
 
@@ -134,6 +135,9 @@ namespace pixelroot32::core {
         PaletteContext backgroundContext = PaletteContext::Background;
         PaletteContext spriteContext = PaletteContext::Sprite;
         unsigned char currentLayer = 255;
+        #if PIXELROOT32_ENABLE_PHYSICS
+            const pixelroot32::math::Scalar alpha = physicsScheduler.getAlpha();
+        #endif
 
         for (int i = 0; i < entityCount; ++i) {
             Entity* entity = entities[i];
@@ -142,6 +146,7 @@ namespace pixelroot32::core {
 
             if (entity->getRenderLayer() != currentLayer) {
                 currentLayer = entity->getRenderLayer();
+                renderer.setDrawLayer(currentLayer);
                 if (currentLayer == 0) {
                     renderer.setRenderContext(&backgroundContext);
                 } else {
@@ -149,9 +154,22 @@ namespace pixelroot32::core {
                 }
             }
 
-            if (isVisibleInViewport(entity, renderer)) {
-                entity->draw(renderer);
-            }
+            if (!isVisibleInViewport(entity, renderer)) continue;
+
+            #if PIXELROOT32_ENABLE_PHYSICS
+                // Opted-in bodies draw between their last two physics states; position is restored after.
+                if (entity->type == EntityType::ACTOR && static_cast<Actor*>(entity)->isPhysicsBody()) {
+                    PhysicsActor* body = static_cast<PhysicsActor*>(static_cast<Actor*>(entity));
+                    if (body->hasRenderInterpolation()) {
+                        const pixelroot32::math::Vector2 stepped = body->position;
+                        body->position = body->getRenderPosition(alpha);
+                        body->draw(renderer);
+                        body->position = stepped;
+                        continue;
+                    }
+                }
+            #endif
+            entity->draw(renderer);
         }
 
         renderer.setRenderContext(nullptr);
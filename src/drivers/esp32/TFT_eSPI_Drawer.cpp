@@ -1,4 +1,5 @@
 #include "drivers/esp32/TFT_eSPI_Drawer.h"
+#include "graphics/Color.h"
 #include "platforms/EngineConfig.h"
 #include "core/Log.h"
 
@@ -79,7 +80,8 @@ void pr32::drivers::esp32::TFT_eSPI_Drawer::init() {
 
     log("[TFT_eSPI_Drawer] Creating Sprite...");
     // Create sprite with LOGICAL resolution (smaller = less memory)
-    spr.setColorDepth(8);
+    // 8bpp RGB332 by default; 16bpp keeps resolved RGB565 so present is a copy
+    spr.setColorDepth(static_cast<int8_t>(sizeof(pixelroot32::graphics::FramebufferPixel) * 8));
     if (!spr.createSprite(logicalWidth, logicalHeight)) {
         log(LogLevel::Error, "Failed to create sprite of size %dx%d", logicalWidth, logicalHeight);
     }
@@ -117,7 +119,45 @@ void pr32::drivers::esp32::TFT_eSPI_Drawer::clearBuffer() {
 }
 
 void pr32::drivers::esp32::TFT_eSPI_Drawer::sendBuffer() {
-    sendBufferScaled();
+    const uint8_t* spritePtr = (const uint8_t*)spr.getPointer();
+    if (!spritePtr) {
+        return;
+    }
+    if constexpr (pixelroot32::platforms::config::FramebufferIndexed) {
+        refreshIndexedPaletteLUT(false);
+    }
+    bool partial = false;
+    uint16_t rectCount = 0;
+#if PIXELROOT32_TFT_ESPI_PARTIAL_PRESENT
+    if (presentDirtyGrid != nullptr) {
+        partial = presentDirtyGrid->collectPresentRects(presentRects, PIXELROOT32_TFT_ESPI_PARTIAL_MAX_RECTS,
+                                                        rectCount, logicalWidth, logicalHeight);
+    }
+#endif
+    sendBufferScaled(spritePtr, partial, rectCount);
+}
+
+void pr32::drivers::esp32::TFT_eSPI_Drawer::presentBuffer(const uint8_t* framebuffer,
+                                                          const pixelroot32::graphics::DirtyRect* rects,
+                                                          uint16_t rectCount,
+                                                          const uint16_t* paletteLUT) {
+    if (!framebuffer) {
+        return;
+    }
+    if constexpr (pixelroot32::platforms::config::FramebufferIndexed) {
+        if (paletteLUT != nullptr) {
+            loadIndexedPaletteLUT(paletteLUT);
+        }
+    }
+    // Rect lists longer than presentRects fall back to the full frame.
+    const bool partial = PIXELROOT32_TFT_ESPI_PARTIAL_PRESENT && rects != nullptr &&
+                         rectCount <= PIXELROOT32_TFT_ESPI_PARTIAL_MAX_RECTS;
+    if (partial) {
+        for (uint16_t i = 0; i < rectCount; ++i) {
+            presentRects[i] = rects[i];
+        }
+    }
+    sendBufferScaled(framebuffer, partial, partial ? rectCount : 0);
 }
 
 // --------------------------------------------------
@@ -161,8 +201,9 @@ void IRAM_ATTR pr32::drivers::esp32::TFT_eSPI_Drawer::drawTileDirect(uint16_t x,
         return;
     }
     
-    // Get direct pointer to sprite buffer (8bpp)
-    uint8_t* buffer = (uint8_t*)spr.getPointer();
+    // Get direct pointer to sprite buffer
+    pixelroot32::graphics::FramebufferPixel* buffer =
+        static_cast<pixelroot32::graphics::FramebufferPixel*>(spr.getPointer());
     if (!buffer) {
         return;
     }
@@ -178,10 +219,17 @@ void IRAM_ATTR pr32::drivers::esp32::TFT_eSPI_Drawer::drawTileDirect(uint16_t x,
         clippedH = logicalHeight - y;
     }
     
-    // Copy tile data directly to sprite buffer (fast memcpy)
+    // Copy tile data directly to sprite buffer (fast memcpy; 16bpp expands RGB332 via paletteLUT)
     for (uint16_t row = 0; row < clippedH; row++) {
-        uint16_t destOffset = (y + row) * logicalWidth + x;
-        std::memcpy(&buffer[destOffset], data + row * width, clippedW);
+        const uint32_t destOffset = static_cast<uint32_t>(y + row) * logicalWidth + x;
+        if constexpr (pixelroot32::platforms::config::Framebuffer16Bpp) {
+            const uint8_t* src = data + row * width;
+            for (uint16_t col = 0; col < clippedW; ++col) {
+                buffer[destOffset + col] = paletteLUT[src[col]];
+            }
+        } else {
+            std::memcpy(&buffer[destOffset], data + row * width, clippedW);
+        }
     }
 }
 
@@ -189,6 +237,10 @@ uint8_t* pr32::drivers::esp32::TFT_eSPI_Drawer::getSpriteBuffer() {
     return (uint8_t*)spr.getPointer();
 }
 
+void pr32::drivers::esp32::TFT_eSPI_Drawer::setPresentDirtyGrid(const pixelroot32::graphics::DirtyGrid* grid) {
+    presentDirtyGrid = grid;
+}
+
 // --------------------------------------------------
 // Scaling Functions
 // --------------------------------------------------
@@ -249,6 +301,9 @@ void pr32::drivers::esp32::TFT_eSPI_Drawer::buildScaleLUTs() {
         // Check if SPI_FREQUENCY is high, maybe we need to be careful?
         paletteLUT[i] = (color16 >> 8) | (color16 << 8);
     }
+    if constexpr (pixelroot32::platforms::config::FramebufferIndexed) {
+        refreshIndexedPaletteLUT(true);
+    }
 
     // Build X lookup table
     for (int i = 0; i < physicalWidth; ++i) {
@@ -298,11 +353,46 @@ void pr32::drivers::esp32::TFT_eSPI_Drawer::freeScalingBuffers() {
     }
 }
 
-void IRAM_ATTR pr32::drivers::esp32::TFT_eSPI_Drawer::sendBufferScaled() {
-    uint8_t* spritePtr = (uint8_t*)spr.getPointer();
-    if (!spritePtr) {
+void pr32::drivers::esp32::TFT_eSPI_Drawer::refreshIndexedPaletteLUT(bool force) {
+    const uint32_t generation = pixelroot32::graphics::getPaletteGeneration();
+    if (paletteLUT == nullptr || (!force && generation == paletteLUTGeneration)) {
         return;
     }
+    // 256 word writes recolour the whole frame (fades, flashes) without redrawing it.
+    pixelroot32::graphics::buildIndexedPaletteLUT(paletteLUT);
+    loadIndexedPaletteLUT(paletteLUT);
+    paletteLUTGeneration = generation;
+}
+
+void pr32::drivers::esp32::TFT_eSPI_Drawer::loadIndexedPaletteLUT(const uint16_t* rgb565) {
+    if (paletteLUT == nullptr || rgb565 == nullptr) {
+        return;
+    }
+    for (int i = 0; i < 256; ++i) {
+        paletteLUT[i] = pixelroot32::graphics::packRgb565ToTftSprite16(rgb565[i]);
+    }
+}
+
+void IRAM_ATTR pr32::drivers::esp32::TFT_eSPI_Drawer::sendBufferScaled(const uint8_t* spritePtr, bool partial, uint16_t rectCount) {
+#if PIXELROOT32_TFT_ESPI_PARTIAL_PRESENT
+    if (partial) {
+        if (rectCount == 0) {
+            return;  // Nothing changed on screen; the panel keeps last frame's pixels.
+        }
+        uint32_t dirtyArea = 0;
+        for (uint16_t i = 0; i < rectCount; ++i) {
+            dirtyArea += static_cast<uint32_t>(presentRects[i].w) * presentRects[i].h;
+        }
+        const uint32_t screenArea = static_cast<uint32_t>(logicalWidth) * static_cast<uint32_t>(logicalHeight);
+        if (dirtyArea * 100u <= screenArea * PIXELROOT32_TFT_ESPI_PARTIAL_MAX_COVERAGE_PCT) {
+            sendDirtyRectsScaled(spritePtr, rectCount);
+            return;
+        }
+    }
+#else
+    (void)partial;
+    (void)rectCount;
+#endif
 
 #ifdef PIXELROOT32_ENABLE_PROFILING
     PR32_SEND_BUF_PROFILE_VARS();
@@ -320,64 +410,13 @@ void IRAM_ATTR pr32::drivers::esp32::TFT_eSPI_Drawer::sendBufferScaled() {
     // ---------------------------------------------------------
     // STAGE 1: Pre-fill (First Block)
     // ---------------------------------------------------------
-    bool is2x = (physicalWidth == logicalWidth * 2 && physicalHeight == logicalHeight * 2);
-
     if (startY < physicalHeight) {
         int endY = startY + activeLinesPerBlock;
         if (endY > physicalHeight) endY = physicalHeight;
         int numLines = endY - startY;
 
         // Scale block 0
-        uint16_t* dst = lineBuffer[currentBuffer];
-
-        if (!needsScaling()) {
-             // 1:1 Optimization for the first block
-             for (int i = 0; i < numLines; ++i) {
-                 uint8_t* srcRow = spritePtr + ((startY + i) * logicalWidth);
-                 const uint16_t* __restrict pLUT = paletteLUT;
-                 int x = 0;
-                 uint32_t* dst32 = (uint32_t*)dst;
-                 
-                 for (; x <= physicalWidth - 8; x += 8) {
-                     uint32_t p01 = ((uint32_t)pLUT[srcRow[x+1]] << 16) | pLUT[srcRow[x]];
-                     uint32_t p23 = ((uint32_t)pLUT[srcRow[x+3]] << 16) | pLUT[srcRow[x+2]];
-                     uint32_t p45 = ((uint32_t)pLUT[srcRow[x+5]] << 16) | pLUT[srcRow[x+4]];
-                     uint32_t p67 = ((uint32_t)pLUT[srcRow[x+7]] << 16) | pLUT[srcRow[x+6]];
-
-                     dst32[x/2]     = p01;
-                     dst32[x/2 + 1] = p23;
-                     dst32[x/2 + 2] = p45;
-                     dst32[x/2 + 3] = p67;
-                 }
-                 for (; x < physicalWidth; ++x) {
-                     dst[x] = pLUT[srcRow[x]];
-                 }
-                 dst += physicalWidth;
-             }
-        } else if (is2x) {
-            // 2x Fast-Path: Duplicate pixels and rows using 32-bit writes
-            for (int physY = startY; physY < endY; physY += 2) {
-                int srcY = physY / 2;
-                uint8_t* srcRow = spritePtr + (srcY * logicalWidth);
-                const uint16_t* __restrict pLUT = paletteLUT;
-                uint32_t* dst32 = (uint32_t*)dst;
-
-                for (int lx = 0; lx < logicalWidth; ++lx) {
-                    uint16_t color = pLUT[srcRow[lx]];
-                    dst32[lx] = (color << 16) | color; // Store two identical pixels
-                }
-                // Duplicate this line for the next physical row
-                std::memcpy(dst + physicalWidth, dst, physicalWidth * sizeof(uint16_t));
-                dst += physicalWidth * 2;
-            }
-        } else {
-            // Normal path with scaling
-            for (int physY = startY; physY < endY; ++physY) {
-                int srcY = yLUT[physY];
-                scaleLine(spritePtr, srcY, dst);
-                dst += physicalWidth;
-            }
-        }
+        scaleWindowBlock(spritePtr, 0, physicalWidth, startY, endY, lineBuffer[currentBuffer]);
 
 #ifdef PIXELROOT32_ENABLE_PROFILING
         PR32_SEND_BUF_PROFILE_ACC(pr32_acc_scale);
@@ -402,59 +441,9 @@ void IRAM_ATTR pr32::drivers::esp32::TFT_eSPI_Drawer::sendBufferScaled() {
         if (endY > physicalHeight) endY = physicalHeight;
         int numLines = endY - startY;
 
-        // 2. CPU calculates the next block in the free buffer
+        // 1. CPU calculates the next block in the free buffer
         // (SPI hardware is busy sending the opposite buffer in the background)
-        uint16_t* dst = lineBuffer[currentBuffer];
-        
-        // Optimization for 1:1 case (No scaling)
-        // We avoid xLUT and yLUT indirection for maximum speed
-        if (!needsScaling()) {
-             // Process block of lines directly
-             for (int i = 0; i < numLines; ++i) {
-                 uint8_t* srcRow = spritePtr + ((startY + i) * logicalWidth);
-                 const uint16_t* __restrict pLUT = paletteLUT;
-                 int x = 0;
-                 uint32_t* dst32 = (uint32_t*)dst;
-                 
-                 for (; x <= physicalWidth - 8; x += 8) {
-                     uint32_t p01 = ((uint32_t)pLUT[srcRow[x+1]] << 16) | pLUT[srcRow[x]];
-                     uint32_t p23 = ((uint32_t)pLUT[srcRow[x+3]] << 16) | pLUT[srcRow[x+2]];
-                     uint32_t p45 = ((uint32_t)pLUT[srcRow[x+5]] << 16) | pLUT[srcRow[x+4]];
-                     uint32_t p67 = ((uint32_t)pLUT[srcRow[x+7]] << 16) | pLUT[srcRow[x+6]];
-
-                     dst32[x/2]     = p01;
-                     dst32[x/2 + 1] = p23;
-                     dst32[x/2 + 2] = p45;
-                     dst32[x/2 + 3] = p67;
-                 }
-                 for (; x < physicalWidth; ++x) {
-                     dst[x] = pLUT[srcRow[x]];
-                 }
-                 dst += physicalWidth;
-             }
-        } else if (is2x) {
-            // 2x Fast-Path for the main loop blocks
-            for (int physY = startY; physY < endY; physY += 2) {
-                int srcY = physY / 2;
-                uint8_t* srcRow = spritePtr + (srcY * logicalWidth);
-                const uint16_t* __restrict pLUT = paletteLUT;
-                uint32_t* dst32 = (uint32_t*)dst;
-
-                for (int lx = 0; lx < logicalWidth; ++lx) {
-                    uint16_t color = pLUT[srcRow[lx]];
-                    dst32[lx] = (color << 16) | color;
-                }
-                std::memcpy(dst + physicalWidth, dst, physicalWidth * sizeof(uint16_t));
-                dst += physicalWidth * 2;
-            }
-        } else {
-            // Normal path with scaling (using LUTs)
-            for (int physY = startY; physY < endY; ++physY) {
-                int srcY = yLUT[physY];
-                scaleLine(spritePtr, srcY, dst);
-                dst += physicalWidth;
-            }
-        }
+        scaleWindowBlock(spritePtr, 0, physicalWidth, startY, endY, lineBuffer[currentBuffer]);
 
 #ifdef PIXELROOT32_ENABLE_PROFILING
         PR32_SEND_BUF_PROFILE_ACC(pr32_acc_scale);
@@ -542,27 +531,97 @@ void IRAM_ATTR pr32::drivers::esp32::TFT_eSPI_Drawer::sendBufferScaled() {
 #endif
 }
 
-void IRAM_ATTR pr32::drivers::esp32::TFT_eSPI_Drawer::scaleLine(const uint8_t* spriteBase, int srcY, uint16_t* dst) {
-    const uint8_t* srcRow = spriteBase + (srcY * logicalWidth);
-    
-    // Use local pointers to help optimization
-    const uint16_t* __restrict pLUT = paletteLUT;
-    const uint16_t* __restrict xL = xLUT;
-    
-    int physX = 0;
-    
-    // Unroll loop 4x for better pipeline usage
-    // This reduces loop overhead and allows better instruction scheduling
-    for (; physX <= physicalWidth - 4; physX += 4) {
-        dst[physX]     = pLUT[srcRow[xL[physX]]];
-        dst[physX + 1] = pLUT[srcRow[xL[physX + 1]]];
-        dst[physX + 2] = pLUT[srcRow[xL[physX + 2]]];
-        dst[physX + 3] = pLUT[srcRow[xL[physX + 3]]];
+void IRAM_ATTR pr32::drivers::esp32::TFT_eSPI_Drawer::sendDirtyRectsScaled(const uint8_t* spritePtr, uint16_t rectCount) {
+    // 2x windows are sent in row pairs; a 1-line block would round down to 0 lines and never advance.
+    static_assert(PIXELROOT32_TFT_ESPI_LINES_PER_BLOCK >= 2, "PIXELROOT32_TFT_ESPI_LINES_PER_BLOCK must be >= 2");
+    static_assert(PIXELROOT32_TFT_ESPI_LINES_PER_BLOCK_FALLBACK >= 2,
+                  "PIXELROOT32_TFT_ESPI_LINES_PER_BLOCK_FALLBACK must be >= 2");
+    const bool is2x = (physicalWidth == logicalWidth * 2 && physicalHeight == logicalHeight * 2);
+    const int blockPixels = physicalWidth * activeLinesPerBlock;
+
+    // First physical coordinate whose LUT sample (p * logical / physical) lands at or after logical l.
+    auto physStart = [](int l, int logicalSize, int physicalSize) {
+        return (l * physicalSize + logicalSize - 1) / logicalSize;
+    };
+
+    tft.startWrite();
+    currentBuffer = 0;
+    bool dmaPending = false;
+
+    for (uint16_t i = 0; i < rectCount; ++i) {
+        const pixelroot32::graphics::DirtyRect& r = presentRects[i];
+        const int px0 = physStart(r.x, logicalWidth, physicalWidth);
+        const int px1 = physStart(r.x + r.w, logicalWidth, physicalWidth);
+        const int py0 = physStart(r.y, logicalHeight, physicalHeight);
+        const int py1 = physStart(r.y + r.h, logicalHeight, physicalHeight);
+        const int winW = px1 - px0;
+        const int winH = py1 - py0;
+        if (winW <= 0 || winH <= 0) {
+            continue;
+        }
+
+        // Narrow windows fit more rows into the same DMA line buffer; 2x needs row pairs.
+        // winW <= physicalWidth, so this is >= activeLinesPerBlock >= 2 (static_asserts above).
+        int linesPerBlock = blockPixels / winW;
+        if (is2x) {
+            linesPerBlock &= ~1;
+        }
+
+        bool windowSet = false;
+        for (int y = py0; y < py1; y += linesPerBlock) {
+            const int yEnd = (y + linesPerBlock < py1) ? (y + linesPerBlock) : py1;
+            uint16_t* dst = lineBuffer[currentBuffer];
+
+            // CPU converts this block while the previous one is still on the bus.
+            scaleWindowBlock(spritePtr, px0, winW, y, yEnd, dst);
+
+            if (dmaPending) {
+                tft.dmaWait();
+            }
+            if (!windowSet) {
+                tft.setAddrWindow(xOffset + px0, yOffset + py0, winW, winH);
+                windowSet = true;
+            }
+            tft.pushPixelsDMA(dst, winW * (yEnd - y));
+            dmaPending = true;
+            currentBuffer = 1 - currentBuffer;
+        }
     }
-    
-    // Handle remaining pixels
-    for (; physX < physicalWidth; ++physX) {
-        dst[physX] = pLUT[srcRow[xL[physX]]];
+
+    if (dmaPending) {
+        tft.dmaWait();
+    }
+    tft.endWrite();
+}
+
+void IRAM_ATTR pr32::drivers::esp32::TFT_eSPI_Drawer::scaleWindowBlock(const uint8_t* spriteBase, int physX0, int physW,
+                                                                      int physY0, int physY1, uint16_t* dst) {
+    namespace present = pixelroot32::graphics::present;
+    // 8bpp: RGB332 through paletteLUT. 16bpp: words are already panel-order RGB565.
+    using pixelroot32::graphics::FramebufferPixel;
+    const FramebufferPixel* fb = reinterpret_cast<const FramebufferPixel*>(spriteBase);
+    // 8bpp rows go through the selected kernel set (SIMD / word-wide / scalar); 16bpp rows are copies.
+    const present::RowKernels& kernels = present::activeKernels();
+
+    if (!needsScaling()) {
+        // 1:1 (windows are 8 px aligned, so 32-bit stores stay aligned)
+        for (int y = physY0; y < physY1; ++y) {
+            present::convertRow(kernels, fb + (y * logicalWidth) + physX0, dst, physW, paletteLUT);
+            dst += physW;
+        }
+    } else if (physicalWidth == logicalWidth * 2 && physicalHeight == logicalHeight * 2) {
+        // 2x Fast-Path: origin and size are even, duplicate pixels and rows
+        for (int y = physY0; y < physY1; y += 2) {
+            present::convertRow2x(kernels, fb + ((y / 2) * logicalWidth) + physX0 / 2, dst, physW / 2, paletteLUT);
+            std::memcpy(dst + physW, dst, physW * sizeof(uint16_t));
+            dst += physW * 2;
+        }
+    } else {
+        // Normal path with scaling (using LUTs)
+        for (int y = physY0; y < physY1; ++y) {
+            present::convertRowScaled(kernels, fb + (yLUT[y] * logicalWidth), dst, physW, xLUT + physX0, paletteLUT);
+            dst += physW;
+        }
     }
 }
 
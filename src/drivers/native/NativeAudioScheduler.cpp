@@ -6,13 +6,24 @@
 
 #include "drivers/native/NativeAudioScheduler.h"
 
-#include <chrono>
+#include <algorithm>
 #include <cstring>
 
 namespace pixelroot32::audio {
 
+    namespace {
+
+        size_t roundUpPowerOfTwo(size_t n) {
+            size_t p = 1;
+            while (p < n) p <<= 1;
+            return p;
+        }
+
+    } // namespace
+
     NativeAudioScheduler::NativeAudioScheduler(size_t ringBufferSize)
-        : rbCapacity(ringBufferSize) {
+        : rbCapacity(roundUpPowerOfTwo(std::max(ringBufferSize, (size_t)ApuCore::MIX_BLOCK_SAMPLES * 2))),
+          rbMask(rbCapacity - 1) {
         ringBuffer.resize(rbCapacity);
     }
 
@@ -20,10 +31,15 @@ namespace pixelroot32::audio {
         stop();
     }
 
-    void NativeAudioScheduler::init(AudioBackend* /*backend*/, int sampleRate,
+    void NativeAudioScheduler::init(AudioBackend* /*backend*/, int rate,
                                     const pixelroot32::platforms::PlatformCapabilities& /*caps*/, int blkSize) {
-        apu.init(sampleRate);
-        blockSize = blkSize;
+        apu.init(rate);
+        sampleRate = rate;
+        // Keep at least two blocks in the ring so the producer can render ahead.
+        blockSize = std::max(1, std::min(blkSize, (int)(rbCapacity / 2)));
+        targetLatency.store(std::min((size_t)blockSize * 2, rbCapacity), std::memory_order_relaxed);
+        underruns.store(0, std::memory_order_relaxed);
+        cleanSamples = 0;
     }
 
     void NativeAudioScheduler::submitCommand(const AudioCommand& cmd) {
@@ -32,72 +48,120 @@ namespace pixelroot32::audio {
 
     void NativeAudioScheduler::start() {
         if (running.load(std::memory_order_acquire)) return;
+        primed.store(false, std::memory_order_relaxed);
         running.store(true, std::memory_order_release);
         audioThread = std::thread(&NativeAudioScheduler::threadLoop, this);
     }
 
     void NativeAudioScheduler::stop() {
         if (!running.load(std::memory_order_acquire)) return;
-        running.store(false, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            running.store(false, std::memory_order_release);
+        }
+        wakeCv.notify_one();
         if (audioThread.joinable()) audioThread.join();
     }
 
     void NativeAudioScheduler::generateSamples(int16_t* stream, int length) {
         if (!stream || length <= 0) return;
 
-        const size_t available = rbAvailableToRead();
-        if (available < (size_t)length) {
-            rbRead(stream, available);
-            std::memset(stream + available, 0, (length - available) * sizeof(int16_t));
+        // At most two spans: up to the end of the ring, then from its start.
+        size_t copied = 0;
+        while (copied < (size_t)length) {
+            size_t span = 0;
+            const int16_t* src = rbReadSpan(span);
+            span = std::min(span, (size_t)length - copied);
+            if (span == 0) break;
+            std::memcpy(stream + copied, src, span * sizeof(int16_t));
+            rbCommitRead(span);
+            copied += span;
+        }
+        if (copied < (size_t)length) {
+            std::memset(stream + copied, 0, ((size_t)length - copied) * sizeof(int16_t));
+        }
+
+        adaptLatency(copied < (size_t)length, (size_t)length);
+
+        // Taking the mutex (held by the producer only while it checks its wait
+        // predicate) orders this wakeup after that check, so none is lost.
+        { std::lock_guard<std::mutex> lock(wakeMutex); }
+        wakeCv.notify_one();
+    }
+
+    void NativeAudioScheduler::adaptLatency(bool shortRead, size_t consumed) {
+        // A callback asking for more than the target would underrun every time.
+        const size_t minTarget = std::min(std::max((size_t)blockSize, consumed), rbCapacity);
+        size_t target = targetLatency.load(std::memory_order_relaxed);
+
+        if (shortRead) {
+            // Short reads while (re)filling are expected; one step per starvation episode.
+            if (primed.exchange(false, std::memory_order_acq_rel)) {
+                underruns.fetch_add(1, std::memory_order_relaxed);
+                target = std::min(std::max(target, minTarget) + (size_t)blockSize, rbCapacity);
+            }
+            cleanSamples = 0;
         } else {
-            rbRead(stream, length);
+            cleanSamples += consumed;
+            if (cleanSamples >= (size_t)sampleRate * LATENCY_DECAY_SECONDS) {
+                cleanSamples = 0;
+                const size_t step = (size_t)ApuCore::MIX_BLOCK_SAMPLES;
+                target = (target > minTarget + step) ? target - step : minTarget;
+            }
         }
+        targetLatency.store(target, std::memory_order_relaxed);
     }
 
     void NativeAudioScheduler::threadLoop() {
-        // Max block size is 256 (with FPU), use static buffer to avoid VLA issues
-        int16_t chunk[256];
-
         while (running.load(std::memory_order_acquire)) {
-            if (rbAvailableToWrite() >= (size_t)blockSize) {
-                apu.generateSamples(chunk, blockSize);
-                rbWrite(chunk, blockSize);
-            } else {
-                std::this_thread::sleep_for(std::chrono::microseconds(500));
+            size_t span = 0;
+            int16_t* dst = rbWriteSpan(span);
+            const size_t fill = rbAvailableToRead();
+            if (fill >= targetLatency.load(std::memory_order_relaxed) || span == 0) {
+                primed.store(true, std::memory_order_release);
+                std::unique_lock<std::mutex> lock(wakeMutex);
+                wakeCv.wait(lock, [this] {
+                    return !running.load(std::memory_order_acquire)
+                        || rbAvailableToRead() < targetLatency.load(std::memory_order_relaxed);
+                });
+                continue;
             }
+
+            // Render straight into the ring; blocks may overshoot the target by less than one block.
+            const size_t n = std::min(span, (size_t)blockSize);
+            apu.generateSamples(dst, (int)n);
+            rbCommitWrite(n);
         }
     }
 
     size_t NativeAudioScheduler::rbAvailableToRead() const {
         const size_t r = rbReadPos.load(std::memory_order_acquire);
         const size_t w = rbWritePos.load(std::memory_order_acquire);
-        if (w >= r) return w - r;
-        return rbCapacity - (r - w);
+        return w - r;
     }
 
-    size_t NativeAudioScheduler::rbAvailableToWrite() const {
+    int16_t* NativeAudioScheduler::rbWriteSpan(size_t& count) {
+        const size_t w = rbWritePos.load(std::memory_order_relaxed);
         const size_t r = rbReadPos.load(std::memory_order_acquire);
-        const size_t w = rbWritePos.load(std::memory_order_acquire);
-        const size_t avail = (w >= r) ? (rbCapacity - (w - r)) : (r - w);
-        return avail > 0 ? avail - 1 : 0;
+        const size_t index = w & rbMask;
+        count = std::min(rbCapacity - (w - r), rbCapacity - index);
+        return ringBuffer.data() + index;
     }
 
-    void NativeAudioScheduler::rbWrite(const int16_t* data, size_t count) {
-        size_t w = rbWritePos.load(std::memory_order_relaxed);
-        for (size_t i = 0; i < count; ++i) {
-            ringBuffer[w] = data[i];
-            w = (w + 1) % rbCapacity;
-        }
-        rbWritePos.store(w, std::memory_order_release);
+    void NativeAudioScheduler::rbCommitWrite(size_t count) {
+        rbWritePos.store(rbWritePos.load(std::memory_order_relaxed) + count, std::memory_order_release);
     }
 
-    void NativeAudioScheduler::rbRead(int16_t* data, size_t count) {
-        size_t r = rbReadPos.load(std::memory_order_relaxed);
-        for (size_t i = 0; i < count; ++i) {
-            data[i] = ringBuffer[r];
-            r = (r + 1) % rbCapacity;
-        }
-        rbReadPos.store(r, std::memory_order_release);
+    const int16_t* NativeAudioScheduler::rbReadSpan(size_t& count) const {
+        const size_t r = rbReadPos.load(std::memory_order_relaxed);
+        const size_t w = rbWritePos.load(std::memory_order_acquire);
+        const size_t index = r & rbMask;
+        count = std::min(w - r, rbCapacity - index);
+        return ringBuffer.data() + index;
+    }
+
+    void NativeAudioScheduler::rbCommitRead(size_t count) {
+        rbReadPos.store(rbReadPos.load(std::memory_order_relaxed) + count, std::memory_order_release);
     }
 
 } // namespace pixelroot32::audio
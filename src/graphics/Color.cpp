@@ -46,6 +46,13 @@ static constexpr uint8_t kNumSpritePaletteSlots =
     static_cast<uint8_t>(pixelroot32::platforms::config::kMaxSpritePaletteSlots);
 static const uint16_t* spritePaletteSlots[kNumSpritePaletteSlots] = {};
 
+// Bumped by every palette / slot / mode change; indexed framebuffers rebuild their LUT on change.
+static uint32_t paletteGeneration = 0;
+
+static_assert(!pixelroot32::platforms::config::FramebufferIndexed ||
+              (kNumBackgroundPaletteSlots <= 8 && kNumSpritePaletteSlots <= 8),
+              "Indexed framebuffer encodes at most 8 background and 8 sprite palette slots");
+
 static void ensureBackgroundPaletteSlotsInited() {
     if (backgroundPaletteSlots[0] != nullptr) return;
     for (uint8_t i = 0; i < kNumBackgroundPaletteSlots; i++)
@@ -59,11 +66,13 @@ static void ensureSpritePaletteSlotsInited() {
 }
 
 void initBackgroundPaletteSlots() {
+    ++paletteGeneration;
     for (uint8_t i = 0; i < kNumBackgroundPaletteSlots; i++)
         backgroundPaletteSlots[i] = PALETTE_PR32;
 }
 
 void initSpritePaletteSlots() {
+    ++paletteGeneration;
     for (uint8_t i = 0; i < kNumSpritePaletteSlots; i++)
         spritePaletteSlots[i] = PALETTE_PR32;
 }
@@ -76,6 +85,7 @@ void initSpritePaletteSlots() {
  * 
 */
 void setPalette(PaletteType palette) {
+    ++paletteGeneration;
     const uint16_t* selectedPalette = PALETTE_PR32; // fallback
     
     for (const auto& entry : kPalettes) {
@@ -107,6 +117,7 @@ void setPalette(PaletteType palette) {
  * The palette pointer must remain valid for the entire usage period.
 */
 void setCustomPalette(const uint16_t* palette) {
+    ++paletteGeneration;
     if (palette != nullptr) {
         // Set all palettes to the same value (legacy behavior)
         currentPalette = palette;
@@ -144,6 +155,7 @@ uint16_t IRAM_ATTR resolveColor(Color color) {
  * @param enable True to enable dual palette mode, false for legacy mode.
  */
 void enableDualPaletteMode(bool enable) {
+    ++paletteGeneration;
     dualPaletteMode = enable;
 }
 
@@ -152,6 +164,7 @@ void enableDualPaletteMode(bool enable) {
  * @param palette The palette type to use for backgrounds.
  */
 void setBackgroundPalette(PaletteType palette) {
+    ++paletteGeneration;
     ensureBackgroundPaletteSlotsInited();
     for (const auto& entry : kPalettes) {
         if (entry.type == palette) {
@@ -169,6 +182,7 @@ void setBackgroundPalette(PaletteType palette) {
  * @param palette The palette type to use for sprites.
  */
 void setSpritePalette(PaletteType palette) {
+    ++paletteGeneration;
     for (const auto& entry : kPalettes) {
         if (entry.type == palette) {
             spritePalette = entry.colors;
@@ -187,6 +201,7 @@ void setSpritePalette(PaletteType palette) {
  * @param palette Pointer to an array of 16 uint16_t RGB565 color values.
  */
 void setBackgroundCustomPalette(const uint16_t* palette) {
+    ++paletteGeneration;
     if (palette != nullptr) {
         ensureBackgroundPaletteSlotsInited();
         backgroundPalette = palette;
@@ -199,6 +214,7 @@ void setBackgroundCustomPalette(const uint16_t* palette) {
  * @param palette Pointer to an array of 16 uint16_t RGB565 color values.
  */
 void setSpriteCustomPalette(const uint16_t* palette) {
+    ++paletteGeneration;
     if (palette != nullptr) {
         spritePalette = palette;
         ensureSpritePaletteSlotsInited();
@@ -233,6 +249,7 @@ void setDualCustomPalette(const uint16_t* bgPalette, const uint16_t* spritePal)
 }
 
 void setBackgroundPaletteSlot(uint8_t slotIndex, PaletteType palette) {
+    ++paletteGeneration;
     if (slotIndex >= kNumBackgroundPaletteSlots) return;
     ensureBackgroundPaletteSlotsInited();
     for (const auto& entry : kPalettes) {
@@ -247,6 +264,7 @@ void setBackgroundPaletteSlot(uint8_t slotIndex, PaletteType palette) {
 }
 
 void setBackgroundCustomPaletteSlot(uint8_t slotIndex, const uint16_t* palette) {
+    ++paletteGeneration;
     if (slotIndex >= kNumBackgroundPaletteSlots || palette == nullptr) return;
     ensureBackgroundPaletteSlotsInited();
     backgroundPaletteSlots[slotIndex] = palette;
@@ -262,6 +280,7 @@ const uint16_t* getBackgroundPaletteSlot(uint8_t slotIndex) {
 }
 
 void setSpritePaletteSlot(uint8_t slotIndex, PaletteType palette) {
+    ++paletteGeneration;
     if (slotIndex >= kNumSpritePaletteSlots) return;
     ensureSpritePaletteSlotsInited();
     for (const auto& entry : kPalettes) {
@@ -276,6 +295,7 @@ void setSpritePaletteSlot(uint8_t slotIndex, PaletteType palette) {
 }
 
 void setSpriteCustomPaletteSlot(uint8_t slotIndex, const uint16_t* palette) {
+    ++paletteGeneration;
     if (slotIndex >= kNumSpritePaletteSlots || palette == nullptr) return;
     ensureSpritePaletteSlotsInited();
     spritePaletteSlots[slotIndex] = palette;
@@ -329,4 +349,24 @@ uint16_t IRAM_ATTR resolveColor(Color color, PaletteContext context) {
     return currentPalette[idx];
 }
 
+uint32_t getPaletteGeneration() {
+    return paletteGeneration;
+}
+
+void markPalettesChanged() {
+    ++paletteGeneration;
+}
+
+void buildIndexedPaletteLUT(uint16_t* out) {
+    if (out == nullptr) return;
+    for (uint8_t slot = 0; slot < 8; ++slot) {
+        const uint16_t* bg = getBackgroundPaletteSlot(slot);
+        const uint16_t* sp = getSpritePaletteSlot(slot);
+        for (uint8_t c = 0; c < PALETTE_SIZE; ++c) {
+            out[(slot << 4) | c] = bg[c];
+            out[0x80 | (slot << 4) | c] = sp[c];
+        }
+    }
+}
+
 }
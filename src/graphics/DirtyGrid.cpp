@@ -19,6 +19,14 @@ inline int divFloorNonneg(int v, int d) {
     return v / d;
 }
 
+inline void fillRun(uint8_t* dst, uint8_t value, int count) {
+    std::memset(dst, value, static_cast<size_t>(count));
+}
+
+inline void fillRun(uint16_t* dst, uint16_t value, int count) {
+    std::fill_n(dst, count, value);
+}
+
 }  // namespace
 
 DirtyGrid::~DirtyGrid() {
@@ -30,6 +38,7 @@ DirtyGrid::DirtyGrid(DirtyGrid&& other) noexcept
       rows(other.rows),
       prev(other.prev),
       curr(other.curr),
+      covered(other.covered),
       fullDirty(other.fullDirty),
       byteCount(other.byteCount),
       currMarkedCount_(other.currMarkedCount_),
@@ -38,6 +47,7 @@ DirtyGrid::DirtyGrid(DirtyGrid&& other) noexcept
     other.rows             = 0;
     other.prev             = nullptr;
     other.curr             = nullptr;
+    other.covered          = nullptr;
     other.fullDirty        = false;
     other.byteCount        = 0;
     other.currMarkedCount_ = 0;
@@ -51,6 +61,7 @@ DirtyGrid& DirtyGrid::operator=(DirtyGrid&& other) noexcept {
         rows             = other.rows;
         prev             = other.prev;
         curr             = other.curr;
+        covered          = other.covered;
         fullDirty        = other.fullDirty;
         byteCount        = other.byteCount;
         currMarkedCount_ = other.currMarkedCount_;
@@ -59,6 +70,7 @@ DirtyGrid& DirtyGrid::operator=(DirtyGrid&& other) noexcept {
         other.rows             = 0;
         other.prev             = nullptr;
         other.curr             = nullptr;
+        other.covered          = nullptr;
         other.fullDirty        = false;
         other.byteCount        = 0;
         other.currMarkedCount_ = 0;
@@ -75,8 +87,10 @@ size_t DirtyGrid::bytesForGrid(uint8_t c, uint8_t r) {
 void DirtyGrid::freeBuffers() {
     delete[] prev;
     delete[] curr;
+    delete[] covered;
     prev             = nullptr;
     curr             = nullptr;
+    covered          = nullptr;
     cols             = 0;
     rows             = 0;
     byteCount        = 0;
@@ -98,12 +112,14 @@ bool DirtyGrid::init(int screenW, int screenH) {
     byteCount       = bytesForGrid(cols, rows);
     prev            = new (std::nothrow) uint8_t[byteCount];
     curr            = new (std::nothrow) uint8_t[byteCount];
-    if (!prev || !curr) {
+    covered         = new (std::nothrow) uint8_t[byteCount];
+    if (!prev || !curr || !covered) {
         freeBuffers();
         return false;
     }
     std::memset(prev, 0, byteCount);
     std::memset(curr, 0, byteCount);
+    std::memset(covered, 0, byteCount);
     fullDirty        = false;
     currMarkedCount_ = 0;
     prevMarkedCount_ = 0;
@@ -141,6 +157,26 @@ void DirtyGrid::markRect(int x, int y, int w, int h) {
     }
 }
 
+void DirtyGrid::markCells(const uint8_t* mask) {
+    if (!mask || !curr || cols == 0) {
+        return;
+    }
+    const uint32_t bytesPerRow = (static_cast<uint32_t>(cols) + 7u) >> 3u;
+    // Bits of the last byte per row that map to real columns.
+    const uint8_t tailMask = (cols & 7u) ? static_cast<uint8_t>((1u << (cols & 7u)) - 1u) : 0xFFu;
+    for (size_t b = 0; b < byteCount; ++b) {
+        uint8_t bits = mask[b];
+        if ((b % bytesPerRow) == bytesPerRow - 1u) {
+            bits &= tailMask;
+        }
+        const uint8_t added = static_cast<uint8_t>(bits & ~curr[b]);
+        if (added != 0) {
+            currMarkedCount_ += static_cast<uint32_t>(__builtin_popcount(added));
+            curr[b] |= added;
+        }
+    }
+}
+
 bool DirtyGrid::isPrevDirty(uint8_t cx, uint8_t cy) const {
     if (cx >= cols || cy >= rows || !prev) {
         return false;
@@ -155,6 +191,7 @@ void DirtyGrid::swapAndClear() {
     std::swap(prev, curr);
     prevMarkedCount_ = currMarkedCount_;
     std::memset(curr, 0, byteCount);
+    std::memset(covered, 0, byteCount);
     currMarkedCount_ = 0;
 }
 
@@ -193,6 +230,37 @@ uint32_t DirtyGrid::popcountBuffer(const uint8_t* buf, size_t nbytes) {
     return n;
 }
 
+void DirtyGrid::markCovered(uint8_t cx, uint8_t cy) {
+    if (cx >= cols || cy >= rows || !covered) {
+        return;
+    }
+    setBit(covered, cx, cy);
+}
+
+bool DirtyGrid::isCovered(uint8_t cx, uint8_t cy) const {
+    if (cx >= cols || cy >= rows || !covered) {
+        return false;
+    }
+    return getBit(covered, cx, cy);
+}
+
+void DirtyGrid::clearCovered() {
+    if (covered) {
+        std::memset(covered, 0, byteCount);
+    }
+}
+
+uint32_t DirtyGrid::countPrevCoveredCells() const {
+    if (!prev || !covered) {
+        return 0;
+    }
+    uint32_t n = 0;
+    for (size_t i = 0; i < byteCount; ++i) {
+        n += __builtin_popcount(prev[i] & covered[i]);
+    }
+    return n;
+}
+
 uint32_t DirtyGrid::countPrevMarkedCells() const {
     return prevMarkedCount_;
 }
@@ -216,11 +284,28 @@ void DirtyGrid::clearFramebuffer8FromPrev(uint8_t* fb,
                                           int framebufferWidth,
                                           int framebufferHeight,
                                           uint8_t fillByte) const {
-    if (!fb || !prev || cols == 0 || rows == 0) {
+    clearFramebufferFromPrevImpl(fb, framebufferWidth, framebufferHeight, fillByte);
+}
+
+void DirtyGrid::clearFramebuffer16FromPrev(uint16_t* fb,
+                                           int framebufferWidth,
+                                           int framebufferHeight,
+                                           uint16_t fillWord) const {
+    clearFramebufferFromPrevImpl(fb, framebufferWidth, framebufferHeight, fillWord);
+}
+
+template <typename T>
+void DirtyGrid::clearFramebufferFromPrevImpl(T* fb,
+                                             int framebufferWidth,
+                                             int framebufferHeight,
+                                             T fillByte) const {
+    if (!fb || !prev || !covered || cols == 0 || rows == 0) {
         return;
     }
 
     const size_t bytesPerRow = (cols + 7u) >> 3u;
+    // Cells known to be fully repainted by opaque content this frame keep their old pixels.
+    auto clearBits = [this](size_t i) { return static_cast<uint8_t>(prev[i] & ~covered[i]); };
 
     for (uint8_t cy = 0; cy < rows; ++cy) {
         const int py = static_cast<int>(cy) * static_cast<int>(CELL_H);
@@ -233,7 +318,7 @@ void DirtyGrid::clearFramebuffer8FromPrev(uint8_t* fb,
         uint8_t cx = 0;
 
         while (byteIdx <= static_cast<size_t>(cy + 1) * bytesPerRow - 1 && cx < cols) {
-            if (prev[byteIdx] == 0) {
+            if (clearBits(byteIdx) == 0) {
                 cx = static_cast<uint8_t>(std::min(static_cast<int>(cx) + 8, static_cast<int>(cols)));
                 ++byteIdx;
                 if (byteIdx >= static_cast<size_t>(cy + 1) * bytesPerRow) {
@@ -242,7 +327,7 @@ void DirtyGrid::clearFramebuffer8FromPrev(uint8_t* fb,
                 continue;
             }
 
-            const uint8_t bits = prev[byteIdx];
+            const uint8_t bits = clearBits(byteIdx);
             const int localCx = static_cast<int>(cx);
 
             if (bits == 0xFF) {
@@ -250,7 +335,7 @@ void DirtyGrid::clearFramebuffer8FromPrev(uint8_t* fb,
                 int runEnd = localCx;
 
                 size_t nextByteIdx = byteIdx + 1;
-                while (nextByteIdx < static_cast<size_t>(cy + 1) * bytesPerRow && prev[nextByteIdx] == 0xFF) {
+                while (nextByteIdx < static_cast<size_t>(cy + 1) * bytesPerRow && clearBits(nextByteIdx) == 0xFF) {
                     runEnd += 8;
                     ++nextByteIdx;
                 }
@@ -269,9 +354,9 @@ void DirtyGrid::clearFramebuffer8FromPrev(uint8_t* fb,
                     wpixels = framebufferWidth - px;
                 }
                 if (wpixels > 0) {
-                    uint8_t* rowPtr = fb + py * framebufferWidth + px;
+                    T* rowPtr = fb + py * framebufferWidth + px;
                     for (int r = 0; r < rowH; ++r) {
-                        std::memset(rowPtr + r * framebufferWidth, fillByte, static_cast<size_t>(wpixels));
+                        fillRun(rowPtr + r * framebufferWidth, fillByte, wpixels);
                     }
                 }
             } else {
@@ -297,9 +382,9 @@ void DirtyGrid::clearFramebuffer8FromPrev(uint8_t* fb,
                             wpixels = framebufferWidth - runStartPx;
                         }
                         if (wpixels > 0) {
-                            uint8_t* rowPtr = fb + py * framebufferWidth + runStartPx;
+                            T* rowPtr = fb + py * framebufferWidth + runStartPx;
                             for (int r = 0; r < rowH; ++r) {
-                                std::memset(rowPtr + r * framebufferWidth, fillByte, static_cast<size_t>(wpixels));
+                                fillRun(rowPtr + r * framebufferWidth, fillByte, wpixels);
                             }
                         }
                     }
@@ -314,4 +399,81 @@ void DirtyGrid::clearFramebuffer8FromPrev(uint8_t* fb,
     }
 }
 
+bool DirtyGrid::collectPresentRects(DirtyRect* out,
+                                    uint16_t maxRects,
+                                    uint16_t& outCount,
+                                    int screenW,
+                                    int screenH,
+                                    uint8_t mergeGapCells) const {
+    outCount = 0;
+    if (!out || !prev || !curr || cols == 0 || rows == 0 || fullDirty) {
+        return false;
+    }
+    // Pixels outside the cell-aligned area are never marked, so they cannot be tracked here.
+    if (screenW != static_cast<int>(cols) * static_cast<int>(CELL_W) ||
+        screenH != static_cast<int>(rows) * static_cast<int>(CELL_H)) {
+        return false;
+    }
+
+    const size_t bytesPerRow = (cols + 7u) >> 3u;
+
+    for (uint8_t cy = 0; cy < rows; ++cy) {
+        const uint8_t* prevRow = prev + static_cast<size_t>(cy) * bytesPerRow;
+        const uint8_t* currRow = curr + static_cast<size_t>(cy) * bytesPerRow;
+        const uint16_t py = static_cast<uint16_t>(cy * CELL_H);
+
+        int cx = 0;
+        while (cx < cols) {
+            // Skip clean cells a byte at a time where possible.
+            const uint8_t unionByte = static_cast<uint8_t>(prevRow[cx >> 3] | currRow[cx >> 3]);
+            if ((cx & 7) == 0 && unionByte == 0) {
+                cx += 8;
+                continue;
+            }
+            if ((unionByte & (1u << (cx & 7))) == 0) {
+                ++cx;
+                continue;
+            }
+
+            // Extend the run, bridging gaps of up to mergeGapCells clean cells.
+            const int runStart = cx;
+            int runEnd = cx;  // inclusive, last dirty cell
+            int gap = 0;
+            for (++cx; cx < cols; ++cx) {
+                const uint8_t u = static_cast<uint8_t>(prevRow[cx >> 3] | currRow[cx >> 3]);
+                if (u & (1u << (cx & 7))) {
+                    runEnd = cx;
+                    gap = 0;
+                } else if (++gap > mergeGapCells) {
+                    break;
+                }
+            }
+            cx = runEnd + 1;
+
+            const uint16_t px = static_cast<uint16_t>(runStart * CELL_W);
+            const uint16_t pw = static_cast<uint16_t>((runEnd - runStart + 1) * CELL_W);
+
+            // Grow a rect from the previous cell row with the same column span.
+            bool merged = false;
+            for (uint16_t i = 0; i < outCount; ++i) {
+                DirtyRect& r = out[i];
+                if (r.x == px && r.w == pw && static_cast<uint16_t>(r.y + r.h) == py) {
+                    r.h = static_cast<uint16_t>(r.h + CELL_H);
+                    merged = true;
+                    break;
+                }
+            }
+            if (merged) {
+                continue;
+            }
+            if (outCount >= maxRects) {
+                outCount = 0;
+                return false;
+            }
+            out[outCount++] = DirtyRect{px, py, pw, static_cast<uint16_t>(CELL_H)};
+        }
+    }
+    return true;
+}
+
 }  // namespace pixelroot32::graphics
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#include "graphics/DisplayList.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace pixelroot32::graphics {
+
+namespace {
+
+/// How far back a sprite may travel to join a batch with the same palette.
+constexpr std::size_t kPaletteBatchLookback = 8;
+
+bool isPaletteSprite(const DrawCommand& c) {
+    return c.type == DrawCommandType::Sprite2bpp || c.type == DrawCommandType::Sprite4bpp;
+}
+
+bool samePaletteKey(const DrawCommand& a, const DrawCommand& b) {
+    return a.type == b.type && a.spriteN.palette == b.spriteN.palette && a.paletteSlot == b.paletteSlot;
+}
+
+bool overlaps(const DrawCommand& a, const DrawCommand& b) {
+    int ax0, ay0, ax1, ay1, bx0, by0, bx1, by1;
+    a.bounds(ax0, ay0, ax1, ay1);
+    b.bounds(bx0, by0, bx1, by1);
+    return ax0 < bx1 && bx0 < ax1 && ay0 < by1 && by0 < ay1;
+}
+
+/// Folds @p b into @p a when both are same-colour rects whose union is exactly a rectangle.
+bool tryMergeRects(DrawCommand& a, const DrawCommand& b) {
+    if (a.rect.surfaceColor != b.rect.surfaceColor) {
+        return false;
+    }
+    if (a.y == b.y && a.h == b.h && a.x <= b.x + b.w && b.x <= a.x + a.w) {
+        const int32_t x0 = std::min(a.x, b.x);
+        a.w = static_cast<int16_t>(std::max(a.x + a.w, b.x + b.w) - x0);
+        a.x = x0;
+        return true;
+    }
+    if (a.x == b.x && a.w == b.w && a.y <= b.y + b.h && b.y <= a.y + a.h) {
+        const int32_t y0 = std::min(a.y, b.y);
+        a.h = static_cast<int16_t>(std::max(a.y + a.h, b.y + b.h) - y0);
+        a.y = y0;
+        return true;
+    }
+    return false;
+}
+
+/// Folds @p b into @p a when both draw touching / overlapping row ranges of the same map placement.
+bool tryMergeTileRuns(DrawCommand& a, const DrawCommand& b) {
+    if (a.tiles.map != b.tiles.map || a.x != b.x || a.y != b.y || a.tiles.color != b.tiles.color ||
+        a.tiles.colBegin != b.tiles.colBegin || a.tiles.colEnd != b.tiles.colEnd) {
+        return false;
+    }
+    if (a.tiles.rowBegin > b.tiles.rowEnd || b.tiles.rowBegin > a.tiles.rowEnd) {
+        return false;
+    }
+    a.tiles.rowBegin = std::min(a.tiles.rowBegin, b.tiles.rowBegin);
+    a.tiles.rowEnd = std::max(a.tiles.rowEnd, b.tiles.rowEnd);
+    return true;
+}
+
+} // namespace
+
+void DrawCommand::bounds(int& x0, int& y0, int& x1, int& y1) const {
+    switch (type) {
+        case DrawCommandType::TileRun1bpp:
+        case DrawCommandType::TileRun2bpp:
+        case DrawCommandType::TileRun4bpp:
+            x0 = x + tiles.colBegin * tiles.tileWidth;
+            x1 = x + tiles.colEnd * tiles.tileWidth;
+            y0 = y + tiles.rowBegin * tiles.tileHeight;
+            y1 = y + tiles.rowEnd * tiles.tileHeight;
+            break;
+        default:
+            x0 = x;
+            y0 = y;
+            x1 = x + w;
+            y1 = y + h;
+            break;
+    }
+}
+
+DisplayList::~DisplayList() {
+    release();
+}
+
+DisplayList::DisplayList(DisplayList&& other) noexcept
+    : commands(other.commands),
+      textBytes(other.textBytes),
+      commandCapacity(other.commandCapacity),
+      textCapacity(other.textCapacity),
+      count(other.count),
+      textUsed(other.textUsed) {
+    other.commands = nullptr;
+    other.textBytes = nullptr;
+    other.commandCapacity = 0;
+    other.textCapacity = 0;
+    other.count = 0;
+    other.textUsed = 0;
+}
+
+DisplayList& DisplayList::operator=(DisplayList&& other) noexcept {
+    if (this != &other) {
+        release();
+        commands = other.commands;
+        textBytes = other.textBytes;
+        commandCapacity = other.commandCapacity;
+        textCapacity = other.textCapacity;
+        count = other.count;
+        textUsed = other.textUsed;
+        other.commands = nullptr;
+        other.textBytes = nullptr;
+        other.commandCapacity = 0;
+        other.textCapacity = 0;
+        other.count = 0;
+        other.textUsed = 0;
+    }
+    return *this;
+}
+
+bool DisplayList::allocate(std::size_t newCommandCapacity, std::size_t newTextCapacity) {
+    release();
+    // Text offsets are 16-bit.
+    newTextCapacity = std::min<std::size_t>(newTextCapacity, 0xFFFF);
+    if (newCommandCapacity == 0) {
+        return false;
+    }
+    commands = new (std::nothrow) DrawCommand[newCommandCapacity];
+    textBytes = newTextCapacity > 0 ? new (std::nothrow) char[newTextCapacity] : nullptr;
+    if (commands == nullptr || (newTextCapacity > 0 && textBytes == nullptr)) {
+        release();
+        return false;
+    }
+    commandCapacity = newCommandCapacity;
+    textCapacity = newTextCapacity;
+    return true;
+}
+
+void DisplayList::release() {
+    delete[] commands;
+    delete[] textBytes;
+    commands = nullptr;
+    textBytes = nullptr;
+    commandCapacity = 0;
+    textCapacity = 0;
+    count = 0;
+    textUsed = 0;
+}
+
+int DisplayList::appendText(std::string_view text) {
+    if (text.size() > 0xFF || textUsed + text.size() > textCapacity) {
+        return -1;
+    }
+    const int offset = static_cast<int>(textUsed);
+    std::memcpy(textBytes + textUsed, text.data(), text.size());
+    textUsed += text.size();
+    return offset;
+}
+
+void DisplayList::erase(std::size_t i) {
+    if (i >= count) {
+        return;
+    }
+    std::memmove(&commands[i], &commands[i + 1], (count - i - 1) * sizeof(DrawCommand));
+    --count;
+}
+
+void DisplayList::sortByLayerAndPalette() {
+    // Insertion sort: stable, in place, and linear for the usual already-layered input.
+    for (std::size_t i = 1; i < count; ++i) {
+        if (commands[i - 1].layer <= commands[i].layer) {
+            continue;
+        }
+        const DrawCommand c = commands[i];
+        std::size_t j = i;
+        while (j > 0 && commands[j - 1].layer > c.layer) {
+            commands[j] = commands[j - 1];
+            --j;
+        }
+        commands[j] = c;
+    }
+
+    for (std::size_t i = 1; i < count; ++i) {
+        const DrawCommand& c = commands[i];
+        if (!isPaletteSprite(c) || (isPaletteSprite(commands[i - 1]) && samePaletteKey(commands[i - 1], c))) {
+            continue;
+        }
+        const std::size_t stop = i > kPaletteBatchLookback ? i - kPaletteBatchLookback : 0;
+        for (std::size_t j = i; j-- > stop;) {
+            const DrawCommand& prev = commands[j];
+            if (prev.layer != c.layer) {
+                break;
+            }
+            if (isPaletteSprite(prev) && samePaletteKey(prev, c)) {
+                // Every command in (j, i) was checked not to overlap c: move c right after j.
+                std::rotate(&commands[j + 1], &commands[i], &commands[i + 1]);
+                break;
+            }
+            if (overlaps(prev, c)) {
+                break;
+            }
+        }
+    }
+}
+
+std::size_t DisplayList::mergeAdjacent() {
+    if (count < 2) {
+        return 0;
+    }
+    std::size_t out = 0;
+    for (std::size_t i = 1; i < count; ++i) {
+        DrawCommand& a = commands[out];
+        const DrawCommand& b = commands[i];
+        bool merged = false;
+        if (a.type == b.type && a.layer == b.layer && a.flags == b.flags) {
+            if (a.type == DrawCommandType::FilledRect) {
+                merged = tryMergeRects(a, b);
+            } else if (a.type == DrawCommandType::TileRun1bpp || a.type == DrawCommandType::TileRun2bpp ||
+                       a.type == DrawCommandType::TileRun4bpp) {
+                merged = tryMergeTileRuns(a, b);
+            }
+        }
+        if (!merged) {
+            commands[++out] = b;
+        }
+    }
+    const std::size_t removed = count - (out + 1);
+    count = out + 1;
+    return removed;
+}
+
+} // namespace pixelroot32::graphics
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#include "graphics/PresentKernels.h"
+
+#include <cstring>
+
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+namespace pixelroot32::graphics::present {
+
+namespace {
+
+// --------------------------------------------------
+// Scalar reference
+// --------------------------------------------------
+
+void scalarRow(const uint8_t* src, uint16_t* dst, int n, const uint16_t* lut) {
+    convertRow(src, dst, n, lut);
+}
+
+void scalarRow2x(const uint8_t* src, uint16_t* dst, int srcN, const uint16_t* lut) {
+    convertRow2x(src, dst, srcN, lut);
+}
+
+void scalarRowScaled(const uint8_t* src, uint16_t* dst, int n, const uint16_t* xLUT, const uint16_t* lut) {
+    convertRowScaled(src, dst, n, xLUT, lut);
+}
+
+// --------------------------------------------------
+// Word-wide (Xtensa candidate, opt-in)
+// --------------------------------------------------
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+constexpr bool kLittleEndian = true;
+#else
+constexpr bool kLittleEndian = false;
+#endif
+
+/// Aligned 32-bit load without breaking strict aliasing (a single l32i / mov).
+inline uint32_t load32(const void* p) {
+    uint32_t w;
+    std::memcpy(&w, __builtin_assume_aligned(p, 4), sizeof(w));
+    return w;
+}
+
+inline uint32_t pair(const uint16_t* lut, uint32_t lo, uint32_t hi) {
+    return (static_cast<uint32_t>(lut[hi]) << 16) | lut[lo];
+}
+
+void IRAM_ATTR wordRow(const uint8_t* src, uint16_t* dst, int n, const uint16_t* lut) {
+    if (!kLittleEndian) {
+        convertRow(src, dst, n, lut);
+        return;
+    }
+    // Pixels before the first 4-byte source boundary; an odd count would misalign the packed stores.
+    const int head = static_cast<int>((4u - (reinterpret_cast<uintptr_t>(src) & 3u)) & 3u);
+    int x = 0;
+    if (head != 0) {
+        if (head > n || (head & 1) != 0) {
+            convertRow(src, dst, n, lut);
+            return;
+        }
+        for (; x < head; ++x) {
+            dst[x] = lut[src[x]];
+        }
+    }
+    uint32_t* dst32 = reinterpret_cast<uint32_t*>(dst + x);
+    for (; x <= n - 8; x += 8) {
+        const uint32_t a = load32(src + x);
+        const uint32_t b = load32(src + x + 4);
+        dst32[0] = pair(lut, a & 0xFFu, (a >> 8) & 0xFFu);
+        dst32[1] = pair(lut, (a >> 16) & 0xFFu, a >> 24);
+        dst32[2] = pair(lut, b & 0xFFu, (b >> 8) & 0xFFu);
+        dst32[3] = pair(lut, (b >> 16) & 0xFFu, b >> 24);
+        dst32 += 4;
+    }
+    for (; x < n; ++x) {
+        dst[x] = lut[src[x]];
+    }
+}
+
+void IRAM_ATTR wordRow2x(const uint8_t* src, uint16_t* dst, int srcN, const uint16_t* lut) {
+    if (!kLittleEndian) {
+        convertRow2x(src, dst, srcN, lut);
+        return;
+    }
+    uint32_t* dst32 = reinterpret_cast<uint32_t*>(dst);
+    int x = 0;
+    for (; x < srcN && (reinterpret_cast<uintptr_t>(src + x) & 3u) != 0; ++x) {
+        const uint32_t c = lut[src[x]];
+        dst32[x] = (c << 16) | c;
+    }
+    for (; x <= srcN - 4; x += 4) {
+        const uint32_t a = load32(src + x);
+        const uint32_t c0 = lut[a & 0xFFu];
+        const uint32_t c1 = lut[(a >> 8) & 0xFFu];
+        const uint32_t c2 = lut[(a >> 16) & 0xFFu];
+        const uint32_t c3 = lut[a >> 24];
+        dst32[x]     = (c0 << 16) | c0;
+        dst32[x + 1] = (c1 << 16) | c1;
+        dst32[x + 2] = (c2 << 16) | c2;
+        dst32[x + 3] = (c3 << 16) | c3;
+    }
+    for (; x < srcN; ++x) {
+        const uint32_t c = lut[src[x]];
+        dst32[x] = (c << 16) | c;
+    }
+}
+
+void IRAM_ATTR wordRowScaled(const uint8_t* src, uint16_t* dst, int n, const uint16_t* xLUT, const uint16_t* lut) {
+    // xLUT entries are read in pairs; the driver passes xLUT + physX0 with an even window origin.
+    if (!kLittleEndian || (reinterpret_cast<uintptr_t>(xLUT) & 3u) != 0) {
+        convertRowScaled(src, dst, n, xLUT, lut);
+        return;
+    }
+    uint32_t* dst32 = reinterpret_cast<uint32_t*>(dst);
+    int x = 0;
+    for (; x <= n - 4; x += 4) {
+        const uint32_t i01 = load32(xLUT + x);
+        const uint32_t i23 = load32(xLUT + x + 2);
+        dst32[x / 2]     = pair(lut, src[i01 & 0xFFFFu], src[i01 >> 16]);
+        dst32[x / 2 + 1] = pair(lut, src[i23 & 0xFFFFu], src[i23 >> 16]);
+    }
+    for (; x < n; ++x) {
+        dst[x] = lut[src[xLUT[x]]];
+    }
+}
+
+constexpr RowKernels kScalarKernels{"scalar", &scalarRow, &scalarRow2x, &scalarRowScaled};
+constexpr RowKernels kWordKernels{"word32", &wordRow, &wordRow2x, &wordRowScaled};
+// word32 stays opt-in until it is measured on the target: on the host it is slower than scalar.
+constexpr const RowKernels* kDefaultKernels = &kScalarKernels;
+
+const RowKernels* gActiveKernels = kDefaultKernels;
+
+} // namespace
+
+const RowKernels& scalarKernels() {
+    return kScalarKernels;
+}
+
+const RowKernels& wordKernels() {
+    return kWordKernels;
+}
+
+const RowKernels& defaultKernels() {
+    return *kDefaultKernels;
+}
+
+const RowKernels& activeKernels() {
+    return *gActiveKernels;
+}
+
+void setActiveKernels(const RowKernels& kernels) {
+    gActiveKernels = &kernels;
+}
+
+} // namespace pixelroot32::graphics::present
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#include "graphics/PresentPipeline.h"
+
+#include "graphics/Color.h"
+#include "graphics/DrawSurface.h"
+#include "graphics/FramebufferFormat.h"
+#include "platforms/EngineConfig.h"
+
+#include <cstring>
+#include <new>
+
+namespace pixelroot32::graphics {
+
+namespace {
+
+uint32_t nowMicros() {
+    return static_cast<uint32_t>(pixelroot32::platforms::config::profilerMicros());
+}
+
+/// Native: yields before an idle worker sleeps; a present is usually a few ms away.
+constexpr int kSpinsBeforeSleep = 64;
+
+} // namespace
+
+PresentPipeline::~PresentPipeline() {
+    stop();
+}
+
+bool PresentPipeline::start(DrawSurface& drawSurface, int w, int h,
+                            const pixelroot32::platforms::PlatformCapabilities& caps) {
+    stop();
+    if (!drawSurface.supportsBufferPresent() || w <= 0 || h <= 0) {
+        return false;
+    }
+#if defined(PLATFORM_NATIVE) || defined(ESP32)
+    const std::size_t bytes = static_cast<std::size_t>(w) * static_cast<std::size_t>(h) * sizeof(FramebufferPixel);
+    presentBuffer = new (std::nothrow) uint8_t[bytes];
+    if (presentBuffer == nullptr) {
+        return false;
+    }
+    if constexpr (pixelroot32::platforms::config::FramebufferIndexed) {
+        paletteSnapshot = new (std::nothrow) uint16_t[256];
+        if (paletteSnapshot == nullptr) {
+            delete[] presentBuffer;
+            presentBuffer = nullptr;
+            return false;
+        }
+    }
+    paletteSnapshotValid = false;
+    paletteSnapshotPending = false;
+    surface = &drawSurface;
+    width = w;
+    height = h;
+    primed = false;
+    workerFrames = 0;
+    workerLastUs = 0;
+    workerTotalUs = 0;
+    if (!worker.start("PresentTask", caps.presentWorkerCoreId, caps.presentWorkerPriority, kSpinsBeforeSleep)) {
+        delete[] presentBuffer;
+        presentBuffer = nullptr;
+        delete[] paletteSnapshot;
+        paletteSnapshot = nullptr;
+        surface = nullptr;
+        return false;
+    }
+    return true;
+#else
+    (void)caps;
+    return false;
+#endif
+}
+
+void PresentPipeline::stop() {
+    if (!worker.isRunning()) {
+        return;
+    }
+    waitIdle();
+    worker.stop();
+    delete[] presentBuffer;
+    presentBuffer = nullptr;
+    delete[] paletteSnapshot;
+    paletteSnapshot = nullptr;
+    surface = nullptr;
+}
+
+void PresentPipeline::waitIdle() {
+    if (!worker.isRunning()) {
+        return;
+    }
+    worker.wait();
+    stats.framesPresented += workerFrames;
+    stats.totalPresentUs += workerTotalUs;
+    if (workerFrames != 0) {
+        stats.lastPresentUs = workerLastUs;
+    }
+    workerFrames = 0;
+    workerTotalUs = 0;
+}
+
+void PresentPipeline::submit(const uint8_t* framebuffer, const DirtyGrid* grid) {
+    if (!worker.isRunning() || framebuffer == nullptr) {
+        return;
+    }
+    const uint32_t t0 = nowMicros();
+    waitIdle();
+    const uint32_t t1 = nowMicros();
+
+    uint16_t count = 0;
+    const bool partial = primed && grid != nullptr &&
+                         grid->collectPresentRects(rects, kMaxRects, count, width, height);
+    const std::size_t stride = static_cast<std::size_t>(width) * sizeof(FramebufferPixel);
+    if (partial) {
+        for (uint16_t i = 0; i < count; ++i) {
+            const DirtyRect& r = rects[i];
+            const std::size_t offset = static_cast<std::size_t>(r.x) * sizeof(FramebufferPixel);
+            const std::size_t span = static_cast<std::size_t>(r.w) * sizeof(FramebufferPixel);
+            for (int y = r.y; y < r.y + r.h; ++y) {
+                const std::size_t row = static_cast<std::size_t>(y) * stride + offset;
+                std::memcpy(presentBuffer + row, framebuffer + row, span);
+            }
+        }
+    } else {
+        std::memcpy(presentBuffer, framebuffer, stride * static_cast<std::size_t>(height));
+        ++stats.fullCopies;
+        primed = true;
+    }
+    if constexpr (pixelroot32::platforms::config::FramebufferIndexed) {
+        // The worker is idle, so the snapshot can be rewritten; it only ever reads this copy.
+        const uint32_t generation = getPaletteGeneration();
+        if (!paletteSnapshotValid || generation != paletteSnapshotGeneration) {
+            buildIndexedPaletteLUT(paletteSnapshot);
+            paletteSnapshotGeneration = generation;
+            paletteSnapshotValid = true;
+            paletteSnapshotPending = true;
+        }
+    }
+    const uint32_t t2 = nowMicros();
+
+    ++stats.framesSubmitted;
+    stats.totalWaitUs += t1 - t0;
+    stats.totalCopyUs += t2 - t1;
+
+    if (partial && count == 0) {
+        return;  // Nothing changed on screen: no present needed.
+    }
+    rectCount = partial ? count : 0;
+    fullFrame = !partial;
+    presentPalette = paletteSnapshotPending ? paletteSnapshot : nullptr;
+    paletteSnapshotPending = false;
+    worker.dispatch(&PresentPipeline::presentJob, this);
+}
+
+void PresentPipeline::presentPending() {
+    const uint32_t t0 = nowMicros();
+    surface->presentBuffer(presentBuffer, fullFrame ? nullptr : rects, rectCount, presentPalette);
+    const uint32_t elapsed = nowMicros() - t0;
+    ++workerFrames;
+    workerLastUs = elapsed;
+    workerTotalUs += elapsed;
+}
+
+void PresentPipeline::presentJob(void* self) {
+    static_cast<PresentPipeline*>(self)->presentPending();
+}
+
+} // namespace pixelroot32::graphics
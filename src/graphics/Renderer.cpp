@@ -18,6 +18,7 @@
 #include <cmath>
 #include <cstring>
 #include <cassert>
+#include <type_traits>
 
 #if defined(PIXELROOT32_DEBUG_MODE)
 using pixelroot32::core::logging::LogLevel;
@@ -34,13 +35,37 @@ namespace pixelroot32::graphics {
         return c != Color::Transparent;
     }
 
-    /// Match TFT_eSprite::drawPixel for 8bpp sprites (TFT_eSPI Extensions/Sprite.cpp).
-    inline uint8_t packRgb565ToTftSprite8(uint16_t rgb565) {
-        return static_cast<uint8_t>(
-            ((rgb565 & 0xE000) >> 8) |
-            ((rgb565 & 0x0700) >> 6) |
-            ((rgb565 & 0x0018) >> 3));
-    }
+    namespace {
+        /// Row decoding for the tilemap rasteriser; "8" helpers cover one row of an 8-pixel-wide tile.
+        template<typename SpriteT> struct TileRowCodec;
+
+        template<> struct TileRowCodec<Sprite2bpp> {
+            static int strideBytes(int width) { return (width * 2 + 7) / 8; }
+            /// 8 pixels, pixel i at bits 2i (compiler pack_2bpp: LSB = left pixel).
+            static uint32_t load8(const uint8_t* row) { return *reinterpret_cast<const uint16_t*>(row); }
+            static uint8_t pixel8(uint32_t bits, int col) { return static_cast<uint8_t>((bits >> (col << 1)) & 0x03u); }
+            static bool anyTransparent8(uint32_t bits) { return ((bits - 0x5555u) & ~bits & 0xAAAAu) != 0; }
+            static uint8_t pixel(const uint8_t* row, int col) {
+                const uint16_t* words = reinterpret_cast<const uint16_t*>(row);
+                return static_cast<uint8_t>((words[col >> 3] >> ((col & 7) << 1)) & 0x03u);
+            }
+        };
+
+        template<> struct TileRowCodec<Sprite4bpp> {
+            static int strideBytes(int width) { return (width * 4 + 7) / 8; }
+            /// 8 pixels, pixel i at bits 4i (low nibble = left pixel).
+            static uint32_t load8(const uint8_t* row) {
+                return static_cast<uint32_t>(row[0]) | (static_cast<uint32_t>(row[1]) << 8) |
+                       (static_cast<uint32_t>(row[2]) << 16) | (static_cast<uint32_t>(row[3]) << 24);
+            }
+            static uint8_t pixel8(uint32_t bits, int col) { return static_cast<uint8_t>((bits >> (col << 2)) & 0x0Fu); }
+            static bool anyTransparent8(uint32_t bits) { return ((bits - 0x11111111u) & ~bits & 0x88888888u) != 0; }
+            static uint8_t pixel(const uint8_t* row, int col) {
+                return static_cast<uint8_t>((row[col >> 1] >> ((col & 1) << 2)) & 0x0Fu);
+            }
+        };
+    } // namespace
+
 
     Renderer::Renderer(const DisplayConfig& config) 
         : config(config),
@@ -160,7 +185,7 @@ namespace pixelroot32::graphics {
         }
         const uint8_t cols = dirtyGrid.getCols();
         const uint8_t rows = dirtyGrid.getRows();
-        const uint16_t outlineCol = resolveColor(Color::Magenta, PaletteContext::Sprite);
+        const uint16_t outlineCol = surfaceColor(Color::Magenta, PaletteContext::Sprite);
 
         // If fullDirty is set, highlight all cells
         if (dirtyGrid.isFullDirty()) {
@@ -197,6 +222,34 @@ namespace pixelroot32::graphics {
         }
     }
 
+    void Renderer::requestFullPresent() {
+        if constexpr (pixelroot32::platforms::config::EnableDirtyRegions) {
+            presentFullFrame_ = true;
+        }
+    }
+
+    void Renderer::noteStaticLayerDraw(const void* mapKey, int viewOriginX, int viewOriginY, uint32_t contentSignature) {
+        if constexpr (!pixelroot32::platforms::config::EnableDirtyRegions) {
+            (void)mapKey;
+            (void)viewOriginX;
+            (void)viewOriginY;
+            (void)contentSignature;
+            return;
+        }
+        // FNV-1a style mix; order-sensitive so reordering static layers also counts as a change.
+        const uint32_t words[4] = {
+            static_cast<uint32_t>(reinterpret_cast<uintptr_t>(mapKey)),
+            static_cast<uint32_t>(viewOriginX),
+            static_cast<uint32_t>(viewOriginY),
+            contentSignature,
+        };
+        uint32_t h = staticLayerSignature_ ^ 2166136261u;
+        for (uint32_t w : words) {
+            h = (h ^ w) * 16777619u;
+        }
+        staticLayerSignature_ = h;
+    }
+
     void Renderer::resetFramebufferClearSuppressionAdvice() {
         if constexpr (!pixelroot32::platforms::config::EnableDirtyRegions) {
             return;
@@ -221,13 +274,49 @@ namespace pixelroot32::graphics {
         if (logicalFrameBuffer8 == nullptr) {
             return;
         }
-        constexpr uint8_t kClear8bpp = 0;  // aligns with TFT_BLACK in 8bpp sprite buffer
-        dirtyGrid.clearFramebuffer8FromPrev(logicalFrameBuffer8, logicalWidth, logicalHeight, kClear8bpp);
+        if constexpr (pixelroot32::platforms::config::Framebuffer16Bpp) {
+            constexpr uint16_t kClear16bpp = 0;  // TFT_BLACK in a 16bpp sprite buffer
+            dirtyGrid.clearFramebuffer16FromPrev(reinterpret_cast<uint16_t*>(logicalFrameBuffer8), logicalWidth, logicalHeight, kClear16bpp);
+        } else {
+            constexpr uint8_t kClear8bpp = 0;  // aligns with TFT_BLACK in 8bpp sprite buffer
+            dirtyGrid.clearFramebuffer8FromPrev(logicalFrameBuffer8, logicalWidth, logicalHeight, kClear8bpp);
+        }
     }
 
     void Renderer::beginFrame() {
         logicalFrameBuffer8 = getDrawSurface().getSpriteBuffer();
 
+        // Recorded commands only execute in endFrame(); anything left here was never drawn.
+        const uint32_t discarded = static_cast<uint32_t>(displayList_.size());
+#if defined(PIXELROOT32_DEBUG_MODE)
+        if (discarded != 0) {
+            log(LogLevel::Warning, "Renderer: %u recorded draw commands dropped; end each frame with endFrame()",
+                static_cast<unsigned>(discarded));
+        }
+#endif
+        displayList_.clear();
+        displayListStats_ = DisplayListStats{};
+        displayListStats_.discarded = discarded;
+        displayListBarrier_ = false;
+        frameClearedDirtyCellsOnly_ = false;
+        frameClearPending_ = false;
+        drawLayer_ = 0;
+
+        if constexpr (pixelroot32::platforms::config::EnableDirtyRegions) {
+            // Whole-screen invalidation (first frame, resize, forceFullRedraw) cannot be presented partially.
+            presentFullFrame_ = (logicalFrameBuffer8 == nullptr) || dirtyGrid.getCols() == 0 ||
+                                dirtyGrid.isFullDirty();
+            prevStaticLayerSignature_ = staticLayerSignature_;
+            staticLayerSignature_ = 0;
+            // A palette swap recolours pixels outside the dirty cells (at present time for the indexed
+            // framebuffer, when static layers are redrawn otherwise): push the whole frame once.
+            const uint32_t paletteGeneration = getPaletteGeneration();
+            if (paletteGeneration != presentPaletteGeneration_) {
+                presentPaletteGeneration_ = paletteGeneration;
+                presentFullFrame_ = true;
+            }
+        }
+
         if constexpr (!pixelroot32::platforms::config::EnableDirtyRegions) {
             suppressFramebufferClearBeforeStaticMemcpy_ = false;
             getDrawSurface().clearBuffer();
@@ -268,7 +357,12 @@ namespace pixelroot32::graphics {
         if (skipClearForMemcpy) {
             // Full framebuffer will be restored from StaticTilemapLayerCache before dynamic draws.
         } else if (!dirtyGrid.isFullDirty() && (dirtyGrid.countPrevMarkedCells() > 0)) {
-            clearDirtyCellsFramebuffer8();
+            if (recording_) {
+                frameClearPending_ = true;
+            } else {
+                clearDirtyCellsFramebuffer8();
+            }
+            frameClearedDirtyCellsOnly_ = true;
         } else {
             getDrawSurface().clearBuffer();
             if (dirtyGrid.isFullDirty()) {
@@ -278,12 +372,540 @@ namespace pixelroot32::graphics {
     }
 
     void Renderer::endFrame() {
+        flushDisplayList(true);
 #if defined(PIXELROOT32_DEBUG_MODE)
         drawDebugDirtyCellOverlay();
 #endif
+        if constexpr (pixelroot32::platforms::config::EnableDirtyRegions) {
+            // Static layers are not cell-tracked: any change in which maps are drawn, or where, repaints everything.
+            const bool staticLayersChanged = staticLayerSignature_ != prevStaticLayerSignature_;
+            const bool partial = !presentFullFrame_ && !staticLayersChanged && dirtyGrid.getCols() != 0;
+            if (presentPipeline_ != nullptr && logicalFrameBuffer8 != nullptr) {
+                presentPipeline_->submit(logicalFrameBuffer8, partial ? &dirtyGrid : nullptr);
+                return;
+            }
+            getDrawSurface().setPresentDirtyGrid(partial ? &dirtyGrid : nullptr);
+            getDrawSurface().sendBuffer();
+            getDrawSurface().setPresentDirtyGrid(nullptr);
+            return;
+        }
+        if (presentPipeline_ != nullptr && logicalFrameBuffer8 != nullptr) {
+            presentPipeline_->submit(logicalFrameBuffer8, nullptr);
+            return;
+        }
         getDrawSurface().sendBuffer();
     }
 
+    void Renderer::setPresentPipeline(PresentPipeline* pipeline) {
+        if (presentPipeline_ != nullptr) {
+            presentPipeline_->waitIdle();
+        }
+        presentPipeline_ = pipeline;
+    }
+
+    bool Renderer::enableRecordedMode(std::size_t commandCapacity, std::size_t textCapacity) {
+        flushDisplayList(false);
+        recording_ = false;
+        if (!displayList_.allocate(commandCapacity, textCapacity)) {
+            return false;
+        }
+        recording_ = true;
+        return true;
+    }
+
+    void Renderer::disableRecordedMode() {
+        flushDisplayList(false);
+        displayList_.release();
+        recording_ = false;
+    }
+
+    void Renderer::flushDisplayList() {
+        flushDisplayList(false);
+    }
+
+    void Renderer::flushDisplayList(bool endOfFrame) {
+        if (!isRecording()) {
+            return;
+        }
+        if (displayList_.size() > 0) {
+            displayList_.sortByLayerAndPalette();
+            displayListStats_.merged += static_cast<uint32_t>(displayList_.mergeAdjacent());
+            if (endOfFrame && !displayListBarrier_) {
+                cullStaticTileRunsAgainstDirtyGrid();
+            }
+            cullOccludedDrawCommands();
+        }
+        if (frameClearPending_) {
+            resolveFrameClear();
+        }
+        if (displayList_.size() > 0) {
+            PaletteContext* const savedContext = currentRenderContext;
+            const bool savedBypass = offsetBypass;
+            const uint8_t savedSlot = currentSpritePaletteSlot;
+            replaying_ = true;
+            offsetBypass = true;  // commands are already in screen space
+            currentSpritePaletteSlot = kSpritePaletteSlotContextInactive;
+
+            uint16_t lutStorage[16];
+            const uint16_t* lut = nullptr;
+            const DrawCommand* lutKey = nullptr;
+            for (std::size_t i = 0; i < displayList_.size(); ++i) {
+                executeDrawCommand(displayList_[i], lut, lutStorage, lutKey);
+            }
+            displayListStats_.executed += static_cast<uint32_t>(displayList_.size());
+
+            replaying_ = false;
+            offsetBypass = savedBypass;
+            currentSpritePaletteSlot = savedSlot;
+            setRenderContext(savedContext);
+            displayList_.clear();
+        }
+        if (!endOfFrame) {
+            displayListBarrier_ = true;
+        }
+    }
+
+    DrawCommand* Renderer::appendDrawCommand() {
+        DrawCommand* cmd = displayList_.append();
+        if (cmd == nullptr) {
+            ++displayListStats_.overflowFlushes;
+            flushDisplayList(false);
+            cmd = displayList_.append();
+        }
+        ++displayListStats_.recorded;
+        cmd->layer = drawLayer_;
+        const bool background = currentRenderContext != nullptr && *currentRenderContext == PaletteContext::Background;
+        cmd->flags = background ? DrawCommand::kFlagBackground : 0;
+        cmd->paletteSlot = 0;
+        return cmd;
+    }
+
+    bool Renderer::recordableBounds(int x, int y, int w, int h) {
+        if (w <= 0 || h <= 0 || x >= logicalWidth || y >= logicalHeight || x + w <= 0 || y + h <= 0) {
+            ++displayListStats_.culled;
+            return false;
+        }
+        return true;
+    }
+
+    void Renderer::recordSprite(const Sprite& sprite, int x, int y, Color color, bool flipX) {
+        const int sx = offsetBypass ? x : xOffset + x;
+        const int sy = offsetBypass ? y : yOffset + y;
+        if (!recordableBounds(sx, sy, sprite.width, sprite.height)) {
+            return;
+        }
+        DrawCommand* cmd = appendDrawCommand();
+        cmd->type = DrawCommandType::Sprite1bpp;
+        cmd->flags |= flipX ? DrawCommand::kFlagFlipX : 0;
+        cmd->x = sx;
+        cmd->y = sy;
+        cmd->w = sprite.width;
+        cmd->h = sprite.height;
+        cmd->sprite1.data = sprite.data;
+        cmd->sprite1.color = color;
+    }
+
+    void Renderer::recordSprite(DrawCommandType type, const uint8_t* data, const Color* palette, uint8_t width, uint8_t height,
+                                uint8_t paletteSize, uint8_t slot, int x, int y, bool flipX) {
+        const int sx = offsetBypass ? x : xOffset + x;
+        const int sy = offsetBypass ? y : yOffset + y;
+        if (!recordableBounds(sx, sy, width, height)) {
+            return;
+        }
+        DrawCommand* cmd = appendDrawCommand();
+        cmd->type = type;
+        cmd->flags |= flipX ? DrawCommand::kFlagFlipX : 0;
+        cmd->paletteSlot = slot;
+        cmd->x = sx;
+        cmd->y = sy;
+        cmd->w = width;
+        cmd->h = height;
+        cmd->spriteN.data = data;
+        cmd->spriteN.palette = palette;
+        cmd->spriteN.paletteSize = paletteSize;
+    }
+
+    void Renderer::recordFilledRect(int x, int y, int width, int height, uint16_t color) {
+        if (!recordableBounds(x, y, width, height)) {
+            return;
+        }
+        // Clip to the viewport so merged sizes stay within int16_t.
+        const int x0 = std::max(x, 0);
+        const int y0 = std::max(y, 0);
+        const int x1 = std::min(x + width, logicalWidth);
+        const int y1 = std::min(y + height, logicalHeight);
+        DrawCommand* cmd = appendDrawCommand();
+        cmd->type = DrawCommandType::FilledRect;
+        cmd->x = x0;
+        cmd->y = y0;
+        cmd->w = static_cast<int16_t>(x1 - x0);
+        cmd->h = static_cast<int16_t>(y1 - y0);
+        cmd->rect.surfaceColor = color;
+    }
+
+    bool Renderer::recordText(std::string_view text, int x, int y, Color color, uint8_t size, const Font* font) {
+        const int sx = offsetBypass ? x : xOffset + x;
+        const int sy = offsetBypass ? y : yOffset + y;
+        const int width = FontManager::textWidth(font, text, size);
+        if (!recordableBounds(sx, sy, width, font->glyphHeight * size)) {
+            return true;
+        }
+        // Make room for the command first so an overflow flush cannot drop the copied text.
+        if (displayList_.size() == displayList_.capacity()) {
+            ++displayListStats_.overflowFlushes;
+            flushDisplayList(false);
+        }
+        int offset = displayList_.appendText(text);
+        if (offset < 0) {
+            ++displayListStats_.overflowFlushes;
+            flushDisplayList(false);
+            offset = displayList_.appendText(text);
+            if (offset < 0) {
+                return false;
+            }
+        }
+        DrawCommand* cmd = appendDrawCommand();
+        cmd->type = DrawCommandType::Text;
+        cmd->x = sx;
+        cmd->y = sy;
+        cmd->w = static_cast<int16_t>(width);
+        cmd->h = static_cast<int16_t>(font->glyphHeight * size);
+        cmd->text.font = font;
+        cmd->text.textOffset = static_cast<uint16_t>(offset);
+        cmd->text.length = static_cast<uint8_t>(text.size());
+        cmd->text.size = size;
+        cmd->text.color = color;
+        return true;
+    }
+
+    template<typename TMap>
+    void Renderer::recordTileRun(DrawCommandType type, const TMap& map, int originX, int originY, LayerType layerType, Color color) {
+        const int viewX = offsetBypass ? originX : xOffset + originX;
+        const int viewY = offsetBypass ? originY : yOffset + originY;
+        if (layerType == LayerType::Static) {
+            noteStaticLayerDraw(static_cast<const void*>(map.indices), viewX, viewY,
+                                staticLayerContentSignature(map, viewX, viewY));
+        }
+
+        const int colBegin = std::max(0, viewX < 0 ? -viewX / map.tileWidth : 0);
+        const int colEnd = std::min(static_cast<int>(map.width),
+                                    (logicalWidth - viewX + map.tileWidth - 1) / map.tileWidth);
+        const int rowBegin = std::max(0, viewY < 0 ? -viewY / map.tileHeight : 0);
+        const int rowEnd = std::min(static_cast<int>(map.height),
+                                    (logicalHeight - viewY + map.tileHeight - 1) / map.tileHeight);
+        if (colBegin >= colEnd || rowBegin >= rowEnd) {
+            ++displayListStats_.culled;
+            return;
+        }
+
+        DrawCommand* cmd = appendDrawCommand();
+        cmd->type = type;
+        cmd->flags |= (layerType == LayerType::Static) ? DrawCommand::kFlagStatic : 0;
+        cmd->x = viewX;
+        cmd->y = viewY;
+        cmd->w = 0;
+        cmd->h = 0;
+        cmd->tiles.map = &map;
+        cmd->tiles.rowBegin = static_cast<uint8_t>(rowBegin);
+        cmd->tiles.rowEnd = static_cast<uint8_t>(rowEnd);
+        cmd->tiles.tileWidth = map.tileWidth;
+        cmd->tiles.tileHeight = map.tileHeight;
+        cmd->tiles.colBegin = static_cast<uint8_t>(colBegin);
+        cmd->tiles.colEnd = static_cast<uint8_t>(colEnd);
+        cmd->tiles.color = color;
+    }
+
+    void Renderer::cullStaticTileRunsAgainstDirtyGrid() {
+        if constexpr (pixelroot32::platforms::config::EnableDirtyRegions) {
+            // Only when the rest of the framebuffer provably still holds last frame's static pixels.
+            if (!frameClearedDirtyCellsOnly_ || presentFullFrame_ || logicalFrameBuffer8 == nullptr ||
+                staticLayerSignature_ != prevStaticLayerSignature_) {
+                return;
+            }
+            const int cols = dirtyGrid.getCols();
+            const int rows = dirtyGrid.getRows();
+            if (cols == 0 || rows == 0) {
+                return;
+            }
+
+            // Cell rows whose pixels must be repainted: cleared at beginFrame, or already touched this frame.
+            uint8_t rowNeeded[256] = {};
+            for (int cy = 0; cy < rows; ++cy) {
+                for (int cx = 0; cx < cols; ++cx) {
+                    if (dirtyGrid.isPrevDirty(static_cast<uint8_t>(cx), static_cast<uint8_t>(cy))) {
+                        rowNeeded[cy] = 1;
+                        break;
+                    }
+                }
+            }
+            auto pixelRowsNeeded = [&](int y0, int y1) {
+                const int c0 = std::max(0, y0 / DirtyGrid::CELL_H);
+                const int c1 = std::min(rows, (y1 + DirtyGrid::CELL_H - 1) / DirtyGrid::CELL_H);
+                for (int c = c0; c < c1; ++c) {
+                    if (rowNeeded[c]) {
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            std::size_t i = 0;
+            while (i < displayList_.size()) {
+                DrawCommand& cmd = displayList_[i];
+                const bool tileRun = cmd.type == DrawCommandType::TileRun1bpp ||
+                                     cmd.type == DrawCommandType::TileRun2bpp ||
+                                     cmd.type == DrawCommandType::TileRun4bpp;
+                if (tileRun && (cmd.flags & DrawCommand::kFlagStatic) != 0) {
+                    const int th = cmd.tiles.tileHeight;
+                    while (cmd.tiles.rowBegin < cmd.tiles.rowEnd &&
+                           !pixelRowsNeeded(std::max(0, cmd.y + cmd.tiles.rowBegin * th),
+                                            cmd.y + (cmd.tiles.rowBegin + 1) * th)) {
+                        ++cmd.tiles.rowBegin;
+                    }
+                    while (cmd.tiles.rowEnd > cmd.tiles.rowBegin &&
+                           !pixelRowsNeeded(std::max(0, cmd.y + (cmd.tiles.rowEnd - 1) * th),
+                                            cmd.y + cmd.tiles.rowEnd * th)) {
+                        --cmd.tiles.rowEnd;
+                    }
+                    if (cmd.tiles.rowBegin == cmd.tiles.rowEnd) {
+                        displayList_.erase(i);
+                        ++displayListStats_.culled;
+                        continue;
+                    }
+                }
+                int x0, y0, x1, y1;
+                cmd.bounds(x0, y0, x1, y1);
+                const int c0 = std::max(0, y0 / DirtyGrid::CELL_H);
+                const int c1 = std::min(rows, (y1 + DirtyGrid::CELL_H - 1) / DirtyGrid::CELL_H);
+                for (int c = c0; c < c1; ++c) {
+                    rowNeeded[c] = 1;
+                }
+                ++i;
+            }
+        }
+    }
+
+    void Renderer::resolveFrameClear() {
+        frameClearPending_ = false;
+        const uint32_t skipped = dirtyGrid.countPrevCoveredCells();
+        clearDirtyCellsFramebuffer8();
+        displayListStats_.bytesSaved += skipped * DirtyGrid::CELL_W * DirtyGrid::CELL_H *
+                                        static_cast<uint32_t>(sizeof(FramebufferPixel));
+    }
+
+    void Renderer::cullOccludedDrawCommands() {
+        if constexpr (pixelroot32::platforms::config::EnableDirtyRegions) {
+            if (logicalFrameBuffer8 == nullptr || dirtyGrid.getCols() == 0 || dirtyGrid.getRows() == 0) {
+                return;
+            }
+            // Coverage is per batch: cells repainted by an earlier flush do not hide anything now.
+            dirtyGrid.clearCovered();
+            const int gridW = dirtyGrid.getCols() * DirtyGrid::CELL_W;
+            const int gridH = dirtyGrid.getRows() * DirtyGrid::CELL_H;
+            bool anyCovered = false;
+
+            // Back to front: a command is hidden when every cell it touches is covered by a later one.
+            for (std::size_t i = displayList_.size(); i-- > 0;) {
+                const DrawCommand& cmd = displayList_[i];
+                if (anyCovered) {
+                    int x0, y0, x1, y1;
+                    cmd.bounds(x0, y0, x1, y1);
+                    x0 = std::max(x0, 0);
+                    y0 = std::max(y0, 0);
+                    x1 = std::min(x1, static_cast<int>(logicalWidth));
+                    y1 = std::min(y1, static_cast<int>(logicalHeight));
+                    // Pixels outside the grid (width / height not a multiple of 8) are never covered.
+                    bool hidden = x0 < x1 && y0 < y1 && x1 <= gridW && y1 <= gridH;
+                    for (int cy = y0 / DirtyGrid::CELL_H; hidden && cy * DirtyGrid::CELL_H < y1; ++cy) {
+                        for (int cx = x0 / DirtyGrid::CELL_W; cx * DirtyGrid::CELL_W < x1; ++cx) {
+                            if (!dirtyGrid.isCovered(static_cast<uint8_t>(cx), static_cast<uint8_t>(cy))) {
+                                hidden = false;
+                                break;
+                            }
+                        }
+                    }
+                    if (hidden) {
+                        displayListStats_.bytesSaved += static_cast<uint32_t>((x1 - x0) * (y1 - y0)) *
+                                                        static_cast<uint32_t>(sizeof(FramebufferPixel));
+                        ++displayListStats_.occluded;
+                        displayList_.erase(i);
+                        continue;
+                    }
+                }
+                anyCovered |= markOpaqueCoverage(cmd);
+            }
+        }
+    }
+
+    bool Renderer::markOpaqueCoverage(const DrawCommand& cmd) {
+        switch (cmd.type) {
+            case DrawCommandType::FilledRect: {
+                // Cells entirely inside the rect.
+                const int cx0 = (std::max(cmd.x, 0) + DirtyGrid::CELL_W - 1) / DirtyGrid::CELL_W;
+                const int cy0 = (std::max(cmd.y, 0) + DirtyGrid::CELL_H - 1) / DirtyGrid::CELL_H;
+                const int cx1 = std::min((cmd.x + cmd.w) / DirtyGrid::CELL_W, static_cast<int>(dirtyGrid.getCols()));
+                const int cy1 = std::min((cmd.y + cmd.h) / DirtyGrid::CELL_H, static_cast<int>(dirtyGrid.getRows()));
+                bool any = false;
+                for (int cy = cy0; cy < cy1; ++cy) {
+                    for (int cx = cx0; cx < cx1; ++cx) {
+                        dirtyGrid.markCovered(static_cast<uint8_t>(cx), static_cast<uint8_t>(cy));
+                        any = true;
+                    }
+                }
+                return any;
+            }
+            case DrawCommandType::TileRun2bpp:
+                if constexpr (pixelroot32::platforms::config::Enable2BppSprites) {
+                    return markTileRunCoverage<TileMap2bpp>(cmd);
+                }
+                return false;
+            case DrawCommandType::TileRun4bpp:
+                if constexpr (pixelroot32::platforms::config::Enable4BppSprites) {
+                    return markTileRunCoverage<TileMap4bpp>(cmd);
+                }
+                return false;
+            default:
+                // 1bpp content, sprites and text may leave pixels untouched.
+                return false;
+        }
+    }
+
+    template<typename TMap>
+    bool Renderer::markTileRunCoverage(const DrawCommand& cmd) {
+        using SpriteT = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<TMap>().tiles[0])>>;
+        using Codec = TileRowCodec<SpriteT>;
+        const TMap& map = *static_cast<const TMap*>(cmd.tiles.map);
+        const int tw = map.tileWidth;
+        const int th = map.tileHeight;
+
+        // Per tile index: 0 unknown, 1 every pixel opaque, 2 not.
+        uint8_t opacity[256] = {};
+        auto cellOpaque = [&](int tx, int ty) {
+            if (tx < cmd.tiles.colBegin || tx >= cmd.tiles.colEnd || ty < cmd.tiles.rowBegin || ty >= cmd.tiles.rowEnd) {
+                return false;
+            }
+            const int cellIndex = ty * map.width + tx;
+            uint8_t index = map.indices[cellIndex];
+            if (map.animManager) {
+                index = map.animManager->resolveFrame(index);
+            }
+            if (index == 0 || index >= map.tileCount) {
+                return false;
+            }
+            if (map.runtimeMask && !(map.runtimeMask[cellIndex >> 3] & (1 << (cellIndex & 7)))) {
+                return false;
+            }
+            if (opacity[index] == 0) {
+                const SpriteT& tile = map.tiles[index];
+                bool opaque = tile.data != nullptr && tile.width == tw && tile.height == th;
+                for (int r = 0; opaque && r < th; ++r) {
+                    const uint8_t* row = tile.data + r * Codec::strideBytes(tw);
+                    for (int c = 0; c < tw; ++c) {
+                        if (Codec::pixel(row, c) == 0) {
+                            opaque = false;
+                            break;
+                        }
+                    }
+                }
+                opacity[index] = opaque ? 1 : 2;
+            }
+            return opacity[index] == 1;
+        };
+
+        int x0, y0, x1, y1;
+        cmd.bounds(x0, y0, x1, y1);
+        const int cx0 = (std::max(x0, 0) + DirtyGrid::CELL_W - 1) / DirtyGrid::CELL_W;
+        const int cy0 = (std::max(y0, 0) + DirtyGrid::CELL_H - 1) / DirtyGrid::CELL_H;
+        const int cx1 = std::min(x1 / DirtyGrid::CELL_W, static_cast<int>(dirtyGrid.getCols()));
+        const int cy1 = std::min(y1 / DirtyGrid::CELL_H, static_cast<int>(dirtyGrid.getRows()));
+        bool any = false;
+        for (int cy = cy0; cy < cy1; ++cy) {
+            // Tiles under this cell row (cells lie inside the run, so offsets are non-negative).
+            const int ty0 = (cy * DirtyGrid::CELL_H - cmd.y) / th;
+            const int ty1 = (cy * DirtyGrid::CELL_H + DirtyGrid::CELL_H - 1 - cmd.y) / th;
+            for (int cx = cx0; cx < cx1; ++cx) {
+                const int tx0 = (cx * DirtyGrid::CELL_W - cmd.x) / tw;
+                const int tx1 = (cx * DirtyGrid::CELL_W + DirtyGrid::CELL_W - 1 - cmd.x) / tw;
+                bool covered = true;
+                for (int ty = ty0; covered && ty <= ty1; ++ty) {
+                    for (int tx = tx0; tx <= tx1; ++tx) {
+                        if (!cellOpaque(tx, ty)) {
+                            covered = false;
+                            break;
+                        }
+                    }
+                }
+                if (covered) {
+                    dirtyGrid.markCovered(static_cast<uint8_t>(cx), static_cast<uint8_t>(cy));
+                    any = true;
+                }
+            }
+        }
+        return any;
+    }
+
+    void Renderer::executeDrawCommand(const DrawCommand& cmd, const uint16_t*& lut, uint16_t* lutStorage,
+                                      const DrawCommand*& lutKey) {
+        PaletteContext context = (cmd.flags & DrawCommand::kFlagBackground) != 0
+            ? PaletteContext::Background
+            : PaletteContext::Sprite;
+        setRenderContext(&context);
+        const bool flipX = (cmd.flags & DrawCommand::kFlagFlipX) != 0;
+        const LayerType layerType = (cmd.flags & DrawCommand::kFlagStatic) != 0 ? LayerType::Static : LayerType::Dynamic;
+
+        switch (cmd.type) {
+            case DrawCommandType::Sprite1bpp:
+                drawSprite(Sprite{cmd.sprite1.data, static_cast<uint8_t>(cmd.w), static_cast<uint8_t>(cmd.h)},
+                           cmd.x, cmd.y, cmd.sprite1.color, flipX);
+                break;
+            case DrawCommandType::Sprite2bpp:
+            case DrawCommandType::Sprite4bpp: {
+                // Sorting groups same-palette sprites: rebuild the LUT only when the key changes.
+                const bool is2bpp = cmd.type == DrawCommandType::Sprite2bpp;
+                if (lutKey == nullptr || lutKey->type != cmd.type || lutKey->spriteN.palette != cmd.spriteN.palette ||
+                    lutKey->paletteSlot != cmd.paletteSlot) {
+                    const uint8_t maxColors = is2bpp ? 4 : 16;
+                    const uint8_t count = cmd.spriteN.paletteSize > maxColors ? maxColors : cmd.spriteN.paletteSize;
+                    buildSlotLUT(cmd.spriteN.palette, count, PaletteContext::Sprite, cmd.paletteSlot, lutStorage);
+                    lut = lutStorage;
+                }
+                lutKey = &cmd;
+                if (is2bpp) {
+                    const Sprite2bpp sprite{cmd.spriteN.data, cmd.spriteN.palette, static_cast<uint8_t>(cmd.w),
+                                            static_cast<uint8_t>(cmd.h), cmd.spriteN.paletteSize};
+                    drawSpriteInternal(sprite, cmd.x, cmd.y, lut, flipX);
+                } else {
+                    const Sprite4bpp sprite{cmd.spriteN.data, cmd.spriteN.palette, static_cast<uint8_t>(cmd.w),
+                                            static_cast<uint8_t>(cmd.h), cmd.spriteN.paletteSize};
+                    drawSpriteInternal(sprite, cmd.x, cmd.y, lut, flipX);
+                }
+                break;
+            }
+            case DrawCommandType::FilledRect:
+                getDrawSurface().drawFilledRectangle(cmd.x, cmd.y, cmd.w, cmd.h, cmd.rect.surfaceColor);
+                markDirtyLogicalRect(cmd.x, cmd.y, cmd.w, cmd.h);
+                break;
+            case DrawCommandType::Text:
+                drawText(displayList_.text(cmd), static_cast<int16_t>(cmd.x), static_cast<int16_t>(cmd.y),
+                         cmd.text.color, cmd.text.size, cmd.text.font);
+                break;
+            case DrawCommandType::TileRun1bpp:
+            case DrawCommandType::TileRun2bpp:
+            case DrawCommandType::TileRun4bpp:
+                tileRowClipBegin_ = cmd.tiles.rowBegin;
+                tileRowClipEnd_ = cmd.tiles.rowEnd;
+                if (cmd.type == DrawCommandType::TileRun1bpp) {
+                    drawTileMap(*static_cast<const TileMap*>(cmd.tiles.map), cmd.x, cmd.y, cmd.tiles.color, layerType);
+                } else if (cmd.type == DrawCommandType::TileRun2bpp) {
+                    drawTileMap(*static_cast<const TileMap2bpp*>(cmd.tiles.map), cmd.x, cmd.y, layerType);
+                } else {
+                    drawTileMap(*static_cast<const TileMap4bpp*>(cmd.tiles.map), cmd.x, cmd.y, layerType);
+                }
+                tileRowClipEnd_ = -1;
+                break;
+        }
+    }
+
     void Renderer::drawText(std::string_view text, int16_t x, int16_t y, Color color, uint8_t size) {
         // Legacy method: delegate to new method with default font
         drawText(text, x, y, color, size, nullptr);
@@ -302,6 +924,10 @@ namespace pixelroot32::graphics {
             return;
         }
 
+        if (isRecording() && recordText(text, x, y, color, size, activeFont)) {
+            return;
+        }
+
         int16_t currentX = x;
         float scale = static_cast<float>(size);
 
@@ -360,28 +986,31 @@ namespace pixelroot32::graphics {
 
     void Renderer::drawFilledCircle(int x, int y, int radius, Color color) {
         if (!isDrawable(color)) return;
+        if (isRecording()) flushDisplayList(false);
         PaletteContext context = (currentRenderContext != nullptr) ? *currentRenderContext : PaletteContext::Sprite;
         int finalX = offsetBypass ? x : xOffset + x;
         int finalY = offsetBypass ? y : yOffset + y;
-        getDrawSurface().drawFilledCircle(finalX, finalY, radius, resolveColor(color, context));
+        getDrawSurface().drawFilledCircle(finalX, finalY, radius, surfaceColor(color, context));
         markDirtyLogicalRect(finalX - radius, finalY - radius, 2 * radius + 1, 2 * radius + 1);
     }
 
     void Renderer::drawCircle(int x, int y, int radius, Color color) {
         if (!isDrawable(color)) return;
+        if (isRecording()) flushDisplayList(false);
         PaletteContext context = (currentRenderContext != nullptr) ? *currentRenderContext : PaletteContext::Sprite;
         int finalX = offsetBypass ? x : xOffset + x;
         int finalY = offsetBypass ? y : yOffset + y;
-        getDrawSurface().drawCircle(finalX, finalY, radius, resolveColor(color, context));
+        getDrawSurface().drawCircle(finalX, finalY, radius, surfaceColor(color, context));
         markDirtyLogicalRect(finalX - radius, finalY - radius, 2 * radius + 1, 2 * radius + 1);
     }
 
     void Renderer::drawRectangle(int x, int y, int width, int height, Color color) {
         if (!isDrawable(color)) return;
+        if (isRecording()) flushDisplayList(false);
         PaletteContext context = (currentRenderContext != nullptr) ? *currentRenderContext : PaletteContext::Sprite;
         int finalX = offsetBypass ? x : xOffset + x;
         int finalY = offsetBypass ? y : yOffset + y;
-        getDrawSurface().drawRectangle(finalX, finalY, width, height, resolveColor(color, context));
+        getDrawSurface().drawRectangle(finalX, finalY, width, height, surfaceColor(color, context));
         markDirtyLogicalRect(finalX, finalY, width, height);
     }
 
@@ -390,25 +1019,134 @@ namespace pixelroot32::graphics {
         PaletteContext context = (currentRenderContext != nullptr) ? *currentRenderContext : PaletteContext::Sprite;
         int finalX = offsetBypass ? x : xOffset + x;
         int finalY = offsetBypass ? y : yOffset + y;
-        getDrawSurface().drawFilledRectangle(finalX, finalY, width, height, resolveColor(color, context));
+        if (isRecording()) {
+            recordFilledRect(finalX, finalY, width, height, surfaceColor(color, context));
+            return;
+        }
+        getDrawSurface().drawFilledRectangle(finalX, finalY, width, height, surfaceColor(color, context));
         markDirtyLogicalRect(finalX, finalY, width, height);
     }
 
     void Renderer::drawFilledRectangleW(int x, int y, int width, int height, uint16_t color) {
         int finalX = offsetBypass ? x : xOffset + x;
         int finalY = offsetBypass ? y : yOffset + y;
+        color = surfaceColorRgb565(color);
+        if (isRecording()) {
+            recordFilledRect(finalX, finalY, width, height, color);
+            return;
+        }
         getDrawSurface().drawFilledRectangle(finalX, finalY, width, height, color);
         markDirtyLogicalRect(finalX, finalY, width, height);
     }
 
+    void IRAM_ATTR Renderer::drawPointBatch(const int16_t* xs, const int16_t* ys, const uint8_t* colorIndex, int count,
+                                            const uint16_t* colors, uint8_t colorCount, uint8_t size) {
+        if (count <= 0 || colorCount == 0) return;
+        if (isRecording()) flushDisplayList(false);
+        if (colorCount > kPointBatchMaxColors) colorCount = kPointBatchMaxColors;
+        size = (size >= 2) ? 2 : 1;
+
+        uint16_t surface[kPointBatchMaxColors];
+        for (uint8_t i = 0; i < colorCount; ++i) {
+            surface[i] = surfaceColorRgb565(colors[i]);
+        }
+
+        const int ox = offsetBypass ? 0 : xOffset;
+        const int oy = offsetBypass ? 0 : yOffset;
+        const int screenW = logicalWidth;
+        const int screenH = logicalHeight;
+
+        // Cells the points touch, OR-ed into the DirtyGrid once at the end. Scattered particles
+        // must not dirty the whole box around them. Grids too large for the local mask mark
+        // each point directly.
+        uint8_t cellMask[kPointBatchCellMaskBytes];
+        const uint8_t cellCols = dirtyGrid.getCols();
+        const uint8_t cellRows = dirtyGrid.getRows();
+        const int maskStride = (cellCols + 7) >> 3;
+        const bool trackCells = pixelroot32::platforms::config::EnableDirtyRegions &&
+                          tilemapSpriteDirtyMode_ != TilemapSpriteDirtyMode::SuppressPerSpriteBoundsMark &&
+                          cellCols != 0;
+        const bool useMask = trackCells && dirtyGrid.cellMaskBytes() <= sizeof(cellMask);
+        bool anyMarked = false;
+        if (useMask) {
+            std::memset(cellMask, 0, dirtyGrid.cellMaskBytes());
+        }
+        // Marks the clipped pixel span [x0, x1] x [y0, y1] (inclusive, on screen).
+        auto markPoint = [&](int x0, int y0, int x1, int y1) {
+            if (!trackCells) return;
+            if (!useMask) {
+                dirtyGrid.markRect(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+                return;
+            }
+            const int cx1 = std::min(x1 / DirtyGrid::CELL_W, cellCols - 1);
+            const int cy1 = std::min(y1 / DirtyGrid::CELL_H, cellRows - 1);
+            for (int cy = y0 / DirtyGrid::CELL_H; cy <= cy1; ++cy) {
+                for (int cx = x0 / DirtyGrid::CELL_W; cx <= cx1; ++cx) {
+                    cellMask[cy * maskStride + (cx >> 3)] |= static_cast<uint8_t>(1u << (cx & 7));
+                    anyMarked = true;
+                }
+            }
+        };
+
+        FramebufferPixel* const fb = framebufferPixels();
+        if (fb != nullptr) {
+            FramebufferPixel packed[kPointBatchMaxColors];
+            for (uint8_t i = 0; i < colorCount; ++i) {
+                packed[i] = packRgb565ToFramebuffer(surface[i]);
+            }
+            for (int i = 0; i < count; ++i) {
+                const int x = xs[i] + ox;
+                const int y = ys[i] + oy;
+                const FramebufferPixel c = packed[colorIndex[i] < colorCount ? colorIndex[i] : 0];
+                if (size == 2 && x >= 0 && y >= 0 && x + 1 < screenW && y + 1 < screenH) {
+                    // Whole 2x2 splat on screen: two unclipped row pairs.
+                    FramebufferPixel* p = fb + y * screenW + x;
+                    p[0] = c;
+                    p[1] = c;
+                    p[screenW] = c;
+                    p[screenW + 1] = c;
+                    markPoint(x, y, x + 1, y + 1);
+                    continue;
+                }
+                const int x0 = std::max(x, 0);
+                const int y0 = std::max(y, 0);
+                const int x1 = std::min(x + size, screenW);
+                const int y1 = std::min(y + size, screenH);
+                if (x0 >= x1 || y0 >= y1) continue;
+                for (int py = y0; py < y1; ++py) {
+                    for (int px = x0; px < x1; ++px) {
+                        fb[py * screenW + px] = c;
+                    }
+                }
+                markPoint(x0, y0, x1 - 1, y1 - 1);
+            }
+        } else {
+            DrawSurface& surf = getDrawSurface();
+            for (int i = 0; i < count; ++i) {
+                const int x0 = std::max(xs[i] + ox, 0);
+                const int y0 = std::max(ys[i] + oy, 0);
+                const int x1 = std::min(xs[i] + ox + size, screenW);
+                const int y1 = std::min(ys[i] + oy + size, screenH);
+                if (x0 >= x1 || y0 >= y1) continue;
+                surf.drawFilledRectangle(x0, y0, x1 - x0, y1 - y0,
+                                         surface[colorIndex[i] < colorCount ? colorIndex[i] : 0]);
+                markPoint(x0, y0, x1 - 1, y1 - 1);
+            }
+        }
+        if (anyMarked) {
+            dirtyGrid.markCells(cellMask);
+        }
+    }
+
     void Renderer::drawLine(int x1, int y1, int x2, int y2, Color color) {
         if (!isDrawable(color)) return;
+        if (isRecording()) flushDisplayList(false);
         PaletteContext context = (currentRenderContext != nullptr) ? *currentRenderContext : PaletteContext::Sprite;
         int finalX1 = offsetBypass ? x1 : xOffset + x1;
         int finalY1 = offsetBypass ? y1 : yOffset + y1;
         int finalX2 = offsetBypass ? x2 : xOffset + x2;
         int finalY2 = offsetBypass ? y2 : yOffset + y2;
-        getDrawSurface().drawLine(finalX1, finalY1, finalX2, finalY2, resolveColor(color, context));
+        getDrawSurface().drawLine(finalX1, finalY1, finalX2, finalY2, surfaceColor(color, context));
         const int minX = std::min(finalX1, finalX2);
         const int minY = std::min(finalY1, finalY2);
         const int maxX = std::max(finalX1, finalX2);
@@ -424,19 +1162,21 @@ namespace pixelroot32::graphics {
     //draw an image to the screen in an bitmap format
     void Renderer::drawBitmap(int x, int y, int width, int height, const uint8_t *bitmap, Color color) {
         if (!isDrawable(color)) return;
+        if (isRecording()) flushDisplayList(false);
         PaletteContext context = (currentRenderContext != nullptr) ? *currentRenderContext : PaletteContext::Sprite;
         int finalX = offsetBypass ? x : xOffset + x;
         int finalY = offsetBypass ? y : yOffset + y;
-        getDrawSurface().drawBitmap(finalX, finalY, width, height, bitmap, resolveColor(color, context));
+        getDrawSurface().drawBitmap(finalX, finalY, width, height, bitmap, surfaceColor(color, context));
         markDirtyLogicalRect(finalX, finalY, width, height);
     }
 
     void Renderer::drawPixel(int x, int y, Color color) {
         if (!isDrawable(color)) return;
+        if (isRecording()) flushDisplayList(false);
         PaletteContext context = (currentRenderContext != nullptr) ? *currentRenderContext : PaletteContext::Sprite;
         int finalX = offsetBypass ? x : xOffset + x;
         int finalY = offsetBypass ? y : yOffset + y;
-        getDrawSurface().drawPixel(finalX, finalY, resolveColor(color, context));
+        getDrawSurface().drawPixel(finalX, finalY, surfaceColor(color, context));
         markDirtyLogicalRect(finalX, finalY, 1, 1);
     }
 
@@ -445,14 +1185,25 @@ namespace pixelroot32::graphics {
             return;
         }
 
+        if (isRecording()) {
+            recordSprite(sprite, x, y, color, flipX);
+            return;
+        }
+
         const int screenW = logicalWidth;
         const int screenH = logicalHeight;
         PaletteContext context = (currentRenderContext != nullptr) ? *currentRenderContext : PaletteContext::Sprite;
-        const uint16_t resolvedColor = resolveColor(color, context);
+        const uint16_t resolvedColor = surfaceColor(color, context);
 
         int startX = offsetBypass ? x : xOffset + x;
         int startY = offsetBypass ? y : yOffset + y;
 
+        if (logicalFrameBuffer8 != nullptr && sprite.width <= 16) {
+            drawSprite1bppSpans(sprite, startX, startY, packRgb565ToFramebuffer(resolvedColor), flipX);
+            markDirtyLogicalRect(startX, startY, sprite.width, sprite.height);
+            return;
+        }
+
         for (int row = 0; row < sprite.height; ++row) {
             const int logicalY = startY + row;
             // Note: clipping against logicalWidth/Height might be tricky if xOffset is applied,
@@ -485,6 +1236,58 @@ namespace pixelroot32::graphics {
         markDirtyLogicalRect(startX, startY, sprite.width, sprite.height);
     }
 
+    void IRAM_ATTR Renderer::drawSprite1bppSpans(const Sprite& sprite, int startX, int startY, FramebufferPixel packedColor, bool flipX) {
+        const int screenW = logicalWidth;
+        const int screenH = logicalHeight;
+        const int w = sprite.width;
+
+        // Clip once: visible destination columns [colBegin, colEnd) and rows [rowBegin, rowEnd).
+        const int colBegin = std::max(0, -startX);
+        const int colEnd   = std::min(w, screenW - startX);
+        const int rowBegin = std::max(0, -startY);
+        const int rowEnd   = std::min(static_cast<int>(sprite.height), screenH - startY);
+        if (colBegin >= colEnd || rowBegin >= rowEnd) {
+            return;
+        }
+
+        // Non-flipped rows are left-aligned at bit 31 (destination column d = bit 31 - d);
+        // flipped rows are used as-is (destination column d = bit d).
+        const uint32_t clipMask = flipX
+            ? (((1u << colEnd) - 1u) & ~((1u << colBegin) - 1u))
+            : ((0xFFFFFFFFu >> colBegin) & ~(0xFFFFFFFFu >> colEnd));
+
+        for (int row = rowBegin; row < rowEnd; ++row) {
+            FramebufferPixel* const dst = framebufferPixels() + (startY + row) * screenW + startX;
+            int col = 0;
+
+            if (!flipX) {
+                // Bit (w - 1) is the leftmost pixel; bits above width fall off the shift.
+                uint32_t bits = (static_cast<uint32_t>(sprite.data[row]) << (32 - w)) & clipMask;
+                while (bits != 0) {
+                    const int skip = __builtin_clz(bits);
+                    bits <<= skip;
+                    col += skip;
+                    // Low (32 - w) bits are always clear, so ~bits != 0 and run < 32.
+                    const int run = __builtin_clz(~bits);
+                    fillFramebufferSpan(dst + col, packedColor, run);
+                    bits <<= run;
+                    col += run;
+                }
+            } else {
+                uint32_t bits = static_cast<uint32_t>(sprite.data[row]) & clipMask;
+                while (bits != 0) {
+                    const int skip = __builtin_ctz(bits);
+                    bits >>= skip;
+                    col += skip;
+                    const int run = __builtin_ctz(~bits);
+                    fillFramebufferSpan(dst + col, packedColor, run);
+                    bits >>= run;
+                    col += run;
+                }
+            }
+        }
+    }
+
     void Renderer::drawSprite(const Sprite2bpp& sprite, int x, int y, uint8_t paletteSlot, bool flipX) {
         if constexpr (pixelroot32::platforms::config::Enable2BppSprites) {
             if (sprite.data == nullptr || sprite.width == 0 || sprite.height == 0 || sprite.palette == nullptr || sprite.paletteSize == 0) {
@@ -495,13 +1298,15 @@ namespace pixelroot32::graphics {
             uint8_t effectiveSlot = (currentSpritePaletteSlot != kSpritePaletteSlotContextInactive) ? 
                                    currentSpritePaletteSlot : paletteSlot;
 
-            const uint16_t* palettePtr = getSpritePaletteSlot(effectiveSlot);
-            
+            if (isRecording()) {
+                recordSprite(DrawCommandType::Sprite2bpp, sprite.data, sprite.palette, sprite.width, sprite.height,
+                             sprite.paletteSize, effectiveSlot, x, y, flipX);
+                return;
+            }
+
             uint16_t paletteLUT[4];
             uint8_t paletteCount = sprite.paletteSize > 4 ? 4 : sprite.paletteSize;
-            for (uint8_t i = 0; i < paletteCount; ++i) {
-                paletteLUT[i] = resolveColorWithPalette(sprite.palette[i], palettePtr);
-            }
+            buildSlotLUT(sprite.palette, paletteCount, PaletteContext::Sprite, effectiveSlot, paletteLUT);
 
             drawSpriteInternal(sprite, x, y, paletteLUT, flipX);
         }
@@ -522,7 +1327,7 @@ namespace pixelroot32::graphics {
             int startX = offsetBypass ? x : xOffset + x;
             int startY = offsetBypass ? y : yOffset + y;
 
-            uint8_t* const fb8 = logicalFrameBuffer8;
+            FramebufferPixel* const fb8 = framebufferPixels();
 
             // Data: 16-bit words (8 pixels per word). Compiler pack_2bpp: LSB = left pixel (bitOffset = (col&7)<<1), word order [left, right]
             for (int row = 0; row < sprite.height; ++row) {
@@ -530,7 +1335,7 @@ namespace pixelroot32::graphics {
                 if (logicalY < 0 || logicalY >= screenH) continue;
 
                 const uint16_t* rowWords = reinterpret_cast<const uint16_t*>(sprite.data + row * rowStrideBytes);
-                uint8_t* dstRow = fb8 ? (fb8 + logicalY * screenW) : nullptr;
+                FramebufferPixel* dstRow = fb8 ? (fb8 + logicalY * screenW) : nullptr;
 
                 for (int col = 0; col < sprite.width; ++col) {
                     const int wordIdx = col >> 3; // 8 pixels per word; word 0 = left half, word 1 = right half
@@ -543,7 +1348,7 @@ namespace pixelroot32::graphics {
                     if (logicalX < 0 || logicalX >= screenW) continue;
 
                     if (dstRow) {
-                        dstRow[logicalX] = packRgb565ToTftSprite8(paletteLUT[val]);
+                        dstRow[logicalX] = packRgb565ToFramebuffer(paletteLUT[val]);
                     } else {
                         getDrawSurface().drawPixel(logicalX, logicalY, paletteLUT[val]);
                     }
@@ -563,13 +1368,15 @@ namespace pixelroot32::graphics {
             uint8_t effectiveSlot = (currentSpritePaletteSlot != kSpritePaletteSlotContextInactive) ? 
                                    currentSpritePaletteSlot : paletteSlot;
 
-            const uint16_t* palettePtr = getSpritePaletteSlot(effectiveSlot);
-            
+            if (isRecording()) {
+                recordSprite(DrawCommandType::Sprite4bpp, sprite.data, sprite.palette, sprite.width, sprite.height,
+                             sprite.paletteSize, effectiveSlot, x, y, flipX);
+                return;
+            }
+
             uint16_t paletteLUT[16];
             uint8_t paletteCount = sprite.paletteSize > 16 ? 16 : sprite.paletteSize;
-            for (uint8_t i = 0; i < paletteCount; ++i) {
-                paletteLUT[i] = resolveColorWithPalette(sprite.palette[i], palettePtr);
-            }
+            buildSlotLUT(sprite.palette, paletteCount, PaletteContext::Sprite, effectiveSlot, paletteLUT);
 
             drawSpriteInternal(sprite, x, y, paletteLUT, flipX);
         }
@@ -589,7 +1396,7 @@ namespace pixelroot32::graphics {
             int startX = offsetBypass ? x : xOffset + x;
             int startY = offsetBypass ? y : yOffset + y;
 
-            uint8_t* const fb8 = logicalFrameBuffer8;
+            FramebufferPixel* const fb8 = framebufferPixels();
 
             for (int row = 0; row < sprite.height; ++row) {
                 const int logicalY = startY + row;
@@ -598,7 +1405,7 @@ namespace pixelroot32::graphics {
                 const uint8_t* rowData = sprite.data + row * rowStrideBytes;
 
                 if (fb8 && !flipX) {
-                    uint8_t* dstRow = fb8 + logicalY * screenW;
+                    FramebufferPixel* dstRow = fb8 + logicalY * screenW;
                     int col = 0;
                     for (; col + 1 < sprite.width; col += 2) {
                         const uint8_t b = rowData[col >> 1];
@@ -607,10 +1414,10 @@ namespace pixelroot32::graphics {
                         const int lx0 = startX + col;
                         const int lx1 = startX + col + 1;
                         if (v0 != 0 && lx0 >= 0 && lx0 < screenW) {
-                            dstRow[lx0] = packRgb565ToTftSprite8(paletteLUT[v0]);
+                            dstRow[lx0] = packRgb565ToFramebuffer(paletteLUT[v0]);
                         }
                         if (v1 != 0 && lx1 >= 0 && lx1 < screenW) {
-                            dstRow[lx1] = packRgb565ToTftSprite8(paletteLUT[v1]);
+                            dstRow[lx1] = packRgb565ToFramebuffer(paletteLUT[v1]);
                         }
                     }
                     if (col < sprite.width) {
@@ -620,12 +1427,12 @@ namespace pixelroot32::graphics {
                         if (val != 0) {
                             const int lx = startX + col;
                             if (lx >= 0 && lx < screenW) {
-                                dstRow[lx] = packRgb565ToTftSprite8(paletteLUT[val]);
+                                dstRow[lx] = packRgb565ToFramebuffer(paletteLUT[val]);
                             }
                         }
                     }
                 } else if (fb8) {
-                    uint8_t* dstRow = fb8 + logicalY * screenW;
+                    FramebufferPixel* dstRow = fb8 + logicalY * screenW;
                     for (int col = 0; col < sprite.width; ++col) {
                         const int byteIdx = col >> 1;
                         const int bitOffset = (col & 1) << 2;
@@ -633,7 +1440,7 @@ namespace pixelroot32::graphics {
                         if (val == 0) continue;
                         const int logicalX = startX + (sprite.width - 1 - col);
                         if (logicalX < 0 || logicalX >= screenW) continue;
-                        dstRow[logicalX] = packRgb565ToTftSprite8(paletteLUT[val]);
+                        dstRow[logicalX] = packRgb565ToFramebuffer(paletteLUT[val]);
                     }
                 } else {
                     for (int col = 0; col < sprite.width; ++col) {
@@ -681,11 +1488,14 @@ namespace pixelroot32::graphics {
         if (sprite.data == nullptr || sprite.width == 0 || sprite.height == 0 || scaleX <= 0 || scaleY <= 0) {
             return;
         }
+        if (isRecording()) {
+            flushDisplayList(false);
+        }
 
         const int screenW = logicalWidth;
         const int screenH = logicalHeight;
         PaletteContext context = (currentRenderContext != nullptr) ? *currentRenderContext : PaletteContext::Sprite;
-        const uint16_t resolvedColor = resolveColor(color, context);
+        const uint16_t resolvedColor = surfaceColor(color, context);
 
         const int dstWidth = static_cast<int>(std::ceil(sprite.width * scaleX));
         const int dstHeight = static_cast<int>(std::ceil(sprite.height * scaleY));
@@ -770,6 +1580,11 @@ namespace pixelroot32::graphics {
         ctx.viewOriginX = offsetBypass ? originX : xOffset + originX;
         ctx.viewOriginY = offsetBypass ? originY : yOffset + originY;
 
+        if (layerType == LayerType::Static) {
+            noteStaticLayerDraw(static_cast<const void*>(map.indices), ctx.viewOriginX, ctx.viewOriginY,
+                                staticLayerContentSignature(map, ctx.viewOriginX, ctx.viewOriginY));
+        }
+
         const bool selectiveAnimMarks =
             (layerType == LayerType::Dynamic && map.animManager != nullptr);
 
@@ -843,6 +1658,11 @@ namespace pixelroot32::graphics {
             return;
         }
 
+        if (isRecording()) {
+            recordTileRun(DrawCommandType::TileRun1bpp, map, originX, originY, layerType, color);
+            return;
+        }
+
         auto h = computeTilemapDirtyTracking(map, originX, originY, layerType);
 
         for (int ty = h.startRow; ty < h.endRow; ++ty) {
@@ -899,47 +1719,137 @@ namespace pixelroot32::graphics {
         setRenderContext(h.oldContext);
     }
 
-    void Renderer::drawTileMap(const TileMap2bpp& map, int originX, int originY, LayerType layerType) {
-        if constexpr (pixelroot32::platforms::config::Enable2BppSprites) {
-        if (map.indices == nullptr || map.tiles == nullptr ||
-            map.width == 0 || map.height == 0 ||
-            map.tileWidth == 0 || map.tileHeight == 0 ||
-            map.tileCount == 0) {
-            return;
-        }
+    template<typename TMap>
+    void IRAM_ATTR Renderer::rasterizeTileMap(const TMap& map,
+                                              LayerType layerType,
+                                              const TilemapDirtyTrackingHelper& h,
+                                              const TileRasterTarget& target,
+                                              bool markDirty) {
+        using SpriteT = std::remove_cv_t<std::remove_reference_t<decltype(map.tiles[0])>>;
+        using Codec = TileRowCodec<SpriteT>;
+        constexpr int kMaxColors = std::is_same_v<SpriteT, Sprite2bpp> ? 4 : 16;
+        constexpr int kSegmentCells = 32;
+        constexpr int kLutCacheSize = 4;
+
+        struct Cell {
+            const uint8_t* data;
+            int            x;
+            uint8_t        width;
+            uint8_t        height;
+            uint8_t        lut;
+        };
+
+        FramebufferPixel* const fb = target.pixels;
+        const int stride = target.stride;
+        const int clipX0 = target.clipX0;
+        const int clipX1 = target.clipX1;
+
+        Cell cells[kSegmentCells];
+        FramebufferPixel luts[kLutCacheSize][kMaxColors];
+        const Color* lutPalette[kLutCacheSize];
+        uint8_t lutSlot[kLutCacheSize];
+        int cellCount = 0;
+        int lutCount = 0;
 
-        auto h = computeTilemapDirtyTracking(map, originX, originY, layerType);
+        for (int ty = h.startRow; ty < h.endRow; ++ty) {
+            const int bandY = h.viewOriginY + ty * map.tileHeight;
+            const int rowIndexBase = ty * map.width;
+
+            // Dirty run: consecutive drawn tiles of equal height are marked as one rect.
+            int runX0 = 0;
+            int runX1 = 0;
+            int runH = 0;
+
+            // Rasterise the collected cells one scanline at a time.
+            auto flushSegment = [&]() {
+                if (cellCount == 0) {
+                    return;
+                }
+                int yEnd = bandY;
+                for (int i = 0; i < cellCount; ++i) {
+                    yEnd = std::max(yEnd, bandY + cells[i].height);
+                }
+                const int y0 = std::max(bandY, target.clipY0);
+                const int y1 = std::min(yEnd, target.clipY1);
+                for (int y = y0; y < y1; ++y) {
+                    const int r = y - bandY;
+                    FramebufferPixel* const dstRow = fb + y * stride;
+                    for (int i = 0; i < cellCount; ++i) {
+                        const Cell& c = cells[i];
+                        if (r >= c.height) {
+                            continue;
+                        }
+                        const uint8_t* rowData = c.data + r * Codec::strideBytes(c.width);
+                        const FramebufferPixel* lut = luts[c.lut];
+                        FramebufferPixel* dst = dstRow + c.x;
+
+                        if (c.width == 8 && c.x >= clipX0 && c.x + 8 <= clipX1) {
+                            // Interior 8-pixel row: decode once, branch-free when fully opaque.
+                            const uint32_t bits = Codec::load8(rowData);
+                            if (bits == 0) {
+                                continue;
+                            }
+                            if (!Codec::anyTransparent8(bits)) {
+                                for (int col = 0; col < 8; ++col) {
+                                    dst[col] = lut[Codec::pixel8(bits, col)];
+                                }
+                            } else {
+                                for (int col = 0; col < 8; ++col) {
+                                    const uint8_t v = Codec::pixel8(bits, col);
+                                    if (v != 0) {
+                                        dst[col] = lut[v];
+                                    }
+                                }
+                            }
+                            continue;
+                        }
 
-        // Palette Caching (tile palette + background palette slot)
-        uint16_t cachedLUT[4];
-        const Color* lastTilePalettePtr = nullptr;
-        const uint16_t* lastBackgroundPalettePtr = nullptr;
+                        // Edge (or non-8-wide) tile: clip columns once.
+                        const int colBegin = std::max(0, clipX0 - c.x);
+                        const int colEnd = std::min(static_cast<int>(c.width), clipX1 - c.x);
+                        for (int col = colBegin; col < colEnd; ++col) {
+                            const uint8_t v = Codec::pixel(rowData, col);
+                            if (v != 0) {
+                                dst[col] = lut[v];
+                            }
+                        }
+                    }
+                }
+                cellCount = 0;
+            };
 
-        for (int ty = h.startRow; ty < h.endRow; ++ty) {
-            int baseY = originY + ty * map.tileHeight;
-            int rowIndexBase = ty * map.width;
+            auto flushDirtyRun = [&]() {
+                if (runH > 0) {
+                    if (markDirty) {
+                        markDirtyLogicalRect(runX0, bandY, runX1 - runX0, runH);
+                    }
+                    runH = 0;
+                }
+            };
 
             for (int tx = h.startCol; tx < h.endCol; ++tx) {
-                int baseX = originX + tx * map.tileWidth;
-                int cellIndex = rowIndexBase + tx;
-                uint8_t rawIndex = map.indices[cellIndex];
-                uint8_t index   = rawIndex;
+                const int cellIndex = rowIndexBase + tx;
+                const int screenX = h.viewOriginX + tx * map.tileWidth;
+                const uint8_t rawIndex = map.indices[cellIndex];
+                uint8_t index = rawIndex;
 
                 if (map.animManager) {
                     index = map.animManager->resolveFrame(rawIndex);
                 }
 
                 if (index == 0 || index >= map.tileCount) {
+                    flushDirtyRun();
                     continue;
                 }
 
                 if (map.runtimeMask) {
                     if (!(map.runtimeMask[cellIndex >> 3] & (1 << (cellIndex & 7)))) {
+                        flushDirtyRun();
                         continue;
                     }
                 }
 
-                if (layerType == LayerType::Dynamic) {
+                if (markDirty && layerType == LayerType::Dynamic) {
                     bool markCell = true;
                     if (map.animManager != nullptr) {
                         markCell = h.mapOrOriginMovedAnim ||
@@ -947,64 +1857,86 @@ namespace pixelroot32::graphics {
                     }
                     if (markCell) {
                         if constexpr (pixelroot32::platforms::config::EnableDirtyRegions) {
-                            const int pixelX = offsetBypass ? baseX : xOffset + baseX;
-                            const int pixelY = offsetBypass ? baseY : yOffset + baseY;
-                            dirtyGrid.markRect(pixelX, pixelY, map.tileWidth, map.tileHeight);
+                            dirtyGrid.markRect(screenX, bandY, map.tileWidth, map.tileHeight);
                         }
                     }
                 }
 
-                const Sprite2bpp& tile = map.tiles[index];
+                const SpriteT& tile = map.tiles[index];
+                if (tile.data == nullptr || tile.width == 0 || tile.height == 0) {
+                    flushDirtyRun();
+                    continue;
+                }
 
                 // Per-cell background palette: use paletteIndices if present, else slot 0
-                const uint16_t* palettePtr = (map.paletteIndices != nullptr)
-                    ? getBackgroundPaletteSlot(map.paletteIndices[cellIndex] & kTileCellPaletteMask)
-                    : getBackgroundPaletteSlot(0);
-                
-                // Rebuild LUT only when tile palette or background palette slot changes
-                uint8_t paletteCount = 0;
-                if (tile.palette != lastTilePalettePtr || palettePtr != lastBackgroundPalettePtr) {
-                    paletteCount = tile.paletteSize > 4 ? 4 : tile.paletteSize;
-                    for (uint8_t i = 0; i < paletteCount; ++i) {
-                        cachedLUT[i] = resolveColorWithPalette(tile.palette[i], palettePtr);
+                const uint8_t paletteSlot = (map.paletteIndices != nullptr)
+                    ? static_cast<uint8_t>(map.paletteIndices[cellIndex] & kTileCellPaletteMask)
+                    : 0;
+
+                int lut = 0;
+                while (lut < lutCount && (lutPalette[lut] != tile.palette || lutSlot[lut] != paletteSlot)) {
+                    ++lut;
+                }
+                if (lut == lutCount) {
+                    if (lutCount == kLutCacheSize) {
+                        // Cached LUTs are referenced by pending cells: draw them before reuse.
+                        flushSegment();
+                        lutCount = 0;
+                        lut = 0;
+                    }
+                    uint16_t colors[kMaxColors] = {};
+                    const uint8_t paletteCount = tile.paletteSize > kMaxColors ? kMaxColors : tile.paletteSize;
+                    buildSlotLUT(tile.palette, paletteCount, PaletteContext::Background, paletteSlot, colors);
+                    for (int i = 0; i < kMaxColors; ++i) {
+                        luts[lut][i] = packRgb565ToFramebuffer(colors[i]);
                     }
-                    lastTilePalettePtr = tile.palette;
-                    lastBackgroundPalettePtr = palettePtr;
+                    lutPalette[lut] = tile.palette;
+                    lutSlot[lut] = paletteSlot;
+                    ++lutCount;
                 }
 
-                // Use original path - drawSpriteInternal handles custom palettes correctly
-                drawSpriteInternal(tile, baseX, baseY, cachedLUT, false);
-            }
-        }
-
-        if (h.animSlot) {
-            h.animSlot->primed = true;
-            h.animSlot->mapKey = map.indices;
-            h.animSlot->ox     = h.viewOriginX;
-            h.animSlot->oy     = h.viewOriginY;
-        }
-
-        tilemapSpriteDirtyMode_ = h.savedMode;
+                if (cellCount == kSegmentCells) {
+                    flushSegment();
+                }
+                cells[cellCount++] = Cell{tile.data, screenX, tile.width, tile.height, static_cast<uint8_t>(lut)};
 
-        setRenderContext(h.oldContext);
+                if (runH == tile.height && runX1 == screenX) {
+                    runX1 = screenX + tile.width;
+                } else {
+                    flushDirtyRun();
+                    runX0 = screenX;
+                    runX1 = screenX + tile.width;
+                    runH = tile.height;
+                }
+            }
+            flushDirtyRun();
+            flushSegment();
         }
     }
 
-    void Renderer::drawTileMap(const TileMap4bpp& map, int originX, int originY, LayerType layerType) {
-        if constexpr (pixelroot32::platforms::config::Enable4BppSprites) {
-            if (map.indices == nullptr || map.tiles == nullptr ||
+    void Renderer::drawTileMap(const TileMap2bpp& map, int originX, int originY, LayerType layerType) {
+        if constexpr (pixelroot32::platforms::config::Enable2BppSprites) {
+        if (map.indices == nullptr || map.tiles == nullptr ||
             map.width == 0 || map.height == 0 ||
             map.tileWidth == 0 || map.tileHeight == 0 ||
             map.tileCount == 0) {
             return;
-            }
+        }
 
-            auto h = computeTilemapDirtyTracking(map, originX, originY, layerType);
+        if (isRecording()) {
+            recordTileRun(DrawCommandType::TileRun2bpp, map, originX, originY, layerType, Color::White);
+            return;
+        }
+
+        auto h = computeTilemapDirtyTracking(map, originX, originY, layerType);
 
+        if (framebufferPixels() != nullptr) {
+            rasterizeTileMap(map, layerType, h, screenRasterTarget(), true);
+        } else {
             // Palette Caching (tile palette + background palette slot)
-            uint16_t cachedLUT[16];
+            uint16_t cachedLUT[4];
             const Color* lastTilePalettePtr = nullptr;
-            const uint16_t* lastBackgroundPalettePtr = nullptr;
+            uint8_t lastPaletteSlot = 0xFF;
 
             for (int ty = h.startRow; ty < h.endRow; ++ty) {
                 int baseY = originY + ty * map.tileHeight;
@@ -1014,7 +1946,7 @@ namespace pixelroot32::graphics {
                     int baseX = originX + tx * map.tileWidth;
                     int cellIndex = rowIndexBase + tx;
                     uint8_t rawIndex = map.indices[cellIndex];
-                    uint8_t index    = rawIndex;
+                    uint8_t index   = rawIndex;
 
                     if (map.animManager) {
                         index = map.animManager->resolveFrame(rawIndex);
@@ -1045,27 +1977,123 @@ namespace pixelroot32::graphics {
                         }
                     }
 
-                    const Sprite4bpp& tile = map.tiles[index];
+                    const Sprite2bpp& tile = map.tiles[index];
 
                     // Per-cell background palette: use paletteIndices if present, else slot 0
-                    const uint16_t* palettePtr = (map.paletteIndices != nullptr)
-                        ? getBackgroundPaletteSlot(map.paletteIndices[cellIndex] & kTileCellPaletteMask)
-                        : getBackgroundPaletteSlot(0);
-                    
+                    const uint8_t paletteSlot = (map.paletteIndices != nullptr)
+                        ? static_cast<uint8_t>(map.paletteIndices[cellIndex] & kTileCellPaletteMask)
+                        : 0;
+                
                     // Rebuild LUT only when tile palette or background palette slot changes
-                    if (tile.palette != lastTilePalettePtr || palettePtr != lastBackgroundPalettePtr) {
-                        uint8_t paletteCount = tile.paletteSize > 16 ? 16 : tile.paletteSize;
-                        for (uint8_t i = 0; i < paletteCount; ++i) {
-                            cachedLUT[i] = resolveColorWithPalette(tile.palette[i], palettePtr);
-                        }
+                    if (tile.palette != lastTilePalettePtr || paletteSlot != lastPaletteSlot) {
+                        const uint8_t paletteCount = tile.paletteSize > 4 ? 4 : tile.paletteSize;
+                        buildSlotLUT(tile.palette, paletteCount, PaletteContext::Background, paletteSlot, cachedLUT);
                         lastTilePalettePtr = tile.palette;
-                        lastBackgroundPalettePtr = palettePtr;
+                        lastPaletteSlot = paletteSlot;
                     }
 
-                    // Use drawSpriteInternal - handles custom palettes correctly
+                    // Use original path - drawSpriteInternal handles custom palettes correctly
                     drawSpriteInternal(tile, baseX, baseY, cachedLUT, false);
                 }
             }
+        }
+
+        if (h.animSlot) {
+            h.animSlot->primed = true;
+            h.animSlot->mapKey = map.indices;
+            h.animSlot->ox     = h.viewOriginX;
+            h.animSlot->oy     = h.viewOriginY;
+        }
+
+        tilemapSpriteDirtyMode_ = h.savedMode;
+
+        setRenderContext(h.oldContext);
+        }
+    }
+
+    void Renderer::drawTileMap(const TileMap4bpp& map, int originX, int originY, LayerType layerType) {
+        if constexpr (pixelroot32::platforms::config::Enable4BppSprites) {
+            if (map.indices == nullptr || map.tiles == nullptr ||
+            map.width == 0 || map.height == 0 ||
+            map.tileWidth == 0 || map.tileHeight == 0 ||
+            map.tileCount == 0) {
+            return;
+            }
+
+            if (isRecording()) {
+                recordTileRun(DrawCommandType::TileRun4bpp, map, originX, originY, layerType, Color::White);
+                return;
+            }
+
+            auto h = computeTilemapDirtyTracking(map, originX, originY, layerType);
+
+            if (framebufferPixels() != nullptr) {
+                rasterizeTileMap(map, layerType, h, screenRasterTarget(), true);
+            } else {
+                // Palette Caching (tile palette + background palette slot)
+                uint16_t cachedLUT[16];
+                const Color* lastTilePalettePtr = nullptr;
+                uint8_t lastPaletteSlot = 0xFF;
+
+                for (int ty = h.startRow; ty < h.endRow; ++ty) {
+                    int baseY = originY + ty * map.tileHeight;
+                    int rowIndexBase = ty * map.width;
+
+                    for (int tx = h.startCol; tx < h.endCol; ++tx) {
+                        int baseX = originX + tx * map.tileWidth;
+                        int cellIndex = rowIndexBase + tx;
+                        uint8_t rawIndex = map.indices[cellIndex];
+                        uint8_t index    = rawIndex;
+
+                        if (map.animManager) {
+                            index = map.animManager->resolveFrame(rawIndex);
+                        }
+
+                        if (index == 0 || index >= map.tileCount) {
+                            continue;
+                        }
+
+                        if (map.runtimeMask) {
+                            if (!(map.runtimeMask[cellIndex >> 3] & (1 << (cellIndex & 7)))) {
+                                continue;
+                            }
+                        }
+
+                        if (layerType == LayerType::Dynamic) {
+                            bool markCell = true;
+                            if (map.animManager != nullptr) {
+                                markCell = h.mapOrOriginMovedAnim ||
+                                           map.animManager->animatedTileAppearanceChanged(rawIndex);
+                            }
+                            if (markCell) {
+                                if constexpr (pixelroot32::platforms::config::EnableDirtyRegions) {
+                                    const int pixelX = offsetBypass ? baseX : xOffset + baseX;
+                                    const int pixelY = offsetBypass ? baseY : yOffset + baseY;
+                                    dirtyGrid.markRect(pixelX, pixelY, map.tileWidth, map.tileHeight);
+                                }
+                            }
+                        }
+
+                        const Sprite4bpp& tile = map.tiles[index];
+
+                        // Per-cell background palette: use paletteIndices if present, else slot 0
+                        const uint8_t paletteSlot = (map.paletteIndices != nullptr)
+                            ? static_cast<uint8_t>(map.paletteIndices[cellIndex] & kTileCellPaletteMask)
+                            : 0;
+                    
+                        // Rebuild LUT only when tile palette or background palette slot changes
+                        if (tile.palette != lastTilePalettePtr || paletteSlot != lastPaletteSlot) {
+                            const uint8_t paletteCount = tile.paletteSize > 16 ? 16 : tile.paletteSize;
+                            buildSlotLUT(tile.palette, paletteCount, PaletteContext::Background, paletteSlot, cachedLUT);
+                            lastTilePalettePtr = tile.palette;
+                            lastPaletteSlot = paletteSlot;
+                        }
+
+                        // Use drawSpriteInternal - handles custom palettes correctly
+                        drawSpriteInternal(tile, baseX, baseY, cachedLUT, false);
+                    }
+                }
+            }
 
             if (h.animSlot) {
                 h.animSlot->primed = true;
@@ -1080,6 +2108,99 @@ namespace pixelroot32::graphics {
         }
     }
 
+    void Renderer::rasterizeTileMapRegion(const TileMap4bpp& map,
+                                          int destX,
+                                          int destY,
+                                          FramebufferPixel* target,
+                                          int targetStride,
+                                          int clipX0,
+                                          int clipY0,
+                                          int clipX1,
+                                          int clipY1) {
+        if constexpr (pixelroot32::platforms::config::Enable4BppSprites) {
+            if (target == nullptr || targetStride <= 0 || clipX1 <= clipX0 || clipY1 <= clipY0 ||
+                map.indices == nullptr || map.tiles == nullptr ||
+                map.width == 0 || map.height == 0 ||
+                map.tileWidth == 0 || map.tileHeight == 0 ||
+                map.tileCount == 0) {
+                return;
+            }
+
+            // Cull to the tiles overlapping the clip rectangle (no dirty tracking, no offsets).
+            TilemapDirtyTrackingHelper h;
+            h.viewOriginX = destX;
+            h.viewOriginY = destY;
+            h.startCol = (clipX0 > destX) ? (clipX0 - destX) / map.tileWidth : 0;
+            h.endCol   = (clipX1 > destX) ? (clipX1 - destX + map.tileWidth - 1) / map.tileWidth : 0;
+            h.startRow = (clipY0 > destY) ? (clipY0 - destY) / map.tileHeight : 0;
+            h.endRow   = (clipY1 > destY) ? (clipY1 - destY + map.tileHeight - 1) / map.tileHeight : 0;
+            if (h.endCol > map.width) h.endCol = map.width;
+            if (h.endRow > map.height) h.endRow = map.height;
+            if (h.startCol >= h.endCol || h.startRow >= h.endRow) {
+                return;
+            }
+
+            rasterizeTileMap(map, LayerType::Static, h,
+                             TileRasterTarget{target, targetStride, clipX0, clipY0, clipX1, clipY1}, false);
+        } else {
+            (void)map;
+            (void)destX;
+            (void)destY;
+            (void)target;
+            (void)targetStride;
+            (void)clipX0;
+            (void)clipY0;
+            (void)clipX1;
+            (void)clipY1;
+        }
+    }
+
+    uint16_t Renderer::surfaceColor(Color color, PaletteContext context) const {
+        if constexpr (pixelroot32::platforms::config::FramebufferIndexed) {
+            return rgb565CarrierForTftSprite8(paletteSlotIndex(context, 0, color));
+        } else {
+            return resolveColor(color, context);
+        }
+    }
+
+    uint16_t Renderer::surfaceColorRgb565(uint16_t rgb565) const {
+        if constexpr (pixelroot32::platforms::config::FramebufferIndexed) {
+            // No index for an arbitrary RGB565: snap to the nearest sprite slot 0 colour.
+            const uint16_t* palette = getSpritePaletteSlot(0);
+            uint8_t best = 0;
+            int bestDist = 0x7FFFFFFF;
+            for (uint8_t i = 0; i < PALETTE_SIZE; ++i) {
+                const int dr = ((palette[i] >> 11) & 0x1F) - ((rgb565 >> 11) & 0x1F);
+                const int dg = ((palette[i] >> 5) & 0x3F) - ((rgb565 >> 5) & 0x3F);
+                const int db = (palette[i] & 0x1F) - (rgb565 & 0x1F);
+                const int dist = 4 * dr * dr + dg * dg + 4 * db * db;
+                if (dist < bestDist) {
+                    bestDist = dist;
+                    best = i;
+                }
+            }
+            return surfaceColor(static_cast<Color>(best), PaletteContext::Sprite);
+        } else {
+            return rgb565;
+        }
+    }
+
+    void Renderer::buildSlotLUT(const Color* palette, uint8_t count, PaletteContext context, uint8_t slot, uint16_t* out) const {
+        if constexpr (pixelroot32::platforms::config::FramebufferIndexed) {
+            // Late resolution: only the slot-qualified index is stored, the driver LUT supplies the colour.
+            for (uint8_t i = 0; i < count; ++i) {
+                out[i] = rgb565CarrierForTftSprite8(paletteSlotIndex(context, slot, palette[i]));
+            }
+        } else {
+            const uint16_t* palettePtr = (context == PaletteContext::Background)
+                ? getBackgroundPaletteSlot(slot)
+                : getSpritePaletteSlot(slot);
+            for (uint8_t i = 0; i < count; ++i) {
+                out[i] = resolveColorWithPalette(palette[i], palettePtr);
+            }
+        }
+    }
+
     void Renderer::setSpritePaletteSlotContext(uint8_t slot) {
         currentSpritePaletteSlot = slot;
     }
@@ -4,6 +4,7 @@
  */
 #include "graphics/StaticTilemapLayerCache.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -47,6 +48,16 @@ bool hasAnyStaticMap(const TileMap4bppDrawSpec* staticLayers, std::size_t static
     }
     return false;
 }
+
+/** Floor division for ring coordinates (world positions may be negative). */
+int floorDiv(int a, int b) {
+    const int q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+bool sameLayerSpec(const TileMap4bppDrawSpec& a, const TileMap4bppDrawSpec& b) {
+    return a.map == b.map && a.originX == b.originX && a.originY == b.originY;
+}
 #endif
 
 } // namespace
@@ -70,7 +81,8 @@ bool StaticTilemapLayerCache::allocateForLogicalSize(int width, int height) {
         clear();
         return false;
     }
-    const std::size_t n = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+    const std::size_t n = static_cast<std::size_t>(width) * static_cast<std::size_t>(height) *
+                          sizeof(FramebufferPixel);
     if (cacheBytes && cacheByteCount == n) {
         invalidate();
         return true;
@@ -121,6 +133,155 @@ bool StaticTilemapLayerCache::isFramebufferCacheEnabled() const {
 #endif
 }
 
+void StaticTilemapLayerCache::setScrollingEnabled(bool enabled) {
+#if PIXELROOT32_ENABLE_STATIC_TILEMAP_FB_CACHE
+    if (scrollingEnabled == enabled) {
+        return;
+    }
+    scrollingEnabled = enabled;
+#else
+    (void)enabled;
+#endif
+}
+
+bool StaticTilemapLayerCache::isScrollingEnabled() const {
+#if PIXELROOT32_ENABLE_STATIC_TILEMAP_FB_CACHE
+    return scrollingEnabled;
+#else
+    return false;
+#endif
+}
+
+std::size_t StaticTilemapLayerCache::getLastRasterizedPixelCount() const {
+#if PIXELROOT32_ENABLE_STATIC_TILEMAP_FB_CACHE
+    return lastRasterizedPixels;
+#else
+    return 0;
+#endif
+}
+
+#if PIXELROOT32_ENABLE_STATIC_TILEMAP_FB_CACHE
+bool StaticTilemapLayerCache::canScroll(std::size_t staticLayerCount) const {
+    return scrollingEnabled && staticLayerCount <= kMaxScrollingStaticLayers;
+}
+
+void StaticTilemapLayerCache::rasterizeRingRegion(Renderer& renderer,
+                                                  const TileMap4bppDrawSpec* staticLayers,
+                                                  std::size_t staticLayerCount,
+                                                  int x0,
+                                                  int y0,
+                                                  int x1,
+                                                  int y1) {
+    FramebufferPixel* const ring = reinterpret_cast<FramebufferPixel*>(cacheBytes.get());
+    // A world rect narrower than the ring touches at most two wraps per axis.
+    for (int wy = y0; wy < y1;) {
+        const int ky = floorDiv(wy, ringHeight);
+        const int wyEnd = std::min(y1, (ky + 1) * ringHeight);
+        const int ry0 = wy - ky * ringHeight;
+        const int ry1 = wyEnd - ky * ringHeight;
+        for (int wx = x0; wx < x1;) {
+            const int kx = floorDiv(wx, ringWidth);
+            const int wxEnd = std::min(x1, (kx + 1) * ringWidth);
+            const int rx0 = wx - kx * ringWidth;
+            const int rx1 = wxEnd - kx * ringWidth;
+
+            // Same clear value as Renderer::beginFrame, so the ring matches a direct draw.
+            for (int ry = ry0; ry < ry1; ++ry) {
+                fillFramebufferSpan(ring + ry * ringWidth + rx0, 0, rx1 - rx0);
+            }
+            for (std::size_t i = 0; i < staticLayerCount; ++i) {
+                const TileMap4bpp* m = staticLayers[i].map;
+                if (!m) {
+                    continue;
+                }
+                renderer.rasterizeTileMapRegion(*m,
+                                                staticLayers[i].originX - kx * ringWidth,
+                                                staticLayers[i].originY - ky * ringHeight,
+                                                ring, ringWidth, rx0, ry0, rx1, ry1);
+            }
+            lastRasterizedPixels += static_cast<std::size_t>(rx1 - rx0) * static_cast<std::size_t>(ry1 - ry0);
+            wx = wxEnd;
+        }
+        wy = wyEnd;
+    }
+}
+
+void StaticTilemapLayerCache::drawScrollingStaticLayers(Renderer& renderer,
+                                                        FramebufferPixel* fb,
+                                                        const TileMap4bppDrawSpec* staticLayers,
+                                                        std::size_t staticLayerCount) {
+    const int w = renderer.getLogicalWidth();
+    const int h = renderer.getLogicalHeight();
+    // World position of the screen's top-left pixel, as drawTileMap would place the layers.
+    const int viewX = renderer.isOffsetBypassEnabled() ? 0 : -renderer.getXOffset();
+    const int viewY = renderer.isOffsetBypassEnabled() ? 0 : -renderer.getYOffset();
+
+    bool layersChanged = (staticLayerCount != ringLayerCount);
+    for (std::size_t i = 0; !layersChanged && i < staticLayerCount; ++i) {
+        layersChanged = !sameLayerSpec(staticLayers[i], ringLayers[i]);
+    }
+
+    const int dx = viewX - ringViewX;
+    const int dy = viewY - ringViewY;
+    const bool fullRebuild = !cacheValid || userInvalidated || !cacheHoldsRing || layersChanged ||
+                             ringWidth != w || ringHeight != h ||
+                             dx <= -w || dx >= w || dy <= -h || dy >= h;
+
+    if (fullRebuild) {
+        ringWidth = w;
+        ringHeight = h;
+        for (std::size_t i = 0; i < staticLayerCount; ++i) {
+            ringLayers[i] = staticLayers[i];
+        }
+        ringLayerCount = staticLayerCount;
+        rasterizeRingRegion(renderer, staticLayers, staticLayerCount, viewX, viewY, viewX + w, viewY + h);
+    } else {
+        // Newly exposed columns (full new height), then rows (remaining width): an L-shaped strip.
+        if (dx != 0) {
+            const int x0 = dx > 0 ? ringViewX + w : viewX;
+            const int x1 = dx > 0 ? viewX + w : ringViewX;
+            rasterizeRingRegion(renderer, staticLayers, staticLayerCount, x0, viewY, x1, viewY + h);
+        }
+        if (dy != 0) {
+            const int y0 = dy > 0 ? ringViewY + h : viewY;
+            const int y1 = dy > 0 ? viewY + h : ringViewY;
+            const int x0 = std::max(viewX, ringViewX);
+            const int x1 = std::min(viewX + w, ringViewX + w);
+            rasterizeRingRegion(renderer, staticLayers, staticLayerCount, x0, y0, x1, y1);
+        }
+    }
+
+    if (fullRebuild || dx != 0 || dy != 0) {
+        // Every screen pixel may have moved; dirty cells do not describe a scroll.
+        renderer.requestFullPresent();
+    }
+    ringViewX = viewX;
+    ringViewY = viewY;
+    cacheHoldsRing = true;
+    cacheValid = true;
+    userInvalidated = false;
+
+    // Visible window: each scanline is the ring row's tail from the wrap column, then its head.
+    const FramebufferPixel* const ring = reinterpret_cast<const FramebufferPixel*>(cacheBytes.get());
+    const int rx = viewX - floorDiv(viewX, w) * w;
+    const int ryStart = viewY - floorDiv(viewY, h) * h;
+    const std::size_t tailBytes = static_cast<std::size_t>(w - rx) * sizeof(FramebufferPixel);
+    const std::size_t headBytes = static_cast<std::size_t>(rx) * sizeof(FramebufferPixel);
+    int ry = ryStart;
+    for (int y = 0; y < h; ++y) {
+        const FramebufferPixel* src = ring + ry * w;
+        FramebufferPixel* dst = fb + y * w;
+        std::memcpy(dst, src + rx, tailBytes);
+        if (headBytes != 0) {
+            std::memcpy(dst + (w - rx), src, headBytes);
+        }
+        if (++ry == h) {
+            ry = 0;
+        }
+    }
+}
+#endif
+
 #if PIXELROOT32_ENABLE_STATIC_TILEMAP_FB_CACHE
 bool StaticTilemapLayerCache::wouldRestoreFramebufferViaCacheMemcpy(Renderer& renderer,
                                                                     int cameraSampleX,
@@ -136,12 +297,16 @@ bool StaticTilemapLayerCache::wouldRestoreFramebufferViaCacheMemcpy(Renderer& re
     uint8_t* fb = renderer.getDrawSurface().getSpriteBuffer();
     const int w = renderer.getLogicalWidth();
     const int h = renderer.getLogicalHeight();
-    const std::size_t bufBytes = static_cast<std::size_t>(w) * static_cast<std::size_t>(h);
+    const std::size_t bufBytes = static_cast<std::size_t>(w) * static_cast<std::size_t>(h) * sizeof(FramebufferPixel);
     if (!fb || !cacheBytes || cacheByteCount != bufBytes) {
         return false;
     }
+    if (canScroll(staticLayerCount)) {
+        // The ring blit always covers the whole framebuffer, rebuilt or not.
+        return true;
+    }
     const bool camMoved = (cameraSampleX != lastCameraX || cameraSampleY != lastCameraY);
-    const bool needRebuild = !cacheValid || camMoved || userInvalidated;
+    const bool needRebuild = !cacheValid || cacheHoldsRing || camMoved || userInvalidated;
     return !needRebuild;
 }
 #endif
@@ -205,22 +370,36 @@ void StaticTilemapLayerCache::draw(Renderer& renderer,
     uint8_t* fb = renderer.getDrawSurface().getSpriteBuffer();
     const int w = renderer.getLogicalWidth();
     const int h = renderer.getLogicalHeight();
-    const std::size_t bufBytes = static_cast<std::size_t>(w) * static_cast<std::size_t>(h);
+    const std::size_t bufBytes = static_cast<std::size_t>(w) * static_cast<std::size_t>(h) * sizeof(FramebufferPixel);
 
     if (!fb || !cacheBytes || cacheByteCount != bufBytes) {
         drawAllLayers(renderer, staticLayers, staticLayerCount, dynamicLayers, dynamicLayerCount);
         return;
     }
 
+    // The cache reads and writes the framebuffer directly: pending recorded commands go first.
+    renderer.flushDisplayList();
+    lastRasterizedPixels = 0;
+    if (canScroll(staticLayerCount)) {
+        drawScrollingStaticLayers(renderer, reinterpret_cast<FramebufferPixel*>(fb), staticLayers, staticLayerCount);
+        drawSpecs(renderer, dynamicLayers, dynamicLayerCount, LayerType::Dynamic);
+        return;
+    }
+
     const bool camMoved = (cameraSampleX != lastCameraX || cameraSampleY != lastCameraY);
-    const bool needRebuild = !cacheValid || camMoved || userInvalidated;
+    const bool needRebuild = !cacheValid || cacheHoldsRing || camMoved || userInvalidated;
 
     if (needRebuild) {
+        // Static pixels may differ everywhere (invalidate(), first build); not covered by dirty cells.
+        renderer.requestFullPresent();
         drawSpecs(renderer, staticLayers, staticLayerCount, LayerType::Static);
+        renderer.flushDisplayList();
         std::memcpy(cacheBytes.get(), fb, bufBytes);
+        lastRasterizedPixels = static_cast<std::size_t>(w) * static_cast<std::size_t>(h);
         drawSpecs(renderer, dynamicLayers, dynamicLayerCount, LayerType::Dynamic);
         lastCameraX = cameraSampleX;
         lastCameraY = cameraSampleY;
+        cacheHoldsRing = false;
         cacheValid = true;
         userInvalidated = false;
     } else {
@@ -6,11 +6,13 @@
  * Licensed under the MIT License
  */
 #include "graphics/particles/ParticleEmitter.h"
+#include "graphics/particles/ParticlePool.h"
 #include "graphics/Renderer.h"
 #include "graphics/Color.h"
 #include <cmath>
 #include "core/Engine.h"
 #include <math/MathUtil.h>
+#include "math/BatchMath.h"
 
 namespace pr32 = pixelroot32;
 
@@ -28,6 +30,7 @@ namespace pixelroot32::graphics::particles {
     using math::toScalar;
     using math::kDegToRad;
     using math::Fixed16;
+    using math::max;
     using gfx::Renderer;
     using core::EntityType;
 
@@ -74,6 +77,45 @@ namespace pixelroot32::graphics::particles {
             if (min >= max) return min;
             return min + (fastRand() % (max - min + 1));
         }
+
+        /// Config speeds, gravity and lifetimes are per 60 Hz reference frame.
+        const Scalar kFramesPerMs = toScalar(0.06f);
+        /// Particles this far outside the camera view are killed.
+        constexpr int kCullMargin = 8;
+        constexpr uint8_t kParticleSize = 2;
+        constexpr int kRampSteps = Renderer::kPointBatchMaxColors;
+
+        // One emitter's visible particles, handed to Renderer::drawPointBatch in a single call.
+        int16_t s_drawX[ParticlePool::kCapacity];
+        int16_t s_drawY[ParticlePool::kCapacity];
+        uint8_t s_drawShade[ParticlePool::kCapacity];
+
+        /// Replaces particle @p i with the last live one, @p last.
+        inline void killParticle(ParticleBlock& b, int i, int last) {
+            b.posX[i] = b.posX[last];
+            b.posY[i] = b.posY[last];
+            b.velX[i] = b.velX[last];
+            b.velY[i] = b.velY[last];
+            b.age[i] = b.age[last];
+            b.ageRate[i] = b.ageRate[last];
+        }
+
+        /// Linear interpolation between two RGB565 colours (@p t in [0, 1]).
+        inline uint16_t lerpColor(uint16_t c1, uint16_t c2, Scalar t) {
+            uint8_t r1 = (c1 >> 11) & 0x1F;
+            uint8_t g1 = (c1 >> 5)  & 0x3F;
+            uint8_t b1 = c1 & 0x1F;
+
+            uint8_t r2 = (c2 >> 11) & 0x1F;
+            uint8_t g2 = (c2 >> 5)  & 0x3F;
+            uint8_t b2 = c2 & 0x1F;
+
+            uint8_t r = static_cast<uint8_t>(static_cast<int>(toScalar(r1) + toScalar(r2 - r1) * t));
+            uint8_t g = static_cast<uint8_t>(static_cast<int>(toScalar(g1) + toScalar(g2 - g1) * t));
+            uint8_t b = static_cast<uint8_t>(static_cast<int>(toScalar(b1) + toScalar(b2 - b1) * t));
+
+            return (r << 11) | (g << 5) | b;
+        }
     }
 
     ParticleEmitter::ParticleEmitter(Vector2 position, const ParticleConfig& cfg)
@@ -83,93 +125,145 @@ namespace pixelroot32::graphics::particles {
              s_rngState = (uint32_t)((uintptr_t)this + 12345); 
     }
 
-    void ParticleEmitter::update(unsigned long deltaTime) {
-        (void)deltaTime;
-
-        int screenW = engine.getRenderer().getLogicalWidth();
-        int screenH = engine.getRenderer().getLogicalHeight();
-
-        for (int i = 0; i < maxParticles; i++) {
-            Particle& p = particles[i];
-            if (!p.active) continue;
-
-            // Early culling: skip physics calculation if particle is already out of bounds
-            // This avoids unnecessary math for particles that will be deactivated anyway
-            if (p.position.x < -2 || p.position.x > screenW + 2 || 
-                p.position.y < -2 || p.position.y > screenH + 2) {
-                p.active = false;
-                continue;
-            }
-
-            p.position += p.velocity;
+    ParticleEmitter::~ParticleEmitter() {
+        clear();
+    }
 
-            p.velocity.y += config.gravity;
-            p.velocity *= config.friction;
+    void ParticleEmitter::clear() {
+        ParticlePool& pool = ParticlePool::shared();
+        while (firstBlock >= 0) {
+            const int16_t index = firstBlock;
+            firstBlock = pool.block(index).next;
+            pool.release(index);
+        }
+        activeCount = 0;
+    }
 
-            if (p.position.x < 0 || p.position.x > screenW || p.position.y < 0 || p.position.y > screenH) {
-                p.active = false;
-                continue;
+    void ParticleEmitter::update(unsigned long deltaTime) {
+        if (firstBlock < 0) return;
+
+        // Config values are per reference frame; scale them by the frames this update covers.
+        const Scalar step = toScalar(static_cast<int>(deltaTime)) * kFramesPerMs;
+        const Scalar gravityStep = config.gravity * step;
+        const Scalar damping = max(toScalar(0), toScalar(1) - (toScalar(1) - config.friction) * step);
+
+        // Cull in world space against the camera view (the renderer offset is -camera).
+        const Renderer& renderer = engine.getRenderer();
+        const Scalar minX = toScalar(-renderer.getXOffset() - kCullMargin);
+        const Scalar minY = toScalar(-renderer.getYOffset() - kCullMargin);
+        const Scalar maxX = toScalar(-renderer.getXOffset() + renderer.getLogicalWidth() + kCullMargin);
+        const Scalar maxY = toScalar(-renderer.getYOffset() + renderer.getLogicalHeight() + kCullMargin);
+
+        ParticlePool& pool = ParticlePool::shared();
+        int16_t* link = &firstBlock;
+        while (*link >= 0) {
+            ParticleBlock& b = pool.block(*link);
+            int n = b.count;
+            math::batch::integratePositions(b.posX, b.posY, b.velX, b.velY, step, n);
+            math::batch::axpy(b.age, b.ageRate, step, n);
+            math::batch::scale(b.velX, damping, n);
+            for (int i = 0; i < n; i++) {
+                b.velY[i] = (b.velY[i] + gravityStep) * damping;
             }
 
-            if (p.life > 0) {
-                p.life--;
-
-                if (config.fadeColor) {
-                    Scalar t = toScalar(1) - (toScalar(p.life) / toScalar(p.maxLife));
-                    p.color = lerpColor(resolveColor(p.startColor), resolveColor(p.endColor), t);
+            // Points against the view box; walking backwards, the particle swapped into a dead
+            // slot has already been checked.
+            uint8_t inView[ParticleBlock::kCapacity];
+            math::batch::aabbOverlapMask(b.posX, b.posY, b.posX, b.posY, n, minX, minY, maxX, maxY, inView);
+            for (int i = n - 1; i >= 0; i--) {
+                if (!inView[i] || b.age[i] >= toScalar(1)) {
+                    killParticle(b, i, --n);
                 }
+            }
+            activeCount -= b.count - n;
+            b.count = static_cast<uint8_t>(n);
 
+            if (n == 0) {
+                const int16_t index = *link;
+                *link = b.next;
+                pool.release(index);
             } else {
-                p.active = false;
+                link = &b.next;
             }
         }
     }
 
     void ParticleEmitter::draw(Renderer& renderer) {
-        int screenW = renderer.getLogicalWidth();
-        int screenH = renderer.getLogicalHeight();
-
-        for (int i = 0; i < maxParticles; i++) {
-            Particle& p = particles[i]; 
-            if (!p.active) continue;
-            
-            int px = static_cast<int>(p.position.x);
-            int py = static_cast<int>(p.position.y);
-
-            // Culling: skip particles outside viewport (with 2px margin for 2x2 particles)
-            if (px < -2 || px >= screenW || py < -2 || py >= screenH) {
-                continue;
+        if (activeCount == 0) return;
+
+        // Colour ramp shared by all particles; the age picks the entry.
+        uint16_t ramp[kRampSteps];
+        const uint16_t startColor = resolveColor(config.startColor);
+        uint8_t rampSize = 1;
+        ramp[0] = startColor;
+        if (config.fadeColor) {
+            const uint16_t endColor = resolveColor(config.endColor);
+            rampSize = kRampSteps;
+            for (int k = 0; k < kRampSteps; k++) {
+                ramp[k] = lerpColor(startColor, endColor, toScalar(k) / toScalar(kRampSteps - 1));
             }
-            
-            renderer.drawFilledRectangleW(px, py, 2, 2, p.color);
         }
+        const Scalar rampScale = toScalar(static_cast<int>(rampSize));
+
+        const int minX = -renderer.getXOffset() - kParticleSize;
+        const int minY = -renderer.getYOffset() - kParticleSize;
+        const int maxX = -renderer.getXOffset() + renderer.getLogicalWidth();
+        const int maxY = -renderer.getYOffset() + renderer.getLogicalHeight();
+
+        const ParticlePool& pool = ParticlePool::shared();
+        int n = 0;
+        for (int16_t index = firstBlock; index >= 0; index = pool.block(index).next) {
+            const ParticleBlock& b = pool.block(index);
+            for (int i = 0; i < b.count; i++) {
+                const int px = static_cast<int>(b.posX[i]);
+                const int py = static_cast<int>(b.posY[i]);
+                if (px <= minX || px >= maxX || py <= minY || py >= maxY) continue;
+                int shade = static_cast<int>(b.age[i] * rampScale);
+                if (shade >= rampSize) shade = rampSize - 1;
+                s_drawX[n] = static_cast<int16_t>(px);
+                s_drawY[n] = static_cast<int16_t>(py);
+                s_drawShade[n] = static_cast<uint8_t>(shade);
+                n++;
+            }
+        }
+        renderer.drawPointBatch(s_drawX, s_drawY, s_drawShade, n, ramp, rampSize, kParticleSize);
     }
 
     void ParticleEmitter::burst(Vector2 position, int count) {
-        int activated = 0;
-
-        for (int i = 0; i < maxParticles && activated < count; i++) {
-            Particle& p = particles[i];
-            if (p.active) continue;
-
-            p.active = true;
-            p.position = position;
-
-            Scalar angleDeg = fastRandScalar(config.minAngleDeg, config.maxAngleDeg);
-            Scalar angle = angleDeg * kDegToRad;
-            Scalar speed = fastRandScalar(config.minSpeed, config.maxSpeed);
+        ParticlePool& pool = ParticlePool::shared();
+
+        // Top up this emitter's blocks first, then take new ones from the pool.
+        int16_t index = firstBlock;
+        while (count > 0) {
+            const bool fresh = index < 0;
+            if (fresh) {
+                index = pool.acquire();
+                if (index < 0) break;
+                pool.block(index).next = firstBlock;
+                firstBlock = index;
+            }
+            ParticleBlock& b = pool.block(index);
+            while (count > 0 && b.count < ParticleBlock::kCapacity) {
+                const int i = b.count++;
 
-            p.velocity.x = cos(angle) * speed;
-            p.velocity.y = sin(angle) * speed;
+                Scalar angleDeg = fastRandScalar(config.minAngleDeg, config.maxAngleDeg);
+                Scalar angle = angleDeg * kDegToRad;
+                Scalar speed = fastRandScalar(config.minSpeed, config.maxSpeed);
 
-            p.maxLife = fastRandInt(config.minLife, config.maxLife);
-            p.life = p.maxLife;
+                b.posX[i] = position.x;
+                b.posY[i] = position.y;
+                b.velX[i] = cos(angle) * speed;
+                b.velY[i] = sin(angle) * speed;
 
-            p.startColor = config.startColor;
-            p.endColor   = config.endColor;
-            p.color      = resolveColor(config.startColor);
+                const int life = fastRandInt(config.minLife, config.maxLife);
+                b.age[i] = toScalar(0);
+                b.ageRate[i] = toScalar(1) / toScalar(life > 0 ? life : 1);
 
-            activated++;
+                activeCount++;
+                count--;
+            }
+            // A fresh block is filled up when it runs out; its successors are already full.
+            index = fresh ? -1 : b.next;
         }
     }
 }
@@ -0,0 +1,45 @@
+#include "core/EngineModules.h"
+#if PIXELROOT32_ENABLE_PARTICLES
+
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#include "graphics/particles/ParticlePool.h"
+
+namespace pixelroot32::graphics::particles {
+
+    ParticlePool::ParticlePool() {
+        for (int i = kBlockCount - 1; i >= 0; --i) {
+            release(static_cast<int16_t>(i));
+        }
+    }
+
+    ParticlePool& ParticlePool::shared() {
+        static ParticlePool pool;
+        return pool;
+    }
+
+    int16_t ParticlePool::acquire() {
+        const int16_t index = freeHead;
+        if (index < 0) {
+            return -1;
+        }
+        ParticleBlock& b = blocks[index];
+        freeHead = b.next;
+        --freeCount;
+        b.count = 0;
+        b.next = -1;
+        return index;
+    }
+
+    void ParticlePool::release(int16_t index) {
+        ParticleBlock& b = blocks[index];
+        b.count = 0;
+        b.next = freeHead;
+        freeHead = index;
+        ++freeCount;
+    }
+}
+
+#endif // PIXELROOT32_ENABLE_PARTICLES
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#include "math/BatchMath.h"
+
+#include <cmath>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define PR32_BATCH_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define PR32_BATCH_NEON 1
+#if defined(__aarch64__)
+#define PR32_BATCH_NEON_DIV 1  // vsqrtq_f32 / vdivq_f32 are AArch64 only
+#endif
+#endif
+
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+namespace pixelroot32::math::batch {
+
+namespace {
+
+/// Raw Fixed16 product, as Fixed16::operator*.
+inline int32_t mulRaw(int32_t a, int32_t b) {
+    return static_cast<int32_t>((static_cast<int64_t>(a) * b) >> Fixed16::FRACTIONAL_BITS);
+}
+
+/// Scalar tail of clampLength(), as Vector2::limit_length().
+inline void clampOne(float& x, float& y, float maxLen, float maxLenSq) {
+    const float lenSq = x * x + y * y;
+    if (lenSq > maxLenSq && lenSq > 0.0f) {
+        const float f = maxLen / std::sqrt(lenSq);
+        x = x * f;
+        y = y * f;
+    }
+}
+
+} // namespace
+
+// --------------------------------------------------
+// float
+// --------------------------------------------------
+
+void IRAM_ATTR axpy(float* __restrict y, const float* __restrict x, float a, int n) {
+    int i = 0;
+#if defined(PR32_BATCH_SSE2)
+    const __m128 va = _mm_set1_ps(a);
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(_mm_loadu_ps(x + i), va)));
+    }
+#elif defined(PR32_BATCH_NEON)
+    const float32x4_t va = vdupq_n_f32(a);
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(y + i, vaddq_f32(vld1q_f32(y + i), vmulq_f32(vld1q_f32(x + i), va)));
+    }
+#endif
+    for (; i < n; i++) {
+        y[i] = y[i] + x[i] * a;
+    }
+}
+
+void IRAM_ATTR scale(float* __restrict x, float s, int n) {
+    int i = 0;
+#if defined(PR32_BATCH_SSE2)
+    const __m128 vs = _mm_set1_ps(s);
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(x + i, _mm_mul_ps(_mm_loadu_ps(x + i), vs));
+    }
+#elif defined(PR32_BATCH_NEON)
+    const float32x4_t vs = vdupq_n_f32(s);
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(x + i, vmulq_f32(vld1q_f32(x + i), vs));
+    }
+#endif
+    for (; i < n; i++) {
+        x[i] = x[i] * s;
+    }
+}
+
+void IRAM_ATTR clampLength(float* __restrict x, float* __restrict y, float maxLen, int n) {
+    const float maxLenSq = maxLen * maxLen;
+    int i = 0;
+    // Lanes that are not clamped compute a factor too (possibly inf for a zero vector) and
+    // then keep their input through the select.
+#if defined(PR32_BATCH_SSE2)
+    const __m128 vMax = _mm_set1_ps(maxLen);
+    const __m128 vMaxSq = _mm_set1_ps(maxLenSq);
+    const __m128 vZero = _mm_setzero_ps();
+    for (; i + 4 <= n; i += 4) {
+        const __m128 vx = _mm_loadu_ps(x + i);
+        const __m128 vy = _mm_loadu_ps(y + i);
+        const __m128 lenSq = _mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy));
+        const __m128 clamp = _mm_and_ps(_mm_cmpgt_ps(lenSq, vMaxSq), _mm_cmpgt_ps(lenSq, vZero));
+        const __m128 f = _mm_div_ps(vMax, _mm_sqrt_ps(lenSq));
+        _mm_storeu_ps(x + i, _mm_or_ps(_mm_and_ps(clamp, _mm_mul_ps(vx, f)), _mm_andnot_ps(clamp, vx)));
+        _mm_storeu_ps(y + i, _mm_or_ps(_mm_and_ps(clamp, _mm_mul_ps(vy, f)), _mm_andnot_ps(clamp, vy)));
+    }
+#elif defined(PR32_BATCH_NEON_DIV)
+    const float32x4_t vMax = vdupq_n_f32(maxLen);
+    const float32x4_t vMaxSq = vdupq_n_f32(maxLenSq);
+    const float32x4_t vZero = vdupq_n_f32(0.0f);
+    for (; i + 4 <= n; i += 4) {
+        const float32x4_t vx = vld1q_f32(x + i);
+        const float32x4_t vy = vld1q_f32(y + i);
+        const float32x4_t lenSq = vaddq_f32(vmulq_f32(vx, vx), vmulq_f32(vy, vy));
+        const uint32x4_t clamp = vandq_u32(vcgtq_f32(lenSq, vMaxSq), vcgtq_f32(lenSq, vZero));
+        const float32x4_t f = vdivq_f32(vMax, vsqrtq_f32(lenSq));
+        vst1q_f32(x + i, vbslq_f32(clamp, vmulq_f32(vx, f), vx));
+        vst1q_f32(y + i, vbslq_f32(clamp, vmulq_f32(vy, f), vy));
+    }
+#endif
+    for (; i < n; i++) {
+        clampOne(x[i], y[i], maxLen, maxLenSq);
+    }
+}
+
+void IRAM_ATTR integratePositions(float* __restrict px, float* __restrict py,
+                                  const float* __restrict vx, const float* __restrict vy, float dt, int n) {
+    axpy(px, vx, dt, n);
+    axpy(py, vy, dt, n);
+}
+
+int IRAM_ATTR aabbOverlapMask(const float* minX, const float* minY, const float* maxX, const float* maxY, int n,
+                              float qMinX, float qMinY, float qMaxX, float qMaxY, uint8_t* __restrict mask) {
+    int hits = 0;
+    int i = 0;
+#if defined(PR32_BATCH_SSE2)
+    const __m128 qx0 = _mm_set1_ps(qMinX);
+    const __m128 qy0 = _mm_set1_ps(qMinY);
+    const __m128 qx1 = _mm_set1_ps(qMaxX);
+    const __m128 qy1 = _mm_set1_ps(qMaxY);
+    for (; i + 4 <= n; i += 4) {
+        const __m128 outside = _mm_or_ps(
+            _mm_or_ps(_mm_cmplt_ps(_mm_loadu_ps(maxX + i), qx0), _mm_cmpgt_ps(_mm_loadu_ps(minX + i), qx1)),
+            _mm_or_ps(_mm_cmplt_ps(_mm_loadu_ps(maxY + i), qy0), _mm_cmpgt_ps(_mm_loadu_ps(minY + i), qy1)));
+        const int bits = ~_mm_movemask_ps(outside) & 0xF;
+        for (int k = 0; k < 4; k++) {
+            mask[i + k] = static_cast<uint8_t>((bits >> k) & 1);
+        }
+        hits += __builtin_popcount(static_cast<unsigned>(bits));
+    }
+#elif defined(PR32_BATCH_NEON)
+    const float32x4_t qx0 = vdupq_n_f32(qMinX);
+    const float32x4_t qy0 = vdupq_n_f32(qMinY);
+    const float32x4_t qx1 = vdupq_n_f32(qMaxX);
+    const float32x4_t qy1 = vdupq_n_f32(qMaxY);
+    for (; i + 4 <= n; i += 4) {
+        const uint32x4_t outside = vorrq_u32(
+            vorrq_u32(vcltq_f32(vld1q_f32(maxX + i), qx0), vcgtq_f32(vld1q_f32(minX + i), qx1)),
+            vorrq_u32(vcltq_f32(vld1q_f32(maxY + i), qy0), vcgtq_f32(vld1q_f32(minY + i), qy1)));
+        uint32_t lanes[4];
+        vst1q_u32(lanes, vshrq_n_u32(vmvnq_u32(outside), 31));
+        for (int k = 0; k < 4; k++) {
+            mask[i + k] = static_cast<uint8_t>(lanes[k]);
+            hits += static_cast<int>(lanes[k]);
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        const bool overlap = !(maxX[i] < qMinX || minX[i] > qMaxX || maxY[i] < qMinY || minY[i] > qMaxY);
+        mask[i] = overlap ? 1 : 0;
+        hits += overlap ? 1 : 0;
+    }
+    return hits;
+}
+
+// --------------------------------------------------
+// Fixed16 (raw 32-bit values)
+// --------------------------------------------------
+
+void IRAM_ATTR axpy(Fixed16* __restrict y, const Fixed16* __restrict x, Fixed16 a, int n) {
+    const int32_t ar = a.raw;
+    for (int i = 0; i < n; i++) {
+        y[i].raw = y[i].raw + mulRaw(x[i].raw, ar);
+    }
+}
+
+void IRAM_ATTR scale(Fixed16* __restrict x, Fixed16 s, int n) {
+    const int32_t sr = s.raw;
+    for (int i = 0; i < n; i++) {
+        x[i].raw = mulRaw(x[i].raw, sr);
+    }
+}
+
+void IRAM_ATTR clampLength(Fixed16* __restrict x, Fixed16* __restrict y, Fixed16 maxLen, int n) {
+    const int32_t maxLenSq = mulRaw(maxLen.raw, maxLen.raw);
+    for (int i = 0; i < n; i++) {
+        const int32_t lenSq = mulRaw(x[i].raw, x[i].raw) + mulRaw(y[i].raw, y[i].raw);
+        if (lenSq > maxLenSq && lenSq > 0) {
+            const int32_t f = (maxLen / Fixed16::sqrt(Fixed16::fromRaw(lenSq))).raw;
+            x[i].raw = mulRaw(x[i].raw, f);
+            y[i].raw = mulRaw(y[i].raw, f);
+        }
+    }
+}
+
+void IRAM_ATTR integratePositions(Fixed16* __restrict px, Fixed16* __restrict py,
+                                  const Fixed16* __restrict vx, const Fixed16* __restrict vy, Fixed16 dt, int n) {
+    axpy(px, vx, dt, n);
+    axpy(py, vy, dt, n);
+}
+
+int IRAM_ATTR aabbOverlapMask(const Fixed16* minX, const Fixed16* minY, const Fixed16* maxX, const Fixed16* maxY, int n,
+                              Fixed16 qMinX, Fixed16 qMinY, Fixed16 qMaxX, Fixed16 qMaxY, uint8_t* __restrict mask) {
+    int hits = 0;
+    for (int i = 0; i < n; i++) {
+        const bool overlap = !(maxX[i].raw < qMinX.raw || minX[i].raw > qMaxX.raw ||
+                               maxY[i].raw < qMinY.raw || minY[i].raw > qMaxY.raw);
+        mask[i] = overlap ? 1 : 0;
+        hits += overlap ? 1 : 0;
+    }
+    return hits;
+}
+
+} // namespace pixelroot32::math::batch
@@ -10,8 +10,45 @@ namespace pixelroot32::physics {
 
 using pixelroot32::core::Rect;
 using pixelroot32::math::Scalar;
+using pixelroot32::math::Vector2;
 using pixelroot32::math::toScalar;
 
+namespace {
+
+/**
+ * Inclusive overlap window of a span [a0, a1] moving by d against a fixed span [b0, b1],
+ * clipped to t in [0, 1]. Gaps are compared against |d| before dividing so the times stay
+ * in range with Fixed16. @p entered is false when the spans already overlap at t = 0.
+ */
+bool sweepAxis(Scalar a0, Scalar a1, Scalar d, Scalar b0, Scalar b1,
+               Scalar& tIn, Scalar& tOut, bool& entered) {
+    const Scalar zero = toScalar(0.0f);
+    const Scalar one = toScalar(1.0f);
+    if (pixelroot32::math::abs(d) < pixelroot32::math::kEpsilon) {
+        tIn = zero;
+        tOut = one;
+        entered = false;
+        return !(a1 < b0 || a0 > b1);
+    }
+    Scalar gapIn;
+    Scalar gapOut;
+    if (d > zero) {
+        gapIn = b0 - a1;
+        gapOut = b1 - a0;
+    } else {
+        gapIn = a0 - b1;
+        gapOut = a1 - b0;
+        d = -d;
+    }
+    if (gapOut < zero || gapIn > d) return false;
+    entered = gapIn >= zero;
+    tIn = entered ? gapIn / d : zero;
+    tOut = gapOut >= d ? one : gapOut / d;
+    return true;
+}
+
+} // namespace
+
 bool intersects(const Circle& a, const Circle& b) {
     Scalar dx = a.x - b.x;
     Scalar dy = a.y - b.y;
@@ -158,4 +195,77 @@ bool sweepCircleVsRect(const Circle& start,
     return true;
 }
 
+bool sweepRectVsRect(const Rect& moving,
+                     const Vector2& motion,
+                     const Rect& target,
+                     Scalar& tHit,
+                     Vector2& normal) {
+    const Scalar ax0 = moving.position.x;
+    const Scalar ay0 = moving.position.y;
+    const Scalar ax1 = ax0 + toScalar(moving.width);
+    const Scalar ay1 = ay0 + toScalar(moving.height);
+    const Scalar bx0 = target.position.x;
+    const Scalar by0 = target.position.y;
+    const Scalar bx1 = bx0 + toScalar(target.width);
+    const Scalar by1 = by0 + toScalar(target.height);
+
+    Scalar txIn, txOut, tyIn, tyOut;
+    bool enteredX, enteredY;
+    if (!sweepAxis(ax0, ax1, motion.x, bx0, bx1, txIn, txOut, enteredX)) return false;
+    if (!sweepAxis(ay0, ay1, motion.y, by0, by1, tyIn, tyOut, enteredY)) return false;
+
+    const Scalar tEnter = txIn > tyIn ? txIn : tyIn;
+    const Scalar tExit = txOut < tyOut ? txOut : tyOut;
+    if (tEnter > tExit) return false;
+    tHit = tEnter;
+
+    const Scalar zero = toScalar(0.0f);
+    if (enteredX || enteredY) {
+        // Face entered last is the one that closes the gap; vertical wins ties (floors at corners).
+        if (enteredY && (!enteredX || tyIn >= txIn)) {
+            normal = Vector2(toScalar(0.0f), motion.y > zero ? toScalar(-1.0f) : toScalar(1.0f));
+        } else {
+            normal = Vector2(motion.x > zero ? toScalar(-1.0f) : toScalar(1.0f), toScalar(0.0f));
+        }
+        return true;
+    }
+
+    // Already touching or overlapping: push out along the axis of least penetration.
+    const Scalar distX = (ax0 + ax1) - (bx0 + bx1);
+    const Scalar distY = (ay0 + ay1) - (by0 + by1);
+    const Scalar overlapX = (ax1 - ax0) + (bx1 - bx0) - pixelroot32::math::abs(distX);
+    const Scalar overlapY = (ay1 - ay0) + (by1 - by0) - pixelroot32::math::abs(distY);
+    if (overlapX < overlapY) {
+        normal = Vector2(distX < zero ? toScalar(-1.0f) : toScalar(1.0f), toScalar(0.0f));
+    } else {
+        normal = Vector2(toScalar(0.0f), distY < zero ? toScalar(-1.0f) : toScalar(1.0f));
+    }
+    return true;
+}
+
+bool sweepCircleVsCircle(const Circle& moving,
+                         const Vector2& motion,
+                         const Circle& target,
+                         Scalar& tHit) {
+    const Scalar zero = toScalar(0.0f);
+    const Scalar dx = moving.x - target.x;
+    const Scalar dy = moving.y - target.y;
+    const Scalar r = moving.radius + target.radius;
+    const Scalar c = dx * dx + dy * dy - r * r;
+    if (c <= zero) {
+        tHit = zero;
+        return true;
+    }
+    // |d + motion * t| = r  ->  a t^2 + 2 b t + c = 0
+    const Scalar a = motion.x * motion.x + motion.y * motion.y;
+    const Scalar b = dx * motion.x + dy * motion.y;
+    if (b >= zero || a < pixelroot32::math::kEpsilon) return false;  // Not approaching
+    const Scalar disc = b * b - a * c;
+    if (disc < zero) return false;
+    const Scalar t = (-b - pixelroot32::math::sqrt(disc)) / a;
+    if (t < zero || t > toScalar(1.0f)) return false;
+    tHit = t;
+    return true;
+}
+
 }
@@ -8,11 +8,13 @@
  */
 #include "physics/CollisionSystem.h"
 #include "physics/RigidActor.h"
+#include "physics/PhysicsWorker.h"
 #include "core/Actor.h"
 #include "core/PhysicsActor.h"
 #include "math/MathUtil.h"
 #include <algorithm>
 #include <cassert>
+#include <new>
 
 #ifndef IRAM_ATTR
 #define IRAM_ATTR
@@ -36,6 +38,7 @@ namespace pixelroot32::physics {
     using math::min;
     using math::max;
     using math::clamp;
+    using math::abs;
 
     namespace {
         struct ScalarRect {
@@ -58,6 +61,7 @@ namespace pixelroot32::physics {
         }
         entities[entityCount++] = e;
         grid.markStaticDirty();
+        moversDirty = true;
     }
 
     void CollisionSystem::removeEntity(Entity* e) {
@@ -67,153 +71,384 @@ namespace pixelroot32::physics {
             if (entities[i] == e) {
                 entities[i] = entities[--entityCount];
                 grid.markStaticDirty();
+                moversDirty = true;
+                // Whatever rested on it must fall.
+                wakeAll();
                 return;
             }
         }
     }
 
     void CollisionSystem::update() {
-        // Store previous positions before integration
-        for (uint16_t i = 0; i < entityCount; i++) {
-            Entity* e = entities[i];
-            if (e->type == EntityType::ACTOR) {
-                Actor* actor = static_cast<Actor*>(e);
-                if (actor->isPhysicsBody()) {
-                    static_cast<PhysicsActor*>(actor)->updatePreviousPosition();
+        wakeIslands();
+
+        if (soaBodies) {
+            // Same pipeline over the body store: one pass over the actors in (which also
+            // stores previous positions), one out. In between, the narrowphase reads the store.
+            PIXELROOT32_PROFILE_BEGIN(Physics_IntegrateVelocity);
+            bodyStore.gather(entities, entityCount);
+            bodyStore.integrate(FIXED_DT);
+            bodiesInStore = true;
+            PIXELROOT32_PROFILE_END(Physics_IntegrateVelocity);
+
+            PIXELROOT32_PROFILE_BEGIN(Physics_DetectCollisions);
+            detectCollisions();
+            PIXELROOT32_PROFILE_END(Physics_DetectCollisions);
+            // The parallel island solve covers both solver passes.
+            PIXELROOT32_PROFILE_BEGIN(Physics_SolveVelocity);
+            const bool solved = solveIslandsParallel();
+            if (!solved) {
+                bodyStore.solveVelocity(contacts, contactCount);
+                cacheContactImpulses();
+            }
+            PIXELROOT32_PROFILE_END(Physics_SolveVelocity);
+            PIXELROOT32_PROFILE_BEGIN(Physics_SolvePenetration);
+            if (!solved) bodyStore.solvePenetration(contacts, contactCount);
+            bodyStore.writeBack();
+            bodiesInStore = false;
+            PIXELROOT32_PROFILE_END(Physics_SolvePenetration);
+        } else {
+            // Store previous positions before integration
+            for (uint16_t i = 0; i < entityCount; i++) {
+                Entity* e = entities[i];
+                if (e->type == EntityType::ACTOR) {
+                    Actor* actor = static_cast<Actor*>(e);
+                    if (actor->isPhysicsBody()) {
+                        static_cast<PhysicsActor*>(actor)->updatePreviousPosition();
+                    }
                 }
             }
-        }
-        
-        // Integrate velocities/forces FIRST (RigidActor::integrate updates velocity)
-        PIXELROOT32_PROFILE_BEGIN(Physics_IntegrateVelocity);
-        for (uint16_t i = 0; i < entityCount; i++) {
-            Entity* e = entities[i];
-            if (e->type != EntityType::ACTOR) continue;
-            Actor* actor = static_cast<Actor*>(e);
-            if (!actor->isPhysicsBody()) continue;
-            PhysicsActor* pa = static_cast<PhysicsActor*>(actor);
-            if (pa->getBodyType() == PhysicsBodyType::RIGID) {
-                // Cast to RigidActor to call its integrate (updates velocity from forces/gravity)
-                RigidActor* rigid = static_cast<RigidActor*>(pa);
-                rigid->integrate(FIXED_DT);
+
+            // Integrate velocities/forces FIRST (RigidActor::integrate updates velocity)
+            PIXELROOT32_PROFILE_BEGIN(Physics_IntegrateVelocity);
+            for (uint16_t i = 0; i < entityCount; i++) {
+                Entity* e = entities[i];
+                if (e->type != EntityType::ACTOR) continue;
+                Actor* actor = static_cast<Actor*>(e);
+                if (!actor->isPhysicsBody()) continue;
+                PhysicsActor* pa = static_cast<PhysicsActor*>(actor);
+                if (pa->getBodyType() == PhysicsBodyType::RIGID && !pa->isSleeping()) {
+                    // Cast to RigidActor to call its integrate (updates velocity from forces/gravity)
+                    RigidActor* rigid = static_cast<RigidActor*>(pa);
+                    rigid->integrate(FIXED_DT);
+                }
             }
+            PIXELROOT32_PROFILE_END(Physics_IntegrateVelocity);
+
+            // Integrate positions SECOND to enable spatial crossing detection
+            PIXELROOT32_PROFILE_BEGIN(Physics_IntegratePositions);
+            integratePositions();
+            PIXELROOT32_PROFILE_END(Physics_IntegratePositions);
+
+            // Then detect collisions using previous and current positions
+            PIXELROOT32_PROFILE_BEGIN(Physics_DetectCollisions);
+            detectCollisions();
+            PIXELROOT32_PROFILE_END(Physics_DetectCollisions);
+            PIXELROOT32_PROFILE_BEGIN(Physics_SolveVelocity);
+            const bool solved = solveIslandsParallel();
+            if (!solved) solveVelocity();
+            PIXELROOT32_PROFILE_END(Physics_SolveVelocity);
+            PIXELROOT32_PROFILE_BEGIN(Physics_SolvePenetration);
+            if (!solved) solvePenetration();
+            PIXELROOT32_PROFILE_END(Physics_SolvePenetration);
         }
-        PIXELROOT32_PROFILE_END(Physics_IntegrateVelocity);
-        
-        // Integrate positions SECOND to enable spatial crossing detection
-        PIXELROOT32_PROFILE_BEGIN(Physics_IntegratePositions);
-        integratePositions();
-        PIXELROOT32_PROFILE_END(Physics_IntegratePositions);
-        
-        // Then detect collisions using previous and current positions
-        PIXELROOT32_PROFILE_BEGIN(Physics_DetectCollisions);
-        detectCollisions();
-        PIXELROOT32_PROFILE_END(Physics_DetectCollisions);
-        PIXELROOT32_PROFILE_BEGIN(Physics_SolveVelocity);
-        solveVelocity();
-        PIXELROOT32_PROFILE_END(Physics_SolveVelocity);
-        PIXELROOT32_PROFILE_BEGIN(Physics_SolvePenetration);
-        solvePenetration();
-        PIXELROOT32_PROFILE_END(Physics_SolvePenetration);
         PIXELROOT32_PROFILE_BEGIN(Physics_TriggerCallbacks);
         triggerCallbacks();
         PIXELROOT32_PROFILE_END(Physics_TriggerCallbacks);
+        updateSleeping();
+    }
+
+    namespace {
+        /// Body types that can ever produce a contact (STATIC-STATIC and KINEMATIC-KINEMATIC never do).
+        inline bool pairable(const PhysicsActor* a, const PhysicsActor* b) {
+            const PhysicsBodyType ta = a->getBodyType();
+            const PhysicsBodyType tb = b->getBodyType();
+            if (ta == PhysicsBodyType::STATIC && tb == PhysicsBodyType::STATIC) return false;
+            if (ta == PhysicsBodyType::KINEMATIC && tb == PhysicsBodyType::KINEMATIC) return false;
+            return true;
+        }
+
+        /// Zero for STATIC, KINEMATIC and sleeping bodies: the solver does not move them.
+        inline Scalar inverseMass(const PhysicsActor* body) {
+            return (body->getBodyType() == PhysicsBodyType::RIGID && !body->isSleeping())
+                ? toScalar(1.0f) / body->getMass() : toScalar(0.0f);
+        }
+
+        /// Bodies that can push others: awake RIGID and KINEMATIC.
+        inline bool isActive(const PhysicsActor* body) {
+            return body->getBodyType() == PhysicsBodyType::KINEMATIC ||
+                   (body->getBodyType() == PhysicsBodyType::RIGID && !body->isSleeping());
+        }
+    }
+
+    inline Vector2 CollisionSystem::bodyPosition(const PhysicsActor* body) const {
+        return bodiesInStore ? bodyStore.position(body->solverIndex) : body->position;
+    }
+
+    inline Vector2 CollisionSystem::bodyVelocity(const PhysicsActor* body) const {
+        return bodiesInStore ? bodyStore.velocity(body->solverIndex) : body->getVelocity();
+    }
+
+    inline Rect CollisionSystem::bodyHitBox(PhysicsActor* body) const {
+        return bodiesInStore ? bodyStore.hitBox(body->solverIndex) : body->getHitBox();
+    }
+
+    inline Rect CollisionSystem::bodyHitBox(Actor* actor) const {
+        if (bodiesInStore && actor->isPhysicsBody()) return bodyHitBox(static_cast<PhysicsActor*>(actor));
+        return actor->getHitBox();
     }
 
     void IRAM_ATTR CollisionSystem::detectCollisions() {
         contactCount = 0;
-        grid.rebuildStaticIfNeeded(entities, entityCount);
-        grid.clearDynamic();
+        prepareQueries();
 
-        for (uint16_t i = 0; i < entityCount; i++) {
-            Entity* e = entities[i];
-            if (e->type != EntityType::ACTOR) continue;
-            Actor* actor = static_cast<Actor*>(e);
-            if (!actor->isPhysicsBody()) continue;
-            PhysicsActor* pa = static_cast<PhysicsActor*>(actor);
-            if (pa->getBodyType() != PhysicsBodyType::STATIC)
-                grid.insertDynamic(actor);
+        // Only bodies whose cell range changed touch the grid and regenerate their pairs.
+        movedBodies = 0;
+        pairsGenerated = 0;
+        for (uint16_t i = 0; i < moverCount; i++) {
+            if (grid.syncDynamic(movers[i], bodyHitBox(movers[i]))) {
+                movedBodies++;
+                if (pairsValid) refreshPairs(movers[i]);
+            }
         }
+        if (!pairsValid && !pairOverflow) rebuildPairs();
 
-        static Actor* potential[64];
-        
+        ContactBuffer out{contacts, 0};
+        if (pairsValid && pairCount >= kParallelMinWork && parallelReady()) {
+            collidePairsParallel();
+        } else if (pairsValid) {
+            for (int i = 0; i < pairCount; i++) {
+                collidePair(pairs[i].a, pairs[i].b, i, out);
+            }
+            contactCount = out.count;
+        } else {
+            // Too many pairs to keep: enumerate them from the grid, and retry the list once they fit.
+            int candidates = 0;
+            forEachCandidatePair([&](PhysicsActor* a, PhysicsActor* b) {
+                candidates++;
+                collidePair(a, b, -1, out);
+            });
+            pairsGenerated = static_cast<uint16_t>(candidates);
+            pairOverflow = candidates > kMaxPairs;
+            contactCount = out.count;
+        }
+        finishContacts();
+    }
+
+    void CollisionSystem::setWorker(PhysicsWorker* w) {
+        worker = w;
+        if (worker != nullptr && !parallel) {
+            parallel.reset(new (std::nothrow) ParallelScratch());
+        }
+    }
+
+    bool CollisionSystem::parallelReady() const {
+        return worker != nullptr && parallel && worker->isRunning();
+    }
+
+    void CollisionSystem::collidePairsParallel() {
+        // Each half writes its own buffer and its own pairs; the first half fills contacts directly.
+        const int split = pairCount / 2;
+        ContactBuffer halves[2] = {{contacts, 0}, {parallel->contacts, 0}};
+        auto job = [&](int half) {
+            const int begin = half == 0 ? 0 : split;
+            const int end = half == 0 ? split : pairCount;
+            for (int i = begin; i < end; i++) {
+                collidePair(pairs[i].a, pairs[i].b, i, halves[half]);
+            }
+        };
+        worker->run(job);
+
+        // Second half after the first: the serial loop's order, truncated where it would have stopped.
+        int count = halves[0].count;
+        for (int i = 0; i < halves[1].count && count < kMaxContacts; i++) {
+            contacts[count++] = parallel->contacts[i];
+        }
+        contactCount = count;
+    }
+
+    void CollisionSystem::finishContacts() {
+        // Wakes are deferred to here so the narrowphase never writes a body.
+        solverStats.cachedContacts = 0;
+        for (int i = 0; i < contactCount; ++i) {
+            const Contact& contact = contacts[i];
+            if (contact.normalImpulse > toScalar(0.0f)) solverStats.cachedContacts++;
+            if (contact.wakeA) {
+                contact.bodyA->wakeUp();
+                if (soaBodies) bodyStore.wake(contact.bodyA->solverIndex);
+            }
+            if (contact.wakeB) {
+                contact.bodyB->wakeUp();
+                if (soaBodies) bodyStore.wake(contact.bodyB->solverIndex);
+            }
+        }
+        solverStats.contacts = static_cast<uint16_t>(contactCount);
+    }
+
+    template <typename Fn>
+    void CollisionSystem::forEachCandidatePair(Fn&& fn) {
         for (uint16_t i = 0; i < entityCount; i++) {
             Entity* e = entities[i];
             if (e->type != EntityType::ACTOR) continue;
             Actor* actorA = static_cast<Actor*>(e);
             if (!actorA->isPhysicsBody()) continue;
-            // Skip invisible entities from collision detection
-            if (!actorA->isVisible) continue;
             PhysicsActor* pA = static_cast<PhysicsActor*>(actorA);
-            
+
             int count = 0;
-            grid.getPotentialColliders(actorA, potential, count, 64);
-            
-            for (int i = 0; i < count; ++i) {
-                Actor* actorB = potential[i];
-                // Skip invisible entities from collision detection
-                if (!actorB->isVisible) continue;
-                
+            grid.getPotentialColliders(actorA, bodyHitBox(pA), candidateScratch, count, kMaxCandidates);
+            for (int k = 0; k < count; ++k) {
+                Actor* actorB = candidateScratch[k];
                 // Deduplicate by entityId: process each pair once (A with smaller id).
                 if (actorA->entityId >= actorB->entityId) continue;
-                
                 if (!actorB->isPhysicsBody()) continue;
                 PhysicsActor* pB = static_cast<PhysicsActor*>(actorB);
-                
-                // STATIC vs STATIC: never generate contact.
-                if (pA->getBodyType() == PhysicsBodyType::STATIC &&
-                    pB->getBodyType() == PhysicsBodyType::STATIC) continue;
-                // KINEMATIC vs KINEMATIC: each resolves on its own.
-                if (pA->getBodyType() == PhysicsBodyType::KINEMATIC &&
-                    pB->getBodyType() == PhysicsBodyType::KINEMATIC) continue;
-                
-                // Layer/mask filter.
-                if (!(actorA->mask & actorB->layer) && !(actorB->mask & actorA->layer)) continue;
-                
-                // CCD path: fast RIGID circle vs STATIC AABB (only for this pair type).
-                PhysicsActor* moving = nullptr;
-                PhysicsActor* staticBody = nullptr;
-                if (pA->getBodyType() != PhysicsBodyType::STATIC && pB->getBodyType() == PhysicsBodyType::STATIC) {
-                    moving = pA;
-                    staticBody = pB;
-                } else if (pB->getBodyType() != PhysicsBodyType::STATIC && pA->getBodyType() == PhysicsBodyType::STATIC) {
-                    moving = pB;
-                    staticBody = pA;
-                }
-                if (moving && staticBody && needsCCD(moving) &&
-                    moving->getShape() == CollisionShape::CIRCLE &&
-                    staticBody->getShape() == CollisionShape::AABB) {
-                    Scalar hitTime;
-                    Vector2 hitNormal;
-                    if (sweptCircleVsAABB(moving, staticBody, hitTime, hitNormal)) {
-                        // One-way platform validation
-                        if (staticBody->isOneWay()) {
-                            if (!validateOneWayPlatform(moving, staticBody, hitNormal)) {
-                                continue;  // Skip this collision
-                            }
-                        }
-                        
-                        Contact contact;
-                        contact.bodyA = moving;
-                        contact.bodyB = staticBody;
-                        contact.normal = hitNormal;
-                        Scalar rA = moving->isBounce() ? moving->getRestitution() : toScalar(0.0f);
-                        Scalar rB = staticBody->isBounce() ? staticBody->getRestitution() : toScalar(0.0f);
-                        contact.restitution = min(rA, rB);
-                        contact.penetration = toScalar(0.01f);
-                        contact.contactPoint = moving->position + moving->getVelocity() * FIXED_DT * hitTime;
-                        contact.isSensorContact = moving->isSensor() || staticBody->isSensor();
-                        if (contactCount < kMaxContacts)
-                            contacts[contactCount++] = contact;
+                if (pairable(pA, pB)) fn(pA, pB);
+            }
+        }
+    }
+
+    Vector2 CollisionSystem::cachedImpulse(const CollisionPair* list, int count, const PhysicsActor* a, const PhysicsActor* b) {
+        for (int i = 0; i < count; i++) {
+            if (list[i].a == a && list[i].b == b) return list[i].impulse;
+        }
+        return Vector2(toScalar(0.0f), toScalar(0.0f));
+    }
+
+    void CollisionSystem::rebuildPairs() {
+        // Carry the contact cache over to the new list (previous pairs are only valid if the list was).
+        CollisionPair* previous = pairScratch;
+        const int previousCount = pairCount;
+        for (int i = 0; i < previousCount; i++) previous[i] = pairs[i];
+
+        pairCount = 0;
+        pairsValid = true;
+        forEachCandidatePair([&](PhysicsActor* a, PhysicsActor* b) {
+            pairsGenerated++;
+            if (!addPair(a, b, cachedImpulse(previous, previousCount, a, b))) pairsValid = false;
+        });
+        pairOverflow = !pairsValid;
+    }
+
+    void IRAM_ATTR CollisionSystem::refreshPairs(Actor* actor) {
+        if (!actor->isPhysicsBody()) return;
+        // Removed pairs keep their cached impulses in case the same partners pair up again.
+        CollisionPair* removed = pairScratch;
+        int removedCount = 0;
+        for (int i = 0; i < pairCount;) {
+            if (pairs[i].a == actor || pairs[i].b == actor) {
+                removed[removedCount++] = pairs[i];
+                pairs[i] = pairs[--pairCount];
+            } else {
+                i++;
+            }
+        }
+
+        PhysicsActor* self = static_cast<PhysicsActor*>(actor);
+        int count = 0;
+        grid.getPotentialColliders(actor, bodyHitBox(self), candidateScratch, count, kMaxCandidates);
+        for (int k = 0; k < count; ++k) {
+            Actor* other = candidateScratch[k];
+            if (!other->isPhysicsBody()) continue;
+            PhysicsActor* pOther = static_cast<PhysicsActor*>(other);
+            if (!pairable(self, pOther)) continue;
+            PhysicsActor* a = actor->entityId < other->entityId ? self : pOther;
+            PhysicsActor* b = a == self ? pOther : self;
+            pairsGenerated++;
+            const bool ok = addPair(a, b, cachedImpulse(removed, removedCount, a, b));
+            if (!ok) {
+                pairsValid = false;
+                return;
+            }
+        }
+    }
+
+    bool CollisionSystem::addPair(PhysicsActor* a, PhysicsActor* b, Vector2 impulse) {
+        if (pairCount >= kMaxPairs) return false;
+        pairs[pairCount++] = CollisionPair{a, b, impulse};
+        return true;
+    }
+
+    void IRAM_ATTR CollisionSystem::collidePair(PhysicsActor* pA, PhysicsActor* pB, int pairIndex, ContactBuffer& out) {
+        // Sleeping islands cost nothing: no awake body, no contact. Their pairs keep the
+        // cached impulse so the island wakes warm.
+        if (!isActive(pA) && !isActive(pB)) return;
+
+        // Skip invisible entities from collision detection
+        if (!pA->isVisible || !pB->isVisible) return;
+
+        // The cache only survives while the pair keeps producing a contact.
+        Vector2 cached;
+        if (pairIndex >= 0) {
+            cached = pairs[pairIndex].impulse;
+            pairs[pairIndex].impulse = Vector2(toScalar(0.0f), toScalar(0.0f));
+        }
+
+        const int before = out.count;
+        collidePairContacts(pA, pB, out);
+        if (out.count == before) return;
+
+        Contact& contact = out.data[out.count - 1];
+        if (contact.isSensorContact) return;
+        contact.pairIndex = static_cast<int16_t>(pairIndex);
+        if (warmStarting && pairIndex >= 0) {
+            const Vector2 onA = contact.bodyA == pairs[pairIndex].a ? cached : -cached;
+            const Scalar j = onA.dot(contact.normal);
+            if (j > toScalar(0.0f)) {
+                contact.normalImpulse = j;
+            }
+        }
+        // Touching an awake or kinematic body wakes a sleeper (its island follows next step).
+        contact.wakeA = contact.bodyA->isSleeping() && isActive(contact.bodyB);
+        contact.wakeB = contact.bodyB->isSleeping() && isActive(contact.bodyA);
+    }
+
+    void IRAM_ATTR CollisionSystem::collidePairContacts(PhysicsActor* pA, PhysicsActor* pB, ContactBuffer& out) {
+
+        // Layer/mask filter.
+        if (!(pA->mask & pB->layer) && !(pB->mask & pA->layer)) return;
+
+        // CCD path: fast RIGID circle vs STATIC AABB (only for this pair type).
+        PhysicsActor* moving = nullptr;
+        PhysicsActor* staticBody = nullptr;
+        if (pA->getBodyType() != PhysicsBodyType::STATIC && pB->getBodyType() == PhysicsBodyType::STATIC) {
+            moving = pA;
+            staticBody = pB;
+        } else if (pB->getBodyType() != PhysicsBodyType::STATIC && pA->getBodyType() == PhysicsBodyType::STATIC) {
+            moving = pB;
+            staticBody = pA;
+        }
+        if (moving && staticBody && needsCCD(moving) &&
+            moving->getShape() == CollisionShape::CIRCLE &&
+            staticBody->getShape() == CollisionShape::AABB) {
+            Scalar hitTime;
+            Vector2 hitNormal;
+            if (sweptCircleVsAABB(moving, staticBody, hitTime, hitNormal)) {
+                // One-way platform validation
+                if (staticBody->isOneWay()) {
+                    if (!validateOneWayPlatform(moving, staticBody, hitNormal)) {
+                        return;  // Skip this collision
                     }
-                } else {
-                    generateContact(pA, pB);
                 }
+
+                Contact contact;
+                contact.bodyA = moving;
+                contact.bodyB = staticBody;
+                contact.normal = hitNormal;
+                Scalar rA = moving->isBounce() ? moving->getRestitution() : toScalar(0.0f);
+                Scalar rB = staticBody->isBounce() ? staticBody->getRestitution() : toScalar(0.0f);
+                contact.restitution = min(rA, rB);
+                contact.penetration = toScalar(0.01f);
+                contact.contactPoint = bodyPosition(moving) + bodyVelocity(moving) * FIXED_DT * hitTime;
+                contact.isSensorContact = moving->isSensor() || staticBody->isSensor();
+                if (out.count < kMaxContacts)
+                    out.data[out.count++] = contact;
             }
+        } else {
+            generateContact(pA, pB, out);
         }
     }
 
-    bool CollisionSystem::generateContact(PhysicsActor* a, PhysicsActor* b) {
+    bool CollisionSystem::generateContact(PhysicsActor* a, PhysicsActor* b, ContactBuffer& out) {
         assert(a != nullptr && "generateContact: bodyA is null");
         assert(b != nullptr && "generateContact: bodyB is null");
         assert(a != b && "generateContact: bodyA and bodyB are the same actor");
@@ -250,8 +485,8 @@ namespace pixelroot32::physics {
         
         if (hit) {
             contact.isSensorContact = a->isSensor() || b->isSensor();
-            if (contactCount < kMaxContacts)
-                contacts[contactCount++] = contact;
+            if (out.count < kMaxContacts)
+                out.data[out.count++] = contact;
         }
         return hit;
     }
@@ -260,8 +495,8 @@ namespace pixelroot32::physics {
         PhysicsActor* pA = contact.bodyA;
         PhysicsActor* pB = contact.bodyB;
         
-        Vector2 centerA = pA->position + Vector2(pA->getRadius(), pA->getRadius());
-        Vector2 centerB = pB->position + Vector2(pB->getRadius(), pB->getRadius());
+        Vector2 centerA = bodyPosition(pA) + Vector2(pA->getRadius(), pA->getRadius());
+        Vector2 centerB = bodyPosition(pB) + Vector2(pB->getRadius(), pB->getRadius());
         Vector2 d = centerA - centerB;
         Scalar distSqr = d.lengthSquared();
         Scalar radiusSum = pA->getRadius() + pB->getRadius();
@@ -283,8 +518,8 @@ namespace pixelroot32::physics {
     }
     
     bool CollisionSystem::generateAABBVsAABBContact(Contact& contact) {
-        Rect rectA = contact.bodyA->getHitBox();
-        Rect rectB = contact.bodyB->getHitBox();
+        Rect rectA = bodyHitBox(contact.bodyA);
+        Rect rectB = bodyHitBox(contact.bodyB);
 
         if (!rectA.intersects(rectB)) {
             return false;
@@ -320,8 +555,8 @@ namespace pixelroot32::physics {
                                                        PhysicsActor* circle,
                                                        PhysicsActor* box) {
         Scalar r = circle->getRadius();
-        Vector2 centerC = circle->position + Vector2(r, r);
-        ScalarRect boxRec = ScalarRect::from(box->getHitBox());
+        Vector2 centerC = bodyPosition(circle) + Vector2(r, r);
+        ScalarRect boxRec = ScalarRect::from(bodyHitBox(box));
 
         Vector2 closestP = centerC;
         closestP.x = clamp(closestP.x, boxRec.x, boxRec.x + boxRec.w);
@@ -358,53 +593,80 @@ namespace pixelroot32::physics {
         return true;
     }
 
-    void IRAM_ATTR CollisionSystem::solveVelocity() {
+    void CollisionSystem::solveVelocity() {
+        solveVelocityContacts(nullptr, contactCount);
+        cacheContactImpulses();
+    }
+
+    void IRAM_ATTR CollisionSystem::solveVelocityContacts(const uint16_t* order, int count) {
+        // Prestep: restitution target from the approach velocity, then the cached impulse.
+        for (int i = 0; i < count; ++i) {
+            Contact& contact = contacts[order ? order[i] : i];
+            if (contact.isSensorContact) continue;
+
+            PhysicsActor* bodyA = contact.bodyA;
+            PhysicsActor* bodyB = contact.bodyB;
+            Scalar vn = (bodyA->getVelocity() - bodyB->getVelocity()).dot(contact.normal);
+            Scalar e = contact.restitution;
+            if (abs(vn) < VELOCITY_THRESHOLD) {
+                e = toScalar(0.0f);
+            }
+            contact.targetVelocity = vn < 0 ? -e * vn : toScalar(0.0f);
+
+            if (contact.normalImpulse > toScalar(0.0f)) {
+                Vector2 impulse = contact.normal * contact.normalImpulse;
+                Scalar invMassA = inverseMass(bodyA);
+                Scalar invMassB = inverseMass(bodyB);
+                if (invMassA > toScalar(0.0f)) bodyA->setVelocity(bodyA->getVelocity() + impulse * invMassA);
+                if (invMassB > toScalar(0.0f)) bodyB->setVelocity(bodyB->getVelocity() - impulse * invMassB);
+            }
+        }
+
+        // Sequential impulses, clamped on the accumulated impulse so later iterations can take some back.
         for (int iter = 0; iter < VELOCITY_ITERATIONS; iter++) {
-            for (int i = 0; i < contactCount; ++i) {
-                Contact& contact = contacts[i];
+            for (int i = 0; i < count; ++i) {
+                Contact& contact = contacts[order ? order[i] : i];
                 if (contact.isSensorContact) continue;
                 
                 PhysicsActor* bodyA = contact.bodyA;
                 PhysicsActor* bodyB = contact.bodyB;
                 
-                if (bodyA->getBodyType() == PhysicsBodyType::STATIC && 
-                    bodyB->getBodyType() == PhysicsBodyType::STATIC) {
-                    continue;
-                }
-                
-                Vector2 rv = bodyA->getVelocity() - bodyB->getVelocity();
-                Scalar vn = rv.dot(contact.normal);
-                
-                if (vn > 0) continue;
-                
-                Scalar invMassA = (bodyA->getBodyType() == PhysicsBodyType::RIGID) ? 
-                                 (toScalar(1.0f) / bodyA->getMass()) : toScalar(0.0f);
-                Scalar invMassB = (bodyB->getBodyType() == PhysicsBodyType::RIGID) ? 
-                                 (toScalar(1.0f) / bodyB->getMass()) : toScalar(0.0f);
-                
+                Scalar invMassA = inverseMass(bodyA);
+                Scalar invMassB = inverseMass(bodyB);
                 Scalar totalInvMass = invMassA + invMassB;
                 if (totalInvMass <= kEpsilon) continue;
                 
-                Scalar e = contact.restitution;
-                if (abs(vn) < VELOCITY_THRESHOLD) {
-                    e = toScalar(0.0f);
-                }
+                Vector2 rv = bodyA->getVelocity() - bodyB->getVelocity();
+                Scalar vn = rv.dot(contact.normal);
                 
-                Scalar j = -(toScalar(1.0f) + e) * vn;
-                j /= totalInvMass;
+                Scalar j = (contact.targetVelocity - vn) / totalInvMass;
+                Scalar previous = contact.normalImpulse;
+                contact.normalImpulse = max(previous + j, toScalar(0.0f));
+                j = contact.normalImpulse - previous;
+                if (j == toScalar(0.0f)) continue;
                 
                 Vector2 impulse = contact.normal * j;
                 
-                if (bodyA->getBodyType() == PhysicsBodyType::RIGID) {
+                if (invMassA > toScalar(0.0f)) {
                     bodyA->setVelocity(bodyA->getVelocity() + impulse * invMassA);
                 }
-                if (bodyB->getBodyType() == PhysicsBodyType::RIGID) {
+                if (invMassB > toScalar(0.0f)) {
                     bodyB->setVelocity(bodyB->getVelocity() - impulse * invMassB);
                 }
             }
         }
     }
 
+    void CollisionSystem::cacheContactImpulses() {
+        for (int i = 0; i < contactCount; ++i) {
+            const Contact& contact = contacts[i];
+            if (contact.pairIndex < 0) continue;
+            CollisionPair& pair = pairs[contact.pairIndex];
+            Vector2 onA = contact.normal * contact.normalImpulse;
+            pair.impulse = contact.bodyA == pair.a ? onA : -onA;
+        }
+    }
+
     void IRAM_ATTR CollisionSystem::integratePositions() {
         for (uint16_t i = 0; i < entityCount; i++) {
             Entity* e = entities[i];
@@ -413,7 +675,7 @@ namespace pixelroot32::physics {
             if (!actor->isPhysicsBody()) continue;
             
             PhysicsActor* pa = static_cast<PhysicsActor*>(actor);
-            if (pa->getBodyType() != PhysicsBodyType::RIGID) continue;
+            if (pa->getBodyType() != PhysicsBodyType::RIGID || pa->isSleeping()) continue;
             
             // v1.2.0 behavior: simple position integration using existing velocity
             // (velocity update happens in RigidActor::integrate() called by entity.update())
@@ -421,19 +683,21 @@ namespace pixelroot32::physics {
         }
     }
 
-    void IRAM_ATTR CollisionSystem::solvePenetration() {
-        for (int i = 0; i < contactCount; ++i) {
-            Contact& contact = contacts[i];
+    void CollisionSystem::solvePenetration() {
+        solvePenetrationContacts(nullptr, contactCount);
+    }
+
+    void IRAM_ATTR CollisionSystem::solvePenetrationContacts(const uint16_t* order, int count) {
+        for (int i = 0; i < count; ++i) {
+            Contact& contact = contacts[order ? order[i] : i];
             if (contact.isSensorContact) continue;
             if (contact.penetration <= SLOP) continue;
             
             PhysicsActor* bodyA = contact.bodyA;
             PhysicsActor* bodyB = contact.bodyB;
             
-            Scalar invMassA = (bodyA->getBodyType() == PhysicsBodyType::RIGID) ? 
-                             (toScalar(1.0f) / bodyA->getMass()) : toScalar(0.0f);
-            Scalar invMassB = (bodyB->getBodyType() == PhysicsBodyType::RIGID) ? 
-                             (toScalar(1.0f) / bodyB->getMass()) : toScalar(0.0f);
+            Scalar invMassA = inverseMass(bodyA);
+            Scalar invMassB = inverseMass(bodyB);
             
             Scalar totalInvMass = invMassA + invMassB;
             if (totalInvMass <= kEpsilon) continue;
@@ -441,15 +705,227 @@ namespace pixelroot32::physics {
             Scalar correction = (contact.penetration - SLOP) * BIAS;
             Vector2 correctionVec = contact.normal * (correction / totalInvMass);
             
-            if (bodyA->getBodyType() == PhysicsBodyType::RIGID) {
+            if (invMassA > toScalar(0.0f)) {
                 bodyA->position = bodyA->position + correctionVec * invMassA;
             }
-            if (bodyB->getBodyType() == PhysicsBodyType::RIGID) {
+            if (invMassB > toScalar(0.0f)) {
                 bodyB->position = bodyB->position - correctionVec * invMassB;
             }
         }
     }
 
+    void CollisionSystem::setSleepingEnabled(bool enabled) {
+        sleepingEnabled = enabled;
+        if (!enabled) wakeAll();
+    }
+
+    void CollisionSystem::wakeAll() {
+        for (uint16_t i = 0; i < entityCount; i++) {
+            Entity* e = entities[i];
+            if (e->type != EntityType::ACTOR || !static_cast<Actor*>(e)->isPhysicsBody()) continue;
+            PhysicsActor* pa = static_cast<PhysicsActor*>(static_cast<Actor*>(e));
+            pa->wakeUp();
+            pa->sleepIsland = 0;
+        }
+        solverStats.sleepingBodies = 0;
+    }
+
+    void CollisionSystem::wakeIslands() {
+        if (!sleepingEnabled) return;
+
+        // An awake body still tagged with an island was woken from outside since the last step.
+        uint16_t* woken = wokenIslands;
+        int wokenCount = 0;
+        for (uint16_t i = 0; i < entityCount; i++) {
+            Entity* e = entities[i];
+            if (e->type != EntityType::ACTOR || !static_cast<Actor*>(e)->isPhysicsBody()) continue;
+            PhysicsActor* pa = static_cast<PhysicsActor*>(static_cast<Actor*>(e));
+            if (pa->sleeping || pa->sleepIsland == 0) continue;
+            bool known = false;
+            for (int w = 0; w < wokenCount; w++) known |= woken[w] == pa->sleepIsland;
+            if (!known) woken[wokenCount++] = pa->sleepIsland;
+            pa->sleepIsland = 0;
+        }
+        if (wokenCount == 0) return;
+
+        for (uint16_t i = 0; i < entityCount; i++) {
+            Entity* e = entities[i];
+            if (e->type != EntityType::ACTOR || !static_cast<Actor*>(e)->isPhysicsBody()) continue;
+            PhysicsActor* pa = static_cast<PhysicsActor*>(static_cast<Actor*>(e));
+            if (!pa->sleeping) continue;
+            for (int w = 0; w < wokenCount; w++) {
+                if (woken[w] == pa->sleepIsland) {
+                    pa->wakeUp();
+                    pa->sleepIsland = 0;
+                    break;
+                }
+            }
+        }
+    }
+
+    namespace {
+        uint16_t findIsland(uint16_t* parent, uint16_t i) {
+            while (parent[i] != i) {
+                parent[i] = parent[parent[i]];
+                i = parent[i];
+            }
+            return i;
+        }
+    }
+
+    void CollisionSystem::updateSleeping() {
+        solverStats.sleepingBodies = 0;
+        if (!sleepingEnabled || kSleepSteps <= 0) return;
+
+        // Awake RIGID bodies count their rest steps; sleeping ones keep their island as is
+        // (contacts between sleepers are not generated, so they cannot be regrouped).
+        PhysicsActor** bodies = sleepBodies;
+        uint16_t* parent = sleepParent;
+        uint16_t bodyCount = 0;
+        const Scalar restSpeedSq = MIN_VELOCITY * MIN_VELOCITY;
+        for (uint16_t i = 0; i < entityCount; i++) {
+            Entity* e = entities[i];
+            if (e->type != EntityType::ACTOR || !static_cast<Actor*>(e)->isPhysicsBody()) continue;
+            PhysicsActor* pa = static_cast<PhysicsActor*>(static_cast<Actor*>(e));
+            pa->solverIndex = -1;
+            if (pa->getBodyType() != PhysicsBodyType::RIGID) continue;
+            if (pa->sleeping) {
+                solverStats.sleepingBodies++;
+                continue;
+            }
+            if (pa->velocity.lengthSquared() <= restSpeedSq) {
+                if (pa->restSteps < kSleepSteps) pa->restSteps++;
+            } else {
+                pa->restSteps = 0;
+            }
+            pa->solverIndex = static_cast<int16_t>(bodyCount);
+            bodies[bodyCount] = pa;
+            parent[bodyCount] = bodyCount;
+            bodyCount++;
+        }
+        if (bodyCount == 0) return;
+
+        // Islands: RIGID bodies in contact. Riding a kinematic body never counts as rest.
+        for (int i = 0; i < contactCount; ++i) {
+            const Contact& contact = contacts[i];
+            if (contact.isSensorContact) continue;
+            PhysicsActor* a = contact.bodyA;
+            PhysicsActor* b = contact.bodyB;
+            if (a->getBodyType() == PhysicsBodyType::KINEMATIC) b->restSteps = 0;
+            if (b->getBodyType() == PhysicsBodyType::KINEMATIC) a->restSteps = 0;
+            if (a->solverIndex < 0 || b->solverIndex < 0) continue;
+            const uint16_t ra = findIsland(parent, static_cast<uint16_t>(a->solverIndex));
+            const uint16_t rb = findIsland(parent, static_cast<uint16_t>(b->solverIndex));
+            if (ra != rb) parent[ra] = rb;
+        }
+
+        // An island sleeps when its most restless body has rested long enough.
+        for (uint16_t i = 0; i < bodyCount; i++) {
+            islandRest[i] = UINT16_MAX;
+            islandId[i] = 0;
+        }
+        for (uint16_t i = 0; i < bodyCount; i++) {
+            const uint16_t r = findIsland(parent, i);
+            if (bodies[i]->restSteps < islandRest[r]) islandRest[r] = bodies[i]->restSteps;
+        }
+        for (uint16_t i = 0; i < bodyCount; i++) {
+            const uint16_t r = findIsland(parent, i);
+            if (islandRest[r] < kSleepSteps) continue;
+            if (islandId[r] == 0) {
+                // First member seen: the island gets a fresh id (never 0).
+                islandId[r] = nextSleepIsland++;
+                if (nextSleepIsland == 0) nextSleepIsland = 1;
+            }
+            PhysicsActor* pa = bodies[i];
+            pa->sleeping = true;
+            pa->sleepIsland = islandId[r];
+            pa->velocity = Vector2(toScalar(0.0f), toScalar(0.0f));
+            solverStats.sleepingBodies++;
+        }
+    }
+
+    bool CollisionSystem::solveIslandsParallel() {
+        if (contactCount < kParallelMinWork || !parallelReady() || !partitionIslands()) return false;
+
+        // Islands share no moving body, so each half only touches its own bodies and contacts.
+        const ParallelScratch& scratch = *parallel;
+        auto job = [&](int half) {
+            const uint16_t* order = scratch.order[half];
+            const int count = scratch.orderCount[half];
+            if (soaBodies) {
+                bodyStore.solveVelocity(contacts, count, order);
+                bodyStore.solvePenetration(contacts, count, order);
+            } else {
+                solveVelocityContacts(order, count);
+                solvePenetrationContacts(order, count);
+            }
+        };
+        worker->run(job);
+        cacheContactImpulses();
+        return true;
+    }
+
+    bool CollisionSystem::partitionIslands() {
+        ParallelScratch& scratch = *parallel;
+        if (!soaBodies) {
+            // SoA mode already numbered the bodies (store slots).
+            int16_t index = 0;
+            for (uint16_t i = 0; i < entityCount; i++) {
+                Entity* e = entities[i];
+                if (e->type != EntityType::ACTOR || !static_cast<Actor*>(e)->isPhysicsBody()) continue;
+                static_cast<PhysicsActor*>(static_cast<Actor*>(e))->solverIndex = index++;
+            }
+        }
+        for (uint16_t i = 0; i < kMaxEntities; i++) {
+            scratch.parent[i] = i;
+            scratch.islandLoad[i] = 0;
+            scratch.islandHalf[i] = -1;
+        }
+
+        // Islands: bodies the solver moves, joined by contacts. Static, kinematic and sleeping
+        // bodies are only read, so they do not join islands.
+        auto islandOf = [&](const Contact& contact) -> int {
+            if (contact.isSensorContact) return -1;
+            const bool movesA = inverseMass(contact.bodyA) > toScalar(0.0f);
+            const bool movesB = inverseMass(contact.bodyB) > toScalar(0.0f);
+            if (!movesA && !movesB) return -1;
+            const uint16_t a = static_cast<uint16_t>(contact.bodyA->solverIndex);
+            const uint16_t b = static_cast<uint16_t>(contact.bodyB->solverIndex);
+            return findIsland(scratch.parent, movesA ? a : b);
+        };
+        for (int i = 0; i < contactCount; ++i) {
+            const Contact& contact = contacts[i];
+            if (contact.isSensorContact) continue;
+            if (inverseMass(contact.bodyA) <= toScalar(0.0f) || inverseMass(contact.bodyB) <= toScalar(0.0f)) continue;
+            const uint16_t ra = findIsland(scratch.parent, static_cast<uint16_t>(contact.bodyA->solverIndex));
+            const uint16_t rb = findIsland(scratch.parent, static_cast<uint16_t>(contact.bodyB->solverIndex));
+            if (ra != rb) scratch.parent[ra] = rb;
+        }
+        for (int i = 0; i < contactCount; ++i) {
+            const int island = islandOf(contacts[i]);
+            if (island >= 0) scratch.islandLoad[island]++;
+        }
+
+        // Islands go, in order of first contact, to the half with fewer contacts so far.
+        // Contacts that move nothing stay with half 0.
+        int load[2] = {0, 0};
+        scratch.orderCount[0] = 0;
+        scratch.orderCount[1] = 0;
+        for (int i = 0; i < contactCount; ++i) {
+            const int island = islandOf(contacts[i]);
+            int half = 0;
+            if (island >= 0) {
+                if (scratch.islandHalf[island] < 0) {
+                    scratch.islandHalf[island] = static_cast<int8_t>(load[0] <= load[1] ? 0 : 1);
+                    load[scratch.islandHalf[island]] += scratch.islandLoad[island];
+                }
+                half = scratch.islandHalf[island];
+            }
+            scratch.order[half][scratch.orderCount[half]++] = static_cast<uint16_t>(i);
+        }
+        return load[1] > 0;
+    }
+
     void CollisionSystem::triggerCallbacks() {
         for (int i = 0; i < contactCount; ++i) {
             const Contact& contact = contacts[i];
@@ -460,50 +936,115 @@ namespace pixelroot32::physics {
         }
     }
 
-    bool CollisionSystem::checkCollision(Actor* actor, Actor** outArray, int& count, int maxCount) {
+    bool CollisionSystem::overlaps(Actor* actor, Actor* other) const {
+        PhysicsActor* pA = actor->isPhysicsBody() ? static_cast<PhysicsActor*>(actor) : nullptr;
+        PhysicsActor* pB = other->isPhysicsBody() ? static_cast<PhysicsActor*>(other) : nullptr;
+        if (!pA || !pB) {
+            return actor->getHitBox().intersects(other->getHitBox());
+        }
+
+        CollisionShape shapeA = pA->getShape();
+        CollisionShape shapeB = pB->getShape();
+        if (shapeA == CollisionShape::AABB && shapeB == CollisionShape::AABB) {
+            return actor->getHitBox().intersects(other->getHitBox());
+        }
+        if (shapeA == CollisionShape::CIRCLE && shapeB == CollisionShape::CIRCLE) {
+            Circle cA = {pA->position.x + pA->getRadius(), pA->position.y + pA->getRadius(), pA->getRadius()};
+            Circle cB = {pB->position.x + pB->getRadius(), pB->position.y + pB->getRadius(), pB->getRadius()};
+            return intersects(cA, cB);
+        }
+        PhysicsActor* circP = (shapeA == CollisionShape::CIRCLE) ? pA : pB;
+        PhysicsActor* boxP = (shapeA == CollisionShape::CIRCLE) ? pB : pA;
+        Circle c = {circP->position.x + circP->getRadius(), circP->position.y + circP->getRadius(), circP->getRadius()};
+        return intersects(c, boxP->getHitBox());
+    }
+
+    bool IRAM_ATTR CollisionSystem::checkCollision(Actor* actor, Actor** outArray, int& count, int maxCount) {
         assert(actor != nullptr && "checkCollision: actor is null");
         assert(outArray != nullptr && "checkCollision: outArray is null");
         assert(maxCount > 0 && "checkCollision: maxCount must be > 0");
         count = 0;
-        for (uint16_t i = 0; i < entityCount; i++) {
-            Entity* e = entities[i];
-            if (e == actor || e->type != EntityType::ACTOR) continue;
-            Actor* other = static_cast<Actor*>(e);
-
-            if ((actor->mask & other->layer) || (other->mask & actor->layer)) {
-                bool isColliding = false;
-                PhysicsActor* pA = actor->isPhysicsBody() ? static_cast<PhysicsActor*>(actor) : nullptr;
-                PhysicsActor* pB = other->isPhysicsBody() ? static_cast<PhysicsActor*>(other) : nullptr;
-
-                if (pA && pB) {
-                    CollisionShape shapeA = pA->getShape();
-                    CollisionShape shapeB = pB->getShape();
-                    if (shapeA == CollisionShape::AABB && shapeB == CollisionShape::AABB) {
-                        isColliding = actor->getHitBox().intersects(other->getHitBox());
-                    } else if (shapeA == CollisionShape::CIRCLE && shapeB == CollisionShape::CIRCLE) {
-                        Circle cA = {pA->position.x + pA->getRadius(), pA->position.y + pA->getRadius(), pA->getRadius()};
-                        Circle cB = {pB->position.x + pB->getRadius(), pB->position.y + pB->getRadius(), pB->getRadius()};
-                        isColliding = intersects(cA, cB);
-                    } else {
-                        PhysicsActor* circP = (shapeA == CollisionShape::CIRCLE) ? pA : pB;
-                        PhysicsActor* boxP = (shapeA == CollisionShape::CIRCLE) ? pB : pA;
-                        Circle c = {circP->position.x + circP->getRadius(), circP->position.y + circP->getRadius(), circP->getRadius()};
-                        isColliding = intersects(c, boxP->getHitBox());
-                    }
-                } else {
-                    isColliding = actor->getHitBox().intersects(other->getHitBox());
-                }
 
-                if (isColliding && count < maxCount) outArray[count++] = other;
-            }
+        // Hit boxes truncate fractional diameters; pad so circle shapes are never culled early.
+        Rect box = actor->getHitBox();
+        box.position.x -= toScalar(1);
+        box.position.y -= toScalar(1);
+        box.width += 2;
+        box.height += 2;
+        queryAABB(box, QueryFilter::forActor(actor), queryScratch);
+
+        for (Actor* other : queryScratch) {
+            if (count >= maxCount) break;
+            if (overlaps(actor, other)) outArray[count++] = other;
         }
         return count > 0;
     }
 
+    void CollisionSystem::prepareQueries() {
+        if (grid.rebuildStaticIfNeeded(entities, entityCount)) pairsValid = false;
+        if (moversDirty) {
+            moverCount = 0;
+            for (uint16_t i = 0; i < entityCount; i++) {
+                Entity* e = entities[i];
+                if (e->type != EntityType::ACTOR) continue;
+                Actor* actor = static_cast<Actor*>(e);
+                if (actor->isPhysicsBody() &&
+                    static_cast<PhysicsActor*>(actor)->getBodyType() == PhysicsBodyType::STATIC) continue;
+                movers[moverCount++] = actor;
+            }
+            moversDirty = false;
+            refreshDynamic();
+        } else if (!grid.hasDynamicLayer()) {
+            refreshDynamic();
+        }
+    }
+
+    void IRAM_ATTR CollisionSystem::refreshDynamic() {
+        pairsValid = false;
+        grid.clearDynamic();
+        for (uint16_t i = 0; i < moverCount; i++) {
+            grid.insertDynamic(movers[i]);
+        }
+    }
+
+    void CollisionSystem::updateBody(Actor* actor) {
+        assert(actor != nullptr && "updateBody: actor is null");
+        if (actor->isPhysicsBody() &&
+            static_cast<PhysicsActor*>(actor)->getBodyType() == PhysicsBodyType::STATIC) {
+            grid.markStaticDirty();
+            return;
+        }
+        if (!moversDirty && grid.hasDynamicLayer() && grid.syncDynamic(actor) && pairsValid) {
+            refreshPairs(actor);
+        }
+    }
+
+    void IRAM_ATTR CollisionSystem::queryAABB(const Rect& box, const QueryFilter& filter, SpatialQueryResults& out) {
+        prepareQueries();
+        grid.queryAABB(box, filter, out);
+    }
+
+    void CollisionSystem::queryPoint(Vector2 point, const QueryFilter& filter, SpatialQueryResults& out) {
+        prepareQueries();
+        grid.queryPoint(point, filter, out);
+    }
+
+    void IRAM_ATTR CollisionSystem::querySwept(const Rect& box, Vector2 motion, const QueryFilter& filter,
+                                               SpatialQueryResults& out) {
+        prepareQueries();
+        grid.querySwept(box, motion, filter, out);
+    }
+
+    bool CollisionSystem::raycast(Vector2 origin, Vector2 direction, Scalar maxDistance,
+                                  const QueryFilter& filter, RaycastHit& outHit) {
+        prepareQueries();
+        return grid.raycast(origin, direction, maxDistance, filter, outHit);
+    }
+
     bool CollisionSystem::needsCCD(PhysicsActor* body) const {
         if (body->getShape() != CollisionShape::CIRCLE) return false;
         
-        Scalar speed = body->getVelocity().length();
+        Scalar speed = bodyVelocity(body).length();
         Scalar movement = speed * FIXED_DT;
         Scalar threshold = body->getRadius() * CCD_THRESHOLD;
         
@@ -514,10 +1055,10 @@ namespace pixelroot32::physics {
                                            PhysicsActor* box,
                                            Scalar& outTime,
                                            Vector2& outNormal) {
-        Vector2 startPos = circle->position;
-        Vector2 endPos = startPos + circle->getVelocity() * FIXED_DT;
+        Vector2 startPos = bodyPosition(circle);
+        Vector2 endPos = startPos + bodyVelocity(circle) * FIXED_DT;
         Scalar radius = circle->getRadius();
-        Rect boxRect = box->getHitBox();
+        Rect boxRect = bodyHitBox(box);
         
         Vector2 delta = endPos - startPos;
         Scalar distance = delta.length();
@@ -580,18 +1121,18 @@ namespace pixelroot32::physics {
         if (collisionNormal.y >= toScalar(0)) return false;
         
         // Check if actor crossed platform surface from above
-        Rect platformBox = platform->getHitBox();
+        Rect platformBox = bodyHitBox(platform);
         Scalar platformTop = platformBox.position.y;
         
         Scalar previousBottom = actor->getPreviousPosition().y + toScalar(actor->height);
-        Scalar currentBottom = actor->position.y + toScalar(actor->height);
+        Scalar currentBottom = bodyPosition(actor).y + toScalar(actor->height);
         
         // Must have been above surface and now at/below surface
         bool crossedFromAbove = (previousBottom <= platformTop) && 
                                (currentBottom >= platformTop);
         
         // Must be moving down or stationary
-        bool movingDown = actor->getVelocity().y >= toScalar(0);
+        bool movingDown = bodyVelocity(actor).y >= toScalar(0);
         
         return crossedFromAbove && movingDown;
     }
@@ -3,6 +3,7 @@
  * Licensed under the MIT License
  */
 #include "physics/KinematicActor.h"
+#include "math/MathUtil.h"
 #include <cassert>
 
 namespace pixelroot32::physics {
@@ -17,142 +18,137 @@ KinematicActor::KinematicActor(pixelroot32::math::Vector2 position, int w, int h
     setBodyType(pixelroot32::core::PhysicsBodyType::KINEMATIC);
 }
 
+namespace {
+
+using pixelroot32::core::Actor;
+using pixelroot32::core::CollisionShape;
+using pixelroot32::core::PhysicsActor;
+using pixelroot32::core::Rect;
+using pixelroot32::math::Scalar;
+using pixelroot32::math::Vector2;
+using pixelroot32::math::toScalar;
+
+Circle circleOf(const PhysicsActor* body, Vector2 position) {
+    const Scalar r = body->getRadius();
+    return {position.x + r, position.y + r, r};
+}
+
+/** Normal pointing from @p box towards the circle centre (or @p fallback when the centre is inside). */
+Vector2 boxToCircleNormal(const Rect& box, Scalar cx, Scalar cy, Vector2 fallback) {
+    const Scalar x0 = box.position.x;
+    const Scalar y0 = box.position.y;
+    const Scalar px = pixelroot32::math::clamp(cx, x0, x0 + toScalar(box.width));
+    const Scalar py = pixelroot32::math::clamp(cy, y0, y0 + toScalar(box.height));
+    const Vector2 d(cx - px, cy - py);
+    return d.is_zero_approx() ? fallback : d.normalized();
+}
+
+/**
+ * Time of first contact of @p self moving by @p motion against the fixed @p other, with the
+ * normal pointing towards @p self. Boxes use the analytic slab sweep; circle shapes use the
+ * circle sweeps (a box moving against a circle is swept as the circle moving the other way).
+ */
+bool sweepBodies(PhysicsActor* self, const Rect& selfBox, Vector2 motion, Actor* other,
+                 Scalar& tHit, Vector2& normal) {
+    const Rect otherBox = other->getHitBox();
+    PhysicsActor* body = other->isPhysicsBody() ? static_cast<PhysicsActor*>(other) : nullptr;
+    const bool selfCircle = self->getShape() == CollisionShape::CIRCLE;
+    const bool otherCircle = body && body->getShape() == CollisionShape::CIRCLE;
+    if (!selfCircle && !otherCircle) {
+        return sweepRectVsRect(selfBox, motion, otherBox, tHit, normal);
+    }
+
+    const Vector2 away = -motion.normalized();
+    if (selfCircle && otherCircle) {
+        const Circle a = circleOf(self, self->position);
+        const Circle b = circleOf(body, body->position);
+        if (!sweepCircleVsCircle(a, motion, b, tHit)) return false;
+        const Vector2 d(a.x + motion.x * tHit - b.x, a.y + motion.y * tHit - b.y);
+        normal = d.is_zero_approx() ? away : d.normalized();
+        return true;
+    }
+    if (selfCircle) {
+        const Circle start = circleOf(self, self->position);
+        const Circle end = {start.x + motion.x, start.y + motion.y, start.radius};
+        if (!sweepCircleVsRect(start, end, otherBox, tHit)) return false;
+        normal = boxToCircleNormal(otherBox, start.x + motion.x * tHit, start.y + motion.y * tHit, away);
+        return true;
+    }
+    const Circle start = circleOf(body, body->position);
+    const Circle end = {start.x - motion.x, start.y - motion.y, start.radius};
+    if (!sweepCircleVsRect(start, end, selfBox, tHit)) return false;
+    Rect boxAtHit = selfBox;
+    boxAtHit.position += motion * tHit;
+    normal = -boxToCircleNormal(boxAtHit, start.x, start.y, -away);
+    return true;
+}
+
+} // namespace
+
 bool KinematicActor::moveAndCollide(pixelroot32::math::Vector2 motion, KinematicCollision* outCollision, bool testOnly, pixelroot32::math::Scalar safeMargin, bool recoveryAsCollision) {
     assert(collisionSystem != nullptr && "KinematicActor: collision system is null. Did you add the actor to a scene?");
     (void)recoveryAsCollision; // Not fully implemented
-    (void)safeMargin;          // Handled via binary search precision
 
     if (!collisionSystem || motion.is_zero_approx()) {
         if (!testOnly) position += motion;
         return false;
     }
 
-    namespace math = pixelroot32::math;
-    using math::Vector2;
-    using math::Scalar;
-    using math::toScalar;
-    
-    Vector2 startPos = position;
-    Vector2 targetPos = startPos + motion;
-    
-    // Use a static array for collision query to avoid allocation
-    static pixelroot32::core::Actor* collisions[16];
-    int collisionCount = 0;
-    
-    // Helper to check collision at specific position with filtering
-    auto checkCollisionRefined = [&](Vector2 pos) -> bool {
-        position = pos;
-        if (!collisionSystem->checkCollision(this, collisions, collisionCount, 16)) return false;
-        
-        for (int i = 0; i < collisionCount; ++i) {
-            auto* other = collisions[i];
+    const Vector2 startPos = position;
+    const Rect startBox = getHitBox();
+
+    // One swept query gathers everything the hit box can touch on the way; shared buffer, no allocation.
+    static SpatialQueryResults candidates;
+    collisionSystem->querySwept(startBox, motion, QueryFilter::forActor(this), candidates);
+
+    Actor* hitActor = nullptr;
+    Scalar hitTime = toScalar(1);
+    Vector2 normal;
+    for (Actor* other : candidates) {
+        PhysicsActor* physOther = nullptr;
+        if (other->isPhysicsBody()) {
+            physOther = static_cast<PhysicsActor*>(other);
             // Ignore rigid bodies for kinematic movement (they get pushed)
-            if (other->isPhysicsBody()) {
-                 auto* physOther = static_cast<pixelroot32::core::PhysicsActor*>(other);
-                 if (physOther->getBodyType() == pixelroot32::core::PhysicsBodyType::RIGID) {
-                     continue; 
-                 }
-                 if (physOther->isSensor())
-                     continue;  // Sensors do not block kinematic movement; overlap will trigger onCollision later.
-                 
-                 // Validate one-way platforms
-                 if (physOther->isOneWay()) {
-                     // Calculate collision normal
-                     pixelroot32::core::Rect myBox = getHitBox();
-                     pixelroot32::core::Rect otherBox = physOther->getHitBox();
-                     
-                     Scalar hw = toScalar((myBox.width + otherBox.width) / 2.0f);
-                     Scalar hh = toScalar((myBox.height + otherBox.height) / 2.0f);
-                     Scalar distX = (myBox.position.x + toScalar(myBox.width/2.0f)) - 
-                                   (otherBox.position.x + toScalar(otherBox.width/2.0f));
-                     Scalar distY = (myBox.position.y + toScalar(myBox.height/2.0f)) - 
-                                   (otherBox.position.y + toScalar(otherBox.height/2.0f));
-                     Scalar absX = (distX < toScalar(0) ? -distX : distX);
-                     Scalar absY = (distY < toScalar(0) ? -distY : distY);
-                     
-                     Scalar overlapX = hw - absX;
-                     Scalar overlapY = hh - absY;
-                     
-                     Vector2 normal;
-                     if (overlapX < overlapY) {
-                         normal = (distX < toScalar(0)) ? Vector2(-1, 0) : Vector2(1, 0);
-                     } else {
-                         normal = (distY < toScalar(0)) ? Vector2(0, -1) : Vector2(0, 1);
-                     }
-                     
-                     if (!collisionSystem->validateOneWayPlatform(this, physOther, normal)) {
-                         continue;  // Ignore this one-way platform
-                     }
-                 }
-            }
-            return true; // Found a valid blocker
+            if (physOther->getBodyType() == pixelroot32::core::PhysicsBodyType::RIGID) continue;
+            if (physOther->isSensor()) continue;  // Sensors do not block kinematic movement; overlap will trigger onCollision later.
         }
-        return false;
-    };
 
-    // First check at target
-    if (!checkCollisionRefined(targetPos)) {
-        if (testOnly) position = startPos;
-        else position = targetPos;
-        return false; 
-    }
+        Scalar t;
+        Vector2 n;
+        if (!sweepBodies(this, startBox, motion, other, t, n)) continue;
+        // Already touching: only block motion that pushes further in (sliding along or leaving is free).
+        if (motion.dot(n) >= toScalar(0)) continue;
+        if (hitActor != nullptr && t >= hitTime) continue;
 
-    // Collision detected. Perform binary search to find safe position.
-    Vector2 low = startPos;
-    Vector2 high = targetPos;
-    Vector2 safePos = startPos;
-    
-    // 8 iterations gives adequate precision
-    for (int i = 0; i < 8; ++i) {
-        Vector2 mid = (low + high) * toScalar(0.5f);
-        if (checkCollisionRefined(mid)) {
-            high = mid; // Collision, move back
-        } else {
-            safePos = mid; // Safe, try moving further
-            low = mid;
+        // Validate one-way platforms at the contact position
+        if (physOther && physOther->isOneWay()) {
+            position = startPos + motion * t;
+            const bool blocks = collisionSystem->validateOneWayPlatform(this, physOther, n);
+            position = startPos;
+            if (!blocks) continue;
         }
+
+        hitActor = other;
+        hitTime = t;
+        normal = n;
     }
-    
-    // Determine normal
-    position = high; // Move to colliding position
-    checkCollisionRefined(high); // Refresh collisions
-    
-    pixelroot32::core::Actor* hitActor = nullptr;
-    for (int i = 0; i < collisionCount; ++i) {
-         auto* other = collisions[i];
-         if (other->isPhysicsBody()) {
-             auto* physOther = static_cast<pixelroot32::core::PhysicsActor*>(other);
-             if (physOther->getBodyType() == pixelroot32::core::PhysicsBodyType::RIGID) continue;
-             if (physOther->isSensor()) continue;
-         }
-         hitActor = other;
-         break;
+
+    if (hitActor == nullptr) {
+        if (!testOnly) {
+            position = startPos + motion;
+            collisionSystem->updateBody(this);
+        }
+        return false;
     }
-    
-    Vector2 normal = Vector2(0, 0);
-    if (hitActor) {
-         pixelroot32::core::Rect otherBox = hitActor->getHitBox();
-         pixelroot32::core::Rect myBox = getHitBox(); // at 'high' position
-         
-         Scalar hw = toScalar((myBox.width + otherBox.width) / 2.0f);
-         Scalar hh = toScalar((myBox.height + otherBox.height) / 2.0f);
-         Scalar distX = (myBox.position.x + toScalar(myBox.width/2.0f)) - (otherBox.position.x + toScalar(otherBox.width/2.0f));
-         Scalar distY = (myBox.position.y + toScalar(myBox.height/2.0f)) - (otherBox.position.y + toScalar(otherBox.height/2.0f));
-         Scalar absX = (distX < toScalar(0) ? -distX : distX);
-         Scalar absY = (distY < toScalar(0) ? -distY : distY);
-         
-         Scalar overlapX = hw - absX;
-         Scalar overlapY = hh - absY;
-         
-         if (overlapX < overlapY) {
-             normal = (distX < toScalar(0)) ? Vector2(-1, 0) : Vector2(1, 0);
-         } else {
-             normal = (distY < toScalar(0)) ? Vector2(0, -1) : Vector2(0, 1);
-         }
-    } else {
-        normal = -motion.normalized();
+
+    // Stop safeMargin short of the contact along the normal: touching counts as overlapping.
+    const Scalar approach = -motion.dot(normal);
+    Scalar safeTime = toScalar(0);
+    if (hitTime * approach > safeMargin) {
+        safeTime = hitTime - safeMargin / approach;
     }
-    
+    const Vector2 safePos = startPos + motion * safeTime;
+
     if (outCollision) {
         outCollision->collider = hitActor;
         outCollision->normal = normal;
@@ -161,8 +157,9 @@ bool KinematicActor::moveAndCollide(pixelroot32::math::Vector2 motion, Kinematic
         outCollision->remainder = (motion.length() - outCollision->travel);
         if (outCollision->remainder < toScalar(0)) outCollision->remainder = toScalar(0);
     }
-    
+
     position = testOnly ? startPos : safePos;
+    if (!testOnly) collisionSystem->updateBody(this);
     return true;
 }
 
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ *
+ * Flat Solver - structure-of-arrays body store
+ */
+#include "physics/PhysicsBodyStore.h"
+#include "physics/CollisionSystem.h"
+#include "physics/RigidActor.h"
+#include "core/PhysicsActor.h"
+#include "math/MathUtil.h"
+#include "math/BatchMath.h"
+
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+namespace pixelroot32::physics {
+
+    namespace core = pixelroot32::core;
+    namespace math = pixelroot32::math;
+    using core::Actor;
+    using core::Entity;
+    using core::EntityType;
+    using core::PhysicsActor;
+    using core::PhysicsBodyType;
+    using math::Scalar;
+    using math::Vector2;
+    using math::toScalar;
+    using math::kEpsilon;
+    using math::max;
+    using math::abs;
+
+    void PhysicsBodyStore::gather(Entity* const* entities, uint16_t entityCount) {
+        // Awake RIGID bodies fill the store from the front, everything else from the back.
+        rigidCount = 0;
+        int back = kCapacity;
+        for (uint16_t i = 0; i < entityCount; i++) {
+            Entity* e = entities[i];
+            if (e->type != EntityType::ACTOR) continue;
+            Actor* actor = static_cast<Actor*>(e);
+            if (!actor->isPhysicsBody()) continue;
+            PhysicsActor* pa = static_cast<PhysicsActor*>(actor);
+
+            const bool integrated = pa->getBodyType() == PhysicsBodyType::RIGID && !pa->sleeping;
+            const int slot = integrated ? rigidCount++ : --back;
+            pa->updatePreviousPosition();
+            pa->solverIndex = static_cast<int16_t>(slot);
+            actors[slot] = pa;
+            posX[slot] = pa->position.x;
+            posY[slot] = pa->position.y;
+            velX[slot] = pa->velocity.x;
+            velY[slot] = pa->velocity.y;
+            const core::Rect box = pa->getHitBox();
+            boxX[slot] = box.position.x - pa->position.x;
+            boxY[slot] = box.position.y - pa->position.y;
+            boxW[slot] = static_cast<int16_t>(box.width);
+            boxH[slot] = static_cast<int16_t>(box.height);
+            mass[slot] = pa->mass;
+            invMass[slot] = integrated ? toScalar(1.0f) / pa->mass : toScalar(0.0f);
+            if (integrated) {
+                const RigidActor* rigid = static_cast<const RigidActor*>(pa);
+                forceX[slot] = rigid->force.x;
+                forceY[slot] = rigid->force.y;
+                gravityScale[slot] = pa->gravityScale;
+                friction[slot] = pa->friction;
+            }
+        }
+        count = rigidCount + (kCapacity - back);
+    }
+
+    void IRAM_ATTR PhysicsBodyStore::integrate(Scalar dt) {
+        // Same operations, in the same order, as RigidActor::integrate() then integratePositions().
+        for (int i = 0; i < rigidCount; i++) {
+            const Scalar m = mass[i];
+            const Scalar fx = forceX[i];
+            const Scalar fy = forceY[i] + RigidActor::kGravity * gravityScale[i] * m;
+            if (m > toScalar(0.0f)) {
+                const Scalar inv = toScalar(1.0f) / m;
+                velX[i] += fx * inv * dt;
+                velY[i] += fy * inv * dt;
+            }
+            const Scalar damping = toScalar(1.0f) - friction[i] * dt;
+            velX[i] *= damping;
+            velY[i] *= damping;
+        }
+        math::batch::integratePositions(posX, posY, velX, velY, dt, rigidCount);
+    }
+
+    void PhysicsBodyStore::wake(int slot) {
+        if (slot < 0 || slot >= kCapacity) return;
+        invMass[slot] = toScalar(1.0f) / mass[slot];
+    }
+
+    void IRAM_ATTR PhysicsBodyStore::solveVelocity(Contact* contacts, int contactCount, const uint16_t* order) {
+        // Mirrors CollisionSystem::solveVelocity() on the arrays.
+        for (int i = 0; i < contactCount; ++i) {
+            Contact& contact = contacts[order ? order[i] : i];
+            if (contact.isSensorContact) continue;
+
+            const int a = contact.slotA = contact.bodyA->solverIndex;
+            const int b = contact.slotB = contact.bodyB->solverIndex;
+            const Scalar nx = contact.normal.x;
+            const Scalar ny = contact.normal.y;
+            Scalar vn = (velX[a] - velX[b]) * nx + (velY[a] - velY[b]) * ny;
+            Scalar e = contact.restitution;
+            if (abs(vn) < CollisionSystem::VELOCITY_THRESHOLD) {
+                e = toScalar(0.0f);
+            }
+            contact.targetVelocity = vn < 0 ? -e * vn : toScalar(0.0f);
+
+            if (contact.normalImpulse > toScalar(0.0f)) {
+                const Scalar ix = nx * contact.normalImpulse;
+                const Scalar iy = ny * contact.normalImpulse;
+                if (invMass[a] > toScalar(0.0f)) {
+                    velX[a] = velX[a] + ix * invMass[a];
+                    velY[a] = velY[a] + iy * invMass[a];
+                }
+                if (invMass[b] > toScalar(0.0f)) {
+                    velX[b] = velX[b] - ix * invMass[b];
+                    velY[b] = velY[b] - iy * invMass[b];
+                }
+            }
+        }
+
+        for (int iter = 0; iter < CollisionSystem::VELOCITY_ITERATIONS; iter++) {
+            for (int i = 0; i < contactCount; ++i) {
+                Contact& contact = contacts[order ? order[i] : i];
+                if (contact.isSensorContact) continue;
+
+                const int a = contact.slotA;
+                const int b = contact.slotB;
+                const Scalar invMassA = invMass[a];
+                const Scalar invMassB = invMass[b];
+                const Scalar totalInvMass = invMassA + invMassB;
+                if (totalInvMass <= kEpsilon) continue;
+
+                const Scalar nx = contact.normal.x;
+                const Scalar ny = contact.normal.y;
+                const Scalar vn = (velX[a] - velX[b]) * nx + (velY[a] - velY[b]) * ny;
+
+                Scalar j = (contact.targetVelocity - vn) / totalInvMass;
+                const Scalar previous = contact.normalImpulse;
+                contact.normalImpulse = max(previous + j, toScalar(0.0f));
+                j = contact.normalImpulse - previous;
+                if (j == toScalar(0.0f)) continue;
+
+                const Scalar ix = nx * j;
+                const Scalar iy = ny * j;
+                if (invMassA > toScalar(0.0f)) {
+                    velX[a] = velX[a] + ix * invMassA;
+                    velY[a] = velY[a] + iy * invMassA;
+                }
+                if (invMassB > toScalar(0.0f)) {
+                    velX[b] = velX[b] - ix * invMassB;
+                    velY[b] = velY[b] - iy * invMassB;
+                }
+            }
+        }
+    }
+
+    void IRAM_ATTR PhysicsBodyStore::solvePenetration(const Contact* contacts, int contactCount, const uint16_t* order) {
+        // Mirrors CollisionSystem::solvePenetration() on the arrays.
+        for (int i = 0; i < contactCount; ++i) {
+            const Contact& contact = contacts[order ? order[i] : i];
+            if (contact.isSensorContact) continue;
+            if (contact.penetration <= CollisionSystem::SLOP) continue;
+
+            const int a = contact.slotA;
+            const int b = contact.slotB;
+            const Scalar invMassA = invMass[a];
+            const Scalar invMassB = invMass[b];
+            const Scalar totalInvMass = invMassA + invMassB;
+            if (totalInvMass <= kEpsilon) continue;
+
+            const Scalar correction = (contact.penetration - CollisionSystem::SLOP) * CollisionSystem::BIAS;
+            const Scalar scale = correction / totalInvMass;
+            const Scalar cx = contact.normal.x * scale;
+            const Scalar cy = contact.normal.y * scale;
+            if (invMassA > toScalar(0.0f)) {
+                posX[a] = posX[a] + cx * invMassA;
+                posY[a] = posY[a] + cy * invMassA;
+            }
+            if (invMassB > toScalar(0.0f)) {
+                posX[b] = posX[b] - cx * invMassB;
+                posY[b] = posY[b] - cy * invMassB;
+            }
+        }
+    }
+
+    void PhysicsBodyStore::writeBack() {
+        for (int i = 0; i < rigidCount; i++) {
+            PhysicsActor* pa = actors[i];
+            pa->position = Vector2(posX[i], posY[i]);
+            pa->velocity = Vector2(velX[i], velY[i]);
+            static_cast<RigidActor*>(pa)->force = Vector2(toScalar(0.0f), toScalar(0.0f));
+        }
+        // Bodies woken by a contact this step.
+        for (int i = kCapacity - (count - rigidCount); i < kCapacity; i++) {
+            if (invMass[i] > toScalar(0.0f)) {
+                actors[i]->position = Vector2(posX[i], posY[i]);
+                actors[i]->velocity = Vector2(velX[i], velY[i]);
+            }
+        }
+    }
+
+} // namespace pixelroot32::physics
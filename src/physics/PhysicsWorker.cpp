@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#include "physics/PhysicsWorker.h"
+
+namespace pixelroot32::physics {
+
+namespace {
+
+/// Native: yields before an idle worker sleeps; a step dispatches in bursts.
+constexpr int kSpinsBeforeSleep = 256;
+
+} // namespace
+
+PhysicsWorker::~PhysicsWorker() {
+    stop();
+}
+
+bool PhysicsWorker::start(const pixelroot32::platforms::PlatformCapabilities& caps) {
+#if defined(ESP32)
+    // A second core is the whole point; on single-core chips the step stays serial.
+    if (!caps.hasDualCore) {
+        return false;
+    }
+#endif
+    return worker.start("PhysicsTask", caps.physicsWorkerCoreId, caps.physicsWorkerPriority, kSpinsBeforeSleep);
+}
+
+void PhysicsWorker::stop() {
+    worker.stop();
+}
+
+} // namespace pixelroot32::physics
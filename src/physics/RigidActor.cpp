@@ -22,11 +22,13 @@ RigidActor::RigidActor(pixelroot32::math::Vector2 position, int w, int h)
 
 void RigidActor::applyForce(const pixelroot32::math::Vector2& f) {
     force += f;
+    if (!f.is_zero_approx()) wakeUp();
 }
 
 void RigidActor::applyImpulse(const pixelroot32::math::Vector2& j) {
     if (mass > pixelroot32::math::toScalar(0.0f)) {
         velocity += j * (pixelroot32::math::toScalar(1.0f) / mass);
+        if (!j.is_zero_approx()) wakeUp();
     }
 }
 
@@ -36,8 +38,7 @@ void RigidActor::integrate(pixelroot32::math::Scalar dt) {
     using math::Vector2;
     using math::toScalar;
 
-    Scalar worldGravityY = toScalar(200.0f); 
-    force.y += worldGravityY * gravityScale * mass;
+    force.y += kGravity * gravityScale * mass;
 
     if (mass > toScalar(0.0f)) {
         Vector2 acceleration = force * (toScalar(1.0f) / mass);
@@ -26,46 +26,147 @@ namespace pixelroot32::physics {
     using math::Vector2;
     using math::toScalar;
 
-    Actor* SpatialGrid::staticCells[SpatialGrid::kMaxCells][SpatialGrid::kMaxStaticPerCell];
-    int SpatialGrid::staticCellCounts[SpatialGrid::kMaxCells];
-    Actor* SpatialGrid::dynamicCells[SpatialGrid::kMaxCells][SpatialGrid::kMaxDynamicPerCell];
-    int SpatialGrid::dynamicCellCounts[SpatialGrid::kMaxCells];
+    namespace {
+        /// Cell coordinate of a world pixel relative to @p origin (floor division).
+        inline int cellOf(Scalar v, int origin) {
+            const int rel = math::floorToInt(v) - origin;
+            return rel >= 0 ? rel / SpatialGrid::kCellSize : -((-rel + SpatialGrid::kCellSize - 1) / SpatialGrid::kCellSize);
+        }
+
+        template <int Cap>
+        inline bool addToCell(Actor* (&cell)[Cap], int& count, Actor* actor, bool unique) {
+            if (unique) {
+                for (int i = 0; i < count; ++i) {
+                    if (cell[i] == actor) return true;
+                }
+            }
+            if (count >= Cap) return false;
+            cell[count++] = actor;
+            return true;
+        }
+
+        template <int N>
+        inline void addOnce(Actor* (&list)[N], int& count, Actor* actor) {
+            for (int i = 0; i < count; ++i) {
+                if (list[i] == actor) return;
+            }
+            if (count < N) list[count++] = actor;
+        }
+    }
+
+    SpatialGrid::SpatialGrid() {
+        clear();
+    }
+
+    void SpatialGrid::setWorldBounds(int x, int y, int width, int height) {
+        worldX = x;
+        worldY = y;
+        cols = (width > kCellSize ? width : kCellSize) / kCellSize + 1;
+        rows = (height > kCellSize ? height : kCellSize) / kCellSize + 1;
+        hashed = static_cast<long>(cols) * rows > kMaxCells;
+        clear();
+    }
+
+    SpatialGridStats SpatialGrid::getStats() const {
+        SpatialGridStats stats;
+        stats.staticOverflow = static_cast<uint16_t>(staticOverflowCount);
+        stats.dynamicOverflow = static_cast<uint16_t>(dynamicOverflowCount);
+        stats.outsideWorld = static_cast<uint16_t>(staticOutside + dynamicOutside);
+        stats.hashed = hashed;
+        for (int i = 0; i < kMaxCells; ++i) {
+            const int load = staticCellCounts[i] + dynamicCellCounts[i];
+            if (load > stats.maxCellLoad) stats.maxCellLoad = static_cast<uint16_t>(load);
+        }
+        return stats;
+    }
 
     void SpatialGrid::clear() {
         for (int i = 0; i < kMaxCells; ++i) {
             staticCellCounts[i] = 0;
             dynamicCellCounts[i] = 0;
         }
+        staticOverflowCount = 0;
+        dynamicOverflowCount = 0;
+        staticOutside = 0;
+        dynamicOutside = 0;
+        proxyCount = 0;
         staticDirty = true;
+        dynamicValid = false;
     }
 
     void SpatialGrid::clearDynamic() {
         for (int i = 0; i < kMaxCells; ++i) {
             dynamicCellCounts[i] = 0;
         }
+        dynamicOverflowCount = 0;
+        dynamicOutside = 0;
+        proxyCount = 0;
+        dynamicValid = true;
     }
 
     void SpatialGrid::markStaticDirty() {
         staticDirty = true;
     }
 
-    int IRAM_ATTR SpatialGrid::getCellIndex(Scalar x, Scalar y) const {
-        int ix = static_cast<int>(x) / kCellSize;
-        int iy = static_cast<int>(y) / kCellSize;
-        int cols = pixelroot32::platforms::config::LogicalWidth / kCellSize + 1;
-        int rows = pixelroot32::platforms::config::LogicalHeight / kCellSize + 1;
-        if (ix < 0) ix = 0;
-        if (ix >= cols) ix = cols - 1;
-        if (iy < 0) iy = 0;
-        if (iy >= rows) iy = rows - 1;
-        return iy * cols + ix;
+    bool IRAM_ATTR SpatialGrid::getCellRange(const Rect& rect, int& minCol, int& minRow, int& maxCol, int& maxRow) const {
+        minCol = cellOf(rect.position.x, worldX);
+        minRow = cellOf(rect.position.y, worldY);
+        maxCol = cellOf(rect.position.x + toScalar(rect.width), worldX);
+        maxRow = cellOf(rect.position.y + toScalar(rect.height), worldY);
+        const bool inside = minCol >= 0 && minRow >= 0 && maxCol < cols && maxRow < rows;
+        if (minCol < 0) minCol = 0;
+        if (maxCol >= cols) maxCol = cols - 1;
+        if (minRow < 0) minRow = 0;
+        if (maxRow >= rows) maxRow = rows - 1;
+        // Entirely beyond one side: the border cell holds it.
+        if (minCol > maxCol) minCol = maxCol = (minCol >= cols ? cols - 1 : 0);
+        if (minRow > maxRow) minRow = maxRow = (minRow >= rows ? rows - 1 : 0);
+        return inside;
+    }
+
+    int IRAM_ATTR SpatialGrid::slotOf(int col, int row) const {
+        if (!hashed) return row * cols + col;
+        const uint32_t h = static_cast<uint32_t>(col) * 73856093u ^ static_cast<uint32_t>(row) * 19349663u;
+        return static_cast<int>(h % static_cast<uint32_t>(kMaxCells));
     }
 
-    void SpatialGrid::rebuildStaticIfNeeded(Entity* const* entities, uint16_t entityCount) {
-        if (!staticDirty) return;
+    template <typename Fn>
+    inline void SpatialGrid::forEachCell(int minCol, int minRow, int maxCol, int maxRow, Fn&& fn) const {
+        // A hashed range larger than the slot table touches every slot anyway.
+        if (hashed && static_cast<long>(maxCol - minCol + 1) * (maxRow - minRow + 1) >= kMaxCells) {
+            for (int i = 0; i < kMaxCells; ++i) fn(minCol, minRow, i);
+            return;
+        }
+        for (int r = minRow; r <= maxRow; ++r) {
+            for (int c = minCol; c <= maxCol; ++c) {
+                fn(c, r, slotOf(c, r));
+            }
+        }
+    }
+
+    int SpatialGrid::beginQuery() {
+        queryId++;
+        if (queryId < 0) queryId = 0;
+        return queryId;
+    }
+
+    bool SpatialGrid::insertStatic(Actor* actor) {
+        int minCol, minRow, maxCol, maxRow;
+        if (!getCellRange(actor->getHitBox(), minCol, minRow, maxCol, maxRow)) staticOutside++;
+        bool fits = true;
+        forEachCell(minCol, minRow, maxCol, maxRow, [&](int, int, int idx) {
+            fits &= addToCell(staticCells[idx], staticCellCounts[idx], actor, hashed);
+        });
+        return fits;
+    }
+
+    bool SpatialGrid::rebuildStaticIfNeeded(Entity* const* entities, uint16_t entityCount) {
+        if (!staticDirty) return false;
         for (int i = 0; i < kMaxCells; ++i) {
             staticCellCounts[i] = 0;
         }
+        staticOverflowCount = 0;
+        staticOutside = 0;
         for (uint16_t i = 0; i < entityCount; ++i) {
             Entity* e = entities[i];
             if (e->type != EntityType::ACTOR) continue;
@@ -74,91 +175,224 @@ namespace pixelroot32::physics {
             PhysicsActor* pa = static_cast<PhysicsActor*>(actor);
             if (pa->getBodyType() != PhysicsBodyType::STATIC) continue;
 
-            Rect rect = actor->getHitBox();
-            int minCol = static_cast<int>(rect.position.x) / kCellSize;
-            int minRow = static_cast<int>(rect.position.y) / kCellSize;
-            int maxCol = static_cast<int>(rect.position.x + toScalar(rect.width)) / kCellSize;
-            int maxRow = static_cast<int>(rect.position.y + toScalar(rect.height)) / kCellSize;
-            int cols = pixelroot32::platforms::config::LogicalWidth / kCellSize + 1;
-            int rows = pixelroot32::platforms::config::LogicalHeight / kCellSize + 1;
-            if (minCol < 0) minCol = 0;
-            if (maxCol >= cols) maxCol = cols - 1;
-            if (minRow < 0) minRow = 0;
-            if (maxRow >= rows) maxRow = rows - 1;
-
-            for (int r = minRow; r <= maxRow; ++r) {
-                for (int c = minCol; c <= maxCol; ++c) {
-                    int idx = r * cols + c;
-                    if (staticCellCounts[idx] < kMaxStaticPerCell) {
-                        staticCells[idx][staticCellCounts[idx]++] = actor;
-                    }
-                }
+            if (!insertStatic(actor) && staticOverflowCount < kMaxOverflow) {
+                staticOverflow[staticOverflowCount++] = actor;
             }
         }
         staticDirty = false;
+        return true;
     }
 
-    void IRAM_ATTR SpatialGrid::insertDynamic(Actor* actor) {
-        Rect rect = actor->getHitBox();
-        int minCol = static_cast<int>(rect.position.x) / kCellSize;
-        int minRow = static_cast<int>(rect.position.y) / kCellSize;
-        int maxCol = static_cast<int>(rect.position.x + toScalar(rect.width)) / kCellSize;
-        int maxRow = static_cast<int>(rect.position.y + toScalar(rect.height)) / kCellSize;
-        int cols = pixelroot32::platforms::config::LogicalWidth / kCellSize + 1;
-        int rows = pixelroot32::platforms::config::LogicalHeight / kCellSize + 1;
-        if (minCol < 0) minCol = 0;
-        if (maxCol >= cols) maxCol = cols - 1;
-        if (minRow < 0) minRow = 0;
-        if (maxRow >= rows) maxRow = rows - 1;
+    void IRAM_ATTR SpatialGrid::removeDynamicCells(const DynamicProxy& proxy, int keepMinCol, int keepMinRow,
+                                                   int keepMaxCol, int keepMaxRow) {
+        Actor* actor = proxy.actor;
+        forEachCell(proxy.minCol, proxy.minRow, proxy.maxCol, proxy.maxRow, [&](int c, int r, int idx) {
+            if (c >= keepMinCol && c <= keepMaxCol && r >= keepMinRow && r <= keepMaxRow) return;
+            Actor** cell = dynamicCells[idx];
+            int& count = dynamicCellCounts[idx];
+            for (int i = 0; i < count; ++i) {
+                if (cell[i] == actor) {
+                    cell[i] = cell[--count];
+                    return;
+                }
+            }
+        });
+    }
 
-        for (int r = minRow; r <= maxRow; ++r) {
-            for (int c = minCol; c <= maxCol; ++c) {
-                int idx = r * cols + c;
-                if (dynamicCellCounts[idx] < kMaxDynamicPerCell) {
-                    dynamicCells[idx][dynamicCellCounts[idx]++] = actor;
+    bool SpatialGrid::syncDynamic(Actor* actor) {
+        return syncDynamic(actor, actor->getHitBox());
+    }
+
+    bool IRAM_ATTR SpatialGrid::syncDynamic(Actor* actor, const Rect& box) {
+        int minCol, minRow, maxCol, maxRow;
+        const bool outside = !getCellRange(box, minCol, minRow, maxCol, maxRow);
+
+        int index = actor->broadphaseProxy;
+        const bool known = index >= 0 && index < proxyCount && proxies[index].actor == actor;
+        if (!known) {
+            if (proxyCount >= kMaxOverflow) return false;
+            index = proxyCount++;
+            actor->broadphaseProxy = static_cast<int16_t>(index);
+            proxies[index] = DynamicProxy{actor, 0, 0, -1, -1, false, false};
+        }
+        DynamicProxy& proxy = proxies[index];
+        if (known && proxy.minCol == minCol && proxy.minRow == minRow &&
+            proxy.maxCol == maxCol && proxy.maxRow == maxRow) {
+            return false;
+        }
+
+        // Dense grids only touch the cells left and entered. Hashed slots can repeat within a
+        // range, and an overflowed actor may be missing from kept cells: those start over.
+        const bool diff = known && !hashed && !proxy.overflowed;
+        if (known) {
+            if (diff) removeDynamicCells(proxy, minCol, minRow, maxCol, maxRow);
+            else removeDynamicCells(proxy, 0, 0, -1, -1);
+        }
+        bool fits = true;
+        forEachCell(minCol, minRow, maxCol, maxRow, [&](int c, int r, int idx) {
+            if (diff && c >= proxy.minCol && c <= proxy.maxCol && r >= proxy.minRow && r <= proxy.maxRow) return;
+            fits &= addToCell(dynamicCells[idx], dynamicCellCounts[idx], actor, hashed);
+        });
+
+        if (!fits && !proxy.overflowed) {
+            addOnce(dynamicOverflow, dynamicOverflowCount, actor);
+        } else if (fits && proxy.overflowed) {
+            for (int i = 0; i < dynamicOverflowCount; ++i) {
+                if (dynamicOverflow[i] == actor) {
+                    dynamicOverflow[i] = dynamicOverflow[--dynamicOverflowCount];
+                    break;
                 }
             }
         }
+        if (outside != proxy.outside) {
+            dynamicOutside = static_cast<uint16_t>(outside ? dynamicOutside + 1 : dynamicOutside - 1);
+        }
+        proxy.minCol = static_cast<int16_t>(minCol);
+        proxy.minRow = static_cast<int16_t>(minRow);
+        proxy.maxCol = static_cast<int16_t>(maxCol);
+        proxy.maxRow = static_cast<int16_t>(maxRow);
+        proxy.overflowed = !fits;
+        proxy.outside = outside;
+        return true;
     }
 
-    void IRAM_ATTR SpatialGrid::getPotentialColliders(Actor* actor, Actor** outArray, int& count, int maxCount) {
-        Rect rect = actor->getHitBox();
-        int minCol = static_cast<int>(rect.position.x) / kCellSize;
-        int minRow = static_cast<int>(rect.position.y) / kCellSize;
-        int maxCol = static_cast<int>(rect.position.x + toScalar(rect.width)) / kCellSize;
-        int maxRow = static_cast<int>(rect.position.y + toScalar(rect.height)) / kCellSize;
-        int cols = pixelroot32::platforms::config::LogicalWidth / kCellSize + 1;
-        int rows = pixelroot32::platforms::config::LogicalHeight / kCellSize + 1;
-        if (minCol < 0) minCol = 0;
-        if (maxCol >= cols) maxCol = cols - 1;
-        if (minRow < 0) minRow = 0;
-        if (maxRow >= rows) maxRow = rows - 1;
+    template <typename Visitor>
+    inline void SpatialGrid::visitCells(int minCol, int minRow, int maxCol, int maxRow, int id, Visitor&& visit) {
+        auto offer = [&](Actor* other) {
+            if (other->queryId != id) {
+                other->queryId = id;
+                visit(other);
+            }
+        };
+        forEachCell(minCol, minRow, maxCol, maxRow, [&](int, int, int idx) {
+            for (int i = 0; i < staticCellCounts[idx]; ++i) offer(staticCells[idx][i]);
+            for (int i = 0; i < dynamicCellCounts[idx]; ++i) offer(dynamicCells[idx][i]);
+        });
+        // Bodies that did not fit in a full cell are always candidates.
+        for (int i = 0; i < staticOverflowCount; ++i) offer(staticOverflow[i]);
+        for (int i = 0; i < dynamicOverflowCount; ++i) offer(dynamicOverflow[i]);
+    }
+
+    void SpatialGrid::getPotentialColliders(Actor* actor, Actor** outArray, int& count, int maxCount) {
+        getPotentialColliders(actor, actor->getHitBox(), outArray, count, maxCount);
+    }
+
+    void IRAM_ATTR SpatialGrid::getPotentialColliders(Actor* actor, const Rect& box, Actor** outArray, int& count, int maxCount) {
+        int minCol, minRow, maxCol, maxRow;
+        getCellRange(box, minCol, minRow, maxCol, maxRow);
 
         count = 0;
-        queryId++;
-        if (queryId < 0) queryId = 0;
+        visitCells(minCol, minRow, maxCol, maxRow, beginQuery(), [&](Actor* other) {
+            if (other != actor && count < maxCount) outArray[count++] = other;
+        });
+    }
 
-        for (int r = minRow; r <= maxRow; ++r) {
-            for (int c = minCol; c <= maxCol; ++c) {
-                int idx = r * cols + c;
-                for (int i = 0; i < staticCellCounts[idx] && count < maxCount; ++i) {
-                    Actor* other = staticCells[idx][i];
-                    if (other == actor) continue;
-                    if (other->queryId != queryId) {
-                        other->queryId = queryId;
-                        outArray[count++] = other;
-                    }
-                }
-                for (int i = 0; i < dynamicCellCounts[idx] && count < maxCount; ++i) {
-                    Actor* other = dynamicCells[idx][i];
-                    if (other == actor) continue;
-                    if (other->queryId != queryId) {
-                        other->queryId = queryId;
-                        outArray[count++] = other;
-                    }
+    void IRAM_ATTR SpatialGrid::queryAABB(const Rect& box, const QueryFilter& filter, SpatialQueryResults& out) {
+        out.clear();
+        int minCol, minRow, maxCol, maxRow;
+        getCellRange(box, minCol, minRow, maxCol, maxRow);
+        visitCells(minCol, minRow, maxCol, maxRow, beginQuery(), [&](Actor* other) {
+            if (filter.accepts(other) && box.intersects(other->getHitBox())) out.add(other);
+        });
+    }
+
+    void IRAM_ATTR SpatialGrid::queryPoint(Vector2 point, const QueryFilter& filter, SpatialQueryResults& out) {
+        queryAABB(Rect{point, 0, 0}, filter, out);
+    }
+
+    void IRAM_ATTR SpatialGrid::querySwept(const Rect& box, Vector2 motion, const QueryFilter& filter,
+                                           SpatialQueryResults& out) {
+        out.clear();
+        int minCol, minRow, maxCol, maxRow;
+        getCellRange(sweptBounds(box, motion), minCol, minRow, maxCol, maxRow);
+        visitCells(minCol, minRow, maxCol, maxRow, beginQuery(), [&](Actor* other) {
+            Scalar t;
+            Vector2 n;
+            if (filter.accepts(other) && sweepRectVsRect(box, motion, other->getHitBox(), t, n)) out.add(other);
+        });
+    }
+
+    bool IRAM_ATTR SpatialGrid::raycast(Vector2 origin, Vector2 direction, Scalar maxDistance,
+                                        const QueryFilter& filter, RaycastHit& outHit) {
+        const Scalar zero = toScalar(0.0f);
+        const Scalar length = direction.length();
+        if (length < math::kEpsilon || maxDistance <= zero) return false;
+        const Vector2 dir = direction / length;
+        const Vector2 ray = dir * maxDistance;
+        const Rect point{origin, 0, 0};
+
+        // DDA over clamped cells: border cells extend to infinity, so they have no far boundary.
+        const Scalar cell = toScalar(kCellSize);
+        const Scalar never = maxDistance + toScalar(1.0f);
+        int cx = cellOf(origin.x, worldX);
+        int cy = cellOf(origin.y, worldY);
+        cx = cx < 0 ? 0 : (cx >= cols ? cols - 1 : cx);
+        cy = cy < 0 ? 0 : (cy >= rows ? rows - 1 : cy);
+        const int stepX = dir.x > zero ? 1 : -1;
+        const int stepY = dir.y > zero ? 1 : -1;
+        // Near-axis-aligned components are treated as zero so cell / |d| stays in Fixed16 range.
+        const Scalar minComponent = toScalar(1.0f / 512.0f);
+        const bool movesX = math::abs(dir.x) >= minComponent;
+        const bool movesY = math::abs(dir.y) >= minComponent;
+        const Scalar deltaX = movesX ? cell / math::abs(dir.x) : never;
+        const Scalar deltaY = movesY ? cell / math::abs(dir.y) : never;
+        auto boundaryT = [&](bool moves, int c, int step, int last, int world, Scalar o, Scalar d) {
+            if (!moves || (step > 0 && c == last) || (step < 0 && c == 0)) return never;
+            const Scalar edge = toScalar(world + (step > 0 ? c + 1 : c) * kCellSize);
+            return (edge - o) / d;
+        };
+        Scalar tMaxX = boundaryT(movesX, cx, stepX, cols - 1, worldX, origin.x, dir.x);
+        Scalar tMaxY = boundaryT(movesY, cy, stepY, rows - 1, worldY, origin.y, dir.y);
+
+        bool hit = false;
+        const int id = beginQuery();
+        for (;;) {
+            visitCells(cx, cy, cx, cy, id, [&](Actor* other) {
+                Scalar t;
+                Vector2 n;
+                if (!filter.accepts(other) || !sweepRectVsRect(point, ray, other->getHitBox(), t, n)) return;
+                const Scalar distance = t * maxDistance;
+                if (!hit || distance < outHit.distance) {
+                    hit = true;
+                    outHit.actor = other;
+                    outHit.distance = distance;
+                    outHit.point = origin + dir * distance;
+                    outHit.normal = n;
                 }
+            });
+            const Scalar cellExit = tMaxX < tMaxY ? tMaxX : tMaxY;
+            if ((hit && outHit.distance <= cellExit) || cellExit > maxDistance) break;
+            if (tMaxX < tMaxY) {
+                cx += stepX;
+                tMaxX = (stepX > 0 ? cx == cols - 1 : cx == 0) ? never : tMaxX + deltaX;
+            } else {
+                cy += stepY;
+                tMaxY = (stepY > 0 ? cy == rows - 1 : cy == 0) ? never : tMaxY + deltaY;
             }
         }
+        return hit;
+    }
+
+    Rect SpatialGrid::sweptBounds(const Rect& box, Vector2 motion) {
+        const Scalar zero = toScalar(0.0f);
+        Rect bounds = box;
+        if (motion.x < zero) bounds.position.x += motion.x;
+        if (motion.y < zero) bounds.position.y += motion.y;
+        bounds.width += static_cast<int>(math::abs(motion.x)) + 1;
+        bounds.height += static_cast<int>(math::abs(motion.y)) + 1;
+        return bounds;
+    }
+
+    QueryFilter QueryFilter::forActor(const Actor* actor) {
+        QueryFilter filter;
+        filter.layer = actor->layer;
+        filter.mask = actor->mask;
+        filter.exclude = actor;
+        return filter;
+    }
+
+    bool QueryFilter::accepts(const Actor* other) const {
+        return other != exclude && ((mask & other->layer) != 0 || (layer & other->mask) != 0);
     }
 
 } // namespace pixelroot32::physics
@@ -23,11 +23,15 @@ PlatformCapabilities PlatformCapabilities::detect() {
     caps.coreCount = 1;
     caps.audioCoreId = 0;
     caps.mainCoreId = 0;
+    caps.presentWorkerCoreId = 0;
+    caps.physicsWorkerCoreId = 0;
 #else
     caps.hasDualCore = true;
     caps.coreCount = 2;
     caps.audioCoreId = PR32_DEFAULT_AUDIO_CORE; // Use defaults from PlatformDefaults.h
     caps.mainCoreId = PR32_DEFAULT_MAIN_CORE;   // Use defaults from PlatformDefaults.h
+    caps.presentWorkerCoreId = PR32_DEFAULT_PRESENT_WORKER_CORE;
+    caps.physicsWorkerCoreId = PR32_DEFAULT_PHYSICS_WORKER_CORE;
 #endif
 
     // Basic feature detection
@@ -42,6 +46,8 @@ PlatformCapabilities PlatformCapabilities::detect() {
     // If single core, we elevate priority so audio isn't starved by U8G2
     // but keep it at 18 (not 24) to avoid extreme display transfer fragmentation
     caps.audioPriority = caps.hasDualCore ? 5 : 18;
+    caps.presentWorkerPriority = PR32_DEFAULT_PRESENT_WORKER_PRIORITY;
+    caps.physicsWorkerPriority = PR32_DEFAULT_PHYSICS_WORKER_PRIORITY;
 
 #elif defined(PLATFORM_NATIVE)
     // For Native (SDL2), we simulate dual-core behavior with threads
@@ -50,6 +56,8 @@ PlatformCapabilities PlatformCapabilities::detect() {
     caps.audioCoreId = 0;
     caps.mainCoreId = 0;
     caps.audioPriority = 5;
+    caps.presentWorkerPriority = PR32_DEFAULT_PRESENT_WORKER_PRIORITY;
+    caps.physicsWorkerPriority = PR32_DEFAULT_PHYSICS_WORKER_PRIORITY;
 #else
     // Default fallback
     caps.hasDualCore = false;
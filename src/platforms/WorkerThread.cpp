@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#include "platforms/WorkerThread.h"
+
+#if defined(PLATFORM_NATIVE)
+#include <chrono>
+#endif
+
+namespace pixelroot32::platforms {
+
+namespace {
+
+#if defined(PLATFORM_NATIVE)
+/// Spin briefly (jobs come in bursts), then sleep so an idle side costs nothing.
+void backoff(int& spins, int limit) {
+    if (++spins < limit) {
+        std::this_thread::yield();
+    } else {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+}
+#endif
+
+} // namespace
+
+WorkerThread::~WorkerThread() {
+    stop();
+}
+
+bool WorkerThread::start(const char* name, int core, int priority, int spinsBeforeSleep) {
+    if (isRunning()) {
+        return true;
+    }
+    spinLimit = spinsBeforeSleep;
+    state.store(kIdle, std::memory_order_relaxed);
+#if defined(PLATFORM_NATIVE)
+    (void)name;
+    (void)core;
+    (void)priority;
+    running.store(true, std::memory_order_release);
+    worker = std::thread(&WorkerThread::workerLoop, this);
+    return true;
+#elif defined(ESP32)
+    running.store(true, std::memory_order_release);
+    workerExited.store(false, std::memory_order_release);
+    if (xTaskCreatePinnedToCore(workerTrampoline, name, 4096, this, priority, &workerTask, core) != pdPASS) {
+        workerTask = nullptr;
+        workerExited.store(true, std::memory_order_release);
+        running.store(false, std::memory_order_release);
+        return false;
+    }
+    return true;
+#else
+    (void)name;
+    (void)core;
+    (void)priority;
+    return false;
+#endif
+}
+
+void WorkerThread::stop() {
+    if (!isRunning()) {
+        return;
+    }
+    wait();
+    running.store(false, std::memory_order_release);
+#if defined(PLATFORM_NATIVE)
+    if (worker.joinable()) {
+        worker.join();
+    }
+#elif defined(ESP32)
+    xTaskNotifyGive(workerTask);
+    while (!workerExited.load(std::memory_order_acquire)) {
+        vTaskDelay(1);
+    }
+    workerTask = nullptr;
+#endif
+}
+
+void WorkerThread::dispatch(JobFn fn, void* ctx) {
+    jobFn = fn;
+    jobCtx = ctx;
+#if defined(ESP32)
+    callerTask = xTaskGetCurrentTaskHandle();
+#endif
+    state.store(kReady, std::memory_order_release);
+#if defined(ESP32)
+    xTaskNotifyGive(workerTask);
+#endif
+}
+
+void WorkerThread::wait() {
+    if (!isRunning()) {
+        return;
+    }
+#if defined(PLATFORM_NATIVE)
+    int spins = 0;
+    while (state.load(std::memory_order_acquire) != kIdle) {
+        backoff(spins, spinLimit);
+    }
+#elif defined(ESP32)
+    while (state.load(std::memory_order_acquire) != kIdle) {
+        ulTaskNotifyTake(pdTRUE, 1);
+    }
+#endif
+}
+
+void WorkerThread::workerLoop() {
+#if defined(PLATFORM_NATIVE)
+    int spins = 0;
+    while (running.load(std::memory_order_acquire)) {
+        if (state.load(std::memory_order_acquire) == kReady) {
+            jobFn(jobCtx);
+            state.store(kIdle, std::memory_order_release);
+            spins = 0;
+        } else {
+            backoff(spins, spinLimit);
+        }
+    }
+#elif defined(ESP32)
+    while (running.load(std::memory_order_acquire)) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (state.load(std::memory_order_acquire) == kReady) {
+            jobFn(jobCtx);
+            state.store(kIdle, std::memory_order_release);
+            xTaskNotifyGive(callerTask);
+        }
+    }
+    workerExited.store(true, std::memory_order_release);
+#endif
+}
+
+#if defined(ESP32)
+void WorkerThread::workerTrampoline(void* param) {
+    static_cast<WorkerThread*>(param)->workerLoop();
+    vTaskDelete(nullptr);
+}
+#endif
+
+} // namespace pixelroot32::platforms
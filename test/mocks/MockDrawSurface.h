@@ -33,7 +33,16 @@ public:
 
     void init() override {}
     void clearBuffer() override { calls.clear(); }
-    void sendBuffer() override {}
+    void sendBuffer() override {
+        ++sendCount;
+        lastSendWasPartial = (presentDirtyGrid != nullptr);
+    }
+
+    void setPresentDirtyGrid(const DirtyGrid* grid) override { presentDirtyGrid = grid; }
+
+    const DirtyGrid* presentDirtyGrid = nullptr;
+    bool lastSendWasPartial = false;
+    int sendCount = 0;
     
     void present() override {}
     
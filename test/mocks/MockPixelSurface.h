@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026 PixelRoot32
+ * Licensed under the MIT License
+ */
+#pragma once
+
+#include "mocks/MockDrawSurface.h"
+#include "graphics/FramebufferFormat.h"
+
+namespace pixelroot32::graphics {
+
+/**
+ * @class MockPixelSurface
+ * @brief Emulates a TFT_eSprite that does not expose its buffer.
+ *
+ * Every pixel and filled rectangle goes through the virtual primitives and is
+ * packed into a caller-owned framebuffer, so tests can compare it pixel for
+ * pixel with a surface whose buffer the Renderer writes directly.
+ */
+class MockPixelSurface : public MockDrawSurface {
+public:
+    MockPixelSurface(FramebufferPixel* fb, int w) : fb(fb), w(w) {}
+
+    void drawPixel(int x, int y, uint16_t color) override {
+        fb[y * w + x] = packRgb565ToFramebuffer(color);
+    }
+
+    void drawFilledRectangle(int x, int y, int rw, int rh, uint16_t color) override {
+        for (int j = 0; j < rh; j++) {
+            for (int i = 0; i < rw; i++) {
+                drawPixel(x + i, y + j, color);
+            }
+        }
+    }
+
+private:
+    FramebufferPixel* fb;
+    int w;
+};
+
+} // namespace pixelroot32::graphics
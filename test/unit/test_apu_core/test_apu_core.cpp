@@ -13,13 +13,33 @@
  * - LFO oscillator (via generateSamples)
  * - Sample generation (main audio loop)
  * - Bitcrusher
+ * - Block renderer against the per-sample reference
+ * - Band-limited oscillators
  */
 
 #include <unity.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include "../../test_config.h"
 #include "audio/ApuCore.h"
 #include "audio/AudioTypes.h"
+#include "audio/AudioMusicTypes.h"
+#include "audio/AudioBandLimitedLUT.h"
+#include "audio/AudioMixerLUT.h"
+
+#ifdef ESP32
+#include <soc/soc_caps.h>
+#endif
+
+// Same selection as ApuCore.cpp: no-FPU ESP32 cores and the native_test_apu_q15
+// build mix in Q15 through the mixer LUT.
+#if (defined(ESP32) && (!defined(SOC_CPU_HAS_FPU) || !SOC_CPU_HAS_FPU)) || defined(PIXELROOT32_APU_FORCE_Q15_MIX)
+#define APU_TEST_Q15_MIX 1
+#endif
 
 using namespace pixelroot32::audio;
 
@@ -789,6 +809,321 @@ void test_apu_core_integration_multiple_voices(void) {
     TEST_ASSERT_TRUE(hasNonZero);
 }
 
+// =============================================================================
+// Block renderer vs per-sample reference
+// =============================================================================
+
+/** Largest output change between neighbouring mixer-LUT entries. */
+static constexpr int mixer_lut_max_step() {
+    int step = 0;
+    for (int i = 1; i < 1025; ++i) {
+        const int d = audio_mixer_lut[i] - audio_mixer_lut[i - 1];
+        step = std::max(step, d < 0 ? -d : d);
+    }
+    return step;
+}
+
+// Largest per-sample difference allowed between the renderers when pitch is
+// not modulated (gain ramps are exact on the piecewise-linear ADSR; only
+// float rounding and the control-rate tremolo step differ).
+#ifdef APU_TEST_Q15_MIX
+// The Q15 renderers round each voice on its own, so their mix sums differ by
+// a few units. The mixer LUT spaces its entries 256 input units apart and
+// interpolates between them. A 32-unit difference therefore moves the output
+// by at most 1/8 of the steepest LUT step, halved into Q14 for master volume.
+static constexpr int Q15_MIX_SUM_SLACK = 32;
+static constexpr int BLOCK_RENDER_TOLERANCE = Q15_MIX_SUM_SLACK * mixer_lut_max_step() / 256 / 2 + 1;
+#else
+static constexpr int BLOCK_RENDER_TOLERANCE = 8;
+#endif
+
+static void playEvent(ApuCore& apu, WaveType type, float freq, float dur, float vol,
+                      const InstrumentPreset* preset = nullptr,
+                      float sweepEndHz = 0.0f, float sweepDurationSec = 0.0f) {
+    AudioCommand cmd;
+    cmd.type = AudioCommandType::PLAY_EVENT;
+    cmd.event.type = type;
+    cmd.event.frequency = freq;
+    cmd.event.duration = dur;
+    cmd.event.volume = vol;
+    cmd.event.duty = 0.25f;
+    cmd.event.preset = preset;
+    cmd.event.sweepEndHz = sweepEndHz;
+    cmd.event.sweepDurationSec = sweepDurationSec;
+    apu.submitCommand(cmd);
+}
+
+static InstrumentPreset makePreset(float attack, float decay, float sustain, float release,
+                                   LfoTarget lfo = LfoTarget::NONE, float lfoHz = 0.0f,
+                                   float lfoDepth = 0.0f, float lfoDelay = 0.0f) {
+    InstrumentPreset p{0.5f, 0.25f, 4};
+    p.attackTime = attack;
+    p.decayTime = decay;
+    p.sustainLevel = sustain;
+    p.releaseTime = release;
+    p.lfoTarget = lfo;
+    p.lfoFrequency = lfoHz;
+    p.lfoDepth = lfoDepth;
+    p.lfoDelay = lfoDelay;
+    return p;
+}
+
+/**
+ * Renders the same scene through both renderers in uneven buffer sizes and
+ * checks that voices start and stop on the same buffers.
+ */
+template <typename Setup>
+static void renderBoth(Setup setup, int16_t* reference, int16_t* block, int total) {
+    ApuCore refApu;
+    ApuCore blockApu;
+    refApu.init(44100);
+    blockApu.init(44100);
+    refApu.setBlockRenderForTesting(false);
+    blockApu.setBlockRenderForTesting(true);
+    setup(refApu);
+    setup(blockApu);
+
+    static const int kChunks[] = {300, 64, 517, 128, 1};
+    int pos = 0;
+    for (int n = 0; pos < total; ++n) {
+        const int len = std::min(kChunks[n % 5], total - pos);
+        refApu.generateSamples(reference + pos, len);
+        blockApu.generateSamples(block + pos, len);
+        TEST_ASSERT_EQUAL(refApu.countEnabledVoicesForTesting(), blockApu.countEnabledVoicesForTesting());
+        pos += len;
+    }
+}
+
+void test_apu_core_block_render_matches_reference(void) {
+    static const InstrumentPreset adsr = makePreset(0.01f, 0.05f, 0.6f, 0.03f);
+    static InstrumentPreset dutySweep = makePreset(0.002f, 0.0f, 1.0f, 0.02f);
+    dutySweep.dutySweep = 0.8f;
+    static const InstrumentPreset tremolo = makePreset(0.004f, 0.02f, 0.8f, 0.05f,
+                                                       LfoTarget::VOLUME, 7.0f, 0.6f, 0.01f);
+
+    constexpr int kTotal = 22050;
+    static int16_t reference[kTotal];
+    static int16_t block[kTotal];
+    renderBoth([](ApuCore& apu) {
+        playEvent(apu, WaveType::PULSE, 440.0f, 0.12f, 0.6f, &adsr);
+        playEvent(apu, WaveType::PULSE, 330.0f, 0.2f, 0.4f, &dutySweep);
+        playEvent(apu, WaveType::TRIANGLE, 220.0f, 0.3f, 0.7f, &tremolo);
+        playEvent(apu, WaveType::SAW, 523.25f, 0.08f, 0.5f, &adsr);
+        playEvent(apu, WaveType::SINE, 660.0f, 0.25f, 0.5f);
+        playEvent(apu, WaveType::NOISE, 4000.0f, 0.1f, 0.5f, &adsr);
+    }, reference, block, kTotal);
+
+    int maxDiff = 0;
+    bool hasSignal = false;
+    for (int i = 0; i < kTotal; ++i) {
+        maxDiff = std::max(maxDiff, std::abs((int)reference[i] - (int)block[i]));
+        hasSignal = hasSignal || reference[i] != 0;
+    }
+    TEST_ASSERT_TRUE(hasSignal);
+    TEST_ASSERT_LESS_OR_EQUAL(BLOCK_RENDER_TOLERANCE, maxDiff);
+}
+
+void test_apu_core_block_render_pitch_modulation_matches_reference(void) {
+    static const InstrumentPreset vibrato = makePreset(0.005f, 0.1f, 0.7f, 0.05f,
+                                                       LfoTarget::PITCH, 5.0f, 0.03f, 0.02f);
+    constexpr int kTotal = 22050;
+    static int16_t reference[kTotal];
+    static int16_t block[kTotal];
+    renderBoth([](ApuCore& apu) {
+        playEvent(apu, WaveType::PULSE, 440.0f, 0.4f, 0.6f, &vibrato);
+        playEvent(apu, WaveType::TRIANGLE, 880.0f, 0.3f, 0.6f, nullptr, 220.0f, 0.25f);
+        playEvent(apu, WaveType::SAW, 110.0f, 0.35f, 0.4f, &vibrato, 440.0f, 0.2f);
+    }, reference, block, kTotal);
+
+    // Pitch ramps are linear per control interval, so oscillator edges may
+    // land one sample apart: compare error energy against signal energy.
+    double signal = 0.0;
+    double error = 0.0;
+    for (int i = 0; i < kTotal; ++i) {
+        const double d = (double)reference[i] - (double)block[i];
+        signal += (double)reference[i] * (double)reference[i];
+        error += d * d;
+    }
+    TEST_ASSERT_GREATER_THAN(0.0, signal);
+    TEST_ASSERT_TRUE(error <= signal * 1e-3);
+}
+
+void test_apu_core_block_render_benchmark(void) {
+    constexpr int kBlock = 256;
+    constexpr int kBlocks = 400;
+    static const InstrumentPreset lead = makePreset(0.01f, 0.1f, 0.7f, 0.1f,
+                                                    LfoTarget::PITCH, 5.0f, 0.02f, 0.0f);
+    auto time = [&](bool blockRender) {
+        ApuCore apu;
+        apu.init(44100);
+        apu.setBlockRenderForTesting(blockRender);
+        static const WaveType kTypes[] = {WaveType::PULSE, WaveType::TRIANGLE, WaveType::SAW, WaveType::SINE};
+        for (int v = 0; v < ApuCore::MAX_VOICES; ++v) {
+            playEvent(apu, kTypes[v % 4], 110.0f * (float)(v + 1), 60.0f, 0.2f, &lead);
+        }
+        int16_t buffer[kBlock];
+        const auto t0 = std::chrono::high_resolution_clock::now();
+        for (int b = 0; b < kBlocks; ++b) {
+            apu.generateSamples(buffer, kBlock);
+        }
+        const auto t1 = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::nano>(t1 - t0).count() / (kBlock * kBlocks);
+    };
+    const double perSample = time(false);
+    const double blockRender = time(true);
+
+    char msg[128];
+    std::snprintf(msg, sizeof(msg), "ns/sample with %d voices: per-sample %.1f | block %.1f",
+                  ApuCore::MAX_VOICES, perSample, blockRender);
+    TEST_MESSAGE(msg);
+}
+
+// =============================================================================
+// Band-limited oscillators
+// =============================================================================
+
+/**
+ * Energy in DFT bins that are not harmonics of the note, relative to the
+ * harmonic energy. The note sits on a bin, so a clean oscillator has nothing
+ * between harmonics and everything there is aliasing.
+ */
+static double aliasRatio(const int16_t* x, int n, int harmonicBin) {
+    double harmonic = 0.0;
+    double alias = 0.0;
+    for (int bin = 1; bin < n / 2; ++bin) {
+        double re = 0.0;
+        double im = 0.0;
+        for (int i = 0; i < n; ++i) {
+            const double w = 2.0 * 3.14159265358979 * (double)bin * (double)i / (double)n;
+            re += (double)x[i] * std::cos(w);
+            im -= (double)x[i] * std::sin(w);
+        }
+        const double e = re * re + im * im;
+        if (bin % harmonicBin == 0) harmonic += e;
+        else alias += e;
+    }
+    return alias / harmonic;
+}
+
+/**
+ * Renders a 1730 Hz note at 22050 Hz with and without band limiting and
+ * returns both alias ratios. 10 Hz bins over 2205 samples put the harmonics
+ * every 173 bins.
+ */
+static void measureAliasing(WaveType type, float volume, double& naiveAlias, double& cleanAlias) {
+    constexpr int kRate = 22050;
+    constexpr int kWindow = 2205;
+    constexpr float kFreq = 1730.0f;
+    static const InstrumentPreset naive = makePreset(0.002f, 0.0f, 1.0f, 0.005f);
+    static InstrumentPreset bandLimited = naive;
+    bandLimited.bandLimited = true;
+
+    auto render = [&](const InstrumentPreset* preset, int16_t* out) {
+        ApuCore apu;
+        apu.init(kRate);
+        playEvent(apu, type, kFreq, 1.0f, volume, preset);
+        static int16_t warmup[kWindow];
+        apu.generateSamples(warmup, kWindow);  // past the attack and the HPF settling
+        apu.generateSamples(out, kWindow);
+    };
+
+    static int16_t naiveOut[kWindow];
+    static int16_t cleanOut[kWindow];
+    render(&naive, naiveOut);
+    render(&bandLimited, cleanOut);
+    naiveAlias = aliasRatio(naiveOut, kWindow, 173);
+    cleanAlias = aliasRatio(cleanOut, kWindow, 173);
+
+    char msg[128];
+    std::snprintf(msg, sizeof(msg), "wave %d at volume %.1f alias/harmonic energy: naive %.2e | band-limited %.2e",
+                  (int)type, volume, naiveAlias, cleanAlias);
+    TEST_MESSAGE(msg);
+}
+
+void test_apu_core_band_limited_reduces_aliasing(void) {
+    static const WaveType kTypes[] = {WaveType::PULSE, WaveType::SAW, WaveType::TRIANGLE};
+    for (WaveType type : kTypes) {
+        double naiveAlias = 0.0;
+        double cleanAlias = 0.0;
+        // Quiet enough that the soft compressor stays close to linear.
+        measureAliasing(type, 0.1f, naiveAlias, cleanAlias);
+        // At least 10 dB less aliasing.
+        TEST_ASSERT_TRUE(cleanAlias * 10.0 < naiveAlias);
+    }
+}
+
+#ifdef APU_TEST_Q15_MIX
+void test_apu_core_band_limited_q15_full_volume(void) {
+    // The wavetables hold exactly the harmonics below Nyquist, so at full
+    // volume the Q15 path removes about 30 dB of aliasing. The naive triangle
+    // aliases about 20 dB less than the saw to begin with, so it has less to lose.
+    struct Case { WaveType type; double minRatio; };
+    static const Case kCases[] = {
+        {WaveType::PULSE, 1000.0}, {WaveType::SAW, 1000.0}, {WaveType::TRIANGLE, 100.0},
+    };
+    for (const Case& c : kCases) {
+        double naiveAlias = 0.0;
+        double cleanAlias = 0.0;
+        measureAliasing(c.type, 1.0f, naiveAlias, cleanAlias);
+        TEST_ASSERT_TRUE(cleanAlias * c.minRatio < naiveAlias);
+    }
+}
+#endif
+
+void test_apu_core_band_limited_block_render_matches_reference(void) {
+    static InstrumentPreset lead = makePreset(0.005f, 0.05f, 0.7f, 0.03f,
+                                              LfoTarget::PITCH, 5.0f, 0.02f, 0.02f);
+    lead.bandLimited = true;
+    constexpr int kTotal = 22050;
+    static int16_t reference[kTotal];
+    static int16_t block[kTotal];
+    renderBoth([](ApuCore& apu) {
+        playEvent(apu, WaveType::PULSE, 1760.0f, 0.3f, 0.5f, &lead);
+        playEvent(apu, WaveType::SAW, 2637.0f, 0.25f, 0.4f, &lead);
+        playEvent(apu, WaveType::TRIANGLE, 880.0f, 0.3f, 0.5f, &lead, 3520.0f, 0.2f);
+    }, reference, block, kTotal);
+
+    double signal = 0.0;
+    double error = 0.0;
+    for (int i = 0; i < kTotal; ++i) {
+        const double d = (double)reference[i] - (double)block[i];
+        signal += (double)reference[i] * (double)reference[i];
+        error += d * d;
+    }
+    TEST_ASSERT_GREATER_THAN(0.0, signal);
+    TEST_ASSERT_TRUE(error <= signal * 1e-3);
+}
+
+void test_apu_core_band_limited_wavetables_stay_below_level_limit(void) {
+    for (int level = 0; level < BL_WAVETABLE_LEVELS; ++level) {
+        const int harmonics = 64 >> level;
+        const int16_t* tables[] = {BL_SAW_Q15[level], BL_TRIANGLE_Q15[level]};
+        // Fundamental amplitude of the naive saw (2/pi) and triangle (8/pi^2).
+        const double fundamentals[] = {2.0 / 3.14159265358979, 8.0 / (3.14159265358979 * 3.14159265358979)};
+        for (int t = 0; t < 2; ++t) {
+            double above = 0.0;
+            double total = 0.0;
+            double fundamental = 0.0;
+            for (int bin = 1; bin < 128; ++bin) {
+                double re = 0.0;
+                double im = 0.0;
+                for (int i = 0; i < 256; ++i) {
+                    const double w = 2.0 * 3.14159265358979 * (double)bin * (double)i / 256.0;
+                    re += tables[t][i] * std::cos(w);
+                    im -= tables[t][i] * std::sin(w);
+                }
+                const double e = re * re + im * im;
+                total += e;
+                if (bin > harmonics) above += e;
+                if (bin == 1) fundamental = std::sqrt(e) * 2.0 / 256.0 / 32767.0;
+            }
+            // Only int16 rounding above the level's top harmonic.
+            TEST_ASSERT_TRUE(above < total * 1e-7);
+            TEST_ASSERT_FLOAT_WITHIN(0.002, fundamentals[t], fundamental);
+        }
+    }
+}
+
 // =============================================================================
 // Unity test runner
 // =============================================================================
@@ -858,5 +1193,18 @@ int main(int argc, char** argv) {
     RUN_TEST(test_apu_core_integration_full_pipeline);
     RUN_TEST(test_apu_core_integration_multiple_voices);
 
+    // Block renderer tests
+    RUN_TEST(test_apu_core_block_render_matches_reference);
+    RUN_TEST(test_apu_core_block_render_pitch_modulation_matches_reference);
+    RUN_TEST(test_apu_core_block_render_benchmark);
+
+    // Band-limited oscillators
+    RUN_TEST(test_apu_core_band_limited_reduces_aliasing);
+#ifdef APU_TEST_Q15_MIX
+    RUN_TEST(test_apu_core_band_limited_q15_full_volume);
+#endif
+    RUN_TEST(test_apu_core_band_limited_block_render_matches_reference);
+    RUN_TEST(test_apu_core_band_limited_wavetables_stay_below_level_limit);
+
     return UNITY_END();
 }
\ No newline at end of file
@@ -1,5 +1,8 @@
 #include <unity.h>
 #include "audio/AudioCommandQueue.h"
+#include <atomic>
+#include <thread>
+#include <vector>
 
 using namespace pixelroot32::audio;
 
@@ -132,6 +135,165 @@ void test_audio_command_queue_mpsc_drop_counter_accuracy(void) {
     TEST_ASSERT_TRUE(queue2.getDroppedCommands() >= 10);
 }
 
+static AudioCommand makeVolume(float v) {
+    AudioCommand cmd;
+    cmd.type = AudioCommandType::SET_MASTER_VOLUME;
+    cmd.volume = v;
+    return cmd;
+}
+
+static AudioCommand makeBpm(float bpm) {
+    AudioCommand cmd;
+    cmd.type = AudioCommandType::MUSIC_SET_BPM;
+    cmd.bpm = bpm;
+    return cmd;
+}
+
+void test_audio_command_queue_drain_batch_fifo_and_limit(void) {
+    AudioCommandQueue queue;
+    for (int i = 0; i < 20; i++) {
+        AudioCommand cmd;
+        cmd.type = AudioCommandType::STOP_CHANNEL;
+        cmd.channelIndex = (uint8_t)i;
+        TEST_ASSERT_TRUE(queue.enqueue(cmd));
+    }
+
+    AudioCommand batch[8];
+    TEST_ASSERT_EQUAL(8, queue.drainBatch(batch, 8));
+    for (int i = 0; i < 8; i++) {
+        TEST_ASSERT_EQUAL(i, batch[i].channelIndex);
+    }
+    TEST_ASSERT_EQUAL(8, queue.drainBatch(batch, 8));
+    TEST_ASSERT_EQUAL(8, batch[0].channelIndex);
+    TEST_ASSERT_EQUAL(4, queue.drainBatch(batch, 8));
+    TEST_ASSERT_EQUAL(19, batch[3].channelIndex);
+    TEST_ASSERT_EQUAL(0, queue.drainBatch(batch, 8));
+    TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+void test_audio_command_queue_drain_batch_coalesces_settings(void) {
+    AudioCommandQueue queue;
+    AudioCommand stop;
+    stop.type = AudioCommandType::STOP_CHANNEL;
+    stop.channelIndex = 3;
+    AudioCommand play;
+    play.type = AudioCommandType::MUSIC_PLAY;
+
+    queue.enqueue(makeVolume(0.1f));
+    queue.enqueue(makeBpm(90.0f));
+    queue.enqueue(stop);
+    queue.enqueue(makeVolume(0.2f));
+    queue.enqueue(makeBpm(100.0f));
+    queue.enqueue(play);
+    queue.enqueue(makeVolume(0.3f));
+    queue.enqueue(makeBpm(120.0f));
+
+    AudioCommand batch[16];
+    const size_t n = queue.drainBatch(batch, 16);
+
+    // Volume collapses to one command at its first position with the last value;
+    // BPM changes either side of MUSIC_PLAY stay separate.
+    TEST_ASSERT_EQUAL(5, n);
+    TEST_ASSERT_EQUAL(AudioCommandType::SET_MASTER_VOLUME, batch[0].type);
+    TEST_ASSERT_EQUAL_FLOAT(0.3f, batch[0].volume);
+    TEST_ASSERT_EQUAL(AudioCommandType::MUSIC_SET_BPM, batch[1].type);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, batch[1].bpm);
+    TEST_ASSERT_EQUAL(AudioCommandType::STOP_CHANNEL, batch[2].type);
+    TEST_ASSERT_EQUAL(AudioCommandType::MUSIC_PLAY, batch[3].type);
+    TEST_ASSERT_EQUAL(AudioCommandType::MUSIC_SET_BPM, batch[4].type);
+    TEST_ASSERT_EQUAL_FLOAT(120.0f, batch[4].bpm);
+}
+
+void test_audio_command_queue_capacity_reusable_across_laps(void) {
+    AudioCommandQueue queue;
+    AudioCommand cmd;
+    cmd.type = AudioCommandType::STOP_CHANNEL;
+    AudioCommand out;
+
+    // Wrap the ring several times at near-full occupancy.
+    for (int lap = 0; lap < 5; lap++) {
+        for (size_t i = 0; i < AudioCommandQueue::CAPACITY - 1; i++) {
+            cmd.channelIndex = (uint8_t)(i & 0xFF);
+            TEST_ASSERT_TRUE(queue.enqueue(cmd));
+        }
+        TEST_ASSERT_FALSE(queue.enqueue(cmd));
+        for (size_t i = 0; i < AudioCommandQueue::CAPACITY - 1; i++) {
+            TEST_ASSERT_TRUE(queue.dequeue(out));
+            TEST_ASSERT_EQUAL((uint8_t)(i & 0xFF), out.channelIndex);
+        }
+        TEST_ASSERT_TRUE(queue.isEmpty());
+    }
+    TEST_ASSERT_EQUAL(5, queue.getDroppedCommands());
+}
+
+// Several game-side producers against one audio-thread consumer that drains a
+// batch per simulated buffer. Every command carries (producer, sequence) and a
+// checksum, so a slot read before its write finished shows up as corruption.
+void test_audio_command_queue_mpsc_stress(void) {
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 200000;
+    AudioCommandQueue queue;
+    std::atomic<int> producersDone{0};
+    std::atomic<bool> go{false};
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; p++) {
+        producers.emplace_back([&queue, &producersDone, &go, p]() {
+            while (!go.load(std::memory_order_acquire)) {}
+            AudioCommand cmd;
+            cmd.type = AudioCommandType::PLAY_EVENT;
+            for (int i = 0; i < kPerProducer; i++) {
+                cmd.event.noisePeriod = (uint8_t)p;
+                cmd.event.frequency = (float)i;
+                cmd.event.volume = (float)(i * 7 + p);
+                cmd.subTrackCount = (size_t)(i ^ p);
+                while (!queue.enqueue(cmd)) {
+                    std::this_thread::yield();
+                }
+            }
+            producersDone.fetch_add(1, std::memory_order_release);
+        });
+    }
+
+    int nextSequence[kProducers] = {0};
+    int received = 0;
+    int corrupt = 0;
+    int outOfOrder = 0;
+    std::thread audioThread([&]() {
+        AudioCommand batch[16];
+        for (;;) {
+            const bool finished = producersDone.load(std::memory_order_acquire) == kProducers;
+            const size_t n = queue.drainBatch(batch, 16);
+            for (size_t k = 0; k < n; k++) {
+                const AudioCommand& c = batch[k];
+                const int p = c.event.noisePeriod;
+                const int i = (int)c.event.frequency;
+                if (c.type != AudioCommandType::PLAY_EVENT || p >= kProducers
+                    || c.event.volume != (float)(i * 7 + p) || c.subTrackCount != (size_t)(i ^ p)) {
+                    corrupt++;
+                    continue;
+                }
+                if (i != nextSequence[p]) outOfOrder++;
+                nextSequence[p] = i + 1;
+                received++;
+            }
+            if (n == 0) {
+                if (finished && queue.isEmpty()) break;
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    go.store(true, std::memory_order_release);
+    for (auto& t : producers) t.join();
+    audioThread.join();
+
+    TEST_ASSERT_EQUAL(0, corrupt);
+    TEST_ASSERT_EQUAL(0, outOfOrder);
+    TEST_ASSERT_EQUAL(kProducers * kPerProducer, received);
+    TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
 int main(int argc, char **argv) {
     UNITY_BEGIN();
     RUN_TEST(test_audio_command_queue_initial_state);
@@ -142,5 +304,10 @@ int main(int argc, char **argv) {
     RUN_TEST(test_audio_command_queue_mpsc_single_producer_baseline);
     RUN_TEST(test_audio_command_queue_mpsc_full_with_drops);
     RUN_TEST(test_audio_command_queue_mpsc_drop_counter_accuracy);
+    // Batch drain
+    RUN_TEST(test_audio_command_queue_drain_batch_fifo_and_limit);
+    RUN_TEST(test_audio_command_queue_drain_batch_coalesces_settings);
+    RUN_TEST(test_audio_command_queue_capacity_reusable_across_laps);
+    RUN_TEST(test_audio_command_queue_mpsc_stress);
     return UNITY_END();
 }
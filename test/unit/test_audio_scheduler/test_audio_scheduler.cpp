@@ -3,6 +3,11 @@
 #include "audio/AudioConfig.h"
 #include "audio/AudioMusicTypes.h"
 #include "audio/ApuCore.h"
+#ifdef PLATFORM_NATIVE
+#include "drivers/native/NativeAudioScheduler.h"
+#include <chrono>
+#include <thread>
+#endif
 
 using namespace pixelroot32::audio;
 
@@ -461,6 +466,108 @@ void test_audio_scheduler_buffer_underrun_recovery(void) {
     TEST_ASSERT_EQUAL(0u, scheduler.core().getDroppedCommands());
 }
 
+#ifdef PLATFORM_NATIVE
+// --- NativeAudioScheduler: SPSC ring, wakeup, adaptive latency ---
+
+namespace {
+
+/** Waits for the producer thread to fill the ring up to its target latency. */
+bool waitForTargetFill(const NativeAudioScheduler& scheduler) {
+    for (int i = 0; i < 2000; ++i) {
+        if (scheduler.getBufferedSamples() >= scheduler.getTargetLatencySamples()) return true;
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+    return false;
+}
+
+void playLongPulse(NativeAudioScheduler& scheduler) {
+    AudioCommand play{};
+    play.type = AudioCommandType::PLAY_EVENT;
+    play.event.type = WaveType::PULSE;
+    play.event.frequency = 440.0f;
+    play.event.volume = 0.5f;
+    play.event.duration = 10.0f;
+    play.event.duty = 0.5f;
+    scheduler.submitCommand(play);
+}
+
+} // namespace
+
+void test_native_scheduler_ring_is_power_of_two(void) {
+    NativeAudioScheduler odd(3000);
+    TEST_ASSERT_EQUAL(4096u, odd.getRingCapacity());
+    NativeAudioScheduler tiny(1);
+    TEST_ASSERT_EQUAL((size_t)ApuCore::MIX_BLOCK_SAMPLES * 2, tiny.getRingCapacity());
+}
+
+void test_native_scheduler_block_size_above_256(void) {
+    // The old producer rendered through a fixed 256-sample chunk.
+    NativeAudioScheduler scheduler(8192);
+    scheduler.init(nullptr, 22050, pixelroot32::platforms::PlatformCapabilities{}, 1024);
+    TEST_ASSERT_EQUAL(2048u, scheduler.getTargetLatencySamples());
+    playLongPulse(scheduler);
+    scheduler.start();
+
+    int16_t buffer[1024];
+    for (int i = 0; i < 8; ++i) {
+        TEST_ASSERT_TRUE(waitForTargetFill(scheduler));
+        scheduler.generateSamples(buffer, 1024);
+        TEST_ASSERT_TRUE(bufferHasNonZero(buffer + 512, 512));
+    }
+    scheduler.stop();
+    TEST_ASSERT_EQUAL(0u, scheduler.getUnderrunCount());
+}
+
+void test_native_scheduler_underrun_raises_latency(void) {
+    NativeAudioScheduler scheduler(4096);
+    scheduler.init(nullptr, 22050, pixelroot32::platforms::PlatformCapabilities{}, 256);
+    // Start-up shortfalls are not underruns.
+    int16_t buffer[1024];
+    scheduler.generateSamples(buffer, 256);
+    TEST_ASSERT_EQUAL(0u, scheduler.getUnderrunCount());
+    TEST_ASSERT_TRUE(bufferAllSilence(buffer, 256));
+
+    scheduler.start();
+    TEST_ASSERT_TRUE(waitForTargetFill(scheduler));
+    scheduler.stop();
+
+    // Producer gone: the next callback drains the ring and comes up short. The
+    // target steps one block past the larger of itself and the callback size.
+    TEST_ASSERT_EQUAL(512u, scheduler.getTargetLatencySamples());
+    scheduler.generateSamples(buffer, 1024);
+    TEST_ASSERT_EQUAL(1u, scheduler.getUnderrunCount());
+    TEST_ASSERT_EQUAL(1024u + 256u, scheduler.getTargetLatencySamples());
+
+    // Later short reads belong to the same episode.
+    scheduler.generateSamples(buffer, 1024);
+    TEST_ASSERT_EQUAL(1u, scheduler.getUnderrunCount());
+}
+
+void test_native_scheduler_latency_decays_without_underruns(void) {
+    constexpr int kRate = 22050;
+    NativeAudioScheduler scheduler(4096);
+    scheduler.init(nullptr, kRate, pixelroot32::platforms::PlatformCapabilities{}, 256);
+    scheduler.start();
+    TEST_ASSERT_TRUE(waitForTargetFill(scheduler));
+    scheduler.stop();
+    int16_t buffer[1024];
+    scheduler.generateSamples(buffer, 1024);  // forced underrun
+    const size_t raised = scheduler.getTargetLatencySamples();
+
+    // Callbacks that always find the ring full, one per refill (the producer
+    // wakes from the callback, no polling), for just over the decay window.
+    scheduler.start();
+    const int callbacks = (2 * kRate) / 256 + 1;
+    for (int i = 0; i < callbacks; ++i) {
+        TEST_ASSERT_TRUE(waitForTargetFill(scheduler));
+        scheduler.generateSamples(buffer, 256);
+    }
+    scheduler.stop();
+    TEST_ASSERT_EQUAL(1u, scheduler.getUnderrunCount());
+    TEST_ASSERT_EQUAL(raised - ApuCore::MIX_BLOCK_SAMPLES, scheduler.getTargetLatencySamples());
+}
+#endif // PLATFORM_NATIVE
+
 void test_audio_scheduler_initialization_failure_handling(void) {
     // Test scheduler behavior with various initialization scenarios
     DefaultAudioScheduler scheduler;
@@ -1188,6 +1295,13 @@ int main(int argc, char **argv) {
     RUN_TEST(test_audio_scheduler_null_buffer_handling);
     RUN_TEST(test_audio_scheduler_command_queue_overflow);
 
+#ifdef PLATFORM_NATIVE
+    RUN_TEST(test_native_scheduler_ring_is_power_of_two);
+    RUN_TEST(test_native_scheduler_block_size_above_256);
+    RUN_TEST(test_native_scheduler_underrun_raises_latency);
+    RUN_TEST(test_native_scheduler_latency_decays_without_underruns);
+#endif
+
     // Init-failure must stay last (see comment in prior revision).
     RUN_TEST(test_audio_scheduler_initialization_failure_handling);
 
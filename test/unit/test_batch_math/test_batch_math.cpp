@@ -0,0 +1,225 @@
+/**
+ * @file test_batch_math.cpp
+ * @brief Unit tests for the structure-of-arrays batch kernels
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * Every kernel, in its float and Fixed16 overloads, must match the per-element
+ * Scalar / Vector2 code bit for bit, including the SIMD bodies and the scalar
+ * tails (odd lengths).
+ */
+
+#include <unity.h>
+#include "../../test_config.h"
+#include "math/BatchMath.h"
+#include "math/Vector2.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+using namespace pixelroot32::math;
+
+namespace {
+
+constexpr int kCount = 67;  // not a multiple of the vector width
+
+uint32_t s_rng = 0x2545F491u;
+
+float nextFloat(float range) {
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return (static_cast<float>(s_rng & 0xFFFF) / 32768.0f - 1.0f) * range;
+}
+
+template <typename T>
+void fill(T* dst, float range) {
+    for (int i = 0; i < kCount; i++) {
+        dst[i] = T(nextFloat(range));
+    }
+}
+
+float sqrtOf(float v) { return std::sqrt(v); }
+Fixed16 sqrtOf(Fixed16 v) { return Fixed16::sqrt(v); }
+
+template <typename T>
+void assertSame(const T* expected, const T* actual, const char* what) {
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, actual, sizeof(T) * kCount, what);
+}
+
+template <typename T>
+void checkAxpyScaleIntegrate() {
+    T x[kCount], y[kCount], vx[kCount], vy[kCount];
+    fill(x, 100.0f);
+    fill(y, 100.0f);
+    fill(vx, 8.0f);
+    fill(vy, 8.0f);
+    const T a = T(0.37f);
+
+    T ry[kCount], rx[kCount], ryy[kCount];
+    for (int i = 0; i < kCount; i++) ry[i] = y[i] + x[i] * a;
+    T by[kCount];
+    std::memcpy(by, y, sizeof(y));
+    batch::axpy(by, x, a, kCount);
+    assertSame(ry, by, "axpy");
+
+    for (int i = 0; i < kCount; i++) rx[i] = x[i] * a;
+    T bx[kCount];
+    std::memcpy(bx, x, sizeof(x));
+    batch::scale(bx, a, kCount);
+    assertSame(rx, bx, "scale");
+
+    for (int i = 0; i < kCount; i++) {
+        rx[i] = x[i] + vx[i] * a;
+        ryy[i] = y[i] + vy[i] * a;
+    }
+    std::memcpy(bx, x, sizeof(x));
+    std::memcpy(by, y, sizeof(y));
+    batch::integratePositions(bx, by, vx, vy, a, kCount);
+    assertSame(rx, bx, "integratePositions x");
+    assertSame(ryy, by, "integratePositions y");
+}
+
+template <typename T>
+void checkClampLength() {
+    T x[kCount], y[kCount];
+    fill(x, 20.0f);
+    fill(y, 20.0f);
+    const T maxLen = T(9.5f);
+    // Zero vector, exactly at the limit, just over it.
+    x[0] = T(0.0f); y[0] = T(0.0f);
+    x[1] = maxLen;  y[1] = T(0.0f);
+    x[2] = T(0.0f); y[2] = -maxLen - T(0.01f);
+
+    T rx[kCount], ry[kCount];
+    for (int i = 0; i < kCount; i++) {
+        rx[i] = x[i];
+        ry[i] = y[i];
+        const T lenSq = x[i] * x[i] + y[i] * y[i];
+        if (lenSq > maxLen * maxLen && lenSq > T(0.0f)) {
+            const T f = maxLen / sqrtOf(lenSq);
+            rx[i] = x[i] * f;
+            ry[i] = y[i] * f;
+        }
+    }
+    batch::clampLength(x, y, maxLen, kCount);
+    assertSame(rx, x, "clampLength x");
+    assertSame(ry, y, "clampLength y");
+}
+
+template <typename T>
+void checkOverlapMask() {
+    T minX[kCount], minY[kCount], maxX[kCount], maxY[kCount];
+    fill(minX, 64.0f);
+    fill(minY, 64.0f);
+    for (int i = 0; i < kCount; i++) {
+        maxX[i] = minX[i] + T(static_cast<int>(s_rng % 24));
+        maxY[i] = minY[i] + T(static_cast<int>((s_rng >> 8) % 24));
+        nextFloat(1.0f);
+    }
+    const T qx0 = T(-10), qy0 = T(-20), qx1 = T(30), qy1 = T(15);
+    // Boxes touching each edge of the query count as overlapping.
+    maxX[0] = qx0;
+    minX[1] = qx1;
+    maxY[2] = qy0; minX[2] = T(0); maxX[2] = T(1);
+    minY[3] = qy1; minX[3] = T(0); maxX[3] = T(1);
+
+    uint8_t expected[kCount];
+    int expectedHits = 0;
+    for (int i = 0; i < kCount; i++) {
+        const bool hit = !(maxX[i] < qx0 || minX[i] > qx1 || maxY[i] < qy0 || minY[i] > qy1);
+        expected[i] = hit ? 1 : 0;
+        expectedHits += hit ? 1 : 0;
+    }
+    uint8_t mask[kCount];
+    const int hits = batch::aabbOverlapMask(minX, minY, maxX, maxY, kCount, qx0, qy0, qx1, qy1, mask);
+    TEST_ASSERT_EQUAL(expectedHits, hits);
+    TEST_ASSERT_EQUAL_MEMORY(expected, mask, kCount);
+    TEST_ASSERT_TRUE(hits > 0 && hits < kCount);
+}
+
+} // namespace
+
+void setUp(void) {
+    test_setup();
+}
+
+void tearDown(void) {
+    test_teardown();
+}
+
+void test_batch_float_matches_reference(void) {
+    checkAxpyScaleIntegrate<float>();
+    checkClampLength<float>();
+    checkOverlapMask<float>();
+}
+
+void test_batch_fixed16_matches_reference(void) {
+    checkAxpyScaleIntegrate<Fixed16>();
+    checkClampLength<Fixed16>();
+    checkOverlapMask<Fixed16>();
+}
+
+void test_batch_clamp_length_matches_vector2(void) {
+    Scalar x[kCount], y[kCount];
+    fill(x, 20.0f);
+    fill(y, 20.0f);
+    const Scalar maxLen = toScalar(6.0f);
+    Vector2 expected[kCount];
+    for (int i = 0; i < kCount; i++) {
+        expected[i] = Vector2(x[i], y[i]).limit_length(maxLen);
+    }
+    batch::clampLength(x, y, maxLen, kCount);
+    for (int i = 0; i < kCount; i++) {
+        TEST_ASSERT_TRUE(expected[i] == Vector2(x[i], y[i]));
+    }
+}
+
+void test_batch_benchmark(void) {
+    constexpr int kN = 1024;
+    constexpr int kReps = 2000;
+    static float px[kN], py[kN], vx[kN], vy[kN];
+    for (int i = 0; i < kN; i++) {
+        px[i] = nextFloat(100.0f);
+        py[i] = nextFloat(100.0f);
+        vx[i] = nextFloat(4.0f);
+        vy[i] = nextFloat(4.0f);
+    }
+    using Clock = std::chrono::steady_clock;
+
+    auto t0 = Clock::now();
+    for (int r = 0; r < kReps; r++) {
+        for (int i = 0; i < kN; i++) {
+            Vector2 p(px[i], py[i]);
+            p += Vector2(vx[i], vy[i]) * toScalar(0.016f);
+            px[i] = static_cast<float>(p.x);
+            py[i] = static_cast<float>(p.y);
+        }
+    }
+    auto t1 = Clock::now();
+    for (int r = 0; r < kReps; r++) {
+        batch::integratePositions(px, py, vx, vy, 0.016f, kN);
+    }
+    auto t2 = Clock::now();
+
+    const double perElem = 1e9 / (static_cast<double>(kN) * kReps);
+    char msg[128];
+    std::snprintf(msg, sizeof(msg), "integratePositions ns/element: per-element Vector2 %.3f | batch %.3f (checksum %.1f)",
+                  std::chrono::duration<double>(t1 - t0).count() * perElem,
+                  std::chrono::duration<double>(t2 - t1).count() * perElem,
+                  static_cast<double>(px[0] + py[kN - 1]));
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_batch_float_matches_reference);
+    RUN_TEST(test_batch_fixed16_matches_reference);
+    RUN_TEST(test_batch_clamp_length_matches_vector2);
+    RUN_TEST(test_batch_benchmark);
+    return UNITY_END();
+}
@@ -148,6 +148,72 @@ void test_collision_segment_tmin_tmax_edge(void) {
     TEST_ASSERT_TRUE(intersects(s, r));
 }
 
+void test_collision_sweep_rect_entry_time_and_normal(void) {
+    Rect moving = { {0, 0}, 10, 10 };
+    Rect wall = { {20, -5}, 5, 20 };
+    float tHit = -1.0f;
+    pixelroot32::math::Vector2 n;
+    TEST_ASSERT_TRUE(sweepRectVsRect(moving, pixelroot32::math::Vector2(20, 0), wall, tHit, n));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.5f, tHit);
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, n.x);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, n.y);
+
+    // Falls short, and passes beside it.
+    TEST_ASSERT_FALSE(sweepRectVsRect(moving, pixelroot32::math::Vector2(9, 0), wall, tHit, n));
+    TEST_ASSERT_FALSE(sweepRectVsRect(moving, pixelroot32::math::Vector2(0, 40), wall, tHit, n));
+}
+
+void test_collision_sweep_rect_diagonal_floor(void) {
+    Rect moving = { {0, 0}, 10, 10 };
+    Rect floor = { {-50, 20}, 100, 10 };
+    float tHit = -1.0f;
+    pixelroot32::math::Vector2 n;
+    TEST_ASSERT_TRUE(sweepRectVsRect(moving, pixelroot32::math::Vector2(10, 20), floor, tHit, n));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.5f, tHit);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, n.x);
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, n.y);
+}
+
+void test_collision_sweep_rect_touching_and_overlapping_start(void) {
+    Rect moving = { {0, 0}, 10, 10 };
+    Rect floor = { {-50, 10}, 100, 10 };  // Touching from below (inclusive edges)
+    float tHit = -1.0f;
+    pixelroot32::math::Vector2 n;
+    TEST_ASSERT_TRUE(sweepRectVsRect(moving, pixelroot32::math::Vector2(5, 0), floor, tHit, n));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, tHit);
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, n.y);  // Least penetration axis
+
+    Rect inside = { {8, 2}, 10, 6 };  // Overlaps 2 px in x, 6 px in y
+    TEST_ASSERT_TRUE(sweepRectVsRect(moving, pixelroot32::math::Vector2(0, 1), inside, tHit, n));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, tHit);
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, n.x);
+}
+
+void test_collision_sweep_rect_zero_size_is_segment_cast(void) {
+    Rect point = { {0, 5}, 0, 0 };
+    Rect r = { {30, 0}, 10, 10 };
+    float tHit = -1.0f;
+    pixelroot32::math::Vector2 n;
+    TEST_ASSERT_TRUE(sweepRectVsRect(point, pixelroot32::math::Vector2(60, 0), r, tHit, n));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.5f, tHit);
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, n.x);
+}
+
+void test_collision_sweep_circle_vs_circle(void) {
+    Circle moving = { 0, 0, 5 };
+    Circle target = { 30, 0, 5 };
+    float tHit = -1.0f;
+    TEST_ASSERT_TRUE(sweepCircleVsCircle(moving, pixelroot32::math::Vector2(40, 0), target, tHit));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.5f, tHit);
+
+    TEST_ASSERT_FALSE(sweepCircleVsCircle(moving, pixelroot32::math::Vector2(10, 0), target, tHit));
+    TEST_ASSERT_FALSE(sweepCircleVsCircle(moving, pixelroot32::math::Vector2(-40, 0), target, tHit));
+
+    Circle overlapping = { 6, 0, 5 };
+    TEST_ASSERT_TRUE(sweepCircleVsCircle(moving, pixelroot32::math::Vector2(-40, 0), overlapping, tHit));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, tHit);
+}
+
 int main(int argc, char **argv) {
     UNITY_BEGIN();
     
@@ -167,6 +233,11 @@ int main(int argc, char **argv) {
     RUN_TEST(test_collision_segment_dy_zero_within);
     RUN_TEST(test_collision_segment_dy_zero_outside);
     RUN_TEST(test_collision_segment_tmin_tmax_edge);
+    RUN_TEST(test_collision_sweep_rect_entry_time_and_normal);
+    RUN_TEST(test_collision_sweep_rect_diagonal_floor);
+    RUN_TEST(test_collision_sweep_rect_touching_and_overlapping_start);
+    RUN_TEST(test_collision_sweep_rect_zero_size_is_segment_cast);
+    RUN_TEST(test_collision_sweep_circle_vs_circle);
     
     return UNITY_END();
 }
@@ -8,9 +8,17 @@
  */
 
 #include <unity.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <thread>
 #include <vector>
 #include "../../test_config.h"
 #include "physics/CollisionSystem.h"
+#include "physics/PhysicsWorker.h"
 #include "physics/RigidActor.h"
 #include "physics/StaticActor.h"
 #include "core/Actor.h"
@@ -1948,6 +1956,644 @@ void test_spatial_grid_clear_dynamic(void) {
     TEST_ASSERT_EQUAL(0, system.getEntityCount());
 }
 
+// =============================================================================
+// Spatial queries (grid-accelerated)
+// =============================================================================
+
+void test_query_aabb_filters_layers_and_finds_offscreen_statics(void) {
+    CollisionSystem system;
+    StaticActor near(toScalar(10), toScalar(10), 20, 20);
+    StaticActor offscreen(toScalar(1000), toScalar(10), 20, 20);  // Beyond the grid: border cell
+    StaticActor otherLayer(toScalar(15), toScalar(15), 20, 20);
+    MockActor mover(20, 20, 10, 10);
+    near.setCollisionLayer(1);
+    offscreen.setCollisionLayer(1);
+    otherLayer.setCollisionLayer(2);
+    mover.setCollisionLayer(1);
+    system.addEntity(&near);
+    system.addEntity(&offscreen);
+    system.addEntity(&otherLayer);
+    system.addEntity(&mover);
+
+    SpatialQueryResults results;
+    QueryFilter filter;
+    filter.mask = 1;
+    system.queryAABB(Rect{Vector2(toScalar(0), toScalar(0)), 40, 40}, filter, results);
+    TEST_ASSERT_EQUAL_INT(2, results.count);
+    TEST_ASSERT_FALSE(results.overflow);
+
+    system.queryAABB(Rect{Vector2(toScalar(990), toScalar(0)), 40, 40}, filter, results);
+    TEST_ASSERT_EQUAL_INT(1, results.count);
+    TEST_ASSERT_EQUAL_PTR(&offscreen, results.actors[0]);
+
+    filter.exclude = &mover;
+    system.queryPoint(Vector2(toScalar(25), toScalar(25)), filter, results);
+    TEST_ASSERT_EQUAL_INT(1, results.count);
+    TEST_ASSERT_EQUAL_PTR(&near, results.actors[0]);
+}
+
+void test_query_results_overflow_flag(void) {
+    CollisionSystem system;
+    std::vector<std::unique_ptr<StaticActor>> walls;
+    for (int i = 0; i < SpatialQueryResults::kCapacity + 2; i++) {
+        auto wall = std::make_unique<StaticActor>(toScalar(static_cast<float>(i % 8)), toScalar(static_cast<float>(i / 8)), 4, 4);
+        wall->setCollisionLayer(1);
+        system.addEntity(wall.get());
+        walls.push_back(std::move(wall));
+    }
+    SpatialQueryResults results;
+    system.queryAABB(Rect{Vector2(toScalar(0), toScalar(0)), 20, 20}, QueryFilter{}, results);
+    TEST_ASSERT_EQUAL_INT(SpatialQueryResults::kCapacity, results.count);
+    TEST_ASSERT_TRUE(results.overflow);
+}
+
+void test_check_collision_uses_overflow_of_full_cells(void) {
+    // More statics in one cell than SPATIAL_GRID_MAX_STATIC_PER_CELL: none may be missed.
+    CollisionSystem system;
+    std::vector<std::unique_ptr<StaticActor>> walls;
+    for (int i = 0; i < SpatialGrid::kMaxStaticPerCell + 4; i++) {
+        auto wall = std::make_unique<StaticActor>(toScalar(static_cast<float>(i * 2)), toScalar(0), 1, 1);
+        wall->setCollisionLayer(1);
+        wall->setCollisionMask(1);
+        system.addEntity(wall.get());
+        walls.push_back(std::move(wall));
+    }
+    MockActor probe(static_cast<float>((SpatialGrid::kMaxStaticPerCell + 3) * 2), 0, 1, 1);
+    probe.setCollisionLayer(1);
+    probe.setCollisionMask(1);
+    system.addEntity(&probe);
+
+    Actor* results[4];
+    int count = 0;
+    TEST_ASSERT_TRUE(system.checkCollision(&probe, results, count, 4));
+    TEST_ASSERT_EQUAL_PTR(walls.back().get(), results[0]);
+}
+
+void test_query_swept_and_raycast_nearest_hit(void) {
+    CollisionSystem system;
+    StaticActor farWall(toScalar(200), toScalar(0), 10, 40);
+    StaticActor nearWall(toScalar(100), toScalar(0), 10, 40);
+    MockActor crate(60, 10, 10, 10);
+    farWall.setCollisionLayer(1);
+    nearWall.setCollisionLayer(1);
+    crate.setCollisionLayer(2);
+    system.addEntity(&farWall);
+    system.addEntity(&nearWall);
+    system.addEntity(&crate);
+
+    QueryFilter walls;
+    walls.mask = 1;
+    RaycastHit hit;
+    TEST_ASSERT_TRUE(system.raycast(Vector2(toScalar(0), toScalar(20)), Vector2(toScalar(1), toScalar(0)),
+                                    toScalar(300), walls, hit));
+    TEST_ASSERT_EQUAL_PTR(&nearWall, hit.actor);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0f, hit.distance);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0f, hit.point.x);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, -1.0f, hit.normal.x);
+
+    // A closer moving body on an accepted layer wins; too short a ray hits nothing.
+    QueryFilter all;
+    TEST_ASSERT_TRUE(system.raycast(Vector2(toScalar(0), toScalar(15)), Vector2(toScalar(4), toScalar(0)),
+                                    toScalar(300), all, hit));
+    TEST_ASSERT_EQUAL_PTR(&crate, hit.actor);
+    TEST_ASSERT_FALSE(system.raycast(Vector2(toScalar(0), toScalar(20)), Vector2(toScalar(1), toScalar(0)),
+                                     toScalar(50), walls, hit));
+
+    // Leftwards from beyond the screen edge.
+    TEST_ASSERT_TRUE(system.raycast(Vector2(toScalar(400), toScalar(20)), Vector2(toScalar(-1), toScalar(0)),
+                                    toScalar(400), walls, hit));
+    TEST_ASSERT_EQUAL_PTR(&farWall, hit.actor);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 190.0f, hit.distance);
+
+    SpatialQueryResults results;
+    system.querySwept(Rect{Vector2(toScalar(0), toScalar(0)), 10, 10}, Vector2(toScalar(150), toScalar(0)), walls, results);
+    TEST_ASSERT_EQUAL_INT(1, results.count);
+    TEST_ASSERT_EQUAL_PTR(&nearWall, results.actors[0]);
+    system.querySwept(Rect{Vector2(toScalar(0), toScalar(50)), 10, 10}, Vector2(toScalar(150), toScalar(0)), walls, results);
+    TEST_ASSERT_EQUAL_INT(0, results.count);
+}
+
+void test_queries_survive_another_system_rebuilding_the_grid(void) {
+    // Grid cell storage is shared; a second system must not corrupt the first one's static layer.
+    CollisionSystem first;
+    StaticActor wall(toScalar(40), toScalar(40), 20, 20);
+    wall.setCollisionLayer(1);
+    first.addEntity(&wall);
+    SpatialQueryResults results;
+    first.queryPoint(Vector2(toScalar(50), toScalar(50)), QueryFilter{}, results);
+    TEST_ASSERT_EQUAL_INT(1, results.count);
+
+    CollisionSystem second;
+    StaticActor other(toScalar(100), toScalar(100), 20, 20);
+    other.setCollisionLayer(1);
+    second.addEntity(&other);
+    second.update();
+
+    first.queryPoint(Vector2(toScalar(50), toScalar(50)), QueryFilter{}, results);
+    TEST_ASSERT_EQUAL_INT(1, results.count);
+    TEST_ASSERT_EQUAL_PTR(&wall, results.actors[0]);
+}
+
+void test_update_body_registers_moved_actor(void) {
+    // Moving bodies stay in the dynamic layer between steps; a position write needs updateBody().
+    CollisionSystem system;
+    MockActor body(10, 10, 8, 8);
+    body.setCollisionLayer(1);
+    system.addEntity(&body);
+    system.update();
+
+    body.position = Vector2(toScalar(200), toScalar(200));
+    SpatialQueryResults results;
+    system.queryPoint(Vector2(toScalar(204), toScalar(204)), QueryFilter{}, results);
+    TEST_ASSERT_EQUAL_INT(0, results.count);
+    system.queryPoint(Vector2(toScalar(14), toScalar(14)), QueryFilter{}, results);
+    TEST_ASSERT_EQUAL_INT(0, results.count);
+
+    system.updateBody(&body);
+    system.queryPoint(Vector2(toScalar(204), toScalar(204)), QueryFilter{}, results);
+    TEST_ASSERT_EQUAL_INT(1, results.count);
+    TEST_ASSERT_EQUAL_PTR(&body, results.actors[0]);
+
+    // The stale cell entry is tested exactly and never reported.
+    system.queryPoint(Vector2(toScalar(14), toScalar(14)), QueryFilter{}, results);
+    TEST_ASSERT_EQUAL_INT(0, results.count);
+}
+
+void test_world_bounds_give_offscreen_statics_their_own_cells(void) {
+    // A scrolling level: a row of walls far to the right of the logical screen.
+    constexpr int kWalls = SpatialGrid::kMaxStaticPerCell + 8;
+    CollisionSystem system;
+    std::vector<std::unique_ptr<StaticActor>> walls;
+    for (int i = 0; i < kWalls; i++) {
+        walls.push_back(std::make_unique<StaticActor>(toScalar(1000 + i * 40), toScalar(100), 16, 16));
+        walls.back()->setCollisionLayer(1);
+        system.addEntity(walls.back().get());
+    }
+    system.update();
+
+    // Screen-sized default: every wall piles into the border cell and spills into the overflow list.
+    SpatialGridStats stats = system.getGridStats();
+    TEST_ASSERT_EQUAL_UINT16(kWalls, stats.outsideWorld);
+    TEST_ASSERT_TRUE(stats.staticOverflow > 0);
+    TEST_ASSERT_FALSE(stats.hashed);
+
+    system.setWorldBounds(0, 0, 2048, 256);
+    system.update();
+    stats = system.getGridStats();
+    TEST_ASSERT_EQUAL_UINT16(0, stats.outsideWorld);
+    TEST_ASSERT_EQUAL_UINT16(0, stats.staticOverflow);
+    TEST_ASSERT_TRUE(stats.hashed);
+
+    SpatialQueryResults results;
+    system.queryPoint(Vector2(toScalar(1000 + 5 * 40 + 8), toScalar(108)), QueryFilter{}, results);
+    TEST_ASSERT_EQUAL_INT(1, results.count);
+    TEST_ASSERT_EQUAL_PTR(walls[5].get(), results.actors[0]);
+
+    MockActor probe(1000 + 9 * 40 + 4, 104, 4, 4);
+    probe.setCollisionLayer(1);
+    probe.setCollisionMask(1);
+    system.addEntity(&probe);
+    Actor* hits[4];
+    int count = 0;
+    TEST_ASSERT_TRUE(system.checkCollision(&probe, hits, count, 4));
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT_EQUAL_PTR(walls[9].get(), hits[0]);
+}
+
+void test_world_bounds_with_negative_origin(void) {
+    CollisionSystem system;
+    system.setWorldBounds(-200, -200, 200, 200);
+    StaticActor wall(toScalar(-150), toScalar(-150), 20, 20);
+    wall.setCollisionLayer(1);
+    system.addEntity(&wall);
+
+    SpatialQueryResults results;
+    system.queryPoint(Vector2(toScalar(-140), toScalar(-140)), QueryFilter{}, results);
+    TEST_ASSERT_EQUAL_INT(1, results.count);
+    TEST_ASSERT_FALSE(system.getGridStats().hashed);
+
+    RaycastHit hit;
+    TEST_ASSERT_TRUE(system.raycast(Vector2(toScalar(-190), toScalar(-140)), Vector2(toScalar(1), toScalar(0)),
+                                    toScalar(100), QueryFilter{}, hit));
+    TEST_ASSERT_EQUAL_PTR(&wall, hit.actor);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 40.0f, static_cast<float>(hit.distance));
+}
+
+// =============================================================================
+// Incremental broadphase
+// =============================================================================
+
+namespace {
+/// Weightless rigid body so it stays where it is put.
+std::unique_ptr<MockActor> makeIdleBody(float x, float y) {
+    auto body = std::make_unique<MockActor>(x, y, 10, 10);
+    body->setGravityScale(toScalar(0));
+    body->setCollisionLayer(1);
+    body->setCollisionMask(1);
+    return body;
+}
+}
+
+void test_broadphase_idle_step_keeps_pairs(void) {
+    CollisionSystem system;
+    StaticActor floor(toScalar(0), toScalar(100), 240, 10);
+    floor.setCollisionLayer(1);
+    floor.setCollisionMask(1);
+    system.addEntity(&floor);
+    std::vector<std::unique_ptr<MockActor>> bodies;
+    for (int i = 0; i < 6; i++) {
+        bodies.push_back(makeIdleBody(10.0f + i * 36.0f, 92.0f));  // resting in the floor
+        system.addEntity(bodies.back().get());
+    }
+    MockActor far(200, 10, 10, 10);
+    far.setGravityScale(toScalar(0));
+    far.setCollisionLayer(1);
+    far.setCollisionMask(1);
+    system.addEntity(&far);
+
+    system.detectCollisions();
+    const BroadphaseStats first = system.getBroadphaseStats();
+    TEST_ASSERT_FALSE(first.pairOverflow);
+    TEST_ASSERT_TRUE(first.pairs >= 6);
+
+    system.detectCollisions();
+    BroadphaseStats stats = system.getBroadphaseStats();
+    TEST_ASSERT_EQUAL_UINT16(0, stats.movedBodies);
+    TEST_ASSERT_EQUAL_UINT16(first.pairs, stats.pairs);
+
+    // Moving one body into another cell only regenerates its own pairs.
+    far.position = Vector2(toScalar(14), toScalar(94));
+    system.update();
+    stats = system.getBroadphaseStats();
+    TEST_ASSERT_EQUAL_UINT16(1, stats.movedBodies);
+    TEST_ASSERT_TRUE(far.collisionCalled);
+    TEST_ASSERT_TRUE(stats.pairs > first.pairs);
+}
+
+void test_broadphase_pair_overflow_still_detects(void) {
+    // More pairs than PHYSICS_MAX_PAIRS: the list is abandoned and pairs come from the grid.
+    CollisionSystem system;
+    std::vector<std::unique_ptr<MockActor>> bodies;
+    for (int i = 0; i < 24; i++) {
+        bodies.push_back(makeIdleBody(40.0f + (i % 6), 40.0f + (i / 6)));
+        system.addEntity(bodies.back().get());
+    }
+    system.update();
+    TEST_ASSERT_TRUE(system.getBroadphaseStats().pairOverflow);
+    for (auto& body : bodies) {
+        TEST_ASSERT_TRUE(body->collisionCalled);
+    }
+}
+
+void test_broadphase_benchmark_idle_bodies(void) {
+    // 16 walls and 48 resting bodies: incremental steps vs clearing and re-bucketing every step.
+    CollisionSystem system;
+    system.setWorldBounds(0, 0, 512, 256);
+    std::vector<std::unique_ptr<StaticActor>> walls;
+    std::vector<std::unique_ptr<MockActor>> bodies;
+    for (int i = 0; i < 16; i++) {
+        walls.push_back(std::make_unique<StaticActor>(toScalar(i * 32), toScalar(200), 32, 8));
+        walls.back()->setCollisionLayer(1);
+        system.addEntity(walls.back().get());
+    }
+    for (int i = 0; i < 48; i++) {
+        bodies.push_back(makeIdleBody(4.0f + (i % 16) * 32.0f, 40.0f + (i / 16) * 50.0f));
+        system.addEntity(bodies.back().get());
+    }
+    constexpr int kSteps = 500;
+    int pairsGenerated = 0;
+    auto time = [&](bool rebuild) {
+        pairsGenerated = 0;
+        const auto t0 = std::chrono::high_resolution_clock::now();
+        for (int s = 0; s < kSteps; s++) {
+            if (rebuild) system.setWorldBounds(0, 0, 512, 256);
+            system.detectCollisions();
+            pairsGenerated += system.getBroadphaseStats().pairsGenerated;
+        }
+        const auto t1 = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+    };
+    time(false);
+    const uint16_t pairs = system.getBroadphaseStats().pairs;
+    TEST_ASSERT_TRUE(pairs > 0);
+    const long long rebuildUs = time(true);
+    const int rebuildPairs = pairsGenerated;
+    const long long incrementalUs = time(false);
+    const int incrementalPairs = pairsGenerated;
+    TEST_ASSERT_EQUAL_UINT16(0, system.getBroadphaseStats().movedBodies);
+
+    // A rebuild regenerates every pair every step; idle incremental steps never query the grid.
+    TEST_ASSERT_EQUAL_INT(kSteps * pairs, rebuildPairs);
+    TEST_ASSERT_EQUAL_INT(0, incrementalPairs);
+
+    char msg[160];
+    std::snprintf(msg, sizeof(msg), "64 bodies, %d steps: full rebuild %lld us | incremental %lld us",
+                  kSteps, rebuildUs, incrementalUs);
+    TEST_MESSAGE(msg);
+}
+
+
+namespace {
+/// Floor at y = 100 plus columns of 10x10 crates stacked on it, under gravity.
+struct CrateStack {
+    StaticActor floor{toScalar(0), toScalar(100), 240, 10};
+    std::vector<std::unique_ptr<MockActor>> crates;
+
+    CrateStack(CollisionSystem& system, int count) {
+        floor.setCollisionLayer(1);
+        floor.setCollisionMask(1);
+        system.addEntity(&floor);
+        addColumn(system, count, 40.0f);
+    }
+
+    void addColumn(CollisionSystem& system, int count, float x) {
+        for (int i = 0; i < count; i++) {
+            crates.push_back(std::make_unique<MockActor>(x, 90.0f - i * 10.0f, 10, 10));
+            crates.back()->setCollisionLayer(1);
+            crates.back()->setCollisionMask(1);
+            crates.back()->setRestitution(toScalar(0));
+            system.addEntity(crates.back().get());
+        }
+    }
+};
+
+/// Largest crate speed after @p steps: residual motion the solver failed to remove.
+float settleStack(bool warmStarting, int steps) {
+    CollisionSystem system;
+    system.setSleepingEnabled(false);
+    system.setWarmStarting(warmStarting);
+    CrateStack stack(system, 4);
+    float worst = 0.0f;
+    for (int s = 0; s < steps; s++) {
+        system.update();
+    }
+    for (int s = 0; s < 10; s++) {
+        system.update();
+        for (auto& crate : stack.crates) {
+            worst = std::max(worst, std::fabs(static_cast<float>(crate->getVelocity().y)));
+        }
+    }
+    return worst;
+}
+}
+
+void test_contact_cache_warm_starts_resting_stack(void) {
+    CollisionSystem system;
+    system.setSleepingEnabled(false);
+    CrateStack stack(system, 4);
+    for (int s = 0; s < 30; s++) {
+        system.update();
+    }
+    const SolverStats stats = system.getSolverStats();
+    TEST_ASSERT_TRUE(stats.contacts >= 4);
+    TEST_ASSERT_EQUAL_UINT16(stats.contacts, stats.cachedContacts);
+
+    // The cached impulses already hold the stack; two iterations from zero do not.
+    const float warm = settleStack(true, 120);
+    const float cold = settleStack(false, 120);
+    char msg[96];
+    std::snprintf(msg, sizeof(msg), "4-crate stack residual speed: warm %.4f | cold %.4f", warm, cold);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(warm < cold);
+}
+
+void test_sleeping_box_on_floor(void) {
+    CollisionSystem system;
+    CrateStack stack(system, 1);
+    MockActor& crate = *stack.crates[0];
+    for (int s = 0; s < 20; s++) {
+        system.update();
+    }
+    TEST_ASSERT_FALSE(crate.isSleeping());
+
+    for (int s = 0; s < 80; s++) {
+        system.update();
+    }
+    TEST_ASSERT_TRUE(crate.isSleeping());
+    TEST_ASSERT_EQUAL_UINT16(1, system.getSolverStats().sleepingBodies);
+
+    // Asleep: no integration, no contact, no callback.
+    const Vector2 rest = crate.position;
+    crate.reset();
+    system.update();
+    TEST_ASSERT_EQUAL_UINT16(0, system.getSolverStats().contacts);
+    TEST_ASSERT_FALSE(crate.collisionCalled);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, static_cast<float>(rest.y), static_cast<float>(crate.position.y));
+
+    // Disabling sleeping wakes everything.
+    system.setSleepingEnabled(false);
+    TEST_ASSERT_FALSE(crate.isSleeping());
+    TEST_ASSERT_EQUAL_UINT16(0, system.getSolverStats().sleepingBodies);
+}
+
+void test_sleeping_island_wakes_together(void) {
+    CollisionSystem system;
+    CrateStack stack(system, 3);
+    for (int s = 0; s < 150; s++) {
+        system.update();
+    }
+    for (auto& crate : stack.crates) {
+        TEST_ASSERT_TRUE(crate->isSleeping());
+    }
+    TEST_ASSERT_EQUAL_UINT16(3, system.getSolverStats().sleepingBodies);
+
+    // An impulse on the top crate wakes the whole stack at the next step.
+    stack.crates[2]->applyImpulse(Vector2(toScalar(0), toScalar(-5)));
+    TEST_ASSERT_FALSE(stack.crates[2]->isSleeping());
+    TEST_ASSERT_TRUE(stack.crates[0]->isSleeping());
+    system.update();
+    for (auto& crate : stack.crates) {
+        TEST_ASSERT_FALSE(crate->isSleeping());
+    }
+}
+
+void test_sleeping_island_wakes_warm(void) {
+    CollisionSystem system;
+    CrateStack stack(system, 3);
+    for (int s = 0; s < 150; s++) {
+        system.update();
+    }
+    TEST_ASSERT_EQUAL_UINT16(3, system.getSolverStats().sleepingBodies);
+    for (int s = 0; s < 20; s++) {
+        system.update();
+    }
+
+    // The pairs kept their impulses while asleep: every contact of the woken stack is warm-started.
+    stack.crates[2]->wakeUp();
+    system.update();
+    const SolverStats stats = system.getSolverStats();
+    TEST_ASSERT_EQUAL_UINT16(0, stats.sleepingBodies);
+    TEST_ASSERT_TRUE(stats.contacts >= 3);
+    TEST_ASSERT_EQUAL_UINT16(stats.contacts, stats.cachedContacts);
+}
+
+void test_sleeping_body_woken_by_contact(void) {
+    CollisionSystem system;
+    CrateStack stack(system, 1);
+    for (int s = 0; s < 100; s++) {
+        system.update();
+    }
+    TEST_ASSERT_TRUE(stack.crates[0]->isSleeping());
+
+    // A crate falling on the sleeper wakes it through their contact.
+    MockActor dropped(40, 60, 10, 10);
+    dropped.setCollisionLayer(1);
+    dropped.setCollisionMask(1);
+    system.addEntity(&dropped);
+    bool woke = false;
+    for (int s = 0; s < 60 && !woke; s++) {
+        system.update();
+        woke = !stack.crates[0]->isSleeping();
+    }
+    TEST_ASSERT_TRUE(woke);
+    TEST_ASSERT_TRUE(dropped.position.y < toScalar(81));
+}
+
+void test_sleeping_benchmark_idle_crates(void) {
+    // 30 crates resting on the floor: every step solved vs asleep.
+    int contacts = 0;
+    auto time = [&contacts](bool sleeping) {
+        CollisionSystem system;
+        system.setSleepingEnabled(sleeping);
+        CrateStack stack(system, 3);
+        for (int i = 0; i < 9; i++) {
+            stack.addColumn(system, 3, 64.0f + i * 18.0f);
+        }
+        for (int s = 0; s < 120; s++) {
+            system.update();
+        }
+        constexpr int kSteps = 500;
+        contacts = 0;
+        const auto t0 = std::chrono::high_resolution_clock::now();
+        for (int s = 0; s < kSteps; s++) {
+            system.update();
+            contacts += system.getSolverStats().contacts;
+        }
+        const auto t1 = std::chrono::high_resolution_clock::now();
+        TEST_ASSERT_EQUAL_UINT16(sleeping ? 30 : 0, system.getSolverStats().sleepingBodies);
+        return static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+    };
+    const long long awakeUs = time(false);
+    const int awakeContacts = contacts;
+    const long long asleepUs = time(true);
+
+    // Awake, every resting crate is re-solved each step; asleep, no pair produces a contact.
+    TEST_ASSERT_TRUE(awakeContacts > 0);
+    TEST_ASSERT_EQUAL_INT(0, contacts);
+
+    char msg[128];
+    std::snprintf(msg, sizeof(msg), "30 resting crates, 500 steps: awake %lld us | asleep %lld us", awakeUs, asleepUs);
+    TEST_MESSAGE(msg);
+}
+
+namespace {
+/// Eight crate columns plus bouncing balls thrown across them: many islands, merging and splitting.
+struct CrateYard {
+    CollisionSystem system;
+    std::unique_ptr<CrateStack> stack;
+    std::vector<std::unique_ptr<MockActor>> balls;
+
+    CrateYard(PhysicsWorker* worker, bool soa) {
+        system.setWorker(worker);
+        system.setSoaBodies(soa);
+        stack = std::make_unique<CrateStack>(system, 4);
+        for (int i = 1; i < 8; i++) {
+            stack->addColumn(system, 4, 40.0f + i * 26.0f);
+        }
+        for (int i = 0; i < 6; i++) {
+            balls.push_back(std::make_unique<MockActor>(50.0f + i * 26.0f, 20.0f, 8, 8));
+            MockActor& ball = *balls.back();
+            ball.setShape(CollisionShape::CIRCLE);
+            ball.setRadius(toScalar(4));
+            ball.setCollisionLayer(1);
+            ball.setCollisionMask(1);
+            ball.setRestitution(toScalar(0.5f));
+            ball.setVelocity(toScalar(i % 2 ? -40 : 40), toScalar(0));
+            system.addEntity(&ball);
+        }
+    }
+
+    std::vector<MockActor*> bodies() const {
+        std::vector<MockActor*> all;
+        for (const auto& crate : stack->crates) all.push_back(crate.get());
+        for (const auto& ball : balls) all.push_back(ball.get());
+        return all;
+    }
+};
+
+bool sameBits(Scalar a, Scalar b) {
+    return std::memcmp(&a, &b, sizeof(Scalar)) == 0;
+}
+}
+
+void test_parallel_step_matches_serial_bit_for_bit(void) {
+    PhysicsWorker worker;
+    worker.start(pixelroot32::platforms::PlatformCapabilities{});
+    TEST_ASSERT_TRUE(worker.isRunning());
+
+    for (bool soa : {false, true}) {
+        CrateYard serial(nullptr, false);
+        CrateYard parallel(&worker, soa);
+        const std::vector<MockActor*> a = serial.bodies();
+        const std::vector<MockActor*> b = parallel.bodies();
+        int parallelSteps = 0;
+        for (int s = 0; s < 400; s++) {
+            // Throw a ball back in now and then so sleeping columns get woken by contact.
+            if (s % 90 == 60) {
+                a[a.size() - 1 - s % 6]->applyImpulse(Vector2(toScalar(60), toScalar(-120)));
+                b[b.size() - 1 - s % 6]->applyImpulse(Vector2(toScalar(60), toScalar(-120)));
+            }
+            serial.system.update();
+            parallel.system.update();
+            for (size_t i = 0; i < a.size(); i++) {
+                TEST_ASSERT_TRUE(sameBits(a[i]->position.x, b[i]->position.x));
+                TEST_ASSERT_TRUE(sameBits(a[i]->position.y, b[i]->position.y));
+                TEST_ASSERT_TRUE(sameBits(a[i]->getVelocity().x, b[i]->getVelocity().x));
+                TEST_ASSERT_TRUE(sameBits(a[i]->getVelocity().y, b[i]->getVelocity().y));
+                TEST_ASSERT_EQUAL(a[i]->isSleeping(), b[i]->isSleeping());
+            }
+            const SolverStats sa = serial.system.getSolverStats();
+            const SolverStats sb = parallel.system.getSolverStats();
+            TEST_ASSERT_EQUAL_UINT16(sa.contacts, sb.contacts);
+            TEST_ASSERT_EQUAL_UINT16(sa.cachedContacts, sb.cachedContacts);
+            TEST_ASSERT_EQUAL_UINT16(sa.sleepingBodies, sb.sleepingBodies);
+            // Steps with enough pairs and contacts for both parallel passes (no pair overflow).
+            const BroadphaseStats broadphase = parallel.system.getBroadphaseStats();
+            if (!broadphase.pairOverflow && broadphase.pairs >= 32 && sb.contacts >= 32) parallelSteps++;
+        }
+        TEST_ASSERT_TRUE(parallelSteps >= 100);
+    }
+
+    // A stopped worker falls back to the serial step.
+    worker.stop();
+    CrateYard stopped(&worker, false);
+    stopped.system.update();
+    TEST_ASSERT_FALSE(worker.isRunning());
+}
+
+void test_systems_on_separate_threads_share_no_scratch(void) {
+    // Each system owns its broadphase and sleep scratch, so two can step at the same time.
+    CrateYard reference(nullptr, false);
+    CrateYard left(nullptr, false);
+    CrateYard right(nullptr, true);
+    for (int s = 0; s < 300; s++) reference.system.update();
+    std::thread other([&] {
+        for (int s = 0; s < 300; s++) right.system.update();
+    });
+    for (int s = 0; s < 300; s++) left.system.update();
+    other.join();
+
+    const std::vector<MockActor*> r = reference.bodies();
+    for (CrateYard* yard : {&left, &right}) {
+        const std::vector<MockActor*> b = yard->bodies();
+        for (size_t i = 0; i < r.size(); i++) {
+            TEST_ASSERT_TRUE(sameBits(r[i]->position.x, b[i]->position.x));
+            TEST_ASSERT_TRUE(sameBits(r[i]->position.y, b[i]->position.y));
+            TEST_ASSERT_EQUAL(r[i]->isSleeping(), b[i]->isSleeping());
+        }
+    }
+}
+
 int main(int argc, char **argv) {
     (void)argc;
     (void)argv;
@@ -2053,6 +2699,27 @@ int main(int argc, char **argv) {
     RUN_TEST(test_spatial_grid_mark_static_dirty);
     RUN_TEST(test_spatial_grid_clear_dynamic);
 
+    // Spatial queries
+    RUN_TEST(test_query_aabb_filters_layers_and_finds_offscreen_statics);
+    RUN_TEST(test_query_results_overflow_flag);
+    RUN_TEST(test_check_collision_uses_overflow_of_full_cells);
+    RUN_TEST(test_query_swept_and_raycast_nearest_hit);
+    RUN_TEST(test_queries_survive_another_system_rebuilding_the_grid);
+    RUN_TEST(test_update_body_registers_moved_actor);
+    RUN_TEST(test_world_bounds_give_offscreen_statics_their_own_cells);
+    RUN_TEST(test_world_bounds_with_negative_origin);
+    RUN_TEST(test_broadphase_idle_step_keeps_pairs);
+    RUN_TEST(test_broadphase_pair_overflow_still_detects);
+    RUN_TEST(test_broadphase_benchmark_idle_bodies);
+    RUN_TEST(test_contact_cache_warm_starts_resting_stack);
+    RUN_TEST(test_sleeping_box_on_floor);
+    RUN_TEST(test_sleeping_island_wakes_together);
+    RUN_TEST(test_sleeping_island_wakes_warm);
+    RUN_TEST(test_sleeping_body_woken_by_contact);
+    RUN_TEST(test_sleeping_benchmark_idle_crates);
+    RUN_TEST(test_parallel_step_matches_serial_bit_for_bit);
+    RUN_TEST(test_systems_on_separate_threads_share_no_scratch);
+
     // =============================================================================
     // FASE 3: Sensor contact tests (triggers)
     // =============================================================================
@@ -10,6 +10,7 @@
  * - Color constants
  * - Palette resolution (legacy, dual, context)
  * - Multi-palette background slot bank (initBackgroundPaletteSlots, set/getBackgroundPaletteSlot, resolveColorWithPalette)
+ * - Indexed framebuffer support (paletteSlotIndex, palette generation, buildIndexedPaletteLUT)
  */
 
 #include <unity.h>
@@ -963,6 +964,76 @@ void test_setSpriteCustomPaletteSlot_sync_with_setSpriteCustomPalette(void) {
     setPalette(PaletteType::PR32);
 }
 
+// =============================================================================
+// Tests for indexed framebuffer support
+// =============================================================================
+
+/**
+ * @test paletteSlotIndex encodes bank, slot and colour
+ * @expected bit 7 = sprite bank, bits 4-6 = slot, bits 0-3 = colour; invalid inputs fall back
+ */
+void test_paletteSlotIndex_encoding(void) {
+    TEST_ASSERT_EQUAL_UINT8(0x00, paletteSlotIndex(PaletteContext::Background, 0, Color::Black));
+    TEST_ASSERT_EQUAL_UINT8(0x3B, paletteSlotIndex(PaletteContext::Background, 3, Color::Red));
+    TEST_ASSERT_EQUAL_UINT8(0xF1, paletteSlotIndex(PaletteContext::Sprite, 7, Color::White));
+    TEST_ASSERT_EQUAL_UINT8(0x81, paletteSlotIndex(PaletteContext::Sprite, 9, Color::White));
+    TEST_ASSERT_EQUAL_UINT8(0x00, paletteSlotIndex(PaletteContext::Sprite, 2, Color::Transparent));
+}
+
+/**
+ * @test Palette setters bump the palette generation
+ * @expected Every slot / palette change and markPalettesChanged() advance the counter
+ */
+void test_palette_generation_bumps_on_change(void) {
+    const uint32_t g0 = getPaletteGeneration();
+    setSpritePaletteSlot(2, PaletteType::GB);
+    const uint32_t g1 = getPaletteGeneration();
+    TEST_ASSERT_NOT_EQUAL(g0, g1);
+    setBackgroundPalette(PaletteType::NES);
+    const uint32_t g2 = getPaletteGeneration();
+    TEST_ASSERT_NOT_EQUAL(g1, g2);
+    markPalettesChanged();
+    TEST_ASSERT_NOT_EQUAL(g2, getPaletteGeneration());
+    setPalette(PaletteType::PR32);
+    initSpritePaletteSlots();
+}
+
+/**
+ * @test buildIndexedPaletteLUT resolves every slot-qualified index
+ * @expected Entry paletteSlotIndex(ctx, slot, c) equals resolveColorWithPalette(c, slot palette)
+ */
+void test_buildIndexedPaletteLUT_matches_slot_banks(void) {
+    enableDualPaletteMode(true);
+    initBackgroundPaletteSlots();
+    initSpritePaletteSlots();
+    setBackgroundPalette(PaletteType::NES);
+    setBackgroundPaletteSlot(5, PaletteType::GBC);
+    setSpritePaletteSlot(3, PaletteType::GB);
+    static const uint16_t custom[16] = {0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008,
+                                        0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010};
+    setSpriteCustomPaletteSlot(6, custom);
+
+    uint16_t lut[256];
+    buildIndexedPaletteLUT(lut);
+    for (uint8_t slot = 0; slot < 8; ++slot) {
+        for (uint8_t c = 0; c < PALETTE_SIZE; ++c) {
+            const Color color = static_cast<Color>(c);
+            TEST_ASSERT_EQUAL_UINT16(resolveColorWithPalette(color, getBackgroundPaletteSlot(slot)),
+                                     lut[paletteSlotIndex(PaletteContext::Background, slot, color)]);
+            TEST_ASSERT_EQUAL_UINT16(resolveColorWithPalette(color, getSpritePaletteSlot(slot)),
+                                     lut[paletteSlotIndex(PaletteContext::Sprite, slot, color)]);
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT16(0x000C, lut[paletteSlotIndex(PaletteContext::Sprite, 6, Color::Red)]);
+    TEST_ASSERT_EQUAL_UINT16(resolveColor(Color::Blue, PaletteContext::Background),
+                             lut[paletteSlotIndex(PaletteContext::Background, 0, Color::Blue)]);
+
+    enableDualPaletteMode(false);
+    setPalette(PaletteType::PR32);
+    initBackgroundPaletteSlots();
+    initSpritePaletteSlots();
+}
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -1061,6 +1132,11 @@ int main(int argc, char **argv) {
     RUN_TEST(test_getSpritePaletteSlot_out_of_range_fallback);
     RUN_TEST(test_setSpritePaletteSlot_sync_with_setSpritePalette);
     RUN_TEST(test_setSpriteCustomPaletteSlot_sync_with_setSpriteCustomPalette);
+
+    // Indexed framebuffer support
+    RUN_TEST(test_paletteSlotIndex_encoding);
+    RUN_TEST(test_palette_generation_bumps_on_change);
+    RUN_TEST(test_buildIndexedPaletteLUT_matches_slot_banks);
     
     return UNITY_END();
 }
@@ -55,6 +55,20 @@ void test_dirty_grid_mark_rect_covers_cells(void) {
     TEST_ASSERT_FALSE(g.isPrevDirty(0, 1));
 }
 
+void test_dirty_grid_mark_cells_ors_mask(void) {
+    DirtyGrid g;
+    (void)g.init(80, 16);  // 10 x 2 cells, 2 mask bytes per row
+    TEST_ASSERT_EQUAL_UINT32(4u, static_cast<uint32_t>(g.cellMaskBytes()));
+    g.markCell(0, 0);
+    const uint8_t mask[] = {0x01, 0xFF, 0x00, 0x02};  // (0,0) again, 8..9 + ignored bits, (9,1)
+    g.markCells(mask);
+    TEST_ASSERT_EQUAL_UINT32(4u, g.countCurrMarkedCells());
+    TEST_ASSERT_TRUE(g.isCurrMarked(8, 0));
+    TEST_ASSERT_TRUE(g.isCurrMarked(9, 0));
+    TEST_ASSERT_TRUE(g.isCurrMarked(9, 1));
+    TEST_ASSERT_FALSE(g.isCurrMarked(1, 0));
+}
+
 void test_dirty_grid_mark_rect_clipped(void) {
     DirtyGrid g;
     (void)g.init(16, 16);
@@ -147,6 +161,116 @@ void test_dirty_grid_clear_framebuffer8_row_run_merges_adjacent_cells(void) {
     TEST_ASSERT_EQUAL_UINT8(0xCDu, buf[8 * kW]);
 }
 
+void test_dirty_grid_clear_framebuffer16_from_prev_cells(void) {
+    DirtyGrid g;
+    constexpr int kW = 24;
+    constexpr int kH = 16;
+    (void)g.init(kW, kH);
+    uint16_t buf[kW * kH];
+    for (uint16_t& px : buf) {
+        px = 0xBEEFu;
+    }
+    g.markCell(1, 0);
+    g.markCell(2, 1);
+    g.swapAndClear();
+    g.clearFramebuffer16FromPrev(buf, kW, kH, 0x1234u);
+    TEST_ASSERT_EQUAL_UINT16(0xBEEFu, buf[7]);
+    TEST_ASSERT_EQUAL_UINT16(0x1234u, buf[8]);
+    TEST_ASSERT_EQUAL_UINT16(0x1234u, buf[7 * kW + 15]);
+    TEST_ASSERT_EQUAL_UINT16(0xBEEFu, buf[7 * kW + 16]);
+    TEST_ASSERT_EQUAL_UINT16(0x1234u, buf[15 * kW + 23]);
+    TEST_ASSERT_EQUAL_UINT16(0xBEEFu, buf[15 * kW + 15]);
+}
+
+void test_dirty_grid_clear_skips_covered_cells(void) {
+    DirtyGrid g;
+    constexpr int kW = 24;
+    constexpr int kH = 16;
+    (void)g.init(kW, kH);
+    uint8_t buf[kW * kH];
+    std::memset(buf, 0xCDu, sizeof(buf));
+    g.markRect(0, 0, kW, 8);
+    g.swapAndClear();
+    g.markCovered(1, 0);
+    g.markCovered(2, 1);  // not in prev: no effect on the clear
+    TEST_ASSERT_TRUE(g.isCovered(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(1u, g.countPrevCoveredCells());
+    g.clearFramebuffer8FromPrev(buf, kW, kH, 0);
+    TEST_ASSERT_EQUAL_UINT8(0, buf[7]);
+    TEST_ASSERT_EQUAL_UINT8(0xCDu, buf[8]);
+    TEST_ASSERT_EQUAL_UINT8(0xCDu, buf[7 * kW + 15]);
+    TEST_ASSERT_EQUAL_UINT8(0, buf[7 * kW + 16]);
+    TEST_ASSERT_EQUAL_UINT8(0xCDu, buf[8 * kW + 16]);
+
+    g.swapAndClear();
+    TEST_ASSERT_FALSE(g.isCovered(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(0u, g.countPrevCoveredCells());
+}
+
+void test_dirty_grid_present_rects_union_prev_curr(void) {
+    DirtyGrid g;
+    (void)g.init(64, 64);
+    g.markCell(0, 0);
+    g.swapAndClear();
+    g.markCell(5, 3);
+    DirtyRect rects[8];
+    uint16_t n = 0;
+    TEST_ASSERT_TRUE(g.collectPresentRects(rects, 8, n, 64, 64));
+    TEST_ASSERT_EQUAL_UINT16(2, n);
+    TEST_ASSERT_EQUAL_UINT16(0, rects[0].x);
+    TEST_ASSERT_EQUAL_UINT16(0, rects[0].y);
+    TEST_ASSERT_EQUAL_UINT16(8, rects[0].w);
+    TEST_ASSERT_EQUAL_UINT16(40, rects[1].x);
+    TEST_ASSERT_EQUAL_UINT16(24, rects[1].y);
+    TEST_ASSERT_EQUAL_UINT16(8, rects[1].h);
+}
+
+void test_dirty_grid_present_rects_merge_rows_and_gaps(void) {
+    DirtyGrid g;
+    (void)g.init(128, 64);
+    // Two cells with a one-cell gap on rows 1..3 -> one 24x24 rect.
+    for (uint8_t cy = 1; cy <= 3; ++cy) {
+        g.markCell(2, cy);
+        g.markCell(4, cy);
+    }
+    // Far cell on row 1 stays separate (gap of 5 > 1).
+    g.markCell(10, 1);
+    DirtyRect rects[8];
+    uint16_t n = 0;
+    TEST_ASSERT_TRUE(g.collectPresentRects(rects, 8, n, 128, 64, 1));
+    TEST_ASSERT_EQUAL_UINT16(2, n);
+    TEST_ASSERT_EQUAL_UINT16(16, rects[0].x);
+    TEST_ASSERT_EQUAL_UINT16(8, rects[0].y);
+    TEST_ASSERT_EQUAL_UINT16(24, rects[0].w);
+    TEST_ASSERT_EQUAL_UINT16(24, rects[0].h);
+    TEST_ASSERT_EQUAL_UINT16(80, rects[1].x);
+    TEST_ASSERT_EQUAL_UINT16(8, rects[1].h);
+}
+
+void test_dirty_grid_present_rects_empty_and_fallbacks(void) {
+    DirtyGrid g;
+    (void)g.init(64, 64);
+    DirtyRect rects[2];
+    uint16_t n = 99;
+    TEST_ASSERT_TRUE(g.collectPresentRects(rects, 2, n, 64, 64));
+    TEST_ASSERT_EQUAL_UINT16(0, n);
+
+    // Capacity exceeded.
+    g.markCell(0, 0);
+    g.markCell(0, 2);
+    g.markCell(0, 4);
+    TEST_ASSERT_FALSE(g.collectPresentRects(rects, 2, n, 64, 64));
+
+    // Screen not cell aligned: edge pixels are untracked.
+    DirtyGrid odd;
+    (void)odd.init(60, 64);
+    TEST_ASSERT_FALSE(odd.collectPresentRects(rects, 2, n, 60, 64));
+
+    // Full dirty.
+    g.markAll();
+    TEST_ASSERT_FALSE(g.collectPresentRects(rects, 2, n, 64, 64));
+}
+
 int main() {
     UNITY_BEGIN();
 
@@ -155,6 +279,7 @@ int main() {
     RUN_TEST(test_dirty_grid_mark_cell_swap_prev);
     RUN_TEST(test_dirty_grid_mark_rect_covers_cells);
     RUN_TEST(test_dirty_grid_mark_rect_clipped);
+    RUN_TEST(test_dirty_grid_mark_cells_ors_mask);
     RUN_TEST(test_dirty_grid_swap_clears_curr_next_frame_pattern);
     RUN_TEST(test_dirty_grid_mark_all);
     RUN_TEST(test_dirty_grid_out_of_bounds_mark_ignored);
@@ -162,6 +287,11 @@ int main() {
     RUN_TEST(test_dirty_grid_popcount_prev_curr);
     RUN_TEST(test_dirty_grid_clear_framebuffer8_from_prev_one_cell);
     RUN_TEST(test_dirty_grid_clear_framebuffer8_row_run_merges_adjacent_cells);
+    RUN_TEST(test_dirty_grid_clear_framebuffer16_from_prev_cells);
+    RUN_TEST(test_dirty_grid_clear_skips_covered_cells);
+    RUN_TEST(test_dirty_grid_present_rects_union_prev_curr);
+    RUN_TEST(test_dirty_grid_present_rects_merge_rows_and_gaps);
+    RUN_TEST(test_dirty_grid_present_rects_empty_and_fallbacks);
 
     return UNITY_END();
 }
@@ -0,0 +1,395 @@
+/**
+ * @file test_display_list.cpp
+ * @brief Unit tests for DisplayList and the Renderer's recorded mode
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * Checks the command arena (sort, palette batching, merging), then renders
+ * the same frames in immediate and recorded mode and compares the
+ * framebuffers pixel for pixel, including arena overflow, the DirtyGrid
+ * cull of static tile runs and occlusion by opaque rects / tiles.
+ */
+
+#include <unity.h>
+#include "../test_config.h"
+#include "graphics/DisplayList.h"
+#include "graphics/Renderer.h"
+#include "graphics/DisplayConfig.h"
+#include "graphics/FontManager.h"
+#include "graphics/Font5x7.h"
+#include "mocks/MockDrawSurface.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace pixelroot32::graphics;
+
+namespace {
+
+constexpr int kW = 64;
+constexpr int kH = 48;
+
+/// Exposed framebuffer whose filled rects land in the buffer, like a TFT_eSprite's fillRect().
+class FillSurface : public MockDrawSurface {
+public:
+    FillSurface(FramebufferPixel* fb, int w, int h) : fb(fb), w(w), h(h) {
+        setSpriteBuffer(reinterpret_cast<uint8_t*>(fb), static_cast<size_t>(w * h) * sizeof(FramebufferPixel));
+    }
+
+    void drawFilledRectangle(int x, int y, int width, int height, uint16_t color) override {
+        for (int py = std::max(y, 0); py < std::min(y + height, h); ++py) {
+            for (int px = std::max(x, 0); px < std::min(x + width, w); ++px) {
+                fb[py * w + px] = packRgb565ToFramebuffer(color);
+            }
+        }
+    }
+
+private:
+    FramebufferPixel* fb;
+    int w;
+    int h;
+};
+
+/// Two renderers over exposed framebuffers: one draws immediately, one records.
+struct RecordedPair {
+    std::vector<FramebufferPixel> immediateFb;
+    std::vector<FramebufferPixel> recordedFb;
+    Renderer* immediate = nullptr;
+    Renderer* recorded = nullptr;
+
+    explicit RecordedPair(std::size_t commandCapacity, std::size_t textCapacity = 256)
+        : immediateFb(static_cast<size_t>(kW * kH), 0), recordedFb(static_cast<size_t>(kW * kH), 0) {
+        auto* immediateSurface = new FillSurface(immediateFb.data(), kW, kH);
+        immediate = new Renderer(DisplayConfig::createCustom(immediateSurface, kW, kH));
+        immediate->setDisplaySize(kW, kH);
+
+        auto* recordedSurface = new FillSurface(recordedFb.data(), kW, kH);
+        recorded = new Renderer(DisplayConfig::createCustom(recordedSurface, kW, kH));
+        recorded->setDisplaySize(kW, kH);
+        TEST_ASSERT_TRUE(recorded->enableRecordedMode(commandCapacity, textCapacity));
+    }
+
+    ~RecordedPair() {
+        delete immediate;
+        delete recorded;
+    }
+
+    size_t bytes() const { return immediateFb.size() * sizeof(FramebufferPixel); }
+
+    bool equal() const {
+        return std::memcmp(immediateFb.data(), recordedFb.data(), bytes()) == 0;
+    }
+
+    template<typename F>
+    void frame(F&& draw) {
+        immediate->beginFrame();
+        recorded->beginFrame();
+        draw(*immediate);
+        draw(*recorded);
+        immediate->endFrame();
+        recorded->endFrame();
+    }
+};
+
+DrawCommand makeRect(int x, int y, int w, int h, uint16_t color, uint8_t layer = 0) {
+    DrawCommand c{};
+    c.type = DrawCommandType::FilledRect;
+    c.layer = layer;
+    c.x = x;
+    c.y = y;
+    c.w = static_cast<int16_t>(w);
+    c.h = static_cast<int16_t>(h);
+    c.rect.surfaceColor = color;
+    return c;
+}
+
+DrawCommand makeSprite4(int x, int y, const Color* palette, uint8_t layer = 0) {
+    DrawCommand c{};
+    c.type = DrawCommandType::Sprite4bpp;
+    c.layer = layer;
+    c.x = x;
+    c.y = y;
+    c.w = 8;
+    c.h = 8;
+    c.spriteN.palette = palette;
+    c.spriteN.paletteSize = 16;
+    return c;
+}
+
+const Color kPaletteA[16] = {
+    Color::Transparent, Color::White, Color::Red, Color::Green, Color::Blue, Color::Yellow,
+    Color::Cyan, Color::Magenta, Color::Orange, Color::Purple, Color::Gray, Color::Navy,
+    Color::DarkGreen, Color::DarkRed, Color::LightGreen, Color::LightRed,
+};
+const Color kPaletteB[16] = {
+    Color::Transparent, Color::Navy, Color::Orange, Color::Cyan, Color::Red, Color::Gray,
+    Color::White, Color::Green, Color::Blue, Color::Yellow, Color::Magenta, Color::Purple,
+    Color::LightRed, Color::LightGreen, Color::DarkRed, Color::DarkGreen,
+};
+
+// 8x8 4bpp sprite with a transparent diagonal so overlap order is visible.
+uint8_t kSprite4Data[32];
+const uint16_t kGlyphRows[] = {0x18, 0x3C, 0x7E, 0xFF, 0xFF, 0x7E, 0x3C, 0x18};
+const Sprite kGlyph{kGlyphRows, 8, 8};
+
+struct TileFixture {
+    uint8_t tileData[2][32] = {};
+    Sprite4bpp tiles[2] = {};
+    uint8_t indices[8 * 6] = {};
+    uint8_t solid[8 * 2] = {};
+    TileMap4bpp map{};
+    TileMap4bpp foreground{};  ///< 8x2 fully opaque tiles.
+
+    TileFixture() {
+        for (int b = 0; b < 32; ++b) {
+            tileData[1][b] = static_cast<uint8_t>(((b * 7 + 3) & 0x0F) | 0x11);
+        }
+        tiles[0] = Sprite4bpp{tileData[0], kPaletteA, 8, 8, 16};
+        tiles[1] = Sprite4bpp{tileData[1], kPaletteA, 8, 8, 16};
+        for (int i = 0; i < 8 * 6; ++i) {
+            indices[i] = static_cast<uint8_t>((i % 3) != 0 ? 1 : 0);
+        }
+        map.indices = indices;
+        map.width = 8;
+        map.height = 6;
+        map.tiles = tiles;
+        map.tileWidth = 8;
+        map.tileHeight = 8;
+        map.tileCount = 2;
+
+        std::memset(solid, 1, sizeof(solid));
+        foreground = map;
+        foreground.indices = solid;
+        foreground.height = 2;
+    }
+};
+
+} // namespace
+
+void setUp(void) {
+    test_setup();
+    for (int i = 0; i < 32; ++i) {
+        const int x = (i % 4) * 2;
+        const int y = i / 4;
+        const uint8_t lo = (x == y) ? 0 : static_cast<uint8_t>(1 + (i % 15));
+        const uint8_t hi = (x + 1 == y) ? 0 : static_cast<uint8_t>(1 + ((i * 5) % 15));
+        kSprite4Data[i] = static_cast<uint8_t>(lo | (hi << 4));
+    }
+}
+
+void tearDown(void) {
+    test_teardown();
+}
+
+void test_display_list_merges_adjacent_rects(void) {
+    DisplayList list;
+    TEST_ASSERT_TRUE(list.allocate(8, 0));
+    *list.append() = makeRect(0, 0, 4, 4, 7);
+    *list.append() = makeRect(4, 0, 6, 4, 7);   // extends to the right
+    *list.append() = makeRect(0, 4, 10, 2, 7);  // extends downwards
+    *list.append() = makeRect(20, 0, 4, 4, 7);  // disjoint
+    *list.append() = makeRect(24, 0, 4, 4, 9);  // other colour
+    TEST_ASSERT_EQUAL(2u, list.mergeAdjacent());
+    TEST_ASSERT_EQUAL(3u, list.size());
+    TEST_ASSERT_EQUAL(0, list[0].x);
+    TEST_ASSERT_EQUAL(10, list[0].w);
+    TEST_ASSERT_EQUAL(6, list[0].h);
+    TEST_ASSERT_EQUAL(20, list[1].x);
+    TEST_ASSERT_EQUAL(24, list[2].x);
+}
+
+void test_display_list_sort_is_stable_by_layer(void) {
+    DisplayList list;
+    TEST_ASSERT_TRUE(list.allocate(8, 0));
+    *list.append() = makeRect(0, 0, 1, 1, 1, 2);
+    *list.append() = makeRect(1, 0, 1, 1, 2, 0);
+    *list.append() = makeRect(2, 0, 1, 1, 3, 1);
+    *list.append() = makeRect(3, 0, 1, 1, 4, 0);
+    list.sortByLayerAndPalette();
+    const uint16_t expected[] = {2, 4, 3, 1};
+    for (std::size_t i = 0; i < 4; ++i) {
+        TEST_ASSERT_EQUAL(expected[i], list[i].rect.surfaceColor);
+    }
+}
+
+void test_display_list_batches_palettes_without_reordering_overlaps(void) {
+    DisplayList list;
+    TEST_ASSERT_TRUE(list.allocate(8, 0));
+    *list.append() = makeSprite4(0, 0, kPaletteA);
+    *list.append() = makeSprite4(10, 0, kPaletteB);
+    *list.append() = makeSprite4(20, 0, kPaletteA);  // disjoint: joins the first A
+    *list.append() = makeSprite4(14, 4, kPaletteB);  // overlaps B at x=10: must stay after it
+    *list.append() = makeSprite4(4, 4, kPaletteA);   // overlaps the first A and B at x=10
+    list.sortByLayerAndPalette();
+
+    TEST_ASSERT_EQUAL_PTR(kPaletteA, list[0].spriteN.palette);
+    TEST_ASSERT_EQUAL_PTR(kPaletteA, list[1].spriteN.palette);
+    TEST_ASSERT_EQUAL(20, list[1].x);
+    // Paint order between every overlapping pair is unchanged.
+    auto indexOf = [&](int x) {
+        for (std::size_t i = 0; i < list.size(); ++i) {
+            if (list[i].x == x) return static_cast<int>(i);
+        }
+        return -1;
+    };
+    TEST_ASSERT_LESS_THAN(indexOf(14), indexOf(10));
+    TEST_ASSERT_LESS_THAN(indexOf(4), indexOf(0));
+    TEST_ASSERT_LESS_THAN(indexOf(4), indexOf(10));
+}
+
+void test_recorded_mode_matches_immediate(void) {
+    FontManager::setDefaultFont(&FONT_5X7);
+    const Sprite4bpp spriteA{kSprite4Data, kPaletteA, 8, 8, 16};
+    const Sprite4bpp spriteB{kSprite4Data, kPaletteB, 8, 8, 16};
+    TileFixture tiles;
+
+    RecordedPair pair(64);
+    for (int f = 0; f < 3; ++f) {
+        pair.frame([&](Renderer& r) {
+            r.setDisplayOffset(-f, f);
+            r.drawTileMap(tiles.map, -3, -2);
+            r.setDrawLayer(1);
+            r.drawFilledRectangle(2, 30, 8, 4, Color::Red);
+            r.drawFilledRectangle(10, 30, 8, 4, Color::Red);
+            r.drawSprite(spriteA, 5 + f, 5, false);
+            r.drawSprite(spriteB, 9 + f, 8, true);
+            r.drawSprite(spriteA, 30, 20 - f, false);
+            r.drawSprite(kGlyph, 40, 4, Color::Yellow, f == 1);
+            r.drawSprite(spriteB, 200, 200, false);  // off-viewport
+            r.setDrawLayer(2);
+            r.drawText("HP 9", 1, 40, Color::White, 1);
+            r.drawFilledRectangle(50, 40, 10, 6, Color::Cyan);
+        });
+        TEST_ASSERT_TRUE_MESSAGE(pair.equal(), "recorded frame differs from immediate");
+    }
+    pair.immediate->setDisplayOffset(0, 0);
+    pair.recorded->setDisplayOffset(0, 0);
+
+    const DisplayListStats& stats = pair.recorded->getDisplayListStats();
+    TEST_ASSERT_EQUAL(9u, stats.recorded);
+    TEST_ASSERT_EQUAL(1u, stats.culled);
+    TEST_ASSERT_EQUAL(1u, stats.merged);
+    TEST_ASSERT_EQUAL(8u, stats.executed);
+    TEST_ASSERT_EQUAL(0u, stats.overflowFlushes);
+}
+
+void test_recorded_mode_barrier_keeps_order(void) {
+    RecordedPair pair(16);
+    pair.frame([](Renderer& r) {
+        r.setDrawLayer(3);
+        r.drawFilledRectangle(0, 0, 20, 20, Color::Blue);
+        r.drawLine(0, 0, 30, 30, Color::White);  // not recordable: flushes first
+        r.setDrawLayer(0);
+        r.drawFilledRectangle(5, 5, 4, 4, Color::Red);
+    });
+    TEST_ASSERT_TRUE(pair.equal());
+}
+
+void test_recorded_mode_overflow_flushes_early(void) {
+    FontManager::setDefaultFont(&FONT_5X7);
+    RecordedPair pair(2, 8);
+    pair.frame([](Renderer& r) {
+        for (int i = 0; i < 6; ++i) {
+            r.drawFilledRectangle(i * 9, i * 3, 6, 6, (i & 1) ? Color::Green : Color::Orange);
+        }
+        r.drawText("ABCDEF", 2, 30, Color::White, 1);
+        r.drawText("A TEXT LONGER THAN THE ARENA", 0, 40, Color::White, 1);
+    });
+    TEST_ASSERT_TRUE(pair.equal());
+    TEST_ASSERT_GREATER_THAN(0u, pair.recorded->getDisplayListStats().overflowFlushes);
+}
+
+void test_recorded_mode_counts_commands_of_unended_frame(void) {
+    RecordedPair pair(16);
+    pair.frame([](Renderer& r) { r.drawFilledRectangle(0, 0, 8, 8, Color::Red); });
+    TEST_ASSERT_EQUAL_UINT32(0, pair.recorded->getDisplayListStats().discarded);
+
+    // A loop that skips endFrame() (e.g. presents with sendBuffer()) never executes its commands.
+    pair.recorded->beginFrame();
+    pair.recorded->drawFilledRectangle(0, 0, 8, 8, Color::Red);
+    pair.recorded->drawFilledRectangle(16, 0, 8, 8, Color::Blue);
+    pair.recorded->getDrawSurface().sendBuffer();
+    pair.recorded->beginFrame();
+    TEST_ASSERT_EQUAL_UINT32(2, pair.recorded->getDisplayListStats().discarded);
+    pair.recorded->endFrame();
+}
+
+void test_recorded_mode_culls_clean_static_tile_rows(void) {
+    if constexpr (!pixelroot32::platforms::config::EnableDirtyRegions) {
+        TEST_IGNORE_MESSAGE("requires PIXELROOT32_ENABLE_DIRTY_REGIONS");
+    }
+    TileFixture tiles;
+    RecordedPair pair(16);
+    // The map covers rows 16..47. Its rows are repainted only where last frame's sprite was
+    // cleared (frame 4); a sprite drawn over clean static pixels does not need them (frame 3).
+    const int spriteY[] = {2, 2, 2, 20, 2, 2};
+    const uint32_t expectCulled[] = {0, 1, 1, 1, 0, 1};
+    for (int f = 0; f < 6; ++f) {
+        pair.frame([&](Renderer& r) {
+            r.drawTileMap(tiles.map, 0, 16, LayerType::Static);
+            r.setDrawLayer(1);
+            r.drawSprite(kGlyph, 4 + f * 3, spriteY[f], Color::Red);
+        });
+        TEST_ASSERT_TRUE_MESSAGE(pair.equal(), "culled static rows left stale pixels");
+        TEST_ASSERT_EQUAL(expectCulled[f], pair.recorded->getDisplayListStats().culled);
+        TEST_ASSERT_EQUAL(2u - expectCulled[f], pair.recorded->getDisplayListStats().executed);
+    }
+}
+
+void test_recorded_mode_culls_sprites_behind_opaque_tiles(void) {
+    if constexpr (!pixelroot32::platforms::config::EnableDirtyRegions) {
+        TEST_IGNORE_MESSAGE("requires PIXELROOT32_ENABLE_DIRTY_REGIONS");
+    }
+    const Sprite4bpp sprite{kSprite4Data, kPaletteB, 8, 8, 16};
+    TileFixture tiles;
+    RecordedPair pair(16);
+    for (int f = 0; f < 3; ++f) {
+        pair.frame([&](Renderer& r) {
+            r.drawTileMap(tiles.map, 0, 0, LayerType::Static);
+            r.setDrawLayer(1);
+            r.drawSprite(sprite, 20 + f, 10, false);  // inside the foreground band (rows 8..23)
+            r.drawSprite(sprite, 40, 20 - f, false);  // sticks out below it
+            r.setDrawLayer(2);
+            r.drawTileMap(tiles.foreground, 0, 8, LayerType::Dynamic);
+        });
+        TEST_ASSERT_TRUE_MESSAGE(pair.equal(), "occlusion culling changed the frame");
+        const DisplayListStats& stats = pair.recorded->getDisplayListStats();
+        TEST_ASSERT_EQUAL(1u, stats.occluded);
+        TEST_ASSERT_EQUAL(3u, stats.executed);
+    }
+}
+
+void test_recorded_mode_skips_clear_of_covered_cells(void) {
+    if constexpr (!pixelroot32::platforms::config::EnableDirtyRegions) {
+        TEST_IGNORE_MESSAGE("requires PIXELROOT32_ENABLE_DIRTY_REGIONS");
+    }
+    RecordedPair pair(16);
+    for (int f = 0; f < 3; ++f) {
+        pair.frame([&](Renderer& r) {
+            r.drawFilledRectangle(0, 0, kW, 32, Color::Navy);  // opaque backdrop over cell rows 0..3
+            r.drawSprite(kGlyph, 4 + f * 5, 30, Color::Yellow);  // straddles rows 3 and 4
+        });
+        TEST_ASSERT_TRUE_MESSAGE(pair.equal(), "skipped clear left stale pixels");
+    }
+    // Last frame cleared rows 0..3 (backdrop) and the glyph's cells: only the backdrop rows are skipped.
+    const uint32_t expected = static_cast<uint32_t>(kW * 32) * sizeof(FramebufferPixel);
+    TEST_ASSERT_EQUAL_UINT32(expected, pair.recorded->getDisplayListStats().bytesSaved);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_display_list_merges_adjacent_rects);
+    RUN_TEST(test_display_list_sort_is_stable_by_layer);
+    RUN_TEST(test_display_list_batches_palettes_without_reordering_overlaps);
+    RUN_TEST(test_recorded_mode_matches_immediate);
+    RUN_TEST(test_recorded_mode_barrier_keeps_order);
+    RUN_TEST(test_recorded_mode_overflow_flushes_early);
+    RUN_TEST(test_recorded_mode_counts_commands_of_unended_frame);
+    RUN_TEST(test_recorded_mode_culls_clean_static_tile_rows);
+    RUN_TEST(test_recorded_mode_culls_sprites_behind_opaque_tiles);
+    RUN_TEST(test_recorded_mode_skips_clear_of_covered_cells);
+    return UNITY_END();
+}
@@ -0,0 +1,158 @@
+/**
+ * @file test_fixed16.cpp
+ * @brief Unit tests for the integer Fixed16 sin, cos, atan2 and rsqrt
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * Sweeps each kernel against libm (in double) and checks the worst error in
+ * 16.16 LSBs, then times the integer kernels against the float round trip
+ * through libm that the Fixed16 Scalar path used before.
+ */
+
+#include <unity.h>
+#include "../../test_config.h"
+#include "math/Fixed16.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+using pixelroot32::math::Fixed16;
+
+namespace {
+
+constexpr double kLsb = 1.0 / 65536.0;
+
+double lsbError(Fixed16 got, double expected) {
+    return std::fabs(got.toDouble() - expected) / kLsb;
+}
+
+/// Raw values spread logarithmically over the positive 16.16 range.
+template <typename Fn>
+void forEachPositiveRaw(Fn fn) {
+    for (int bit = 0; bit < 31; bit++) {
+        for (int step = 0; step < 64; step++) {
+            const int64_t raw = (int64_t{1} << bit) + ((int64_t{1} << bit) * step) / 64;
+            if (raw > 0x7FFFFFFF) continue;
+            fn(static_cast<int32_t>(raw));
+        }
+    }
+}
+
+volatile uint32_t g_sink = 0;  // Unsigned: the running sum wraps.
+
+} // namespace
+
+void setUp(void) {
+    test_setup();
+}
+
+void tearDown(void) {
+    test_teardown();
+}
+
+void test_fixed16_sin_cos_match_libm(void) {
+    double worstSin = 0;
+    double worstCos = 0;
+    // Every raw step over [-8, 8] rad, then a coarse sweep out to +-30000 rad.
+    for (int32_t raw = -8 * 65536; raw <= 8 * 65536; raw += 7) {
+        const Fixed16 x = Fixed16::fromRaw(raw);
+        worstSin = std::fmax(worstSin, lsbError(Fixed16::sin(x), std::sin(x.toDouble())));
+        worstCos = std::fmax(worstCos, lsbError(Fixed16::cos(x), std::cos(x.toDouble())));
+    }
+    TEST_ASSERT_TRUE(worstSin <= 2.0);
+    TEST_ASSERT_TRUE(worstCos <= 2.0);
+
+    // Far from zero the radians-to-phase constant adds up to one more LSB.
+    for (int64_t raw = -30000LL * 65536; raw <= 30000LL * 65536; raw += 9973) {
+        const Fixed16 x = Fixed16::fromRaw(static_cast<int32_t>(raw));
+        worstSin = std::fmax(worstSin, lsbError(Fixed16::sin(x), std::sin(x.toDouble())));
+        worstCos = std::fmax(worstCos, lsbError(Fixed16::cos(x), std::cos(x.toDouble())));
+    }
+    TEST_ASSERT_TRUE(worstSin <= 3.0);
+    TEST_ASSERT_TRUE(worstCos <= 3.0);
+
+    TEST_ASSERT_EQUAL(0, Fixed16::sin(Fixed16(0)).raw);
+    TEST_ASSERT_EQUAL(Fixed16::ONE, Fixed16::cos(Fixed16(0)).raw);
+}
+
+void test_fixed16_atan2_matches_libm(void) {
+    double worst = 0;
+    const int32_t magnitudes[] = {1, 3, 100, 4096, 65536, 300000, 5000000, 0x7FFFFFFF};
+    for (int32_t my : magnitudes) {
+        for (int32_t mx : magnitudes) {
+            for (int a = 0; a < 360; a += 7) {
+                // Points around a circle scaled per axis, so every octant and ratio is hit.
+                const double c = std::cos(a * 3.14159265358979 / 180.0);
+                const double s = std::sin(a * 3.14159265358979 / 180.0);
+                const Fixed16 x = Fixed16::fromRaw(static_cast<int32_t>(c * mx));
+                const Fixed16 y = Fixed16::fromRaw(static_cast<int32_t>(s * my));
+                if (x.raw == 0 && y.raw == 0) continue;
+                worst = std::fmax(worst, lsbError(Fixed16::atan2(y, x), std::atan2(y.toDouble(), x.toDouble())));
+            }
+        }
+    }
+    TEST_ASSERT_TRUE(worst <= 2.5);
+
+    TEST_ASSERT_EQUAL(0, Fixed16::atan2(Fixed16(0), Fixed16(0)).raw);
+    TEST_ASSERT_EQUAL(0, Fixed16::atan2(Fixed16(0), Fixed16(1)).raw);
+    TEST_ASSERT_FLOAT_WITHIN(2 * kLsb, 3.14159265f, Fixed16::atan2(Fixed16(0), Fixed16(-1)).toFloat());
+    TEST_ASSERT_FLOAT_WITHIN(2 * kLsb, -1.57079633f, Fixed16::atan2(Fixed16(-1), Fixed16(0)).toFloat());
+}
+
+void test_fixed16_rsqrt_matches_libm(void) {
+    double worst = 0;
+    forEachPositiveRaw([&](int32_t raw) {
+        const Fixed16 x = Fixed16::fromRaw(raw);
+        worst = std::fmax(worst, lsbError(Fixed16::rsqrt(x), 1.0 / std::sqrt(x.toDouble())));
+    });
+    // Correctly rounded up to the half-LSB of the result.
+    TEST_ASSERT_TRUE(worst <= 0.5 + 1e-6);
+
+    TEST_ASSERT_EQUAL(Fixed16::ONE, Fixed16::rsqrt(Fixed16(1)).raw);
+    TEST_ASSERT_EQUAL(Fixed16::ONE / 2, Fixed16::rsqrt(Fixed16(4)).raw);
+    TEST_ASSERT_EQUAL(0, Fixed16::rsqrt(Fixed16(0)).raw);
+    TEST_ASSERT_EQUAL(0, Fixed16::rsqrt(Fixed16(-3)).raw);
+}
+
+void test_fixed16_trig_benchmark(void) {
+    constexpr int kCalls = 200000;
+    auto time = [](auto fn) {
+        const auto t0 = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < kCalls; i++) {
+            g_sink = g_sink + static_cast<uint32_t>(fn(i));
+        }
+        const auto t1 = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::nano>(t1 - t0).count() / kCalls;
+    };
+    // Inputs vary per call so nothing folds away.
+    // Unsigned hash: i * 2654435 overflows int for large i.
+    auto hash = [](int i) { return static_cast<uint32_t>(i) * 2654435u; };
+    auto angle = [&](int i) { return Fixed16::fromRaw(static_cast<int32_t>(hash(i) & 0x7FFFFu)); };
+    auto positive = [&](int i) { return Fixed16::fromRaw(static_cast<int32_t>(1u + (hash(i) & 0x3FFFFFFu))); };
+
+    const double sinLibm = time([&](int i) { return Fixed16(std::sin(angle(i).toFloat())).raw; });
+    const double sinInt = time([&](int i) { return Fixed16::sin(angle(i)).raw; });
+    const double atanLibm = time([&](int i) {
+        return Fixed16(std::atan2(angle(i).toFloat(), angle(i + 7).toFloat() - 3.0f)).raw;
+    });
+    const double atanInt = time([&](int i) { return Fixed16::atan2(angle(i), angle(i + 7) - Fixed16(3)).raw; });
+    const double rsqrtOld = time([&](int i) { return (Fixed16(1) / Fixed16::sqrt(positive(i).toFloat())).raw; });
+    const double rsqrtInt = time([&](int i) { return Fixed16::rsqrt(positive(i)).raw; });
+
+    char msg[160];
+    std::snprintf(msg, sizeof(msg), "ns/call libm round trip vs integer: sin %.1f | %.1f, atan2 %.1f | %.1f, rsqrt %.1f | %.1f",
+                  sinLibm, sinInt, atanLibm, atanInt, rsqrtOld, rsqrtInt);
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_fixed16_sin_cos_match_libm);
+    RUN_TEST(test_fixed16_atan2_matches_libm);
+    RUN_TEST(test_fixed16_rsqrt_matches_libm);
+    RUN_TEST(test_fixed16_trig_benchmark);
+    return UNITY_END();
+}
@@ -114,6 +114,8 @@ int main() {
     RUN_TEST(test_renderer_set_contrast);
     RUN_TEST(test_renderer_draw_bitmap);
     RUN_TEST(test_renderer_draw_filled_rectangle_w);
+    RUN_TEST(test_renderer_partial_present_handoff);
+    RUN_TEST(test_renderer_partial_present_static_layer_move_forces_full);
 
     return UNITY_END();
 }
@@ -188,4 +188,78 @@ void test_renderer_draw_filled_rectangle_w() {
     TEST_ASSERT_EQUAL(0, renderer.getYOffset());
 }
 
+void test_renderer_partial_present_handoff() {
+    if constexpr (!pixelroot32::platforms::config::EnableDirtyRegions) {
+        TEST_IGNORE_MESSAGE("dirty regions disabled");
+    }
+    static FramebufferPixel fb[64 * 64];
+    auto mockDrawer = std::make_unique<MockDrawSurface>();
+    MockDrawSurface* mockRaw = mockDrawer.get();
+    mockRaw->setSpriteBuffer(reinterpret_cast<uint8_t*>(fb), sizeof(fb));
+    DisplayConfig config = PIXELROOT32_CUSTOM_DISPLAY(mockDrawer.release(), 64, 64);
+    Renderer renderer(config);
+    renderer.setDisplaySize(64, 64);
+
+    // setDisplaySize marks the grid full dirty: first frame is a full present.
+    renderer.beginFrame();
+    renderer.drawFilledRectangle(8, 8, 8, 8, Color::White);
+    renderer.endFrame();
+    TEST_ASSERT_FALSE(mockRaw->lastSendWasPartial);
+    TEST_ASSERT_NULL(mockRaw->presentDirtyGrid);
+
+    renderer.beginFrame();
+    renderer.drawFilledRectangle(16, 8, 8, 8, Color::White);
+    renderer.endFrame();
+    TEST_ASSERT_TRUE(mockRaw->lastSendWasPartial);
+
+    renderer.beginFrame();
+    renderer.requestFullPresent();
+    renderer.endFrame();
+    TEST_ASSERT_FALSE(mockRaw->lastSendWasPartial);
+
+    renderer.forceFullRedraw();
+    renderer.beginFrame();
+    renderer.endFrame();
+    TEST_ASSERT_FALSE(mockRaw->lastSendWasPartial);
+    TEST_ASSERT_EQUAL(4, mockRaw->sendCount);
+}
+
+void test_renderer_partial_present_static_layer_move_forces_full() {
+    if constexpr (!pixelroot32::platforms::config::EnableDirtyRegions) {
+        TEST_IGNORE_MESSAGE("dirty regions disabled");
+    }
+    static FramebufferPixel fb[64 * 64];
+    static const uint16_t tileRows[8] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    static const Sprite tiles[2] = {{tileRows, 8, 8}, {tileRows, 8, 8}};
+    static uint8_t indices[4] = {1, 1, 1, 1};
+    TileMap map{};
+    map.indices = indices;
+    map.width = 2;
+    map.height = 2;
+    map.tiles = tiles;
+    map.tileWidth = 8;
+    map.tileHeight = 8;
+    map.tileCount = 2;
+
+    auto mockDrawer = std::make_unique<MockDrawSurface>();
+    MockDrawSurface* mockRaw = mockDrawer.get();
+    mockRaw->setSpriteBuffer(reinterpret_cast<uint8_t*>(fb), sizeof(fb));
+    DisplayConfig config = PIXELROOT32_CUSTOM_DISPLAY(mockDrawer.release(), 64, 64);
+    Renderer renderer(config);
+    renderer.setDisplaySize(64, 64);
+
+    for (int frame = 0; frame < 2; ++frame) {
+        renderer.beginFrame();
+        renderer.drawTileMap(map, 0, 0, Color::White, LayerType::Static);
+        renderer.endFrame();
+    }
+    // Same static layer at the same origin: untracked pixels unchanged.
+    TEST_ASSERT_TRUE(mockRaw->lastSendWasPartial);
+
+    renderer.beginFrame();
+    renderer.drawTileMap(map, 4, 0, Color::White, LayerType::Static);
+    renderer.endFrame();
+    TEST_ASSERT_FALSE(mockRaw->lastSendWasPartial);
+}
+
 void test_renderer_draw_filled_rectangle_w();
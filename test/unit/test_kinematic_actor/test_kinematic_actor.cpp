@@ -4,6 +4,10 @@
 #include "physics/SensorActor.h"
 #include "physics/CollisionSystem.h"
 #include "../../test_config.h"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
 
 using namespace pixelroot32::core;
 using namespace pixelroot32::physics;
@@ -613,6 +617,166 @@ void test_kinematic_actor_rigid_body_ignored_in_collision(void) {
     TEST_IGNORE_MESSAGE("RigidActor test requires RigidActor class implementation");
 }
 
+// =============================================================================
+// Analytic swept moveAndCollide
+// =============================================================================
+
+void test_kinematic_actor_stops_safe_margin_before_wall(void) {
+    wall = new StaticActor(toScalar(12), toScalar(-5), 10, 20);
+    wall->setCollisionLayer(1);
+    wall->setCollisionMask(1);
+    colSystem->addEntity(wall);
+
+    KinematicCollision col;
+    TEST_ASSERT_TRUE(player->moveAndCollide(Vector2(toScalar(15), toScalar(0)), &col));
+    TEST_ASSERT_EQUAL_PTR(wall, col.collider);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -1.0f, col.normal.x);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 2.0f - 0.08f, player->position.x);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.92f, col.travel);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 13.08f, col.remainder);
+}
+
+void test_kinematic_actor_slides_along_touching_floor(void) {
+    // Resting exactly on the floor (edges touch): horizontal motion is free, downward is blocked.
+    wall = new StaticActor(toScalar(-50), toScalar(10), 200, 10);
+    wall->setCollisionLayer(1);
+    wall->setCollisionMask(1);
+    colSystem->addEntity(wall);
+
+    TEST_ASSERT_FALSE(player->moveAndCollide(Vector2(toScalar(20), toScalar(0))));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 20.0f, player->position.x);
+
+    KinematicCollision col;
+    TEST_ASSERT_TRUE(player->moveAndCollide(Vector2(toScalar(0), toScalar(5)), &col));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -1.0f, col.normal.y);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, player->position.y);
+
+    TEST_ASSERT_FALSE(player->moveAndCollide(Vector2(toScalar(0), toScalar(-5))));
+}
+
+void test_kinematic_actor_fast_motion_does_not_tunnel(void) {
+    // 2 px wall, 200 px step: the sweep sees it where sampling the end point would not.
+    wall = new StaticActor(toScalar(100), toScalar(-20), 2, 50);
+    wall->setCollisionLayer(1);
+    wall->setCollisionMask(1);
+    colSystem->addEntity(wall);
+
+    TEST_ASSERT_TRUE(player->moveAndCollide(Vector2(toScalar(200), toScalar(0))));
+    TEST_ASSERT_TRUE(player->position.x < toScalar(90.0f));
+}
+
+void test_kinematic_actor_blocked_by_offscreen_static(void) {
+    // Beyond the logical screen the grid's border cells hold the body.
+    player->position = Vector2(toScalar(600), toScalar(0));
+    wall = new StaticActor(toScalar(620), toScalar(-10), 10, 30);
+    wall->setCollisionLayer(1);
+    wall->setCollisionMask(1);
+    colSystem->addEntity(wall);
+
+    player->moveAndSlide(Vector2(toScalar(20), toScalar(0)));
+    TEST_ASSERT_TRUE(player->is_on_wall());
+    TEST_ASSERT_TRUE(player->position.x < toScalar(610.0f));
+}
+
+void test_kinematic_actor_circle_stops_at_box(void) {
+    player->setShape(CollisionShape::CIRCLE);
+    player->setRadius(toScalar(5));
+    wall = new StaticActor(toScalar(30), toScalar(-20), 10, 50);
+    wall->setCollisionLayer(1);
+    wall->setCollisionMask(1);
+    colSystem->addEntity(wall);
+
+    KinematicCollision col;
+    TEST_ASSERT_TRUE(player->moveAndCollide(Vector2(toScalar(40), toScalar(0)), &col));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, -1.0f, col.normal.x);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 20.0f - 0.08f, player->position.x);
+}
+
+namespace {
+
+/// Old moveAndCollide cost model: a linear overlap scan at the target, 8 bisection steps and a refresh.
+bool legacyMoveAndCollide(KinematicActor* self, const std::vector<std::unique_ptr<KinematicActor>>& all,
+                          Vector2 motion) {
+    auto blocked = [&](Vector2 pos) {
+        self->position = pos;
+        const Rect box = self->getHitBox();
+        for (const auto& other : all) {
+            if (other.get() == self) continue;
+            if (((self->mask & other->layer) || (other->mask & self->layer)) && box.intersects(other->getHitBox())) {
+                return true;
+            }
+        }
+        return false;
+    };
+    const Vector2 start = self->position;
+    if (!blocked(start + motion)) return false;
+    Vector2 low = start;
+    Vector2 high = start + motion;
+    Vector2 safe = start;
+    for (int i = 0; i < 8; ++i) {
+        const Vector2 mid = (low + high) * toScalar(0.5f);
+        if (blocked(mid)) {
+            high = mid;
+        } else {
+            safe = mid;
+            low = mid;
+        }
+    }
+    blocked(high);
+    self->position = safe;
+    return true;
+}
+
+} // namespace
+
+void test_kinematic_actor_benchmark_64_actors(void) {
+    constexpr int kSide = 8;
+    constexpr int kFrames = 300;
+    CollisionSystem system;
+    std::vector<std::unique_ptr<KinematicActor>> actors;
+    std::vector<Vector2> spawn;
+    for (int i = 0; i < kSide * kSide; ++i) {
+        const Vector2 p(toScalar(static_cast<float>(8 + (i % kSide) * 28)), toScalar(static_cast<float>(8 + (i / kSide) * 28)));
+        auto actor = std::make_unique<KinematicActor>(p, 8, 8);
+        actor->setCollisionLayer(1);
+        actor->setCollisionMask(1);
+        actor->collisionSystem = &system;
+        system.addEntity(actor.get());
+        actors.push_back(std::move(actor));
+        spawn.push_back(p);
+    }
+    TEST_ASSERT_EQUAL(64, system.getEntityCount());
+
+    // Neighbouring columns walk towards each other for 8 frames, then apart, with a little drift.
+    auto motionFor = [](int i, int frame) {
+        const int dir = ((i % 2 == 0) == ((frame / 8) % 2 == 0)) ? 1 : -1;
+        return Vector2(toScalar(static_cast<float>(3 * dir)), toScalar(frame % 2 == 0 ? 0.5f : -0.5f));
+    };
+    auto run = [&](auto&& move) {
+        for (size_t i = 0; i < actors.size(); ++i) actors[i]->position = spawn[i];
+        int hits = 0;
+        const auto t0 = std::chrono::high_resolution_clock::now();
+        for (int frame = 0; frame < kFrames; ++frame) {
+            for (size_t i = 0; i < actors.size(); ++i) {
+                hits += move(actors[i].get(), motionFor(static_cast<int>(i), frame)) ? 1 : 0;
+            }
+        }
+        const auto t1 = std::chrono::high_resolution_clock::now();
+        const long long us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+        return std::make_pair(us / kFrames, hits);
+    };
+
+    const auto legacy = run([&](KinematicActor* a, Vector2 m) { return legacyMoveAndCollide(a, actors, m); });
+    const auto swept = run([&](KinematicActor* a, Vector2 m) { return a->moveAndCollide(m); });
+
+    char msg[160];
+    std::snprintf(msg, sizeof(msg), "64 kinematic actors: bisection + linear scan %lld us/frame (%d hits) | "
+                  "grid swept query %lld us/frame (%d hits)", legacy.first, legacy.second, swept.first, swept.second);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(swept.second > 0);
+    TEST_ASSERT_TRUE(swept.first < legacy.first);
+}
+
 int main(int argc, char **argv) {
     (void)argc;
     (void)argv;
@@ -657,6 +821,14 @@ int main(int argc, char **argv) {
     RUN_TEST(test_kinematic_actor_ceiling_exact_threshold);
     RUN_TEST(test_kinematic_actor_slide_vector_calculation);
     RUN_TEST(test_kinematic_actor_rigid_body_ignored_in_collision);
+
+    // Analytic swept moveAndCollide
+    RUN_TEST(test_kinematic_actor_stops_safe_margin_before_wall);
+    RUN_TEST(test_kinematic_actor_slides_along_touching_floor);
+    RUN_TEST(test_kinematic_actor_fast_motion_does_not_tunnel);
+    RUN_TEST(test_kinematic_actor_blocked_by_offscreen_static);
+    RUN_TEST(test_kinematic_actor_circle_stops_at_box);
+    RUN_TEST(test_kinematic_actor_benchmark_64_actors);
     
     return UNITY_END();
 }
@@ -9,6 +9,8 @@
  * - Burst spawning (without accessing internal state)
  * - Update and draw (with mocked renderer)
  * - Edge cases
+ * - Shared particle pool, delta-time integration, camera-aware culling
+ * - Framebuffer point splat vs DrawSurface path, and an explosion benchmark
  */
 
 #include <unity.h>
@@ -26,6 +28,12 @@
 #include "graphics/Renderer.h"
 #include "graphics/DisplayConfig.h"
 #include "graphics/BaseDrawSurface.h"
+#include "graphics/particles/ParticlePool.h"
+#include "mocks/MockDrawSurface.h"
+#include "mocks/MockPixelSurface.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
 
 using namespace pixelroot32::graphics::particles;
 using namespace pixelroot32::math;
@@ -265,7 +273,7 @@ public:
     void init() override {}
     void clearBuffer() override { rectCalls.clear(); }
     void sendBuffer() override {}
-    void drawRectangle(int x, int y, int w, int h, uint16_t c) override {}
+    void drawRectangle(int, int, int, int, uint16_t) override {}
     void drawFilledRectangle(int x, int y, int w, int h, uint16_t c) override {
         rectCalls.push_back({x, y, w, h, c});
     }
@@ -392,6 +400,270 @@ void test_particle_emitter_full_lifecycle(void) {
     TEST_ASSERT_EQUAL(100, emitter.position.y);
 }
 
+// =============================================================================
+// Pool, delta time, culling and splat tests
+// =============================================================================
+
+namespace {
+
+/// One particle flying right at a fixed speed, never fading or slowing down.
+ParticleConfig createStraightConfig(float speed) {
+    ParticleConfig cfg = createBasicConfig();
+    cfg.minAngleDeg = 0;
+    cfg.maxAngleDeg = 0;
+    cfg.minSpeed = speed;
+    cfg.maxSpeed = speed;
+    cfg.minLife = 200;
+    cfg.maxLife = 200;
+    return cfg;
+}
+
+int firstRectX(MockDrawSurfaceParticle* surface) {
+    return surface->rectCalls.empty() ? -1 : std::get<0>(surface->rectCalls.front());
+}
+
+} // namespace
+
+void test_particle_emitters_share_pool(void) {
+    ParticlePool& pool = ParticlePool::shared();
+    const int freeBefore = pool.getFreeBlockCount();
+    {
+        ParticleEmitter a(Vector2(100, 100), createBasicConfig());
+        ParticleEmitter b(Vector2(50, 50), createBasicConfig());
+        a.burst(Vector2(100, 100), 40);
+        b.burst(Vector2(50, 50), 10);
+        TEST_ASSERT_EQUAL(40, a.getActiveCount());
+        TEST_ASSERT_EQUAL(10, b.getActiveCount());
+        TEST_ASSERT_EQUAL(freeBefore - 3, pool.getFreeBlockCount());
+
+        // Topping up reuses the partly filled blocks first.
+        b.burst(Vector2(50, 50), 22);
+        TEST_ASSERT_EQUAL(freeBefore - 3, pool.getFreeBlockCount());
+    }
+    TEST_ASSERT_EQUAL(freeBefore, pool.getFreeBlockCount());
+}
+
+void test_particle_burst_limited_by_pool(void) {
+    ParticleEmitter big(Vector2(100, 100), createExplosionConfig());
+    ParticleEmitter late(Vector2(100, 100), createExplosionConfig());
+    big.burst(Vector2(100, 100), ParticlePool::kCapacity + 10);
+    TEST_ASSERT_EQUAL(ParticlePool::kCapacity, big.getActiveCount());
+    late.burst(Vector2(100, 100), 5);
+    TEST_ASSERT_EQUAL(0, late.getActiveCount());
+
+    // Expired particles give their blocks back.
+    for (int i = 0; i < 60; i++) {
+        big.update(16);
+    }
+    TEST_ASSERT_EQUAL(0, big.getActiveCount());
+    TEST_ASSERT_EQUAL(ParticlePool::kBlockCount, ParticlePool::shared().getFreeBlockCount());
+}
+
+void test_particle_update_scales_with_delta_time(void) {
+    auto surfaceA = std::make_unique<MockDrawSurfaceParticle>();
+    auto surfaceB = std::make_unique<MockDrawSurfaceParticle>();
+    MockDrawSurfaceParticle* rawA = surfaceA.get();
+    MockDrawSurfaceParticle* rawB = surfaceB.get();
+    Renderer rendererA(PIXELROOT32_CUSTOM_DISPLAY(surfaceA.release(), 240, 240));
+    Renderer rendererB(PIXELROOT32_CUSTOM_DISPLAY(surfaceB.release(), 240, 240));
+
+    ParticleEmitter once(Vector2(100, 100), createStraightConfig(3.0f));
+    ParticleEmitter twice(Vector2(100, 100), createStraightConfig(3.0f));
+    once.burst(Vector2(100, 100), 1);
+    twice.burst(Vector2(100, 100), 1);
+
+    // 50 ms is three reference frames at 3 px per frame.
+    once.update(50);
+    twice.update(25);
+    twice.update(25);
+    once.draw(rendererA);
+    twice.draw(rendererB);
+
+    TEST_ASSERT_EQUAL(1, static_cast<int>(rawA->rectCalls.size()));
+    TEST_ASSERT_EQUAL(109, firstRectX(rawA));
+    TEST_ASSERT_EQUAL(firstRectX(rawA), firstRectX(rawB));
+}
+
+void test_particle_culling_uses_camera_offset(void) {
+    Renderer& view = engine.getRenderer();
+    const int savedX = view.getXOffset();
+    const int savedY = view.getYOffset();
+
+    auto surface = std::make_unique<MockDrawSurfaceParticle>();
+    MockDrawSurfaceParticle* raw = surface.get();
+    Renderer renderer(PIXELROOT32_CUSTOM_DISPLAY(surface.release(), 240, 240));
+
+    // Camera scrolled 200 px right: world x 300 is on screen at x 100.
+    const int worldX = view.getLogicalWidth() + 60;
+    view.setDisplayOffset(-200, 0);
+    renderer.setDisplayOffset(-200, 0);
+    ParticleEmitter emitter(Vector2(toScalar(worldX), toScalar(100)), createStraightConfig(1.0f));
+    emitter.burst(Vector2(toScalar(worldX), toScalar(100)), 1);
+    emitter.update(16);
+    TEST_ASSERT_EQUAL(1, emitter.getActiveCount());
+    emitter.draw(renderer);
+    TEST_ASSERT_EQUAL(1, static_cast<int>(raw->rectCalls.size()));
+    TEST_ASSERT_EQUAL(worldX - 200, firstRectX(raw));
+
+    // Back at the origin the same particle is out of view and dies.
+    view.setDisplayOffset(0, 0);
+    emitter.update(16);
+    TEST_ASSERT_EQUAL(0, emitter.getActiveCount());
+
+    view.setDisplayOffset(savedX, savedY);
+}
+
+void test_particle_splat_matches_surface_path(void) {
+    constexpr int kW = 64;
+    constexpr int kH = 48;
+    std::vector<FramebufferPixel> splatFb(kW * kH, 0);
+    std::vector<FramebufferPixel> pixelFb(kW * kH, 0);
+
+    auto* splatSurface = new MockDrawSurface();
+    splatSurface->setSpriteBuffer(reinterpret_cast<uint8_t*>(splatFb.data()), splatFb.size() * sizeof(FramebufferPixel));
+    Renderer splat(DisplayConfig::createCustom(splatSurface, kW, kH));
+    splat.setDisplaySize(kW, kH);
+    Renderer pixels(DisplayConfig::createCustom(new MockPixelSurface(pixelFb.data(), kW), kW, kH));
+    pixels.setDisplaySize(kW, kH);
+    splat.beginFrame();
+    pixels.beginFrame();
+
+    // Points on every edge (partly clipped), fully outside, and inside; two sizes.
+    const int16_t xs[] = {-1, 10, 63, 30, -2, 5, 62, 20, 40, 100};
+    const int16_t ys[] = {5, -1, 20, 47, 10, 46, 46, 20, 21, 10};
+    const uint8_t shades[] = {0, 1, 2, 3, 0, 1, 2, 3, 1, 0};
+    const uint16_t colors[] = {0xF800, 0x07E0, 0x001F, 0xFFE0};
+    for (uint8_t size : {2, 1}) {
+        std::fill(splatFb.begin(), splatFb.end(), 0);
+        std::fill(pixelFb.begin(), pixelFb.end(), 0);
+        for (int offset : {0, 3}) {
+            splat.setDisplayOffset(offset, -offset);
+            pixels.setDisplayOffset(offset, -offset);
+            splat.drawPointBatch(xs, ys, shades, 10, colors, 4, size);
+            pixels.drawPointBatch(xs, ys, shades, 10, colors, 4, size);
+        }
+        TEST_ASSERT_EQUAL_MEMORY(pixelFb.data(), splatFb.data(), splatFb.size() * sizeof(FramebufferPixel));
+    }
+    // Nothing was routed through the surface on the splat path.
+    TEST_ASSERT_FALSE(splatSurface->hasCall("filled_rectangle"));
+    TEST_ASSERT_TRUE(splatFb[20 * kW + 20] != 0);
+}
+
+namespace {
+/// Captures the cells marked this frame while the partial present runs.
+class DirtyCaptureSurface : public MockDrawSurface {
+public:
+    std::vector<std::pair<int, int>> marked;
+    bool sawGrid = false;
+
+    void sendBuffer() override {
+        MockDrawSurface::sendBuffer();
+        sawGrid = presentDirtyGrid != nullptr;
+        marked.clear();
+        if (!sawGrid) return;
+        for (uint8_t cy = 0; cy < presentDirtyGrid->getRows(); ++cy) {
+            for (uint8_t cx = 0; cx < presentDirtyGrid->getCols(); ++cx) {
+                if (presentDirtyGrid->isCurrMarked(cx, cy)) marked.push_back({cx, cy});
+            }
+        }
+    }
+};
+}
+
+void test_point_batch_marks_only_touched_cells(void) {
+    if constexpr (!pixelroot32::platforms::config::EnableDirtyRegions) {
+        TEST_IGNORE_MESSAGE("dirty regions disabled");
+    } else {
+        constexpr int kW = 64;
+        constexpr int kH = 48;
+        std::vector<FramebufferPixel> fb(kW * kH, 0);
+        auto* surface = new DirtyCaptureSurface();
+        surface->setSpriteBuffer(reinterpret_cast<uint8_t*>(fb.data()), fb.size() * sizeof(FramebufferPixel));
+        Renderer renderer(DisplayConfig::createCustom(surface, kW, kH));
+        renderer.setDisplaySize(kW, kH);
+        renderer.beginFrame();
+        renderer.endFrame();
+
+        // Two opposite corners, one splat straddling four cells, and one fully off screen.
+        const int16_t xs[] = {0, 62, 7, 200};
+        const int16_t ys[] = {0, 46, 7, 10};
+        const uint8_t shades[] = {0, 0, 0, 0};
+        const uint16_t color = 0xFFFF;
+        renderer.beginFrame();
+        renderer.drawPointBatch(xs, ys, shades, 4, &color, 1, 2);
+        renderer.endFrame();
+
+        // The bounding box would be all 8x6 cells.
+        TEST_ASSERT_TRUE(surface->sawGrid);
+        const std::vector<std::pair<int, int>> expected = {{0, 0}, {1, 0}, {0, 1}, {1, 1}, {7, 5}};
+        TEST_ASSERT_TRUE(expected == surface->marked);
+    }
+}
+
+void test_particle_explosion_benchmark(void) {
+    constexpr int kW = 240;
+    constexpr int kH = 240;
+    constexpr int kFrames = 300;
+    std::vector<FramebufferPixel> fb(kW * kH, 0);
+    auto* surface = new MockDrawSurface();
+    surface->setSpriteBuffer(reinterpret_cast<uint8_t*>(fb.data()), fb.size() * sizeof(FramebufferPixel));
+    Renderer renderer(DisplayConfig::createCustom(surface, kW, kH));
+    renderer.setDisplaySize(kW, kH);
+    renderer.beginFrame();
+
+    ParticleConfig cfg = createExplosionConfig();
+    cfg.minSpeed = 0.5f;
+    cfg.maxSpeed = 2.0f;
+    cfg.gravity = 0.02f;
+    ParticleEmitter emitter(Vector2(120, 120), cfg);
+
+    long long particleFrames = 0;
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    for (int f = 0; f < kFrames; f++) {
+        if (emitter.getActiveCount() == 0) {
+            emitter.burst(Vector2(120, 120), ParticlePool::kCapacity);
+        }
+        emitter.update(16);
+        emitter.draw(renderer);
+        particleFrames += emitter.getActiveCount();
+    }
+    const auto t1 = std::chrono::high_resolution_clock::now();
+    const long long us = static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+
+    char msg[128];
+    std::snprintf(msg, sizeof(msg), "%d frames, %lld particle-frames (pool %d): %lld us (%.1f ns/particle)",
+                  kFrames, particleFrames, ParticlePool::kCapacity, us,
+                  particleFrames > 0 ? 1000.0 * static_cast<double>(us) / static_cast<double>(particleFrames) : 0.0);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(particleFrames > 0);
+
+    // Draw cost alone: one splat batch vs one drawFilledRectangleW per particle.
+    std::vector<int16_t> xs(ParticlePool::kCapacity);
+    std::vector<int16_t> ys(ParticlePool::kCapacity);
+    std::vector<uint8_t> shades(ParticlePool::kCapacity, 0);
+    for (int i = 0; i < ParticlePool::kCapacity; i++) {
+        xs[i] = static_cast<int16_t>((i * 37) % (kW - 2));
+        ys[i] = static_cast<int16_t>((i * 53) % (kH - 2));
+    }
+    const uint16_t color = 0xFFE0;
+    const auto b0 = std::chrono::high_resolution_clock::now();
+    for (int f = 0; f < kFrames; f++) {
+        renderer.drawPointBatch(xs.data(), ys.data(), shades.data(), ParticlePool::kCapacity, &color, 1, 2);
+    }
+    const auto b1 = std::chrono::high_resolution_clock::now();
+    for (int f = 0; f < kFrames; f++) {
+        for (int i = 0; i < ParticlePool::kCapacity; i++) {
+            renderer.drawFilledRectangleW(xs[i], ys[i], 2, 2, color);
+        }
+    }
+    const auto b2 = std::chrono::high_resolution_clock::now();
+    std::snprintf(msg, sizeof(msg), "draw %d particles x %d: splat %lld us | per-particle rect %lld us",
+                  ParticlePool::kCapacity, kFrames,
+                  static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(b1 - b0).count()),
+                  static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(b2 - b1).count()));
+    TEST_MESSAGE(msg);
+}
+
 // =============================================================================
 // Unity test runner
 // =============================================================================
@@ -432,6 +704,15 @@ int main(void) {
     RUN_TEST(test_particle_emitter_update_then_draw);
     RUN_TEST(test_particle_emitter_multiple_updates);
     RUN_TEST(test_particle_emitter_full_lifecycle);
+
+    // Pool, delta time, culling and splat
+    RUN_TEST(test_particle_emitters_share_pool);
+    RUN_TEST(test_particle_burst_limited_by_pool);
+    RUN_TEST(test_particle_update_scales_with_delta_time);
+    RUN_TEST(test_particle_culling_uses_camera_offset);
+    RUN_TEST(test_particle_splat_matches_surface_path);
+    RUN_TEST(test_point_batch_marks_only_touched_cells);
+    RUN_TEST(test_particle_explosion_benchmark);
     
     return UNITY_END();
 }
@@ -190,6 +190,33 @@ void test_physics_actor_set_one_way(void) {
     TEST_ASSERT_FALSE(actor.isOneWay());
 }
 
+void test_physics_actor_render_interpolation(void) {
+    TestPhysicsActor actor(toScalar(0), toScalar(0), 10, 10);
+    TEST_ASSERT_FALSE(actor.hasRenderInterpolation());
+    actor.setRenderInterpolation(true);
+    TEST_ASSERT_TRUE(actor.hasRenderInterpolation());
+    TEST_ASSERT_TRUE(actor.isBounce());
+
+    // previousPosition (0, 0) -> position (10, -4)
+    actor.updatePreviousPosition();
+    actor.position = Vector2(toScalar(10), toScalar(-4));
+    Vector2 p = actor.getRenderPosition(toScalar(0.25f));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 2.5f, static_cast<float>(p.x));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, -1.0f, static_cast<float>(p.y));
+    p = actor.getRenderPosition(toScalar(0));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, static_cast<float>(p.x));
+    p = actor.getRenderPosition(toScalar(1));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 10.0f, static_cast<float>(p.x));
+
+    // Teleports do not smear.
+    actor.setPosition(Vector2(toScalar(50), toScalar(50)));
+    p = actor.getRenderPosition(toScalar(0.5f));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 50.0f, static_cast<float>(p.x));
+
+    actor.setRenderInterpolation(false);
+    TEST_ASSERT_FALSE(actor.hasRenderInterpolation());
+}
+
 // =============================================================================
 // getHitBox
 // =============================================================================
@@ -638,6 +665,7 @@ int main(int argc, char **argv) {
     RUN_TEST(test_physics_actor_set_shape);
     RUN_TEST(test_physics_actor_set_radius);
     RUN_TEST(test_physics_actor_bounce_default);
+    RUN_TEST(test_physics_actor_render_interpolation);
     
     // getHitBox
     RUN_TEST(test_physics_actor_get_hitbox);
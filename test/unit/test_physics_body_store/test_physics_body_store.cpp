@@ -0,0 +1,254 @@
+/**
+ * @file test_physics_body_store.cpp
+ * @brief Unit tests for the structure-of-arrays physics body store
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * The SoA pipeline (CollisionSystem::setSoaBodies) must reproduce the actor
+ * pipeline bit for bit: stacks, bounces, kinematic pushers, sleeping and
+ * forces. Both layouts are then timed at 64 and 256 bodies.
+ */
+
+#include <unity.h>
+#include "../../test_config.h"
+#include "physics/CollisionSystem.h"
+#include "physics/KinematicActor.h"
+#include "physics/RigidActor.h"
+#include "physics/StaticActor.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace pixelroot32::core;
+using namespace pixelroot32::physics;
+using namespace pixelroot32::math;
+
+namespace {
+
+class Body : public RigidActor {
+public:
+    Body(float x, float y, int w, int h) : RigidActor(toScalar(x), toScalar(y), w, h) {
+        setCollisionLayer(1);
+        setCollisionMask(1);
+    }
+    void update(unsigned long) override {}
+    void draw(pixelroot32::graphics::Renderer&) override {}
+};
+
+/// Hit box inset by 1 px on every side (an override the store reads once per step).
+class InsetBody : public Body {
+public:
+    using Body::Body;
+    Rect getHitBox() override {
+        return {position + Vector2(toScalar(1), toScalar(1)), width - 2, height - 2};
+    }
+};
+
+class Pusher : public KinematicActor {
+public:
+    Pusher(float x, float y, int w, int h) : KinematicActor(toScalar(x), toScalar(y), w, h) {
+        setCollisionLayer(1);
+        setCollisionMask(1);
+    }
+    void update(unsigned long) override {}
+    void draw(pixelroot32::graphics::Renderer&) override {}
+};
+
+/// Floor, walls, crate columns, bouncing balls and a kinematic pusher in one system.
+struct World {
+    CollisionSystem system;
+    std::vector<std::unique_ptr<StaticActor>> statics;
+    std::vector<std::unique_ptr<Body>> bodies;
+    std::unique_ptr<Pusher> pusher;
+
+    World(bool soa, int bodyCount) {
+        system.setSoaBodies(soa);
+        addStatic(0, 200, 240, 16);
+        addStatic(0, 0, 8, 200);
+        addStatic(232, 0, 8, 200);
+        pusher = std::make_unique<Pusher>(20, 180, 16, 16);
+        pusher->setVelocity(toScalar(15), toScalar(0));
+        system.addEntity(pusher.get());
+
+        for (int i = 0; i < bodyCount; i++) {
+            const float x = 12.0f + (i % 18) * 12.0f;
+            const float y = 188.0f - (i / 18) * 11.0f;
+            bodies.push_back(std::make_unique<Body>(x, y, 10, 10));
+            Body& b = *bodies.back();
+            if (i % 5 == 0) {
+                b.setShape(CollisionShape::CIRCLE);
+                b.setRestitution(toScalar(0.6f));
+                b.setVelocity(toScalar(20 - i % 40), toScalar(-30));
+            } else {
+                b.setRestitution(toScalar(0));
+            }
+            if (i % 7 == 0) b.setMass(2.0f);
+            if (i % 11 == 0) b.setFriction(toScalar(0.5f));
+            system.addEntity(&b);
+        }
+    }
+
+    void addStatic(float x, float y, int w, int h) {
+        statics.push_back(std::make_unique<StaticActor>(toScalar(x), toScalar(y), w, h));
+        statics.back()->setCollisionLayer(1);
+        statics.back()->setCollisionMask(1);
+        system.addEntity(statics.back().get());
+    }
+
+    void step(int s) {
+        // Outside input between steps: a force and an impulse now and then.
+        if (s % 40 == 10) bodies[3]->applyImpulse(Vector2(toScalar(30), toScalar(-80)));
+        if (s % 25 == 0) bodies[1]->applyForce(Vector2(toScalar(-400), toScalar(0)));
+        system.update();
+    }
+};
+
+bool sameBits(Scalar a, Scalar b) {
+    return std::memcmp(&a, &b, sizeof(Scalar)) == 0;
+}
+
+} // namespace
+
+void setUp(void) {
+    test_setup();
+}
+
+void tearDown(void) {
+    test_teardown();
+}
+
+void test_body_store_matches_actor_pipeline(void) {
+    World aos(false, 40);
+    World soa(true, 40);
+    for (int s = 0; s < 400; s++) {
+        aos.step(s);
+        soa.step(s);
+        for (size_t i = 0; i < aos.bodies.size(); i++) {
+            const Body& a = *aos.bodies[i];
+            const Body& b = *soa.bodies[i];
+            TEST_ASSERT_TRUE(sameBits(a.position.x, b.position.x));
+            TEST_ASSERT_TRUE(sameBits(a.position.y, b.position.y));
+            TEST_ASSERT_TRUE(sameBits(a.getVelocity().x, b.getVelocity().x));
+            TEST_ASSERT_TRUE(sameBits(a.getVelocity().y, b.getVelocity().y));
+            TEST_ASSERT_EQUAL(a.isSleeping(), b.isSleeping());
+        }
+        TEST_ASSERT_EQUAL_UINT16(aos.system.getSolverStats().contacts, soa.system.getSolverStats().contacts);
+    }
+    // The scene must actually have exercised the solver and sleeping.
+    TEST_ASSERT_TRUE(soa.system.getSolverStats().contacts > 0);
+}
+
+void test_body_store_keeps_hit_box_overrides(void) {
+    // The narrowphase reads the store's hit boxes: an inset box must still rest on its inset.
+    CollisionSystem aos;
+    CollisionSystem soa;
+    soa.setSoaBodies(true);
+    StaticActor floorA(toScalar(0), toScalar(100), 240, 10);
+    StaticActor floorB(toScalar(0), toScalar(100), 240, 10);
+    std::vector<std::unique_ptr<InsetBody>> a, b;
+    for (auto* pair : {&a, &b}) {
+        for (int i = 0; i < 3; i++) {
+            pair->push_back(std::make_unique<InsetBody>(40.0f, 60.0f - i * 12.0f, 10, 10));
+            pair->back()->setRestitution(toScalar(0));
+        }
+    }
+    for (auto* floor : {&floorA, &floorB}) {
+        floor->setCollisionLayer(1);
+        floor->setCollisionMask(1);
+    }
+    aos.addEntity(&floorA);
+    soa.addEntity(&floorB);
+    for (int i = 0; i < 3; i++) {
+        aos.addEntity(a[i].get());
+        soa.addEntity(b[i].get());
+    }
+    for (int s = 0; s < 200; s++) {
+        aos.update();
+        soa.update();
+    }
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(0.01f, static_cast<float>(a[i]->position.y), static_cast<float>(b[i]->position.y));
+    }
+    // Bottom crate: its box bottom (y + 9) sinks into the floor top (100) a little, as a stack
+    // does; the full 10 px box would keep it above y = 91.
+    const float bottom = static_cast<float>(b[0]->position.y);
+    TEST_ASSERT_TRUE(bottom >= 91.0f && bottom < 92.5f);
+}
+
+void test_body_store_wakes_sleeping_body_on_contact(void) {
+    // A crate put to sleep, then hit: both layouts must wake and move it the same way.
+    World aos(false, 2);
+    World soa(true, 2);
+    for (World* world : {&aos, &soa}) {
+        // Keep crate 1 alone on the floor.
+        world->system.removeEntity(world->bodies[0].get());
+        world->system.removeEntity(world->pusher.get());
+        for (int s = 0; s < 120; s++) {
+            world->system.update();
+        }
+        TEST_ASSERT_TRUE(world->bodies[1]->isSleeping());
+    }
+
+    Body dropA(26, 150, 10, 10);
+    Body dropB(26, 150, 10, 10);
+    aos.system.addEntity(&dropA);
+    soa.system.addEntity(&dropB);
+    bool woke = false;
+    for (int s = 0; s < 60; s++) {
+        aos.system.update();
+        soa.system.update();
+        woke |= !soa.bodies[1]->isSleeping();
+        TEST_ASSERT_EQUAL(aos.bodies[1]->isSleeping(), soa.bodies[1]->isSleeping());
+        TEST_ASSERT_TRUE(sameBits(aos.bodies[1]->position.y, soa.bodies[1]->position.y));
+        TEST_ASSERT_TRUE(sameBits(dropA.position.y, dropB.position.y));
+    }
+    TEST_ASSERT_TRUE(woke);
+}
+
+void test_body_store_benchmark(void) {
+    // 256 bodies do not fit one system (PHYSICS_MAX_ENTITIES), so they run as four worlds.
+    constexpr int kSteps = 300;
+    auto time = [](bool soa, int worlds, int bodiesPerWorld) {
+        std::vector<std::unique_ptr<World>> scene;
+        for (int w = 0; w < worlds; w++) {
+            scene.push_back(std::make_unique<World>(soa, bodiesPerWorld));
+        }
+        const auto t0 = std::chrono::high_resolution_clock::now();
+        for (int s = 0; s < kSteps; s++) {
+            for (auto& world : scene) world->step(s);
+        }
+        const auto t1 = std::chrono::high_resolution_clock::now();
+        return static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+    };
+    // Best of five runs: single runs on a loaded host differ by more than the layouts do.
+    auto best = [&](bool soa, int worlds, int bodiesPerWorld) {
+        long long us = time(soa, worlds, bodiesPerWorld);
+        for (int r = 1; r < 5; r++) us = std::min(us, time(soa, worlds, bodiesPerWorld));
+        return us;
+    };
+    // Three statics and the pusher take four slots of each world.
+    const int perWorld = PhysicsBodyStore::kCapacity - 4;
+    for (int worlds : {1, 4}) {
+        const long long aosUs = best(false, worlds, perWorld);
+        const long long soaUs = best(true, worlds, perWorld);
+        char msg[128];
+        std::snprintf(msg, sizeof(msg), "%d bodies, %d steps: actors %lld us | SoA %lld us",
+                      worlds * (perWorld + 4), kSteps, aosUs, soaUs);
+        TEST_MESSAGE(msg);
+    }
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_body_store_matches_actor_pipeline);
+    RUN_TEST(test_body_store_keeps_hit_box_overrides);
+    RUN_TEST(test_body_store_wakes_sleeping_body_on_contact);
+    RUN_TEST(test_body_store_benchmark);
+    return UNITY_END();
+}
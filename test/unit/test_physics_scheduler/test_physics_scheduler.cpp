@@ -171,6 +171,27 @@ void test_adaptive_threshold(void) {
     TEST_ASSERT_EQUAL_UINT8(2, steps2);
 }
 
+// Test: Alpha is the fraction of a step left in the accumulator, 1 while behind
+void test_alpha_tracks_accumulator(void) {
+    PhysicsScheduler scheduler;
+    scheduler.init();
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, static_cast<float>(scheduler.getAlpha()));
+
+    // Half a step pending
+    scheduler.update(8333, *gCollisionSystem);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.5f, static_cast<float>(scheduler.getAlpha()));
+
+    // One step taken, a quarter left
+    scheduler.update(12500, *gCollisionSystem);
+    TEST_ASSERT_EQUAL_UINT8(1, scheduler.getStepsExecuted());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.25f, static_cast<float>(scheduler.getAlpha()));
+
+    // Backlog beyond MAX_STEPS_BACKLOG: show the latest step
+    scheduler.update(100000, *gCollisionSystem);
+    TEST_ASSERT_TRUE(scheduler.getAccumulator() >= PhysicsScheduler::FIXED_DT_MICROS);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 1.0f, static_cast<float>(scheduler.getAlpha()));
+}
+
 void setUp(void) {
     // Initialize global collision system if needed
     if (gCollisionSystem == nullptr) {
@@ -208,6 +229,7 @@ int main(void) {
     // Accessor tests
     RUN_TEST(test_get_steps_executed);
     RUN_TEST(test_adaptive_threshold);
+    RUN_TEST(test_alpha_tracks_accumulator);
     
     UNITY_END();
 }
@@ -0,0 +1,209 @@
+/**
+ * @file test_present_kernels.cpp
+ * @brief Unit tests for the pluggable 8bpp → RGB565 present kernels
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * The word-wide kernel set must be bit-exact against the scalar reference
+ * for all row lengths, source alignments and scale tables, then both sets
+ * are timed on a 240x240 panel (1:1, 2x from 120x120, and 160 → 240
+ * arbitrary scale).
+ */
+
+#include <unity.h>
+#include "../test_config.h"
+#include "graphics/PresentKernels.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace pixelroot32::graphics;
+
+namespace {
+
+constexpr int kMaxN = 96;
+
+uint16_t gLut[256];
+
+/// Kernel sets under test, reference excluded.
+std::vector<const present::RowKernels*> candidates() {
+    return {&present::wordKernels()};
+}
+
+/// Deterministic LCG so failures reproduce.
+uint32_t gSeed = 12345u;
+uint32_t nextRandom() {
+    gSeed = gSeed * 1664525u + 1013904223u;
+    return gSeed >> 8;
+}
+
+} // namespace
+
+void setUp(void) {
+    test_setup();
+    // Arbitrary table, as with the indexed framebuffer (no structure a kernel could rely on).
+    for (int i = 0; i < 256; ++i) {
+        gLut[i] = static_cast<uint16_t>(nextRandom());
+    }
+}
+
+void tearDown(void) {
+    test_teardown();
+    present::setActiveKernels(present::defaultKernels());
+}
+
+void test_present_kernels_row_bit_exact(void) {
+    alignas(16) uint8_t src[kMaxN + 8];
+    for (auto& b : src) {
+        b = static_cast<uint8_t>(nextRandom());
+    }
+    alignas(16) uint16_t expected[kMaxN];
+    alignas(16) uint16_t actual[kMaxN + 2];
+
+    for (const present::RowKernels* k : candidates()) {
+        for (int offset = 0; offset < 4; ++offset) {
+            for (int n = 0; n <= kMaxN; ++n) {
+                std::memset(expected, 0xA5, sizeof(expected));
+                std::memset(actual, 0xA5, sizeof(actual));
+                present::convertRow(src + offset, expected, n, gLut);
+                k->row(src + offset, actual, n, gLut);
+                TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, actual, sizeof(expected), k->name);
+                TEST_ASSERT_EQUAL_HEX16_MESSAGE(0xA5A5, actual[kMaxN], k->name);
+            }
+        }
+    }
+}
+
+void test_present_kernels_row2x_bit_exact(void) {
+    alignas(16) uint8_t src[kMaxN + 8];
+    for (auto& b : src) {
+        b = static_cast<uint8_t>(nextRandom());
+    }
+    alignas(16) uint16_t expected[kMaxN * 2];
+    alignas(16) uint16_t actual[kMaxN * 2 + 2];
+
+    for (const present::RowKernels* k : candidates()) {
+        for (int offset = 0; offset < 4; ++offset) {
+            for (int n = 0; n <= kMaxN; ++n) {
+                std::memset(expected, 0x5A, sizeof(expected));
+                std::memset(actual, 0x5A, sizeof(actual));
+                present::convertRow2x(src + offset, expected, n, gLut);
+                k->row2x(src + offset, actual, n, gLut);
+                TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, actual, sizeof(expected), k->name);
+                TEST_ASSERT_EQUAL_HEX16_MESSAGE(0x5A5A, actual[kMaxN * 2], k->name);
+            }
+        }
+    }
+}
+
+void test_present_kernels_row_scaled_bit_exact(void) {
+    constexpr int kSrcN = 70;
+    uint8_t src[kSrcN];
+    for (auto& b : src) {
+        b = static_cast<uint8_t>(nextRandom());
+    }
+    // Upscale-style table (monotonic, repeated entries) followed by random indices.
+    alignas(16) uint16_t xLUT[kMaxN + 2];
+    for (int i = 0; i < kMaxN + 2; ++i) {
+        xLUT[i] = static_cast<uint16_t>(i < kMaxN / 2 ? (i * kSrcN) / kMaxN : nextRandom() % kSrcN);
+    }
+    alignas(16) uint16_t expected[kMaxN];
+    alignas(16) uint16_t actual[kMaxN];
+
+    for (const present::RowKernels* k : candidates()) {
+        // Odd xLUT starts exercise the unaligned fallback of the word-wide set.
+        for (int start = 0; start < 2; ++start) {
+            for (int n = 0; n <= kMaxN; ++n) {
+                std::memset(expected, 0, sizeof(expected));
+                std::memset(actual, 0, sizeof(actual));
+                present::convertRowScaled(src, expected, n, xLUT + start, gLut);
+                k->rowScaled(src, actual, n, xLUT + start, gLut);
+                TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, actual, sizeof(expected), k->name);
+            }
+        }
+    }
+}
+
+void test_present_kernels_active_set_is_selectable(void) {
+    // Scalar is the default until word32 is measured on the target.
+    TEST_ASSERT_EQUAL_PTR(&present::scalarKernels(), &present::defaultKernels());
+    TEST_ASSERT_EQUAL_PTR(&present::defaultKernels(), &present::activeKernels());
+    present::setActiveKernels(present::wordKernels());
+    TEST_ASSERT_EQUAL_STRING("word32", present::activeKernels().name);
+    present::setActiveKernels(present::scalarKernels());
+    TEST_ASSERT_EQUAL_STRING("scalar", present::activeKernels().name);
+
+    // Dispatch overloads: 8bpp rows use the set, 16bpp rows stay copies.
+    alignas(4) uint8_t src8[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    alignas(4) uint16_t src16[8];
+    for (int i = 0; i < 8; ++i) {
+        src16[i] = gLut[src8[i]];
+    }
+    alignas(4) uint16_t a[8];
+    alignas(4) uint16_t b[8];
+    present::convertRow(present::wordKernels(), src8, a, 8, gLut);
+    present::convertRow(present::wordKernels(), src16, b, 8, gLut);
+    TEST_ASSERT_EQUAL_MEMORY(a, b, sizeof(a));
+}
+
+void test_present_kernels_benchmark(void) {
+    constexpr int kPhys = 240;
+    constexpr int kFrames = 200;
+    std::vector<uint8_t> fb(kPhys * kPhys);
+    for (size_t i = 0; i < fb.size(); ++i) {
+        fb[i] = static_cast<uint8_t>(nextRandom());
+    }
+    std::vector<uint16_t> xLUT(kPhys);
+    for (int i = 0; i < kPhys; ++i) {
+        xLUT[i] = static_cast<uint16_t>((i * 160) / kPhys);
+    }
+    alignas(16) static uint16_t line[kPhys * 2];
+    uint32_t sink = 0;
+
+    auto time = [&](auto&& frame) {
+        const auto t0 = std::chrono::high_resolution_clock::now();
+        for (int f = 0; f < kFrames; ++f) {
+            frame();
+            sink += line[f % kPhys];
+        }
+        const auto t1 = std::chrono::high_resolution_clock::now();
+        return static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+    };
+
+    std::vector<const present::RowKernels*> sets{&present::scalarKernels()};
+    for (const present::RowKernels* k : candidates()) {
+        sets.push_back(k);
+    }
+    for (const present::RowKernels* k : sets) {
+        const long long us1x = time([&] {
+            for (int y = 0; y < kPhys; ++y) k->row(fb.data() + y * kPhys, line, kPhys, gLut);
+        });
+        const long long us2x = time([&] {
+            for (int y = 0; y < kPhys / 2; ++y) k->row2x(fb.data() + y * (kPhys / 2), line, kPhys / 2, gLut);
+        });
+        const long long usScaled = time([&] {
+            for (int y = 0; y < kPhys; ++y) k->rowScaled(fb.data() + (y * 2 / 3) * 160, line, kPhys, xLUT.data(), gLut);
+        });
+        char msg[160];
+        std::snprintf(msg, sizeof(msg), "%-6s %d frames 240x240: 1:1 %lld us | 2x %lld us | 160->240 %lld us",
+                      k->name, kFrames, us1x, us2x, usScaled);
+        TEST_MESSAGE(msg);
+    }
+    char msg[32];
+    std::snprintf(msg, sizeof(msg), "(%u)", static_cast<unsigned>(sink & 1u));
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_present_kernels_row_bit_exact);
+    RUN_TEST(test_present_kernels_row2x_bit_exact);
+    RUN_TEST(test_present_kernels_row_scaled_bit_exact);
+    RUN_TEST(test_present_kernels_active_set_is_selectable);
+    RUN_TEST(test_present_kernels_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,350 @@
+/**
+ * @file test_present_pipeline.cpp
+ * @brief Unit tests for PresentPipeline and the Renderer's pipelined present
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * A mock panel keeps its own copy of the screen and applies each present
+ * (full or dirty rects) from the buffer it is handed. Every presented frame
+ * must equal the frame that was drawn, including while the next frame is
+ * already being drawn into the sprite buffer, and with the indexed framebuffer
+ * with the palette it was submitted with. Overlap is checked with a latch
+ * that holds the present of frame N while frame N+1 is drawn; the frame
+ * times of the sequential and pipelined modes are only reported.
+ */
+
+#include <unity.h>
+#include "../test_config.h"
+#include "graphics/PresentPipeline.h"
+#include "graphics/Renderer.h"
+#include "graphics/DisplayConfig.h"
+#include "mocks/MockDrawSurface.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace pixelroot32::graphics;
+
+namespace {
+
+constexpr int kW = 64;
+constexpr int kH = 48;
+
+/// Exposed framebuffer plus a simulated panel updated by sendBuffer() / presentBuffer().
+class PanelSurface : public MockDrawSurface {
+public:
+    std::vector<FramebufferPixel> fb;
+    std::vector<FramebufferPixel> screen;
+    std::atomic<int> presentSleepUs{0};
+    std::vector<uint16_t> panelPalette = std::vector<uint16_t>(256, 0);  ///< Indexed framebuffer colours
+    int bufferPresents = 0;
+    int partialPresents = 0;
+    int paletteUploads = 0;
+    bool presentedFromSpriteBuffer = false;
+
+    PanelSurface() : fb(static_cast<size_t>(kW * kH), 0), screen(static_cast<size_t>(kW * kH), 0) {
+        setSpriteBuffer(reinterpret_cast<uint8_t*>(fb.data()), fb.size() * sizeof(FramebufferPixel));
+    }
+
+    void drawFilledRectangle(int x, int y, int width, int height, uint16_t color) override {
+        for (int py = std::max(y, 0); py < std::min(y + height, kH); ++py) {
+            for (int px = std::max(x, 0); px < std::min(x + width, kW); ++px) {
+                fb[py * kW + px] = packRgb565ToFramebuffer(color);
+            }
+        }
+    }
+
+    void sendBuffer() override {
+        MockDrawSurface::sendBuffer();
+        simulateBus();
+        screen = fb;
+    }
+
+    bool supportsBufferPresent() const override { return true; }
+
+    /// Latch: presents started from now on block inside presentBuffer() until releasePresents().
+    void holdPresents() {
+        std::lock_guard<std::mutex> lock(latchMutex);
+        held = true;
+        entered = false;
+    }
+
+    void releasePresents() {
+        {
+            std::lock_guard<std::mutex> lock(latchMutex);
+            held = false;
+        }
+        latchCv.notify_all();
+    }
+
+    /// Blocks until a held present has started.
+    void waitPresentEntered() {
+        std::unique_lock<std::mutex> lock(latchMutex);
+        latchCv.wait(lock, [this] { return entered; });
+    }
+
+    void presentBuffer(const uint8_t* framebuffer, const DirtyRect* rects, uint16_t rectCount,
+                       const uint16_t* paletteLUT) override {
+        {
+            std::unique_lock<std::mutex> lock(latchMutex);
+            entered = true;
+            latchCv.notify_all();
+            latchCv.wait(lock, [this] { return !held; });
+        }
+        simulateBus();
+        if (paletteLUT != nullptr) {
+            std::copy(paletteLUT, paletteLUT + 256, panelPalette.begin());
+            ++paletteUploads;
+        }
+        const auto* src = reinterpret_cast<const FramebufferPixel*>(framebuffer);
+        presentedFromSpriteBuffer = framebuffer == reinterpret_cast<const uint8_t*>(fb.data());
+        ++bufferPresents;
+        if (rects == nullptr) {
+            std::copy(src, src + kW * kH, screen.begin());
+            return;
+        }
+        ++partialPresents;
+        for (uint16_t i = 0; i < rectCount; ++i) {
+            for (int y = rects[i].y; y < rects[i].y + rects[i].h; ++y) {
+                const int row = y * kW + rects[i].x;
+                std::copy(src + row, src + row + rects[i].w, screen.begin() + row);
+            }
+        }
+    }
+
+private:
+    std::mutex latchMutex;
+    std::condition_variable latchCv;
+    bool held = false;
+    bool entered = false;
+
+    void simulateBus() {
+        const int us = presentSleepUs.load();
+        if (us > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(us));
+        }
+    }
+};
+
+struct PipelineFixture {
+    PanelSurface* surface = nullptr;
+    Renderer* renderer = nullptr;
+    PresentPipeline pipeline;
+
+    PipelineFixture() {
+        surface = new PanelSurface();
+        renderer = new Renderer(DisplayConfig::createCustom(surface, kW, kH));
+        renderer->setDisplaySize(kW, kH);
+    }
+
+    ~PipelineFixture() {
+        renderer->setPresentPipeline(nullptr);
+        pipeline.stop();
+        delete renderer;
+    }
+
+    bool start() {
+        if (!pipeline.start(*surface, kW, kH, pixelroot32::platforms::PlatformCapabilities{})) {
+            return false;
+        }
+        renderer->setPresentPipeline(&pipeline);
+        return true;
+    }
+
+    /// Background plus an 8x8 block that moves 8 px per frame.
+    void drawFrame(int frame) {
+        renderer->beginFrame();
+        renderer->drawFilledRectangle(0, 40, kW, 8, Color::Blue);
+        renderer->drawFilledRectangle((frame * 8) % (kW - 8), 8 + (frame % 3) * 8, 8, 8, Color::Red);
+    }
+};
+
+} // namespace
+
+void setUp(void) {
+    test_setup();
+}
+
+void tearDown(void) {
+    test_teardown();
+}
+
+void test_present_pipeline_requires_buffer_present() {
+    auto* surface = new MockDrawSurface();
+    Renderer renderer(DisplayConfig::createCustom(surface, kW, kH));
+    PresentPipeline pipeline;
+    TEST_ASSERT_FALSE(pipeline.start(*surface, kW, kH, pixelroot32::platforms::PlatformCapabilities{}));
+    TEST_ASSERT_FALSE(pipeline.isRunning());
+}
+
+void test_present_pipeline_presented_frames_match_drawn_frames() {
+    PipelineFixture f;
+    TEST_ASSERT_TRUE(f.start());
+
+    for (int frame = 0; frame < 12; ++frame) {
+        f.drawFrame(frame);
+        f.renderer->endFrame();
+        const std::vector<FramebufferPixel> drawn = f.surface->fb;
+        f.pipeline.waitIdle();
+        TEST_ASSERT_TRUE(f.surface->screen == drawn);
+    }
+
+    const PresentPipelineStats& stats = f.pipeline.getStats();
+    TEST_ASSERT_EQUAL_UINT32(12, stats.framesSubmitted);
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(f.surface->bufferPresents), stats.framesPresented);
+    TEST_ASSERT_FALSE(f.surface->presentedFromSpriteBuffer);
+    TEST_ASSERT_EQUAL_INT(0, f.surface->sendCount);
+    if constexpr (pixelroot32::platforms::config::EnableDirtyRegions) {
+        // Only the first frame needs the whole buffer; later frames copy and push dirty rects.
+        TEST_ASSERT_EQUAL_UINT32(1, stats.fullCopies);
+        TEST_ASSERT_EQUAL_INT(11, f.surface->partialPresents);
+    }
+}
+
+void test_present_pipeline_next_frame_draws_while_presenting() {
+    PipelineFixture f;
+    TEST_ASSERT_TRUE(f.start());
+    f.surface->presentSleepUs = 5000;
+
+    for (int frame = 0; frame < 6; ++frame) {
+        f.drawFrame(frame);
+        f.renderer->endFrame();
+        const std::vector<FramebufferPixel> drawn = f.surface->fb;
+
+        // Frame N+1 goes into the sprite buffer while frame N is still on the bus.
+        f.drawFrame(frame + 100);
+        f.renderer->drawFilledRectangle(0, 0, kW, kH, Color::White);
+        f.pipeline.waitIdle();
+        TEST_ASSERT_TRUE(f.surface->screen == drawn);
+        f.renderer->endFrame();
+        f.pipeline.waitIdle();
+        TEST_ASSERT_TRUE(f.surface->screen == f.surface->fb);
+    }
+}
+
+void test_present_pipeline_stop_returns_to_sequential_present() {
+    PipelineFixture f;
+    TEST_ASSERT_TRUE(f.start());
+    f.drawFrame(0);
+    f.renderer->endFrame();
+
+    f.renderer->setPresentPipeline(nullptr);
+    f.pipeline.stop();
+    TEST_ASSERT_FALSE(f.pipeline.isRunning());
+
+    f.drawFrame(1);
+    f.renderer->endFrame();
+    TEST_ASSERT_EQUAL_INT(1, f.surface->sendCount);
+    TEST_ASSERT_TRUE(f.surface->screen == f.surface->fb);
+}
+
+void test_present_pipeline_snapshots_indexed_palette() {
+    PipelineFixture f;
+    TEST_ASSERT_TRUE(f.start());
+    f.drawFrame(0);
+    f.renderer->endFrame();
+    f.pipeline.waitIdle();
+    if constexpr (!pixelroot32::platforms::config::FramebufferIndexed) {
+        // Colours were resolved while drawing: no palette travels with the frame.
+        TEST_ASSERT_EQUAL_INT(0, f.surface->paletteUploads);
+    } else {
+        uint16_t lut[256];
+        buildIndexedPaletteLUT(lut);
+        TEST_ASSERT_EQUAL_INT(1, f.surface->paletteUploads);
+        TEST_ASSERT_EQUAL_MEMORY(lut, f.surface->panelPalette.data(), sizeof(lut));
+
+        f.drawFrame(1);
+        f.renderer->endFrame();
+        f.pipeline.waitIdle();
+        TEST_ASSERT_EQUAL_INT(1, f.surface->paletteUploads);
+
+        // The game edits the palette again while frame 2 is on the bus; frame 2 keeps its colours.
+        f.surface->presentSleepUs = 5000;
+        setBackgroundPaletteSlot(1, PaletteType::GBC);
+        buildIndexedPaletteLUT(lut);
+        f.drawFrame(2);
+        f.renderer->endFrame();
+        setBackgroundPaletteSlot(1, PaletteType::NES);
+        f.pipeline.waitIdle();
+        TEST_ASSERT_EQUAL_INT(2, f.surface->paletteUploads);
+        TEST_ASSERT_EQUAL_MEMORY(lut, f.surface->panelPalette.data(), sizeof(lut));
+
+        initBackgroundPaletteSlots();
+    }
+}
+
+void test_present_pipeline_overlaps_draw_and_present() {
+    PipelineFixture f;
+    TEST_ASSERT_TRUE(f.start());
+    f.surface->holdPresents();
+
+    f.drawFrame(0);
+    f.renderer->endFrame();
+    const std::vector<FramebufferPixel> drawn = f.surface->fb;
+
+    // The worker is stuck inside presentBuffer(frame 0) until released; frame 1 is drawn meanwhile.
+    f.surface->waitPresentEntered();
+    f.drawFrame(1);
+    f.renderer->drawFilledRectangle(0, 0, kW, kH, Color::White);
+    TEST_ASSERT_EQUAL_INT(0, f.surface->bufferPresents);
+
+    f.surface->releasePresents();
+    f.pipeline.waitIdle();
+    TEST_ASSERT_EQUAL_INT(1, f.surface->bufferPresents);
+    TEST_ASSERT_TRUE(f.surface->screen == drawn);
+
+    f.renderer->endFrame();
+    f.pipeline.waitIdle();
+    TEST_ASSERT_TRUE(f.surface->screen == f.surface->fb);
+}
+
+void test_present_pipeline_frame_time_benchmark() {
+    using Clock = std::chrono::steady_clock;
+    constexpr int kFrames = 20;
+    constexpr int kWorkUs = 3000;
+
+    auto runFrames = [&](PipelineFixture& f) {
+        const auto t0 = Clock::now();
+        for (int frame = 0; frame < kFrames; ++frame) {
+            std::this_thread::sleep_for(std::chrono::microseconds(kWorkUs));  // update() + draw()
+            f.drawFrame(frame);
+            f.renderer->endFrame();
+        }
+        f.pipeline.waitIdle();
+        return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - t0).count() / kFrames;
+    };
+
+    PipelineFixture sequential;
+    sequential.surface->presentSleepUs = kWorkUs;
+    const long sequentialUs = static_cast<long>(runFrames(sequential));
+
+    PipelineFixture pipelined;
+    TEST_ASSERT_TRUE(pipelined.start());
+    pipelined.surface->presentSleepUs = kWorkUs;
+    const long pipelinedUs = static_cast<long>(runFrames(pipelined));
+
+    char msg[96];
+    std::snprintf(msg, sizeof(msg), "Frame: %ldus (sequential) | %ldus (pipelined)", sequentialUs, pipelinedUs);
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_present_pipeline_requires_buffer_present);
+    RUN_TEST(test_present_pipeline_presented_frames_match_drawn_frames);
+    RUN_TEST(test_present_pipeline_next_frame_draws_while_presenting);
+    RUN_TEST(test_present_pipeline_stop_returns_to_sequential_present);
+    RUN_TEST(test_present_pipeline_snapshots_indexed_palette);
+    RUN_TEST(test_present_pipeline_overlaps_draw_and_present);
+    RUN_TEST(test_present_pipeline_frame_time_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,570 @@
+/**
+ * @file test_renderer_blit.cpp
+ * @brief Unit tests for the Renderer framebuffer blit and present paths
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * Compares the 1bpp span blitter (framebuffer exposed via getSpriteBuffer)
+ * against the per-pixel virtual drawPixel() path, pixel for pixel, and
+ * benchmarks both on a text-heavy HUD. Also compares the 8bpp and 16bpp
+ * present row kernels (memory and conversion throughput), checks the
+ * indexed framebuffer's late colour resolution (PIXELROOT32_FRAMEBUFFER_INDEXED),
+ * and compares the scanline tilemap rasteriser against the per-tile path.
+ */
+
+#include <unity.h>
+#include "../test_config.h"
+#include "graphics/Renderer.h"
+#include "graphics/DisplayConfig.h"
+#include "graphics/FontManager.h"
+#include "graphics/Font5x7.h"
+#include "graphics/PaletteDefs.h"
+#include "mocks/MockDrawSurface.h"
+#include "mocks/MockPixelSurface.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace pixelroot32::graphics;
+
+namespace {
+
+constexpr int kW = 64;
+constexpr int kH = 48;
+
+struct BlitPair {
+    std::vector<FramebufferPixel> spanFb;
+    std::vector<FramebufferPixel> pixelFb;
+    Renderer* spanRenderer = nullptr;
+    Renderer* pixelRenderer = nullptr;
+
+    BlitPair(int w, int h) : spanFb(static_cast<size_t>(w * h), 0), pixelFb(static_cast<size_t>(w * h), 0) {
+        auto* spanSurface = new MockDrawSurface();
+        spanSurface->setSpriteBuffer(reinterpret_cast<uint8_t*>(spanFb.data()), bytes());
+        spanRenderer = new Renderer(DisplayConfig::createCustom(spanSurface, w, h));
+        spanRenderer->setDisplaySize(w, h);
+
+        auto* pixelSurface = new MockPixelSurface(pixelFb.data(), w);
+        pixelRenderer = new Renderer(DisplayConfig::createCustom(pixelSurface, w, h));
+        pixelRenderer->setDisplaySize(w, h);
+
+        spanRenderer->beginFrame();
+        pixelRenderer->beginFrame();
+    }
+
+    ~BlitPair() {
+        delete spanRenderer;
+        delete pixelRenderer;
+    }
+
+    size_t bytes() const { return spanFb.size() * sizeof(FramebufferPixel); }
+
+    void reset() {
+        std::memset(spanFb.data(), 0, bytes());
+        std::memset(pixelFb.data(), 0, bytes());
+    }
+
+    bool equal() const {
+        return std::memcmp(spanFb.data(), pixelFb.data(), bytes()) == 0;
+    }
+};
+
+// 16-wide glyph with ragged runs on every row, including both edge bits.
+const uint16_t kWideRows[] = {
+    0b1000000000000001,
+    0b1111000011110000,
+    0b0000111100001111,
+    0b1010101010101010,
+    0b0101010101010101,
+    0b1111111111111111,
+    0b0000000000000000,
+    0b1100000000000011,
+};
+const Sprite kWideSprite{kWideRows, 16, 8};
+
+// 5-wide glyph: bits above width are set on purpose and must be ignored.
+const uint16_t kNarrowRows[] = {
+    0b1110000010001,
+    0b1110000001110,
+    0b1110000010101,
+};
+const Sprite kNarrowSprite{kNarrowRows, 5, 3};
+
+const Color kTilePalette[16] = {
+    Color::Transparent, Color::White, Color::Navy, Color::Blue, Color::Cyan, Color::DarkGreen,
+    Color::Green, Color::LightGreen, Color::Yellow, Color::Orange, Color::LightRed, Color::Red,
+    Color::DarkRed, Color::Purple, Color::Magenta, Color::Gray,
+};
+
+/// Deterministic tile set and map for the tilemap rasteriser tests (tile 0 is the empty tile).
+struct TileMapFixture {
+    static constexpr int kTiles = 6;
+    static constexpr int kMapW = 12;
+    static constexpr int kMapH = 9;
+
+    uint8_t data4[kTiles][32] = {};
+    uint16_t data2[kTiles][8] = {};
+    Sprite4bpp tiles4[kTiles] = {};
+    Sprite2bpp tiles2[kTiles] = {};
+    uint8_t indices[kMapW * kMapH] = {};
+    uint8_t paletteIdx[kMapW * kMapH] = {};
+    uint8_t mask[(kMapW * kMapH + 7) / 8] = {};
+    TileMap4bpp map4{};
+    TileMap2bpp map2{};
+
+    TileMapFixture() {
+        uint32_t seed = 0x2468ACEu;
+        auto next = [&seed]() {
+            seed = seed * 1664525u + 1013904223u;
+            return seed >> 24;
+        };
+        for (int t = 1; t < kTiles; ++t) {
+            // Tile 1 is fully opaque (fast path); the others have ~25% transparent pixels.
+            for (int b = 0; b < 32; ++b) {
+                uint8_t lo = static_cast<uint8_t>(next() & 0x0F);
+                uint8_t hi = static_cast<uint8_t>(next() & 0x0F);
+                if (t == 1) {
+                    lo |= 1;
+                    hi |= 1;
+                } else {
+                    if ((next() & 3) == 0) lo = 0;
+                    if ((next() & 3) == 0) hi = 0;
+                }
+                data4[t][b] = static_cast<uint8_t>(lo | (hi << 4));
+            }
+            for (int r = 0; r < 8; ++r) {
+                uint16_t w = static_cast<uint16_t>((next() << 8) | next());
+                if (t == 1) {
+                    w |= 0x5555;
+                }
+                data2[t][r] = w;
+            }
+            tiles4[t] = Sprite4bpp{data4[t], kTilePalette, 8, 8, 16};
+            tiles2[t] = Sprite2bpp{reinterpret_cast<const uint8_t*>(data2[t]), kTilePalette + 8, 8, 8, 4};
+        }
+        for (int i = 0; i < kMapW * kMapH; ++i) {
+            indices[i] = static_cast<uint8_t>(next() % kTiles);
+            paletteIdx[i] = static_cast<uint8_t>(next() % 3);
+            mask[i >> 3] |= static_cast<uint8_t>(((next() & 7) != 0 ? 1 : 0) << (i & 7));
+        }
+
+        map4.indices = indices;
+        map4.width = kMapW;
+        map4.height = kMapH;
+        map4.tiles = tiles4;
+        map4.tileWidth = 8;
+        map4.tileHeight = 8;
+        map4.tileCount = kTiles;
+        map4.runtimeMask = mask;
+        map4.paletteIndices = paletteIdx;
+
+        map2.indices = indices;
+        map2.width = kMapW;
+        map2.height = kMapH;
+        map2.tiles = tiles2;
+        map2.tileWidth = 8;
+        map2.tileHeight = 8;
+        map2.tileCount = kTiles;
+        map2.runtimeMask = mask;
+        map2.paletteIndices = paletteIdx;
+    }
+};
+
+} // namespace
+
+void setUp(void) {
+    test_setup();
+}
+
+void tearDown(void) {
+    test_teardown();
+}
+
+void test_span_blit_matches_per_pixel_unclipped(void) {
+    BlitPair pair(kW, kH);
+    for (bool flip : {false, true}) {
+        pair.reset();
+        pair.spanRenderer->drawSprite(kWideSprite, 10, 12, Color::White, flip);
+        pair.pixelRenderer->drawSprite(kWideSprite, 10, 12, Color::White, flip);
+        pair.spanRenderer->drawSprite(kNarrowSprite, 40, 30, Color::Red, flip);
+        pair.pixelRenderer->drawSprite(kNarrowSprite, 40, 30, Color::Red, flip);
+        TEST_ASSERT_TRUE(pair.equal());
+    }
+}
+
+void test_span_blit_matches_per_pixel_clipped_edges(void) {
+    BlitPair pair(kW, kH);
+    const int xs[] = {-17, -15, -9, -1, 0, kW - 16, kW - 9, kW - 1, kW};
+    const int ys[] = {-8, -3, 0, kH - 5, kH - 1, kH};
+    for (bool flip : {false, true}) {
+        for (int x : xs) {
+            for (int y : ys) {
+                pair.reset();
+                pair.spanRenderer->drawSprite(kWideSprite, x, y, Color::Yellow, flip);
+                pair.pixelRenderer->drawSprite(kWideSprite, x, y, Color::Yellow, flip);
+                pair.spanRenderer->drawSprite(kNarrowSprite, x + 3, y + 2, Color::Cyan, flip);
+                pair.pixelRenderer->drawSprite(kNarrowSprite, x + 3, y + 2, Color::Cyan, flip);
+                TEST_ASSERT_TRUE_MESSAGE(pair.equal(), flip ? "flipX mismatch" : "mismatch");
+            }
+        }
+    }
+}
+
+void test_span_blit_respects_camera_offset(void) {
+    BlitPair pair(kW, kH);
+    pair.spanRenderer->setDisplayOffset(-7, 5);
+    pair.pixelRenderer->setDisplayOffset(-7, 5);
+    pair.spanRenderer->drawSprite(kWideSprite, 3, 0, Color::White, false);
+    pair.pixelRenderer->drawSprite(kWideSprite, 3, 0, Color::White, false);
+    TEST_ASSERT_TRUE(pair.equal());
+    // Column 0 of the wide sprite lands at logical x = -4 and is clipped.
+    TEST_ASSERT_EQUAL_UINT16(0, pair.spanFb[5 * kW + 0]);
+}
+
+void test_span_blit_text_matches_per_pixel(void) {
+    FontManager::setDefaultFont(&FONT_5X7);
+    BlitPair pair(kW, kH);
+    pair.spanRenderer->drawText("HP 99 x3", -2, 1, Color::White, 1);
+    pair.pixelRenderer->drawText("HP 99 x3", -2, 1, Color::White, 1);
+    pair.spanRenderer->drawText("SCORE", 40, kH - 4, Color::Green, 1);
+    pair.pixelRenderer->drawText("SCORE", 40, kH - 4, Color::Green, 1);
+    TEST_ASSERT_TRUE(pair.equal());
+}
+
+void test_span_blit_hud_benchmark(void) {
+    FontManager::setDefaultFont(&FONT_5X7);
+    BlitPair pair(240, 240);
+    const char* lines[] = {
+        "SCORE 0012345  HI 0099999",
+        "LIVES x3  STAGE 4-2  TIME 299",
+        "AMMO 128/256  COINS 042",
+        "PRESS START TO CONTINUE",
+    };
+    constexpr int kFrames = 200;
+
+    auto run = [&](Renderer* r) {
+        const auto t0 = std::chrono::high_resolution_clock::now();
+        for (int f = 0; f < kFrames; ++f) {
+            for (int i = 0; i < 4; ++i) {
+                r->drawText(lines[i], 2, static_cast<int16_t>(2 + i * 10), Color::White, 1);
+                r->drawText(lines[i], 2, static_cast<int16_t>(200 + i * 10), Color::Yellow, 1);
+            }
+        }
+        const auto t1 = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+    };
+
+    const long long pixelUs = run(pair.pixelRenderer);
+    const long long spanUs = run(pair.spanRenderer);
+    TEST_ASSERT_TRUE(pair.equal());
+
+    char msg[128];
+    std::snprintf(msg, sizeof(msg), "HUD text %d frames: per-pixel %lld us, spans %lld us",
+                  kFrames, pixelUs, spanUs);
+    TEST_MESSAGE(msg);
+}
+
+void test_present_kernels_16bpp_match_8bpp_lut(void) {
+    // Panel-order LUT exactly as TFT_eSPI_Drawer::buildScaleLUTs() builds it.
+    uint16_t lut[256];
+    for (int i = 0; i < 256; ++i) {
+        const uint16_t r = static_cast<uint16_t>((i & 0xE0) << 8);
+        const uint16_t g = static_cast<uint16_t>((i & 0x1C) << 6);
+        const uint16_t b = static_cast<uint16_t>((i & 0x03) << 3);
+        lut[i] = packRgb565ToTftSprite16(static_cast<uint16_t>(r | g | b));
+    }
+
+    constexpr int kN = 37;
+    uint8_t src8[kN];
+    uint16_t src16[kN];
+    for (int i = 0; i < kN; ++i) {
+        src8[i] = static_cast<uint8_t>(i * 29 + 3);
+        src16[i] = lut[src8[i]];
+    }
+
+    alignas(4) uint16_t a[kN * 2];
+    alignas(4) uint16_t b[kN * 2];
+    present::convertRow(src8, a, kN, lut);
+    present::convertRow(src16, b, kN, lut);
+    TEST_ASSERT_EQUAL_MEMORY(a, b, kN * sizeof(uint16_t));
+
+    present::convertRow2x(src8, a, kN, lut);
+    present::convertRow2x(src16, b, kN, lut);
+    TEST_ASSERT_EQUAL_MEMORY(a, b, kN * 2 * sizeof(uint16_t));
+    TEST_ASSERT_EQUAL_UINT16(a[6], a[7]);
+
+    uint16_t xLUT[kN * 2];
+    for (int i = 0; i < kN * 2; ++i) {
+        xLUT[i] = static_cast<uint16_t>((i * kN) / (kN * 2 - 5) % kN);
+    }
+    present::convertRowScaled(src8, a, kN * 2, xLUT, lut);
+    present::convertRowScaled(src16, b, kN * 2, xLUT, lut);
+    TEST_ASSERT_EQUAL_MEMORY(a, b, kN * 2 * sizeof(uint16_t));
+}
+
+void test_present_kernels_8bpp_vs_16bpp_benchmark(void) {
+    // 240x240 panel fed from a 240x240 (1:1) and a 120x120 (2x) logical framebuffer.
+    constexpr int kPhys = 240;
+    constexpr int kFrames = 100;
+    uint16_t lut[256];
+    for (int i = 0; i < 256; ++i) {
+        lut[i] = static_cast<uint16_t>(i * 0x0101);
+    }
+    std::vector<uint8_t> fb8(kPhys * kPhys);
+    std::vector<uint16_t> fb16(kPhys * kPhys);
+    for (size_t i = 0; i < fb8.size(); ++i) {
+        fb8[i] = static_cast<uint8_t>(i * 7);
+        fb16[i] = lut[fb8[i]];
+    }
+    std::vector<uint16_t> line(kPhys * 2);
+    uint32_t sink = 0;
+
+    auto time = [&](auto&& frame) {
+        const auto t0 = std::chrono::high_resolution_clock::now();
+        for (int f = 0; f < kFrames; ++f) {
+            frame();
+            sink += line[f % kPhys];
+        }
+        const auto t1 = std::chrono::high_resolution_clock::now();
+        return static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+    };
+
+    const long long us8 = time([&] {
+        for (int y = 0; y < kPhys; ++y) present::convertRow(fb8.data() + y * kPhys, line.data(), kPhys, lut);
+    });
+    const long long us16 = time([&] {
+        for (int y = 0; y < kPhys; ++y) present::convertRow(fb16.data() + y * kPhys, line.data(), kPhys, lut);
+    });
+    const long long us8x2 = time([&] {
+        for (int y = 0; y < kPhys / 2; ++y) present::convertRow2x(fb8.data() + y * (kPhys / 2), line.data(), kPhys / 2, lut);
+    });
+    const long long us16x2 = time([&] {
+        for (int y = 0; y < kPhys / 2; ++y) present::convertRow2x(fb16.data() + y * (kPhys / 2), line.data(), kPhys / 2, lut);
+    });
+
+    char msg[200];
+    std::snprintf(msg, sizeof(msg),
+                  "fb %dx%d: 8bpp %d B, 16bpp %d B | %d frames 1:1 8bpp %lld us, 16bpp %lld us | 2x 8bpp %lld us, 16bpp %lld us (%u)",
+                  kPhys, kPhys, kPhys * kPhys, kPhys * kPhys * 2, kFrames, us8, us16, us8x2, us16x2,
+                  static_cast<unsigned>(sink & 1u));
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_LESS_THAN_MESSAGE(us8 + 1, us16, "16bpp 1:1 present should be a plain copy");
+}
+
+void test_indexed_framebuffer_resolves_late(void) {
+    if constexpr (!pixelroot32::platforms::config::FramebufferIndexed) {
+        TEST_IGNORE_MESSAGE("indexed framebuffer disabled");
+    } else {
+        setPalette(PaletteType::PR32);
+        initSpritePaletteSlots();
+        setSpritePaletteSlot(2, PaletteType::NES);
+
+        std::vector<uint8_t> fb(kW * kH, 0);
+        auto* surface = new MockDrawSurface();
+        surface->setSpriteBuffer(fb.data(), fb.size());
+        Renderer renderer(DisplayConfig::createCustom(surface, kW, kH));
+        renderer.setDisplaySize(kW, kH);
+        renderer.beginFrame();
+
+        static const uint8_t pixels[] = {0x21, 0x12};  // 4x1: Red, White, White, Red
+        static const Color palette[] = {Color::Transparent, Color::Red, Color::White};
+        const Sprite4bpp sprite{pixels, palette, 4, 1, 3};
+        renderer.drawSprite(sprite, 4, 6, 2, false);
+        renderer.drawSprite(kNarrowSprite, 20, 10, Color::Green, false);
+
+        const uint8_t red2 = paletteSlotIndex(PaletteContext::Sprite, 2, Color::Red);
+        TEST_ASSERT_EQUAL_UINT8(red2, fb[6 * kW + 4]);
+        TEST_ASSERT_EQUAL_UINT8(paletteSlotIndex(PaletteContext::Sprite, 2, Color::White), fb[6 * kW + 5]);
+        TEST_ASSERT_EQUAL_UINT8(paletteSlotIndex(PaletteContext::Sprite, 0, Color::Green), fb[10 * kW + 20]);
+
+        uint16_t lut[256];
+        buildIndexedPaletteLUT(lut);
+        TEST_ASSERT_EQUAL_UINT16(PALETTE_NES[static_cast<uint8_t>(Color::Red)], lut[fb[6 * kW + 4]]);
+
+        // Palette swap: framebuffer untouched, only the LUT changes.
+        const std::vector<uint8_t> before = fb;
+        setSpritePaletteSlot(2, PaletteType::GB);
+        buildIndexedPaletteLUT(lut);
+        TEST_ASSERT_TRUE(before == fb);
+        TEST_ASSERT_EQUAL_UINT16(PALETTE_GB[static_cast<uint8_t>(Color::Red)], lut[fb[6 * kW + 4]]);
+
+        initSpritePaletteSlots();
+    }
+}
+
+void test_palette_change_forces_full_present(void) {
+    if constexpr (!pixelroot32::platforms::config::EnableDirtyRegions) {
+        TEST_IGNORE_MESSAGE("dirty regions disabled");
+    } else {
+        std::vector<uint8_t> fb(kW * kH * pixelroot32::platforms::config::FramebufferBytesPerPixel, 0);
+        auto* surface = new MockDrawSurface();
+        surface->setSpriteBuffer(fb.data(), fb.size());
+        Renderer renderer(DisplayConfig::createCustom(surface, kW, kH));
+        renderer.setDisplaySize(kW, kH);
+
+        for (int frame = 0; frame < 2; ++frame) {
+            renderer.beginFrame();
+            renderer.drawSprite(kWideSprite, 8, 8, Color::White, false);
+            renderer.endFrame();
+        }
+        TEST_ASSERT_TRUE(surface->lastSendWasPartial);
+
+        setBackgroundPaletteSlot(1, PaletteType::GBC);
+        renderer.beginFrame();
+        renderer.drawSprite(kWideSprite, 8, 8, Color::White, false);
+        renderer.endFrame();
+        TEST_ASSERT_FALSE(surface->lastSendWasPartial);
+
+        initBackgroundPaletteSlots();
+    }
+}
+
+void test_static_layer_content_change_forces_full_present(void) {
+    if constexpr (!pixelroot32::platforms::config::EnableDirtyRegions) {
+        TEST_IGNORE_MESSAGE("dirty regions disabled");
+    } else {
+        std::vector<uint8_t> fb(kW * kH * pixelroot32::platforms::config::FramebufferBytesPerPixel, 0);
+        auto* surface = new MockDrawSurface();
+        surface->setSpriteBuffer(fb.data(), fb.size());
+        Renderer renderer(DisplayConfig::createCustom(surface, kW, kH));
+        renderer.setDisplaySize(kW, kH);
+        TileMapFixture fx;
+
+        auto frame = [&]() {
+            renderer.beginFrame();
+            renderer.drawTileMap(fx.map4, 0, 0, LayerType::Static);
+            renderer.endFrame();
+            return surface->lastSendWasPartial;
+        };
+        frame();
+        TEST_ASSERT_TRUE(frame());
+
+        // Visible tile edit.
+        fx.indices[1] = static_cast<uint8_t>((fx.indices[1] + 1) % TileMapFixture::kTiles);
+        TEST_ASSERT_FALSE(frame());
+        TEST_ASSERT_TRUE(frame());
+
+        // Runtime mask edit.
+        fx.mask[0] ^= 0x01;
+        TEST_ASSERT_FALSE(frame());
+        TEST_ASSERT_TRUE(frame());
+
+        // Edits outside the visible window do not count.
+        fx.indices[TileMapFixture::kMapW * TileMapFixture::kMapH - 1] ^= 1;
+        TEST_ASSERT_TRUE(frame());
+    }
+}
+
+void test_tilemap_raster_matches_per_tile(void) {
+    setPalette(PaletteType::PR32);
+    initBackgroundPaletteSlots();
+    setBackgroundPaletteSlot(1, PaletteType::NES);
+    setBackgroundPaletteSlot(2, PaletteType::GB);
+
+    TileMapFixture fx;
+    BlitPair pair(kW, kH);
+    const int offsets[][2] = {{0, 0}, {-3, -5}, {-13, 7}, {5, -9}, {-41, -27}, {60, 40}, {-100, 0}};
+    for (const auto& o : offsets) {
+        for (int camera = 0; camera < 2; ++camera) {
+            pair.reset();
+            pair.spanRenderer->setDisplayOffset(camera ? -7 : 0, camera ? 3 : 0);
+            pair.pixelRenderer->setDisplayOffset(camera ? -7 : 0, camera ? 3 : 0);
+            pair.spanRenderer->drawTileMap(fx.map4, o[0], o[1]);
+            pair.pixelRenderer->drawTileMap(fx.map4, o[0], o[1]);
+            TEST_ASSERT_TRUE_MESSAGE(pair.equal(), "4bpp tilemap mismatch");
+
+            pair.reset();
+            pair.spanRenderer->drawTileMap(fx.map2, o[0], o[1], LayerType::Static);
+            pair.pixelRenderer->drawTileMap(fx.map2, o[0], o[1], LayerType::Static);
+            TEST_ASSERT_TRUE_MESSAGE(pair.equal(), "2bpp tilemap mismatch");
+        }
+    }
+    pair.spanRenderer->setDisplayOffset(0, 0);
+    initBackgroundPaletteSlots();
+}
+
+void test_tilemap_raster_fullscreen_4bpp_benchmark(void) {
+    constexpr int kScreenW = 240;
+    constexpr int kScreenH = 240;
+    constexpr int kMapW = kScreenW / 8 + 2;
+    constexpr int kMapH = kScreenH / 8 + 2;
+    constexpr int kFrames = 60;
+
+    TileMapFixture fx;
+    std::vector<uint8_t> indices(kMapW * kMapH);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        indices[i] = static_cast<uint8_t>(1 + (i * 7) % (TileMapFixture::kTiles - 1));
+    }
+    TileMap4bpp map{};
+    map.indices = indices.data();
+    map.width = kMapW;
+    map.height = kMapH;
+    map.tiles = fx.tiles4;
+    map.tileWidth = 8;
+    map.tileHeight = 8;
+    map.tileCount = TileMapFixture::kTiles;
+
+    std::vector<FramebufferPixel> fb(kScreenW * kScreenH, 0);
+    auto* surface = new MockDrawSurface();
+    surface->setSpriteBuffer(reinterpret_cast<uint8_t*>(fb.data()), fb.size() * sizeof(FramebufferPixel));
+    Renderer renderer(DisplayConfig::createCustom(surface, kScreenW, kScreenH));
+    renderer.setDisplaySize(kScreenW, kScreenH);
+    renderer.beginFrame();
+
+    const int cameras[][2] = {{0, 0}, {-3, -5}, {-8, -8}, {-13, -2}};
+    long long rasterUs = 0;
+    long long perTileUs = 0;
+    char msg[160];
+    for (const auto& cam : cameras) {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (int f = 0; f < kFrames; ++f) {
+            renderer.drawTileMap(map, cam[0], cam[1]);
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        const long long raster = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+
+        // Baseline: per-tile sprite dispatch over the same visible cells.
+        t0 = std::chrono::high_resolution_clock::now();
+        for (int f = 0; f < kFrames; ++f) {
+            for (int ty = 0; ty < kMapH; ++ty) {
+                for (int tx = 0; tx < kMapW; ++tx) {
+                    const int x = cam[0] + tx * 8;
+                    const int y = cam[1] + ty * 8;
+                    if (x <= -8 || y <= -8 || x >= kScreenW || y >= kScreenH) continue;
+                    renderer.drawSprite(fx.tiles4[indices[ty * kMapW + tx]], x, y, 0, false);
+                }
+            }
+        }
+        t1 = std::chrono::high_resolution_clock::now();
+        const long long perTile = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+
+        std::snprintf(msg, sizeof(msg), "4bpp map %dx%d camera (%d,%d) %d frames: raster %lld us, per-tile %lld us",
+                      kScreenW, kScreenH, cam[0], cam[1], kFrames, raster, perTile);
+        TEST_MESSAGE(msg);
+        rasterUs += raster;
+        perTileUs += perTile;
+    }
+    std::snprintf(msg, sizeof(msg), "4bpp map total: raster %lld us, per-tile %lld us", rasterUs, perTileUs);
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_span_blit_matches_per_pixel_unclipped);
+    RUN_TEST(test_span_blit_matches_per_pixel_clipped_edges);
+    RUN_TEST(test_span_blit_respects_camera_offset);
+    RUN_TEST(test_span_blit_text_matches_per_pixel);
+    RUN_TEST(test_span_blit_hud_benchmark);
+    RUN_TEST(test_present_kernels_16bpp_match_8bpp_lut);
+    RUN_TEST(test_present_kernels_8bpp_vs_16bpp_benchmark);
+    RUN_TEST(test_indexed_framebuffer_resolves_late);
+    RUN_TEST(test_palette_change_forces_full_present);
+    RUN_TEST(test_static_layer_content_change_forces_full_present);
+    RUN_TEST(test_tilemap_raster_matches_per_tile);
+    RUN_TEST(test_tilemap_raster_fullscreen_4bpp_benchmark);
+    return UNITY_END();
+}
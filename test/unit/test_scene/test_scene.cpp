@@ -10,9 +10,11 @@
 #include "core/Scene.h"
 #include "core/Entity.h"
 #include "graphics/Renderer.h"
+#include "physics/RigidActor.h"
 
 using namespace pixelroot32::core;
 using namespace pixelroot32::graphics;
+using namespace pixelroot32::math;
 
 // Mock Entity implementation
 class MockEntity : public Entity {
@@ -34,6 +36,21 @@ public:
     }
 };
 
+// Rigid body recording where it was drawn
+class MockBody : public pixelroot32::physics::RigidActor {
+public:
+    Vector2 drawnAt;
+
+    MockBody(float x, float y) : RigidActor(toScalar(x), toScalar(y), 8, 8) {
+        setGravityScale(toScalar(0));
+    }
+
+    void draw(Renderer& renderer) override {
+        (void)renderer;
+        drawnAt = position;
+    }
+};
+
 void setUp(void) {
     test_setup();
 }
@@ -167,6 +184,33 @@ void test_scene_draw_with_offset_and_layers(void) {
     TEST_ASSERT_TRUE(e2.drawCalled);
 }
 
+void test_scene_draw_interpolates_opted_in_bodies(void) {
+    Scene scene;
+    MockBody smooth(20, 20);
+    MockBody stepped(20, 60);
+    smooth.setVelocity(toScalar(60), toScalar(0));
+    stepped.setVelocity(toScalar(60), toScalar(0));
+    smooth.setRenderInterpolation(true);
+    scene.addEntity(&smooth);
+    scene.addEntity(&stepped);
+    DisplayConfig config(DisplayType::NONE, 0, 240, 240);
+    Renderer renderer(config);
+
+    // One step (x moves right from 20), then half a step pending.
+    scene.update(17);
+    scene.update(8);
+    const float alpha = static_cast<float>(scene.getPhysicsAlpha());
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, 0.5f, alpha);
+    const float x = static_cast<float>(smooth.position.x);
+    TEST_ASSERT_TRUE(x > 20.5f);
+
+    scene.draw(renderer);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 20.0f + (x - 20.0f) * alpha, static_cast<float>(smooth.drawnAt.x));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, static_cast<float>(stepped.position.x), static_cast<float>(stepped.drawnAt.x));
+    // The simulation state is untouched.
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, x, static_cast<float>(smooth.position.x));
+}
+
 int main(int argc, char **argv) {
     UNITY_BEGIN();
     
@@ -176,6 +220,7 @@ int main(int argc, char **argv) {
     RUN_TEST(test_scene_update_propagation);
     RUN_TEST(test_scene_draw_propagation);
     RUN_TEST(test_scene_draw_with_offset_and_layers);
+    RUN_TEST(test_scene_draw_interpolates_opted_in_bodies);
     
     return UNITY_END();
 }
@@ -0,0 +1,283 @@
+/**
+ * @file test_sfx_cache.cpp
+ * @brief Unit tests for audio/SfxCache and ApuCore PCM voices
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * Renders events to PCM8 / IMA ADPCM, plays them back through a PCM voice
+ * and compares against the same event synthesised live, checks the block and
+ * per-sample PCM paths agree, then checks arena accounting, stopping a
+ * cache's voices, and times live synthesis against cached playback.
+ */
+
+#include <unity.h>
+#include "../../test_config.h"
+#include "audio/ApuCore.h"
+#include "audio/AudioMusicTypes.h"
+#include "audio/SfxCache.h"
+#include <chrono>
+#include <cstdio>
+
+using namespace pixelroot32::audio;
+
+namespace {
+
+constexpr int kRate = 22050;
+
+const InstrumentPreset kCoin{
+    0.5f, 0.25f, 5, 0.0f, 0,
+    0.002f, 0.04f, 0.6f, 0.03f,
+    LfoTarget::PITCH, 12.0f, 0.02f, 0.0f,
+    false, 0.0f, false
+};
+
+AudioEvent coinEvent() {
+    AudioEvent e{};
+    e.type = WaveType::PULSE;
+    e.frequency = 987.77f;
+    e.duration = 0.08f;
+    e.volume = 0.6f;
+    e.duty = 0.25f;
+    e.preset = &kCoin;
+    e.sweepEndHz = 1318.5f;
+    e.sweepDurationSec = 0.05f;
+    return e;
+}
+
+AudioEvent padEvent() {
+    AudioEvent e = coinEvent();
+    e.type = WaveType::TRIANGLE;
+    e.frequency = 440.0f;
+    return e;
+}
+
+void play(ApuCore& apu, const AudioEvent& event) {
+    AudioCommand cmd;
+    cmd.type = AudioCommandType::PLAY_EVENT;
+    cmd.event = event;
+    apu.submitCommand(cmd);
+}
+
+constexpr int kTotal = 4096;
+
+void render(const AudioEvent& event, bool blockRender, int16_t* out) {
+    ApuCore apu;
+    apu.init(kRate);
+    apu.setBlockRenderForTesting(blockRender);
+    play(apu, event);
+    apu.generateSamples(out, kTotal);
+}
+
+/** Error energy over signal energy of @p test against @p ref. */
+double relativeError(const int16_t* ref, const int16_t* test) {
+    double signal = 0.0;
+    double error = 0.0;
+    for (int i = 0; i < kTotal; ++i) {
+        const double d = (double)ref[i] - (double)test[i];
+        signal += (double)ref[i] * (double)ref[i];
+        error += d * d;
+    }
+    TEST_ASSERT_GREATER_THAN(0.0, signal);
+    return error / signal;
+}
+
+/** Live synthesis of @p event vs playback of its cached @p sample. */
+double cachedVsLive(const AudioEvent& event, const SfxSample* sample) {
+    static int16_t live[kTotal];
+    static int16_t cached[kTotal];
+    render(event, true, live);
+    render(SfxCache::makeEvent(sample, event.volume), true, cached);
+    return relativeError(live, cached);
+}
+
+volatile int16_t g_sink = 0;
+
+} // namespace
+
+void setUp(void) {
+    test_setup();
+}
+
+void tearDown(void) {
+    test_teardown();
+}
+
+void test_sfx_cache_pcm8_matches_live_synthesis(void) {
+    static uint8_t arena[4096];
+    SfxCache cache(arena, sizeof(arena), kRate);
+    const SfxSample* coin = cache.add(coinEvent(), SfxFormat::PCM8);
+    TEST_ASSERT_NOT_NULL(coin);
+
+    // Note plus release, minus the trimmed tail.
+    const uint32_t maxFrames = (uint32_t)((0.08f + 0.03f) * kRate) + 1;
+    TEST_ASSERT_TRUE(coin->length > (uint32_t)(0.08f * kRate));
+    TEST_ASSERT_TRUE(coin->length <= maxFrames);
+    TEST_ASSERT_EQUAL(coin->length, cache.bytesUsed());
+    TEST_ASSERT_EQUAL(kRate, coin->sampleRate);
+
+    TEST_ASSERT_TRUE(cachedVsLive(coinEvent(), coin) < 1e-3);
+}
+
+void test_sfx_cache_pcm_voice_block_matches_reference(void) {
+    static uint8_t arena[4096];
+    SfxCache cache(arena, sizeof(arena), kRate);
+    const SfxSample* coin = cache.add(coinEvent());
+    TEST_ASSERT_NOT_NULL(coin);
+
+    static int16_t block[kTotal];
+    static int16_t reference[kTotal];
+    const AudioEvent event = SfxCache::makeEvent(coin, 0.6f);
+    render(event, true, block);
+    render(event, false, reference);
+    TEST_ASSERT_TRUE(relativeError(reference, block) < 1e-5);
+}
+
+void test_sfx_cache_adpcm_halves_storage(void) {
+    static uint8_t arena[4096];
+    SfxCache cache(arena, sizeof(arena), kRate);
+    const SfxSample* pcm = cache.add(padEvent(), SfxFormat::PCM8);
+    const size_t pcmBytes = cache.bytesUsed();
+    const SfxSample* adpcm = cache.add(padEvent(), SfxFormat::IMA_ADPCM);
+    TEST_ASSERT_NOT_NULL(pcm);
+    TEST_ASSERT_NOT_NULL(adpcm);
+    TEST_ASSERT_EQUAL(SfxFormat::IMA_ADPCM, adpcm->format);
+    TEST_ASSERT_EQUAL((adpcm->length + 1) / 2, cache.bytesUsed() - pcmBytes);
+
+    TEST_ASSERT_EQUAL(pcm->length, adpcm->length);
+
+    // Smooth waves survive 4-bit ADPCM well (about -30 dB here).
+    TEST_ASSERT_TRUE(cachedVsLive(padEvent(), adpcm) < 5e-3);
+}
+
+void test_sfx_cache_arena_and_table_limits(void) {
+    static uint8_t small[256];
+    SfxCache tight(small, sizeof(small), kRate);
+    TEST_ASSERT_NULL(tight.add(coinEvent()));
+    TEST_ASSERT_EQUAL(0, tight.bytesUsed());
+    TEST_ASSERT_EQUAL(0, tight.size());
+
+    AudioEvent blip = coinEvent();
+    blip.duration = 0.002f;
+    blip.preset = nullptr;
+    blip.sweepDurationSec = 0.0f;
+    static uint8_t arena[8192];
+    SfxCache cache(arena, sizeof(arena), kRate);
+    for (size_t i = 0; i < SfxCache::MAX_SAMPLES; ++i) {
+        TEST_ASSERT_NOT_NULL(cache.add(blip));
+    }
+    TEST_ASSERT_NULL(cache.add(blip));
+    TEST_ASSERT_EQUAL(SfxCache::MAX_SAMPLES, cache.size());
+
+    AudioEvent pcm = SfxCache::makeEvent(nullptr, 1.0f);
+    cache.clear();
+    TEST_ASSERT_EQUAL(0, cache.size());
+    TEST_ASSERT_EQUAL(0, cache.bytesUsed());
+    TEST_ASSERT_NULL(cache.add(pcm));
+    TEST_ASSERT_NOT_NULL(cache.add(blip));
+}
+
+void test_sfx_cache_pcm_voice_ends_with_sample(void) {
+    static uint8_t arena[4096];
+    SfxCache cache(arena, sizeof(arena), kRate);
+    const SfxSample* coin = cache.add(coinEvent());
+    TEST_ASSERT_NOT_NULL(coin);
+
+    ApuCore apu;
+    apu.init(kRate);
+    play(apu, SfxCache::makeEvent(coin, 0.5f));
+    static int16_t buffer[4096];
+    apu.generateSamples(buffer, (int)coin->length - 1);
+    TEST_ASSERT_EQUAL(1, apu.countEnabledVoicesForTesting());
+    apu.generateSamples(buffer, 1);
+    TEST_ASSERT_EQUAL(0, apu.countEnabledVoicesForTesting());
+
+    // A sample-less PCM event never takes a voice.
+    play(apu, SfxCache::makeEvent(nullptr, 0.5f));
+    apu.generateSamples(buffer, 16);
+    TEST_ASSERT_EQUAL(0, apu.countEnabledVoicesForTesting());
+}
+
+void test_sfx_cache_stop_command_stops_cached_voices(void) {
+    static uint8_t arena[8192];
+    SfxCache cache(arena, sizeof(arena), kRate);
+    const SfxSample* coin = cache.add(coinEvent());
+    const SfxSample* pad = cache.add(padEvent(), SfxFormat::IMA_ADPCM);
+    TEST_ASSERT_NOT_NULL(coin);
+    TEST_ASSERT_NOT_NULL(pad);
+
+    // A sample from another cache keeps playing, and so does a live voice.
+    static uint8_t otherArena[4096];
+    SfxCache other(otherArena, sizeof(otherArena), kRate);
+    const SfxSample* otherCoin = other.add(coinEvent());
+    TEST_ASSERT_NOT_NULL(otherCoin);
+
+    ApuCore apu;
+    apu.init(kRate);
+    play(apu, SfxCache::makeEvent(coin, 0.5f));
+    play(apu, SfxCache::makeEvent(pad, 0.5f));
+    play(apu, SfxCache::makeEvent(otherCoin, 0.5f));
+    play(apu, padEvent());
+    static int16_t buffer[64];
+    apu.generateSamples(buffer, 64);
+    TEST_ASSERT_EQUAL(4, apu.countEnabledVoicesForTesting());
+
+    apu.submitCommand(cache.stopCommand());
+    cache.clear();
+    apu.generateSamples(buffer, 64);
+    TEST_ASSERT_EQUAL(2, apu.countEnabledVoicesForTesting());
+}
+
+void test_sfx_cache_playback_benchmark(void) {
+    static uint8_t arena[4096];
+    SfxCache cache(arena, sizeof(arena), kRate);
+    AudioEvent longCoin = coinEvent();
+    longCoin.duration = 0.15f;
+    const SfxSample* coin = cache.add(longCoin);
+    TEST_ASSERT_NOT_NULL(coin);
+
+    constexpr int kBlock = 256;
+    auto time = [&](bool cached) {
+        ApuCore apu;
+        apu.init(kRate);
+        int16_t buffer[kBlock];
+        double ns = 0.0;
+        int samples = 0;
+        // Retrigger 8 voices per burst, like a busy gameplay frame.
+        for (int burst = 0; burst < 50; ++burst) {
+            for (int v = 0; v < ApuCore::MAX_VOICES; ++v) {
+                play(apu, cached ? SfxCache::makeEvent(coin, 0.3f) : longCoin);
+            }
+            const auto t0 = std::chrono::high_resolution_clock::now();
+            for (int b = 0; b < 12; ++b) {
+                apu.generateSamples(buffer, kBlock);
+                g_sink = (int16_t)(g_sink + buffer[kBlock - 1]);
+            }
+            const auto t1 = std::chrono::high_resolution_clock::now();
+            ns += std::chrono::duration<double, std::nano>(t1 - t0).count();
+            samples += 12 * kBlock;
+        }
+        return ns / samples;
+    };
+    const double live = time(false);
+    const double cached = time(true);
+
+    char msg[128];
+    std::snprintf(msg, sizeof(msg), "ns/sample with %d SFX voices: live synthesis %.1f | cached PCM8 %.1f",
+                  ApuCore::MAX_VOICES, live, cached);
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_sfx_cache_pcm8_matches_live_synthesis);
+    RUN_TEST(test_sfx_cache_pcm_voice_block_matches_reference);
+    RUN_TEST(test_sfx_cache_adpcm_halves_storage);
+    RUN_TEST(test_sfx_cache_arena_and_table_limits);
+    RUN_TEST(test_sfx_cache_pcm_voice_ends_with_sample);
+    RUN_TEST(test_sfx_cache_stop_command_stops_cached_voices);
+    RUN_TEST(test_sfx_cache_playback_benchmark);
+    return UNITY_END();
+}
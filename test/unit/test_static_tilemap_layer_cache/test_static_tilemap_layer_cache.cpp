@@ -13,10 +13,92 @@
 #include "mocks/MockDrawSurface.h"
 #include "mocks/MockRenderer.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
 #ifdef PIXELROOT32_ENABLE_STATIC_TILEMAP_FB_CACHE
 
 using namespace pixelroot32::graphics;
 
+namespace {
+
+const Color kScrollPalette[16] = {
+    Color::Transparent, Color::Red, Color::Green, Color::Blue,
+    Color::Yellow, Color::Cyan, Color::Magenta, Color::White,
+    Color::Orange, Color::Purple, Color::Brown, Color::Pink,
+    Color::Navy, Color::Olive, Color::Gray, Color::DarkGray,
+};
+
+/** Two static 4bpp layers (opaque ground + sparse overlay) larger than the screen. */
+struct ScrollFixture {
+    static constexpr int kTiles = 4;
+    static constexpr int kMapW = 24;
+    static constexpr int kMapH = 18;
+
+    uint8_t data[kTiles][32] = {};
+    Sprite4bpp tiles[kTiles] = {};
+    uint8_t groundIndices[kMapW * kMapH] = {};
+    uint8_t overlayIndices[kMapW * kMapH] = {};
+    TileMap4bpp ground{};
+    TileMap4bpp overlay{};
+
+    ScrollFixture() {
+        uint32_t seed = 0x13579BDu;
+        auto next = [&seed]() {
+            seed = seed * 1664525u + 1013904223u;
+            return seed >> 24;
+        };
+        for (int t = 1; t < kTiles; ++t) {
+            for (int b = 0; b < 32; ++b) {
+                uint8_t lo = static_cast<uint8_t>(next() & 0x0F);
+                uint8_t hi = static_cast<uint8_t>(next() & 0x0F);
+                if (t == 1) {
+                    lo |= 1;
+                    hi |= 1;
+                }
+                data[t][b] = static_cast<uint8_t>(lo | (hi << 4));
+            }
+            tiles[t] = Sprite4bpp{data[t], kScrollPalette, 8, 8, 16};
+        }
+        for (int i = 0; i < kMapW * kMapH; ++i) {
+            groundIndices[i] = static_cast<uint8_t>(1 + next() % (kTiles - 1));
+            overlayIndices[i] = (next() & 3) == 0 ? static_cast<uint8_t>(2 + next() % 2) : 0;
+        }
+        for (TileMap4bpp* m : {&ground, &overlay}) {
+            m->width = kMapW;
+            m->height = kMapH;
+            m->tiles = tiles;
+            m->tileWidth = 8;
+            m->tileHeight = 8;
+            m->tileCount = kTiles;
+        }
+        ground.indices = groundIndices;
+        overlay.indices = overlayIndices;
+    }
+};
+
+/** Renderer over an externally owned logical framebuffer. */
+struct FramebufferRenderer {
+    std::vector<FramebufferPixel> fb;
+    std::unique_ptr<Renderer> renderer;
+
+    FramebufferRenderer(int w, int h) : fb(static_cast<size_t>(w * h), 0) {
+        auto* surface = new MockDrawSurface();
+        surface->setSpriteBuffer(reinterpret_cast<uint8_t*>(fb.data()), fb.size() * sizeof(FramebufferPixel));
+        renderer = std::make_unique<Renderer>(DisplayConfig::createCustom(surface, w, h));
+        renderer->setDisplaySize(w, h);
+        renderer->beginFrame();
+    }
+};
+
+constexpr int kScreenW = 64;
+constexpr int kScreenH = 48;
+
+} // namespace
+
 void setUp(void) {
     test_setup();
 }
@@ -196,6 +278,86 @@ void test_cache_clear_then_invalidate(void) {
     TEST_ASSERT_TRUE(cache.isFramebufferCacheEnabled());
 }
 
+
+// =============================================================================
+// Scrolling ring buffer: output must equal a direct draw of the static layers
+// =============================================================================
+
+void test_cache_scrolling_matches_direct_draw(void) {
+    ScrollFixture fx;
+    const TileMap4bppDrawSpec layers[] = {{&fx.ground, -4, 0}, {&fx.overlay, 3, -5}};
+    FramebufferRenderer cached(kScreenW, kScreenH);
+    FramebufferRenderer direct(kScreenW, kScreenH);
+
+    StaticTilemapLayerCache cache;
+    TEST_ASSERT_TRUE(cache.allocateForRenderer(*cached.renderer));
+    TEST_ASSERT_TRUE(cache.isScrollingEnabled());
+
+    // Small steps in every direction, ring-wrap crossings, and a jump larger than the screen.
+    const int cameras[][2] = {{0, 0}, {1, 0}, {2, 1}, {9, 1}, {9, 8}, {8, 20}, {-3, 20}, {-3, -7},
+                              {60, -7}, {66, 40}, {130, 90}, {129, 89}, {70, 50}, {70, 50}, {5, 3}};
+    char msg[64];
+    for (size_t i = 0; i < sizeof(cameras) / sizeof(cameras[0]); ++i) {
+        const int cx = cameras[i][0];
+        const int cy = cameras[i][1];
+        cached.renderer->setDisplayOffset(-cx, -cy);
+        cache.draw(*cached.renderer, cx, cy, layers, 2, nullptr, 0);
+
+        direct.renderer->setDisplayOffset(-cx, -cy);
+        std::fill(direct.fb.begin(), direct.fb.end(), FramebufferPixel{0});
+        direct.renderer->drawTileMap(fx.ground, layers[0].originX, layers[0].originY, LayerType::Static);
+        direct.renderer->drawTileMap(fx.overlay, layers[1].originX, layers[1].originY, LayerType::Static);
+
+        snprintf(msg, sizeof(msg), "scroll mismatch at camera %d,%d", cx, cy);
+        TEST_ASSERT_TRUE_MESSAGE(cached.fb == direct.fb, msg);
+    }
+}
+
+void test_cache_scrolling_rasterizes_only_exposed_strip(void) {
+    ScrollFixture fx;
+    const TileMap4bppDrawSpec layers[] = {{&fx.ground, 0, 0}};
+    FramebufferRenderer cached(kScreenW, kScreenH);
+    StaticTilemapLayerCache cache;
+    TEST_ASSERT_TRUE(cache.allocateForRenderer(*cached.renderer));
+
+    cache.draw(*cached.renderer, 0, 0, layers, 1, nullptr, 0);
+    TEST_ASSERT_EQUAL(kScreenW * kScreenH, cache.getLastRasterizedPixelCount());
+
+    cached.renderer->setDisplayOffset(-1, 0);
+    cache.draw(*cached.renderer, 1, 0, layers, 1, nullptr, 0);
+    TEST_ASSERT_EQUAL(kScreenH, cache.getLastRasterizedPixelCount());
+
+    cached.renderer->setDisplayOffset(-3, -2);
+    cache.draw(*cached.renderer, 3, 2, layers, 1, nullptr, 0);
+    TEST_ASSERT_EQUAL(2 * kScreenH + 2 * (kScreenW - 2), cache.getLastRasterizedPixelCount());
+
+    cache.draw(*cached.renderer, 3, 2, layers, 1, nullptr, 0);
+    TEST_ASSERT_EQUAL(0, cache.getLastRasterizedPixelCount());
+
+    // Non-scrolling snapshot rebuilds everything on a camera move.
+    cache.setScrollingEnabled(false);
+    cached.renderer->setDisplayOffset(-4, -2);
+    cache.draw(*cached.renderer, 4, 2, layers, 1, nullptr, 0);
+    TEST_ASSERT_EQUAL(kScreenW * kScreenH, cache.getLastRasterizedPixelCount());
+}
+
+void test_cache_scrolling_falls_back_without_buffer(void) {
+    ScrollFixture fx;
+    const TileMap4bppDrawSpec layers[] = {{&fx.ground, 0, 0}, {&fx.overlay, 0, 0}};
+    FramebufferRenderer cached(kScreenW, kScreenH);
+    FramebufferRenderer direct(kScreenW, kScreenH);
+    StaticTilemapLayerCache cache; // never allocated: behaves like an OOM at init
+
+    cached.renderer->setDisplayOffset(-5, -6);
+    direct.renderer->setDisplayOffset(-5, -6);
+    cache.draw(*cached.renderer, 5, 6, layers, 2, nullptr, 0);
+    direct.renderer->drawTileMap(fx.ground, 0, 0, LayerType::Static);
+    direct.renderer->drawTileMap(fx.overlay, 0, 0, LayerType::Static);
+
+    TEST_ASSERT_EQUAL(0, cache.getLastRasterizedPixelCount());
+    TEST_ASSERT_TRUE(cached.fb == direct.fb);
+}
+
 // =============================================================================
 // Value Tests for line coverage - allocateForRenderer
 // Note: allocateForRenderer requires Renderer which needs sprite buffer support
@@ -346,6 +508,9 @@ int main(void) {
     RUN_TEST(test_cache_multiple_invalidate_calls);
     RUN_TEST(test_cache_enable_disable_preserves_allocation);
     RUN_TEST(test_cache_clear_then_invalidate);
+    RUN_TEST(test_cache_scrolling_matches_direct_draw);
+    RUN_TEST(test_cache_scrolling_rasterizes_only_exposed_strip);
+    RUN_TEST(test_cache_scrolling_falls_back_without_buffer);
     
     // Note: draw() method requires sprite buffer support from Renderer
     // which has complex mocking requirements. Current tests achieve 